@@ -21,10 +21,12 @@
 #define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (4)           // Pin number attached to the ads data ready line. 
 
-void ads_data_callback(float * sample);
+ads_dev_t ads;                           // One Axis ADS device
+
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type);
 
 /* Stub function here for initialization code to run */
-void ads_data_callback(float * sample, uint8_t sample_type)
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type)
 {
   
 }
@@ -42,7 +44,7 @@ void setup() {
 
   Serial.println("Initializing One Axis sensor");
   
-  ads_init_t init;                                // One Axis ADS initialization structure
+  ads_init_t init{};                              // One Axis ADS initialization structure
 
   init.sps = ADS_100_HZ;                          // Set sample rate to 100 Hz
   init.ads_sample_callback = &ads_data_callback;  // Provide callback for new data
@@ -51,7 +53,7 @@ void setup() {
   init.addr = 0x12;                               // Update value if non default I2C address is assinged to sensor
 
   // Initialize ADS hardware abstraction layer, and set the sample rate
-  int ret_val = ads_init(&init);
+  int ret_val = ads_init(&ads, &init);
   
   if(ret_val != ADS_OK)
   {
@@ -71,7 +73,7 @@ void setup() {
   Serial.println("Updating I2C address...\n");
 
   // Updating I2C address of sensor with new address stored in new_address
-  ret_val = ads_update_device_address(new_address);
+  ret_val = ads_update_device_address(&ads, new_address);
 
   if(ret_val == ADS_OK)
   {
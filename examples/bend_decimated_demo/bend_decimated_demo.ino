@@ -0,0 +1,86 @@
+/* 
+ * Reading the one axis soft flex sensor from Nitto Bend Technologies fast and passing on fewer samples
+ *  
+ * The ADS is sampled at 500 Hz for low noise and latency, and the samples are
+ * decimated to 100 Hz for printing. Printing every fifth sample instead would
+ * fold motion and noise above 50 Hz back into the printed signal; the FIR
+ * decimator filters it out first. Samples stay in Q9.6 fixed point.
+ * 
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ * 
+ * Refer to one_axis_quick_start_guide.pdf for wiring instructions
+ */
+
+#include "Arduino.h"
+#include "ads.h"
+#include "ads_decimate.h"
+
+#define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
+#define ADS_INTERRUPT_PIN  (4)           // Pin number attached to the ads data ready line. 
+
+#define DECIMATION         (5)           // 500 Hz in, 100 Hz out
+#define DECIMATION_TAPS    (41)          // 8 taps per ratio, -55 dB from 70 Hz
+
+ads_dev_t ads;                           // One Axis ADS device
+ads_decimator_t decimator;               // Anti-aliased decimator of the bend angle
+
+void ads_raw_data_callback(ads_dev_t * dev, ads_q6_t * sample, uint8_t sample_type);
+
+/* Receives new fixed point samples from the ADS library, at 500 Hz */
+void ads_raw_data_callback(ads_dev_t * dev, ads_q6_t * sample, uint8_t sample_type)
+{
+  ads_q6_t angle;
+
+  if(sample_type == ADS_SAMPLE)
+  {
+    // One output for every DECIMATION samples
+    if(ads_decimator_apply_q6(&decimator, sample[0], &angle))
+      Serial.println(ads_q6_to_float(angle));
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.println("Initializing One Axis sensor");
+
+  ads_decimator_init(&decimator, ADS_DECIMATE_FIR, DECIMATION, DECIMATION_TAPS);
+  
+  ads_init_t init{};                                      // One Axis ADS initialization structure
+
+  init.sps = ADS_500_HZ;                                  // Set sample rate to 500 Hz
+  init.ads_raw_sample_callback = &ads_raw_data_callback;  // Provide fixed point callback for new data
+  init.reset_pin = ADS_RESET_PIN;                         // Pin connected to ADS reset line
+  init.datardy_pin = ADS_INTERRUPT_PIN;                   // Pin connected to ADS data ready interrupt
+  init.addr = 0;                                          // Update value if non default I2C address is assinged to sensor
+
+  // Initialize ADS hardware abstraction layer, and set the sample rate
+  int ret_val = ads_init(&ads, &init);
+  
+  if(ret_val != ADS_OK)
+  {
+    Serial.print("One Axis ADS initialization failed with reason: ");
+    Serial.println(ret_val);
+  }
+  else
+  {
+    Serial.println("One Axis ADS initialization succeeded...");
+  }
+
+  // Every printed sample is centered this long before it is printed
+  Serial.print("Decimator delay: ");
+  Serial.print(ads_decimator_delay_us(&decimator, ads.sample_period_us) / 1000);
+  Serial.println(" ms");
+
+  // Start reading data in interrupt mode
+  ads_run(&ads, true);
+}
+
+void loop() {
+
+  // New data received through the callback function ads_raw_data_callback
+}
@@ -34,8 +34,10 @@
 #define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (4)           // Not needed in polled mode.  
 
+ads_dev_t ads;                           // One Axis ADS device
+
 /* Not used in polled mode. Stub function necessary for library compilation */
-void ads_data_callback(float * sample, uint8_t sample_type)
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type)
 {
   
 }
@@ -58,7 +60,7 @@ void setup() {
   init.addr = 0;                                  // Update value if non default I2C address is assinged to sensor
 
   // Initialize ADS hardware abstraction layer, and set the sample rate
-  int ret_val = ads_init(&init);  
+  int ret_val = ads_init(&ads, &init);  
   if(ret_val != ADS_OK)
   {
     Serial.print("One Axis ADS initialization failed with reason: ");
@@ -72,7 +74,7 @@ void setup() {
 
   ADS_DEV_TYPE_T dev_type;
   
-  ret_val = ads_get_dev_type(&dev_type);
+  ret_val = ads_get_dev_type(&ads, &dev_type);
   if(ret_val != ADS_OK)
   {
     Serial.print("One Axis ADS get device type failed with reason: ");
@@ -80,7 +82,7 @@ void setup() {
     return;
   }
 
-  if (!ads_dfu_check(dev_type))
+  if (!ads_dfu_check(&ads, dev_type))
   {
     Serial.println("One Axis ADS firmware is up to date.");
     return;
@@ -89,10 +91,10 @@ void setup() {
   // Firmware needs updating. Update device now.
   Serial.println("Updating One Axis ADS firmware...");
   
-  ads_dfu_reset();
+  ads_dfu_reset(&ads);
   ads_hal_delay(50); // Give ADS time to reset
   
-  ret_val = ads_dfu_update(dev_type);
+  ret_val = ads_dfu_update(&ads, dev_type);
   ads_hal_delay(2000); // Let it reinitialize
 
   if (ret_val)
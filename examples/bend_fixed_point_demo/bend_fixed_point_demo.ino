@@ -0,0 +1,122 @@
+/* 
+ * Reading the one axis soft flex sensor from Nitto Bend Technologies in fixed point
+ *  
+ * Same as bend_interrupt_demo, but samples are received and filtered as Q9.6
+ * fixed point (1/64 degree per LSB) and converted to float only for printing.
+ * Suited to microcontrollers without a floating point unit.
+ * 
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ * 
+ * Refer to one_axis_quick_start_guide.pdf for wiring instructions
+ */
+
+#include "Arduino.h"
+#include "ads.h"
+#include "ads_fixed.h"
+
+#define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
+#define ADS_INTERRUPT_PIN  (4)           // Pin number attached to the ads data ready line. 
+
+ads_dev_t ads;                           // One Axis ADS device
+
+ads_q6_biquad_t low_pass;                // 20 Hz low pass filter
+ads_q6_t deadzone_prev;                  // Dead zone filter state
+
+void ads_raw_data_callback(ads_dev_t * dev, ads_q6_t * sample, uint8_t sample_type);
+void parse_com_port(void);
+
+/* Receives new fixed point samples from the ADS library */
+void ads_raw_data_callback(ads_dev_t * dev, ads_q6_t * sample, uint8_t sample_type)
+{
+  if(sample_type == ADS_SAMPLE)
+  {
+    // Low pass IIR filter
+    ads_q6_t angle = ads_q6_biquad(&low_pass, sample[0]);
+  
+    // Deadzone filter, 0.75 degrees
+    angle = ads_q6_deadzone(&deadzone_prev, angle, ADS_Q6_ONE * 3 / 4);
+  
+    Serial.println(ads_q6_to_float(angle));   
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.println("Initializing One Axis sensor");
+
+  // 20 Hz cutoff frequency @ 100 Hz Sample Rate
+  ads_q6_biquad_init(&low_pass, ADS_Q14(0.20657208382614792f), ADS_Q14(0.41314416765229584f), ADS_Q14(0.20657208382614792f),
+                     ADS_Q14(-0.36952737735124147f), ADS_Q14(0.19581571265583314f));
+  
+  ads_init_t init{};                                      // One Axis ADS initialization structure
+
+  init.sps = ADS_100_HZ;                                  // Set sample rate to 100 Hz
+  init.ads_raw_sample_callback = &ads_raw_data_callback;  // Provide fixed point callback for new data
+  init.reset_pin = ADS_RESET_PIN;                         // Pin connected to ADS reset line
+  init.datardy_pin = ADS_INTERRUPT_PIN;                   // Pin connected to ADS data ready interrupt
+  init.addr = 0;                                          // Update value if non default I2C address is assinged to sensor
+
+  // Initialize ADS hardware abstraction layer, and set the sample rate
+  int ret_val = ads_init(&ads, &init);
+  
+  if(ret_val != ADS_OK)
+  {
+    Serial.print("One Axis ADS initialization failed with reason: ");
+    Serial.println(ret_val);
+  }
+  else
+  {
+    Serial.println("One Axis ADS initialization succeeded...");
+  }
+
+  // Start reading data in interrupt mode
+  ads_run(&ads, true);
+}
+
+void loop() {
+
+  // New data received through the callback function ads_raw_data_callback
+  
+  // Check for received hot keys on the com port
+  if(Serial.available())
+  {
+    parse_com_port();
+  }
+}
+
+/* Function parses received characters from the COM port for commands */
+void parse_com_port(void)
+{
+  char key = Serial.read();
+
+  switch(key)
+  {
+    case '0':
+      // Take first calibration point at zero degrees
+      ads_calibrate(&ads, ADS_CALIBRATE_FIRST, 0);
+      break;
+    case '9':
+      // Take second calibration point at 180 degrees
+      ads_calibrate(&ads, ADS_CALIBRATE_SECOND, 180);
+      break;
+    case 'c':
+      // Restore factory calibration coefficients
+      ads_calibrate(&ads, ADS_CALIBRATE_CLEAR, 0);
+      break;
+    case 'r':
+      // Start sampling in interrupt mode
+      ads_run(&ads, true);
+      break;
+    case 's':
+      // Place ADS in suspend mode
+      ads_run(&ads, false);
+      break;
+    default:
+      break;
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * Updating the firmware of several one axis soft flex sensors from Nitto Bend Technologies
+ *
+ * Every sensor's bootloader answers at the same I2C address, so the sensors on
+ * one bus are updated one at a time while the others are held in reset. On
+ * boards with a second I2C bus its sensor is updated at the same time. Each
+ * sensor is checked before and verified after its update, and the time taken
+ * is printed per sensor and in total.
+ *
+ * Sensors sharing a bus must first be given different addresses, see bend_address_update.
+ *
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ *
+ * Refer to one_axis_quick_start_guide.pdf for wiring instructions
+ */
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "ads.h"
+
+#define ADS_FW_INCLUDE_ADS1_V1 0 // Set this to 1 to include version 1 firmware image
+#define ADS_FW_INCLUDE_ADS1_V2 1 // Set this to 1 to include version 2 firmware image
+
+#include "ads_fleet.h"
+
+#define ADS_RESET_PIN_A    (3)           // Pin number attached to the reset line of sensor A
+#define ADS_RESET_PIN_B    (5)           // Pin number attached to the reset line of sensor B
+#define ADS_RESET_PIN_C    (6)           // Pin number attached to the reset line of sensor C
+#define ADS_INTERRUPT_PIN  (4)           // Not used while updating
+
+#if defined(WIRE_INTERFACES_COUNT) && (WIRE_INTERFACES_COUNT > 1)
+#define ADS_SENSORS        (3)           // Sensor C on the second bus
+#else
+#define ADS_SENSORS        (2)
+#endif
+
+ads_dev_t ads[3];                        // One Axis ADS devices
+ads_fleet_entry_t entries[3];            // Devices to update, with their reset lines
+ads_fleet_t fleet;
+
+/* Fills in one device of the fleet */
+void add_sensor(uint8_t i, void * bus, uint8_t addr, uint32_t reset_pin)
+{
+  ads[i].bus = bus;                               // I2C bus of the sensor, NULL for Wire
+  ads[i].addr = addr;                             // I2C address of the sensor
+  entries[i].dev = &ads[i];
+  entries[i].reset_pin = reset_pin;               // Pin connected to ADS reset line
+  entries[i].datardy_pin = ADS_INTERRUPT_PIN;     // Pin connected to ADS data ready interrupt
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Press/send any key to update firmware...");
+
+  while(!Serial.available());
+  Serial.read();
+
+  // Sensors A and B on Wire, C on Wire1 if the board has it
+  add_sensor(0, NULL, 0x12, ADS_RESET_PIN_A);
+  add_sensor(1, NULL, 0x13, ADS_RESET_PIN_B);
+#if ADS_SENSORS > 2
+  add_sensor(2, &Wire1, 0x12, ADS_RESET_PIN_C);
+#endif
+
+  if(ads_fleet_init(&fleet, entries, ADS_SENSORS) != ADS_OK)
+  {
+    Serial.println("Fleet initialization failed");
+    return;
+  }
+
+  Serial.println("Updating...");
+
+  int ret_val = ads_fleet_run(&fleet);
+
+  for(uint8_t i = 0; i < ADS_SENSORS; i++)
+  {
+    Serial.print("Sensor ");
+    Serial.print((char)('A' + i));
+    Serial.print(": ");
+
+    switch(entries[i].status)
+    {
+      case ADS_FLEET_CURRENT: Serial.print("up to date"); break;
+      case ADS_FLEET_UPDATED: Serial.print("updated"); break;
+      default:
+        Serial.print("failed with reason ");
+        Serial.print(entries[i].error);
+        break;
+    }
+
+    Serial.print(", firmware ");
+    Serial.print(entries[i].fw_before);
+    Serial.print(" -> ");
+    Serial.print(entries[i].fw_after);
+    Serial.print(", ");
+    Serial.print(entries[i].time_us / 1000);
+    Serial.println(" ms");
+  }
+
+  Serial.print(ret_val == ADS_OK ? "Fleet updated in " : "Fleet update failed after ");
+  Serial.print(fleet.total_us / 1000);
+  Serial.println(" ms");
+}
+
+void loop() {
+
+}
@@ -0,0 +1,88 @@
+/* 
+ * Reading the one axis soft flex sensor from Nitto Bend Technologies for a control loop
+ *  
+ * A Kalman tracker smooths the bend angle instead of a low pass and deadzone,
+ * without their lag, and estimates the angular velocity. loop stands in for a
+ * control loop: it uses the angle predicted for when its output takes effect,
+ * making up for the age of the last sample and for the loop's own latency.
+ * 
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ * 
+ * Refer to one_axis_quick_start_guide.pdf for wiring instructions
+ */
+
+#include "Arduino.h"
+#include "ads.h"
+#include "ads_hal.h"
+#include "ads_kalman.h"
+
+#define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
+#define ADS_INTERRUPT_PIN  (4)           // Pin number attached to the ads data ready line. 
+
+#define SAMPLE_NOISE       (0.1f)        // Degrees, standard deviation of the angle held still
+#define MOTION_CHANGE      (2000.0f)     // Degrees/s^2, higher follows sudden moves closer
+#define LOOP_LATENCY_US    (10000)       // Time from reading the angle to acting on it
+
+ads_dev_t ads;                           // One Axis ADS device
+ads_kalman_t tracker;                    // Tracker of the bend angle
+
+void ads_timestamped_data_callback(ads_dev_t * dev, ads_sample_t * sample);
+
+/* Receives new time stamped samples from the ADS library */
+void ads_timestamped_data_callback(ads_dev_t * dev, ads_sample_t * sample)
+{
+  ads_kalman_update_sample(&tracker, sample, ADS_SAMPLE);
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.println("Initializing One Axis sensor");
+
+  ads_kalman_init(&tracker, ADS_KALMAN_CV, SAMPLE_NOISE, MOTION_CHANGE, LOOP_LATENCY_US);
+  
+  ads_init_t init{};                                                      // One Axis ADS initialization structure
+
+  init.sps = ADS_500_HZ;                                                  // Set sample rate to 500 Hz
+  init.ads_timestamped_sample_callback = &ads_timestamped_data_callback;  // Provide time stamped callback for new data
+  init.reset_pin = ADS_RESET_PIN;                                         // Pin connected to ADS reset line
+  init.datardy_pin = ADS_INTERRUPT_PIN;                                   // Pin connected to ADS data ready interrupt
+  init.addr = 0;                                                          // Update value if non default I2C address is assinged to sensor
+
+  // Initialize ADS hardware abstraction layer, and set the sample rate
+  int ret_val = ads_init(&ads, &init);
+  
+  if(ret_val != ADS_OK)
+  {
+    Serial.print("One Axis ADS initialization failed with reason: ");
+    Serial.println(ret_val);
+  }
+  else
+  {
+    Serial.println("One Axis ADS initialization succeeded...");
+  }
+
+  // Start reading data in interrupt mode
+  ads_run(&ads, true);
+}
+
+void loop() {
+  ads_kalman_t track;
+
+  // Copy the track with the interrupt held off, it updates it
+  noInterrupts();
+  track = tracker;
+  interrupts();
+
+  Serial.print(ads_kalman_angle(&track));
+  Serial.print(",");
+  Serial.print(ads_kalman_velocity(&track));
+  Serial.print(",");
+  Serial.println(ads_kalman_predict(&track, ads_hal_micros()));
+
+  delay(10);
+}
@@ -17,17 +17,21 @@
 
 #include "Arduino.h"
 #include "ads.h"
+#include "ads_filter.h"
 
 #define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (4)           // Not needed in polled mode.  
 
-void ads_data_callback(float * sample);
+ads_dev_t ads;                           // One Axis ADS device
+ads_filter_t filter[2];                  // Low pass filter of bend and stretch
+
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type);
 void deadzone_filter(float * sample);
 void signal_filter(float * sample);
 void parse_com_port(void);
 
 /* Not used in polled mode. Stub function necessary for library compilation */
-void ads_data_callback(float * sample, uint8_t sample_type)
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type)
 {
   
 }
@@ -37,7 +41,7 @@ void setup() {
 
   Serial.println("Initializing One Axis sensor");
   
-  ads_init_t init;                                // One Axis ADS initialization structure
+  ads_init_t init{};                              // One Axis ADS initialization structure
 
   init.sps = ADS_100_HZ;                          // Set sample rate to 100 Hz (Interrupt mode)
   init.ads_sample_callback = &ads_data_callback;  // Provide callback for new data
@@ -46,7 +50,7 @@ void setup() {
   init.addr = 0;                                  // Update value if non default I2C address is assinged to sensor
 
   // Initialize ADS hardware abstraction layer, and set the sample rate
-  int ret_val = ads_init(&init);
+  int ret_val = ads_init(&ads, &init);
   
   if(ret_val != ADS_OK)
   {
@@ -58,8 +62,12 @@ void setup() {
     Serial.println("One Axis ADS initialization succeeded...");
   }
 
+  // Low pass filters at the polling rate
+  for(uint8_t i=0; i<2; i++)
+    ads_filter_init(&filter[i], ADS_FILTER_LOWPASS, 2, 20.0f, 100.0f);
+
   // Start reading data in polled mode
-  ads_polled(true);
+  ads_polled(&ads, true);
 
   // Wait for first sample
   delay(10);
@@ -71,7 +79,7 @@ void loop() {
   uint8_t data_type;
 
   // Read data from the one axis ads sensor
-  int ret_val = ads_read_polled(sample, &data_type);
+  int ret_val = ads_read_polled(&ads, sample, &data_type);
 
   // Check if read was successfull
   if(ret_val == ADS_OK)
@@ -107,35 +115,35 @@ void parse_com_port(void)
   {
     case '0':
       // Take first calibration point at zero degrees
-      ads_calibrate(ADS_CALIBRATE_FIRST, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_FIRST, 0);
       break;
     case '9':
       // Take second calibration point at 180 degrees
-      ads_calibrate(ADS_CALIBRATE_SECOND, 180);
+      ads_calibrate(&ads, ADS_CALIBRATE_SECOND, 180);
       break;
     case 'c':
       // Restore factory calibration coefficients
-      ads_calibrate(ADS_CALIBRATE_CLEAR, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_CLEAR, 0);
       break;
     case 'r':
       // Start sampling in interrupt mode
-      ads_run(true);
+      ads_run(&ads, true);
       break;
     case 's':
       // Place ADS in suspend mode
-      ads_run(false);
+      ads_run(&ads, false);
       break;
     case 'f':
       // Set ADS sample rate to 200 Hz (interrupt mode)
-      ads_set_sample_rate(ADS_200_HZ);
+      ads_set_sample_rate(&ads, ADS_200_HZ);
       break;
     case 'u':
       // Set ADS sample to rate to 10 Hz (interrupt mode)
-      ads_set_sample_rate(ADS_10_HZ);
+      ads_set_sample_rate(&ads, ADS_10_HZ);
       break;
     case 'n':
       // Set ADS sample rate to 100 Hz (interrupt mode)
-      ads_set_sample_rate(ADS_100_HZ);
+      ads_set_sample_rate(&ads, ADS_100_HZ);
       break;
     default:
       break;
@@ -143,27 +151,13 @@ void parse_com_port(void)
 }
 
 /* 
- *  Second order Infinite impulse response low pass filter. Sample freqency 100 Hz.
- *  Cutoff freqency 20 Hz. 
+ *  Second order Butterworth low pass filter, cutoff freqency 20 Hz at the
+ *  100 Hz polling rate of loop().
  */
 void signal_filter(float * sample)
 {
-    static float filter_samples[2][6];
-
-    for(uint8_t i=0; i<2; i++)
-    {
-      filter_samples[i][5] = filter_samples[i][4];
-      filter_samples[i][4] = filter_samples[i][3];
-      filter_samples[i][3] = (float)sample[i];
-      filter_samples[i][2] = filter_samples[i][1];
-      filter_samples[i][1] = filter_samples[i][0];
-  
-      // 20 Hz cutoff frequency @ 100 Hz Sample Rate
-      filter_samples[i][0] = filter_samples[i][1]*(0.36952737735124147f) - 0.19581571265583314f*filter_samples[i][2] + \
-        0.20657208382614792f*(filter_samples[i][3] + 2*filter_samples[i][4] + filter_samples[i][5]);   
-
-      sample[i] = filter_samples[i][0];
-    }
+  for(uint8_t i=0; i<2; i++)
+    sample[i] = ads_filter_apply(&filter[i], sample[i]);
 }
 
 /* 
@@ -0,0 +1,140 @@
+/* 
+ * Reading the one axis soft flex sensor from Nitto Bend Technologies in queued mode
+ *  
+ * In queued mode the data ready interrupt only reads the packet from the sensor
+ * and places it on a queue. Samples are drained and printed from loop, so a slow
+ * serial port does not stall the interrupt and samples are not lost at high
+ * sample rates.
+ * 
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ * 
+ * Refer to one_axis_quick_start_guide.pdf for wiring instructions
+ */
+
+#include "Arduino.h"
+#include "ads.h"
+#include "ads_cmd.h"
+
+#define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
+#define ADS_INTERRUPT_PIN  (4)           // Pin number attached to the ads data ready line. 
+
+ads_dev_t ads;                           // One Axis ADS device
+ads_cmd_t fw_ver_cmd;                    // Firmware version read, sent while sampling
+
+void parse_com_port(void);
+
+/* Receives the firmware version, samples keep streaming while it is read */
+void fw_ver_callback(ads_dev_t * dev, ads_cmd_t * cmd)
+{
+  if(cmd->status == ADS_OK)
+  {
+    Serial.print("Firmware version: ");
+    Serial.println(ads_cmd_fw_ver(cmd));
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.println("Initializing One Axis sensor");
+  
+  ads_init_t init{};                              // One Axis ADS initialization structure
+
+  init.sps = ADS_500_HZ;                          // Set sample rate to 500 Hz
+  init.queued = true;                             // Queue samples for ads_read_queued, no callback
+  init.reset_pin = ADS_RESET_PIN;                 // Pin connected to ADS reset line
+  init.datardy_pin = ADS_INTERRUPT_PIN;           // Pin connected to ADS data ready interrupt
+  init.addr = 0;                                  // Update value if non default I2C address is assinged to sensor
+
+  // Initialize ADS hardware abstraction layer, and set the sample rate
+  int ret_val = ads_init(&ads, &init);
+  
+  if(ret_val != ADS_OK)
+  {
+    Serial.print("One Axis ADS initialization failed with reason: ");
+    Serial.println(ret_val);
+  }
+  else
+  {
+    Serial.println("One Axis ADS initialization succeeded...");
+  }
+
+  // Start reading data in interrupt mode
+  ads_run(&ads, true);
+}
+
+void loop() {
+  ads_sample_t samples[8];
+  uint8_t count;
+
+  // Drain and decode the samples queued by the data ready interrupt
+  ads_read_batch(&ads, samples, 8, &count);
+
+  for(uint8_t i = 0; i < count; i++)
+  {
+    Serial.print(samples[i].timestamp);
+    Serial.print(",");
+    Serial.println(samples[i].sample[0]);
+  }
+  
+  // Complete asynchronous commands
+  ads_cmd_poll(&ads);
+  
+  // Check for received hot keys on the com port
+  if(Serial.available())
+  {
+    parse_com_port();
+  }
+}
+
+/* Function parses received characters from the COM port for commands */
+void parse_com_port(void)
+{
+  char key = Serial.read();
+
+  switch(key)
+  {
+    case 'o':
+      // Print the queue counters, increase ADS_QUEUE_LEN if samples were dropped
+      Serial.print("Queue overflows: ");
+      Serial.print(ads.queue_overflows);
+      Serial.print(" high water: ");
+      Serial.println(ads.queue_high_water);
+      break;
+    case 'i':
+      // Print the interval between samples, measured at the data ready edge
+      {
+        ads_interval_stats_t stats;
+        ads_get_interval_stats(&ads, &stats);
+
+        Serial.print("Interval us min: ");
+        Serial.print(stats.min_us);
+        Serial.print(" max: ");
+        Serial.print(stats.max_us);
+        Serial.print(" late: ");
+        Serial.print(stats.late);
+        Serial.print(" missed: ");
+        Serial.println(stats.missed);
+      }
+      break;
+    case 'v':
+      // Read the firmware version without stopping the sample stream
+      ads_cmd_get_fw_ver(&fw_ver_cmd);
+      ads_cmd_submit(&ads, &fw_ver_cmd, &fw_ver_callback);
+      break;
+    case 'r':
+      // Start sampling in interrupt mode
+      ads_run(&ads, true);
+      break;
+    case 's':
+      // Place ADS in suspend mode
+      ads_run(&ads, false);
+      break;
+    default:
+      break;
+  }
+}
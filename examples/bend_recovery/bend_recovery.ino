@@ -14,13 +14,31 @@
  */
 
 #include <Wire.h>
-#include "ads_fw_v2.h"
+#include "ads_fw.h"
 
 #define ADS_RESET_PIN      (3)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (4)           // Not needed in polled mode.
 #define SENSOR_ADDRESS    0x12
-
-const uint32_t firmwareSize = sizeof(ads_fw_v2); 
+#define PAGE_SIZE         64             // Bootloader page, acknowledged after each
+#define MAX_RETRIES       8              // Writes resent and acks waited for again per attempt
+
+// Longest write the Wire library sends in one transaction, 32 bytes on AVR
+#if defined(I2C_BUFFER_LENGTH)
+#define WIRE_MAX_WRITE    I2C_BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+#define WIRE_MAX_WRITE    BUFFER_LENGTH
+#elif defined(SERIAL_BUFFER_SIZE)
+#define WIRE_MAX_WRITE    SERIAL_BUFFER_SIZE
+#else
+#define WIRE_MAX_WRITE    32
+#endif
+
+const uint32_t firmwareSize = ads_fw_v2_image.len; 
+
+// Upload progress, kept across attempts so a failed upload resumes where it stopped.
+// The bootloader counts the bytes it takes, so bytes it took are never sent again.
+uint32_t bytesSent = 0;                  // Bytes the bootloader took
+bool ackPending = false;                 // Page up to bytesSent not acknowledged yet
 
 uint8_t writeToI2CDevice(uint8_t address, uint8_t* buffer, size_t size);
 bool waitForAck(uint8_t address, char expectedAck, unsigned long timeout);
@@ -77,10 +95,13 @@ void setup(){
     return;
   }
 
-  // Recovery section
-  if (uploadFirmware() != 0) {
-    Serial.println("Firmware upload failed.");
-    return;
+  // Recovery section, resuming a failed upload while the sensor is still in the bootloader
+  while (uploadFirmware() != 0) {
+    Serial.print("Firmware upload failed at byte ");
+    Serial.println(bytesSent);
+    if (!getUserConfirmation("Do you want to resume the upload? (y/n)")) {
+      return;
+    }
   }
   Serial.println("Firmware upload successful.");
 
@@ -146,38 +167,64 @@ int scanI2CBus() {
   return -1;
 }
 
-int uploadFirmware() {
-  uint8_t block_len = 64;
-  uint32_t nb_blocks = firmwareSize / block_len;
-  uint32_t rem_data = firmwareSize % block_len;
-  uint8_t packet[block_len];
+// Writes part of a page, resending it while the bootloader refuses it
+bool writeWithRetry(uint8_t* buffer, size_t size, uint8_t* retries) {
+  while (writeToI2CDevice(SENSOR_ADDRESS, buffer, size) != 0) {
+    if (++(*retries) > MAX_RETRIES) {
+      return false;
+    }
+    delay(1);
+  }
+  return true;
+}
 
-  for (uint32_t i = 0; i < nb_blocks; i++) {
-    // Copy the next page
-    memcpy(packet, &ads_fw_v2[i * block_len], block_len);
+// Waits for the page acknowledgement, waiting again while it is late
+bool waitForAckWithRetry(uint8_t* retries) {
+  while (!waitForAck(SENSOR_ADDRESS, 's', 500)) {
+    if (++(*retries) > MAX_RETRIES) {
+      return false;
+    }
+  }
+  return true;
+}
 
-    // Send the page
-    writeToI2CDevice(SENSOR_ADDRESS, packet, block_len / 2);
-    writeToI2CDevice(SENSOR_ADDRESS, &packet[block_len / 2], block_len / 2);
+int uploadFirmware() {
+  uint8_t packet[PAGE_SIZE];
+  uint8_t retries = 0;
+
+  while (bytesSent < firmwareSize || ackPending) {
+    if (!ackPending) {
+      // Copy the rest of the page, all of it unless resuming within it
+      uint32_t pageEnd = min((bytesSent / PAGE_SIZE + 1) * PAGE_SIZE, firmwareSize);
+      memcpy(&packet[bytesSent % PAGE_SIZE], &ads_fw_v2_image.data[bytesSent], pageEnd - bytesSent);
+
+      // Send the page in as few writes as Wire takes, counting each write the bootloader takes
+      while (bytesSent < pageEnd) {
+        uint8_t first = bytesSent % PAGE_SIZE;
+        uint8_t chunk = min((uint32_t)WIRE_MAX_WRITE, pageEnd - bytesSent);
+
+        if (!writeWithRetry(&packet[first], chunk, &retries)) {
+          return -1;  // Bootloader keeps refusing the page
+        }
+        bytesSent += chunk;
+      }
+      ackPending = true;
+    }
 
     // Get acknowledgement of the received page
-    if (!waitForAck(SENSOR_ADDRESS, 's', 500)) {
+    if (!waitForAckWithRetry(&retries)) {
       return -1;  // Timeout or error
     }
-  }
-
-  // Transfer the remainder and get acknowledgement
-  memcpy(packet, &ads_fw_v2[nb_blocks * block_len], rem_data);
-
-  if (rem_data > block_len / 2) {
-    writeToI2CDevice(SENSOR_ADDRESS, packet, block_len / 2);
-    writeToI2CDevice(SENSOR_ADDRESS, &packet[block_len / 2], rem_data - block_len / 2);
-  } else {
-    writeToI2CDevice(SENSOR_ADDRESS, packet, rem_data);
-  }
-
-  if (!waitForAck(SENSOR_ADDRESS, 's', 500)) {
-    return -1;  // Timeout or error
+    ackPending = false;
+
+    // Report progress every 16 pages and at the end
+    if (bytesSent % (16 * PAGE_SIZE) == 0 || bytesSent == firmwareSize) {
+      Serial.print("Uploaded ");
+      Serial.print(bytesSent);
+      Serial.print(" of ");
+      Serial.print(firmwareSize);
+      Serial.println(" bytes");
+    }
   }
 
   return 0;  // Success
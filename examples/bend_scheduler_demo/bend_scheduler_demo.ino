@@ -0,0 +1,115 @@
+/* 
+ * Reading two one axis soft flex sensors from Nitto Bend Technologies on one I2C bus
+ *  
+ * The bus scheduler reads each sensor in polled mode at its own rate, the read
+ * due soonest first, instead of pacing the loop with delay(). Press 'i' for
+ * the bus utilization and the number of missed deadlines.
+ * 
+ * The second sensor must first be given address 0x13, see bend_address_update.
+ * 
+ * This software is provided "as is", without any warranty of any kind, express or implied,
+ * including but not limited to the warranties of merchantability, fitness for a particular purpose,
+ * and noninfringement. In no event shall the authors or copyright holders be liable for any claim,
+ * damages, or other liability, whether in an action of contract, tort, or otherwise, arising from,
+ * out of, or in connection with the software or the use or other dealings in the software.
+ * 
+ * Refer to one_axis_quick_start_guide.pdf for wiring instructions
+ */
+
+#include "Arduino.h"
+#include "ads.h"
+#include "ads_sched.h"
+
+#define ADS_RESET_PIN_A    (3)           // Pin number attached to the reset line of sensor A
+#define ADS_RESET_PIN_B    (5)           // Pin number attached to the reset line of sensor B
+#define ADS_INTERRUPT_PIN  (4)           // Not needed in polled mode.  
+
+ads_dev_t ads_a;                         // One Axis ADS device at 0x12, read at 200 Hz
+ads_dev_t ads_b;                         // One Axis ADS device at 0x13, read at 50 Hz
+ads_sched_t sched;                       // Bus scheduler owning the I2C bus
+
+void ads_sample_callback(ads_dev_t * dev, ads_sample_t * sample);
+int init_sensor(ads_dev_t * dev, uint32_t reset_pin, uint8_t addr);
+void parse_com_port(void);
+
+/* Receives every sample read by the scheduler */
+void ads_sample_callback(ads_dev_t * dev, ads_sample_t * sample)
+{
+  if(sample->data_type == ADS_SAMPLE)
+  {
+    Serial.print((dev == &ads_a) ? "A," : "B,");
+    Serial.println(sample->sample[0]);
+  }
+}
+
+/* Initializes one sensor at the given I2C address */
+int init_sensor(ads_dev_t * dev, uint32_t reset_pin, uint8_t addr)
+{
+  ads_init_t init{};                              // One Axis ADS initialization structure
+
+  init.sps = ADS_100_HZ;                          // Sample rate, not used in polled mode
+  init.reset_pin = reset_pin;                     // Pin connected to ADS reset line
+  init.datardy_pin = ADS_INTERRUPT_PIN;           // Pin connected to ADS data ready interrupt
+  init.addr = addr;                               // I2C address of the sensor
+
+  return ads_init(dev, &init);
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  Serial.println("Initializing One Axis sensors");
+
+  if(init_sensor(&ads_a, ADS_RESET_PIN_A, 0x12) != ADS_OK || init_sensor(&ads_b, ADS_RESET_PIN_B, 0x13) != ADS_OK)
+  {
+    Serial.println("One Axis ADS initialization failed");
+  }
+
+  // Schedule both sensors on the 400 kHz bus, each at its own rate
+  ads_sched_init(&sched, 400000, &ads_sample_callback);
+  ads_sched_add(&sched, &ads_a, ADS_200_HZ);
+  ads_sched_add(&sched, &ads_b, ADS_50_HZ);
+
+  // Place both sensors in polled mode and start reading
+  ads_sched_start(&sched);
+}
+
+void loop() {
+
+  // Read the sensors that are due
+  ads_sched_run(&sched);
+  
+  // Check for received hot keys on the com port
+  if(Serial.available())
+  {
+    parse_com_port();
+  }
+}
+
+/* Function parses received characters from the COM port for commands */
+void parse_com_port(void)
+{
+  char key = Serial.read();
+
+  switch(key)
+  {
+    case 'i':
+      // Print bus utilization and deadline misses
+      {
+        ads_sched_stats_t stats;
+        ads_sched_get_stats(&sched, &stats);
+
+        Serial.print("Bus utilization estimated: ");
+        Serial.print(stats.estimated_permille / 10.0f);
+        Serial.print("% measured: ");
+        Serial.print(stats.measured_permille / 10.0f);
+        Serial.print("% reads: ");
+        Serial.print(stats.reads);
+        Serial.print(" misses: ");
+        Serial.println(stats.misses);
+      }
+      break;
+    default:
+      break;
+  }
+}
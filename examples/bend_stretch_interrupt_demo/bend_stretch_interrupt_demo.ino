@@ -20,25 +20,28 @@
 
 #include "Arduino.h"
 #include "ads.h"
+#include "ads_pipeline.h"
 
 #define ADS_RESET_PIN      (4)           // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN  (3)           // Pin number attached to the ads data ready line. 
 
-void ads_data_callback(float * sample);
-void deadzone_filter(float * sample);
-void signal_filter(float * sample);
+ads_dev_t ads;                           // One Axis ADS device
+ads_pipeline_t pipeline[2];              // Processing of bend and stretch
+ads_stage_filter_t lowpass[2];           // Low pass filter stage of each
+ads_stage_deadzone_t deadzone[2];        // Deadzone stage of each
+
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type);
+void print_cost(void);
 void parse_com_port(void);
 
 /* Receives new samples from the ADS library */
-void ads_data_callback(float * sample, uint8_t sample_type)
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type)
 {
   if(sample_type == ADS_SAMPLE)
   {
-    // Low pass IIR filter
-    signal_filter(sample);
-  
-    // Deadzone filter
-    deadzone_filter(sample);
+    // Low pass and deadzone filters
+    for(uint8_t i=0; i<2; i++)
+      ads_pipeline_apply(&pipeline[i], &sample[i]);
   
     Serial.print(sample[0]);    // Contains bend data
     Serial.print(",");
@@ -51,7 +54,7 @@ void setup() {
 
   Serial.println("Initializing One Axis sensor");
   
-  ads_init_t init;                                // One Axis ADS initialization structure
+  ads_init_t init{};                              // One Axis ADS initialization structure
 
   init.sps = ADS_200_HZ;                          // Set sample rate to 200 Hz
   init.ads_sample_callback = &ads_data_callback;  // Provide callback for new data
@@ -60,7 +63,7 @@ void setup() {
   init.addr = 0;                                  // Update value if non default I2C address is assinged to sensor
 
   // Initialize ADS hardware abstraction layer, and set the sample rate
-  int ret_val = ads_init(&init);
+  int ret_val = ads_init(&ads, &init);
   
   if(ret_val != ADS_OK)
   {
@@ -69,10 +72,20 @@ void setup() {
   }
   
   // Enable stretch sensor data
-  ads_stretch_en(true);
+  ads_stretch_en(&ads, true);
+
+  // Second order Butterworth low pass, 20 Hz cutoff at the sample rate of the ADS, then
+  // a 0.5 degree or mm deadzone removing jitter. Budget of 1000 cycles per sample.
+  for(uint8_t i=0; i<2; i++)
+  {
+    ads_pipeline_init(&pipeline[i], 1000);
+    ads_filter_init_dev(&lowpass[i].filter, ADS_FILTER_LOWPASS, 2, 20.0f, &ads);
+    ads_pipeline_add(&pipeline[i], ads_stage_filter(&lowpass[i]));
+    ads_pipeline_add(&pipeline[i], ads_stage_deadzone(&deadzone[i], 0.5f, false));
+  }
 
   // Start reading data in interrupt mode
-  ads_run(true);
+  ads_run(&ads, true);
 }
 
 void loop() {
@@ -95,87 +108,65 @@ void parse_com_port(void)
   {
     case '0':
       // Take first calibration point at zero degrees
-      ads_calibrate(ADS_CALIBRATE_FIRST, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_FIRST, 0);
       break;
     case '9':
       // Take second calibration point at ninety degrees
-      ads_calibrate(ADS_CALIBRATE_SECOND, 90);
+      ads_calibrate(&ads, ADS_CALIBRATE_SECOND, 90);
       break;
     case 'c':
       // Restore factory calibration coefficients
-      ads_calibrate(ADS_CALIBRATE_CLEAR, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_CLEAR, 0);
       break;
     case 'r':
       // Start sampling in interrupt mode
-      ads_run(true);
+      ads_run(&ads, true);
       break;
     case 's':
       // Place ADS in suspend mode
-      ads_run(false);
+      ads_run(&ads, false);
       break;
     case 'f':
       // Set ADS sample rate to 200 Hz (interrupt mode)
-      ads_set_sample_rate(ADS_200_HZ);
+      ads_set_sample_rate(&ads, ADS_200_HZ);
       break;
     case 'u':
       // Set ADS sample to rate to 10 Hz (interrupt mode)
-      ads_set_sample_rate(ADS_10_HZ);
+      ads_set_sample_rate(&ads, ADS_10_HZ);
       break;
     case 'n':
       // Set ADS sample rate to 100 Hz (interrupt mode)
-      ads_set_sample_rate(ADS_100_HZ);
+      ads_set_sample_rate(&ads, ADS_100_HZ);
       break;
     case 'b':
       // Calibrate the zero millimeter linear displacement
-      ads_calibrate(ADS_CALIBRATE_STRETCH_ZERO, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_STRETCH_ZERO, 0);
       break;
     case 'e':
       // Calibrate the 30 millimeter linear displacement (stretch), Make certain the sensor is at 0 degrees angular displacement (flat)
-      ads_calibrate(ADS_CALIBRATE_STRETCH_SECOND, 30);
+      ads_calibrate(&ads, ADS_CALIBRATE_STRETCH_SECOND, 30);
+      break;
+    case 'p':
+      // Print the processing cost of bend and stretch
+      print_cost();
       break;
     default:
       break;
   }
 }
 
-/* 
- *  Second order Infinite impulse response low pass filter. Sample freqency 100 Hz.
- *  Cutoff freqency 20 Hz. 
- */
-void signal_filter(float * sample)
-{
-    static float filter_samples[2][6];
-
-    for(uint8_t i=0; i<2; i++)
-    {
-      filter_samples[i][5] = filter_samples[i][4];
-      filter_samples[i][4] = filter_samples[i][3];
-      filter_samples[i][3] = (float)sample[i];
-      filter_samples[i][2] = filter_samples[i][1];
-      filter_samples[i][1] = filter_samples[i][0];
-  
-      // 20 Hz cutoff frequency @ 100 Hz Sample Rate
-      filter_samples[i][0] = filter_samples[i][1]*(0.36952737735124147f) - 0.19581571265583314f*filter_samples[i][2] + \
-        0.20657208382614792f*(filter_samples[i][3] + 2*filter_samples[i][4] + filter_samples[i][5]);   
-
-      sample[i] = filter_samples[i][0];
-    }
-}
-
-/* 
- *  If the current sample is less that 0.5 degrees different from the previous sample
- *  the function returns the previous sample. Removes jitter from the signal. 
- */
-void deadzone_filter(float * sample)
+/* Prints the mean cycles per sample taken by each stage of the pipelines */
+void print_cost(void)
 {
-  static float prev_sample[2];
-  float dead_zone = 0.5f;
-
   for(uint8_t i=0; i<2; i++)
   {
-    if(fabs(sample[i]-prev_sample[i]) > dead_zone)
-      prev_sample[i] = sample[i];
-    else
-      sample[i] = prev_sample[i];
+    Serial.print(i == 0 ? "Bend: lowpass " : "Stretch: lowpass ");
+    Serial.print(ads_stage_cycles(&lowpass[i].stage));
+    Serial.print(", deadzone ");
+    Serial.print(ads_stage_cycles(&deadzone[i].stage));
+    Serial.print(", max ");
+    Serial.print(pipeline[i].cycles_max);
+    Serial.print(" cycles, over budget ");
+    Serial.println(pipeline[i].over_budget);
   }
 }
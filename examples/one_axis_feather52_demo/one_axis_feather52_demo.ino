@@ -1,5 +1,6 @@
 #include "Arduino.h"
 #include "ads.h"
+#include "ads_filter.h"
 
 #include <bluefruit.h>
 #include <string.h>
@@ -7,6 +8,8 @@
 #define ADS_RESET_PIN       (27)        // Pin number attached to ads reset line.
 #define ADS_INTERRUPT_PIN   (30)        // Pin number attached to the ads data ready line.  
 
+ads_dev_t ads;                          // One Axis ADS device
+ads_filter_t filter;                    // Low pass filter of the bend angle
 
 BLEService        angms = BLEService(0x1820);
 BLECharacteristic angmc = BLECharacteristic(0x2A70);
@@ -21,7 +24,7 @@ void startAdv(void);
 void setupANGM(void);
 void connect_callback(uint16_t conn_handle);
 void disconnect_callback(uint16_t conn_handle, uint8_t reason);
-void ads_data_callback(float sample);
+void ads_data_callback(ads_dev_t * dev, float * sample, uint8_t sample_type);
 float deadzone_filter(float sample);
 float signal_filter(float sample);
 void parse_serial_port(void);
@@ -30,21 +33,10 @@ void parse_serial_port(void);
 float ang = 0.0f;
 volatile bool newData = false;
 
+/* Second order Butterworth low pass filter, 20 Hz cutoff at the sample rate of the ADS */
 float signal_filter(float sample)
 {
-    static float filter_samples[6];
-    
-    filter_samples[5] = filter_samples[4];
-    filter_samples[4] = filter_samples[3];
-    filter_samples[3] = (float)sample;
-    filter_samples[2] = filter_samples[1];
-    filter_samples[1] = filter_samples[0];
-
-    // 20 Hz cutoff frequency @ 100 Hz Sample Rate
-    filter_samples[0] = filter_samples[1]*(0.36952737735124147f) - 0.19581571265583314f*filter_samples[2] + \
-      0.20657208382614792f*(filter_samples[3] + 2*filter_samples[4] + filter_samples[5]);
-      
-    return filter_samples[0];
+  return ads_filter_apply(&filter, sample);
 }
 
 float deadzone_filter(float sample)
@@ -60,8 +52,10 @@ float deadzone_filter(float sample)
   return sample;
 }
 
-void ads_data_callback(float sample)
+void ads_data_callback(ads_dev_t * dev, float * sample_buf, uint8_t sample_type)
 {
+  float sample = sample_buf[0];
+
   // Low pass IIR filter
   sample = (float)signal_filter(sample);
 
@@ -115,7 +109,7 @@ void setup() {
   Serial.println("\nAdvertising"); 
 
   Serial.println("Initializing the One Axis Angular Displacement Sensor");
-  ads_init_t init;
+  ads_init_t init{};
 
   init.sps = ADS_100_HZ;
   init.ads_sample_callback = &ads_data_callback;
@@ -125,9 +119,12 @@ void setup() {
 
   delay(100);
 
-  if(ads_init(&init) != ADS_OK)
+  if(ads_init(&ads, &init) != ADS_OK)
     Serial.println("One Axis ADS initialization failed");
 
+  // Designed again when the sample rate is changed over BLE
+  ads_filter_init_dev(&filter, ADS_FILTER_LOWPASS, 2, 20.0f, &ads);
+
   //delay(100);
 }
 
@@ -186,8 +183,8 @@ void setupANGM(void)
 void connect_callback(uint16_t conn_handle)
 {
     Serial.print("Connected");
-    ads_polled(true);
-  //ads_run(true);
+    ads_polled(&ads, true);
+  //ads_run(&ads, true);
 }
 
 void disconnect_callback(uint16_t conn_handle, uint8_t reason)
@@ -200,8 +197,8 @@ void disconnect_callback(uint16_t conn_handle, uint8_t reason)
   Serial.println("Disconnected");
   Serial.println("Advertising!");
   
-  ads_polled(false);
-  //ads_run(false);
+  ads_polled(&ads, false);
+  //ads_run(&ads, false);
 }
 
 void write_callback(BLECharacteristic& chr, unsigned char * rx, short unsigned len, short unsigned dah)
@@ -210,11 +207,11 @@ void write_callback(BLECharacteristic& chr, unsigned char * rx, short unsigned l
   {
     if(rx[0] == 0)
     {
-      ads_calibrate(ADS_CALIBRATE_FIRST, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_FIRST, 0);
     }
     else if(rx[0] == 1)
     {
-      ads_calibrate(ADS_CALIBRATE_SECOND, 90);
+      ads_calibrate(&ads, ADS_CALIBRATE_SECOND, 90);
     }
     else if(rx[0] == 2)
     {
@@ -222,7 +219,7 @@ void write_callback(BLECharacteristic& chr, unsigned char * rx, short unsigned l
     }
     else if(rx[0] == 3)
     {
-      ads_calibrate(ADS_CALIBRATE_CLEAR, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_CLEAR, 0);
     }
     else if(rx[0] == 0x07)
     {
@@ -233,7 +230,7 @@ void write_callback(BLECharacteristic& chr, unsigned char * rx, short unsigned l
   {
     uint16_t sps = ads_uint16_decode(rx);
     
-    ads_set_sample_rate((ADS_SPS_T)sps);
+    ads_set_sample_rate(&ads, (ADS_SPS_T)sps);
   }
 }
 
@@ -261,21 +258,21 @@ void parse_serial_port(void)
     char key = Serial.read();
     
     if(key == '0')
-      ads_calibrate(ADS_CALIBRATE_FIRST, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_FIRST, 0);
     else if(key == '9')
-      ads_calibrate(ADS_CALIBRATE_SECOND, 90);
+      ads_calibrate(&ads, ADS_CALIBRATE_SECOND, 90);
     else if(key == 'c')
-      ads_calibrate(ADS_CALIBRATE_CLEAR, 0);
+      ads_calibrate(&ads, ADS_CALIBRATE_CLEAR, 0);
     else if(key == 'r')
-      ads_run(true);
+      ads_run(&ads, true);
     else if(key == 's')
-      ads_run(false);
+      ads_run(&ads, false);
     else if(key == 'f')
-      ads_set_sample_rate(ADS_200_HZ);
+      ads_set_sample_rate(&ads, ADS_200_HZ);
     else if(key == 'u')
-      ads_set_sample_rate(ADS_10_HZ);
+      ads_set_sample_rate(&ads, ADS_10_HZ);
     else if(key == 'n')
-      ads_set_sample_rate(ADS_100_HZ);
+      ads_set_sample_rate(&ads, ADS_100_HZ);
 }
 
 void loop() {
@@ -285,7 +282,7 @@ void loop() {
 
   float ang = 0.0f;
 
-  if( ads_hal_read_buffer(read_buffer, 3) == ADS_OK)
+  if( ads_hal_read_buffer(&ads, read_buffer, 3) == ADS_OK)
   {
     int16_t temp = ads_int16_decode(&read_buffer[1]);
     ang = (float)temp/64.0f;
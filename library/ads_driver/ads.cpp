@@ -5,10 +5,99 @@
  */
 
 #include "ads.h"
+#include <string.h>
 
-static ads_callback ads_data_callback;
+/*
+ * Access to single byte indexes and sequence counts shared with the data
+ * ready interrupt. The value owned by the other side is loaded with acquire
+ * and the own value published with release, so data is visible before the
+ * index that hands it over. Single bytes are read and written atomically on
+ * every target.
+ */
+#if defined(__GNUC__)
+#define ADS_LOAD_ACQUIRE(var)		__atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define ADS_STORE_RELEASE(var, val)	__atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+#define ADS_FENCE_ACQUIRE()			__atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define ADS_FENCE_RELEASE()			__atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+#define ADS_LOAD_ACQUIRE(var)		(var)
+#define ADS_STORE_RELEASE(var, val)	((var) = (val))
+#define ADS_FENCE_ACQUIRE()
+#define ADS_FENCE_RELEASE()
+#endif
 
-static bool stretch_en = false;
+/* Scale of the Q6 fixed point samples sent by the ADS */
+#define ADS_SAMPLE_SCALE			(1.0f/64.0f)
+
+/**
+ * @brief Measures the interval to the previous bend sample from the data ready
+ *				time stamp. Called from ads_hal in interrupt context, the only
+ *				writer of dev->interval.
+ */
+static void ads_update_interval(ads_dev_t * dev, uint32_t timestamp)
+{
+	ads_interval_stats_t * stats = &dev->interval;
+	uint8_t seq = dev->interval_seq;
+	
+	dev->interval_seq = seq + 1;
+	ADS_FENCE_RELEASE();
+	
+	if(dev->interval_reset)
+	{
+		memset(stats, 0, sizeof(*stats));
+		dev->interval_reset = false;
+	}
+	
+	if(!dev->interval_restart && stats->samples != 0)
+	{
+		uint32_t interval = timestamp - dev->interval_last;
+		
+		if(stats->intervals == 0 || interval < stats->min_us)
+			stats->min_us = interval;
+		if(interval > stats->max_us)
+			stats->max_us = interval;
+		
+		stats->sum_us += interval;
+		stats->intervals++;
+		
+		// More than half a period late, count the periods without a sample
+		uint32_t period = dev->sample_period_us;
+		
+		if(period != 0 && interval > period + period / 2)
+		{
+			stats->late++;
+			stats->missed += (interval + period / 2) / period - 1;
+		}
+	}
+	
+	stats->samples++;
+	dev->interval_last = timestamp;
+	dev->interval_restart = false;
+	
+	ADS_STORE_RELEASE(dev->interval_seq, (uint8_t)(seq + 2));
+}
+
+/**
+ * @brief Captures the reply of the asynchronous command in flight. Called
+ *				from ads_hal in interrupt context.
+ *
+ * @return	true if the packet was the reply
+ */
+static inline bool ads_capture_reply(ads_dev_t * dev, const uint8_t * buffer)
+{
+	// With no reply expected, an all 0xFF packet of a floating bus is not one
+	if(dev->cmd_reply_type == ADS_CMD_NO_REPLY || buffer[0] != dev->cmd_reply_type)
+		return false;
+	
+	dev->cmd_reply[0] = buffer[0];
+	dev->cmd_reply[1] = buffer[1];
+	dev->cmd_reply[2] = buffer[2];
+	dev->cmd_reply_type = ADS_CMD_NO_REPLY;
+	
+	ADS_STORE_RELEASE(dev->cmd_replied, true);
+	
+	return true;
+}
 
 /**
  * @brief Parses sample buffer from one axis ADS. Scales to degrees and
@@ -16,11 +105,44 @@ static bool stretch_en = false;
  *				This function is called from ads_hal. 
  *              Application should never call this function.
  */	
-static void ads_parse_read_buffer(uint8_t * buffer)
+static void ads_parse_read_buffer(ads_dev_t * dev, uint8_t * buffer)
 {
-	static float sample[2];
+	float * sample = dev->sample;
+	
+	if(ads_capture_reply(dev, buffer))
+		return;
 	
-	if(!stretch_en)
+	if(buffer[0] == ADS_SAMPLE)
+	{
+		ads_update_interval(dev, dev->drdy_timestamp);
+	}
+	
+	// Fixed point path, samples are passed on as sent by the ADS
+	if(dev->raw_callback != NULL)
+	{
+		ads_q6_t * raw_sample = dev->raw_sample;
+		
+		if(!dev->stretch_en)
+		{
+			raw_sample[1] = 0;
+		}
+		
+		if(buffer[0] == ADS_SAMPLE)
+		{
+			raw_sample[0] = ads_int16_decode(&buffer[1]);
+			
+			dev->raw_callback(dev, raw_sample, buffer[0]);
+		}
+		else if(buffer[0] == ADS_STRETCH_SAMPLE)
+		{
+			raw_sample[1] = ads_int16_decode(&buffer[1]);
+			
+			dev->raw_callback(dev, raw_sample, buffer[0]);
+		}
+		return;
+	}
+	
+	if(!dev->stretch_en)
 	{
 		sample[1] = 0.0f;
 	}
@@ -29,32 +151,247 @@ static void ads_parse_read_buffer(uint8_t * buffer)
 	{
 		int16_t temp = ads_int16_decode(&buffer[1]);
 		sample[0] = (float)temp/64.0f;
-		
-		ads_data_callback(sample, buffer[0]);
 	}
 	else if(buffer[0] == ADS_STRETCH_SAMPLE)
 	{
 		int16_t temp = ads_int16_decode(&buffer[1]);
 		sample[1] = (float)temp/64.0f;
+	}
+	else
+	{
+		return;
+	}
+	
+	if(dev->timestamped_callback != NULL)
+	{
+		ads_sample_t timestamped;
+		
+		timestamped.sample[0] = sample[0];
+		timestamped.sample[1] = sample[1];
+		timestamped.data_type = buffer[0];
+		timestamped.timestamp = dev->drdy_timestamp;
+		
+		dev->timestamped_callback(dev, &timestamped);
+	}
+	else
+	{
+		dev->sample_callback(dev, sample, buffer[0]);
+	}
+}
+
+/**
+ * @brief Pushes a packet from the ADS onto the device queue in queued mode.
+ *				Called from ads_hal in interrupt context, the only producer.
+ *				Drops the packet and counts an overflow if the queue is full.
+ *              Application should never call this function.
+ */
+static void ads_queue_read_buffer(ads_dev_t * dev, uint8_t * buffer)
+{
+	if(ads_capture_reply(dev, buffer))
+		return;
+	
+	if(buffer[0] == ADS_SAMPLE)
+	{
+		ads_update_interval(dev, dev->drdy_timestamp);
+	}
+	
+	uint8_t head = dev->queue_head;
+	uint8_t used = (uint8_t)(head - ADS_LOAD_ACQUIRE(dev->queue_tail));
+	
+	if(used >= ADS_QUEUE_LEN)
+	{
+		dev->queue_overflows++;
+		return;
+	}
+	
+	ads_packet_t * entry = &dev->queue[head & (ADS_QUEUE_LEN - 1)];
+	
+	entry->packet[0] = buffer[0];
+	entry->packet[1] = buffer[1];
+	entry->packet[2] = buffer[2];
+	entry->timestamp = dev->drdy_timestamp;
+	
+	ADS_STORE_RELEASE(dev->queue_head, (uint8_t)(head + 1));
+	
+	if(used + 1 > dev->queue_high_water)
+		dev->queue_high_water = used + 1;
+}
+
+/**
+ * @brief Drains packets queued by the data ready interrupt in queued mode,
+ *			oldest first. Never blocks, safe to call while the interrupt runs.
+ *			dev->queue_overflows counts packets dropped because the queue was
+ *			full, dev->queue_high_water the deepest the queue has been.
+ *
+ * @param	dev			ADS device
+ * @param	packets[out]	array receiving the queued packets
+ * @param	max			size of packets
+ * @param	count[out]	number of packets returned
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the device is not in queued mode
+ */
+int ads_read_queued(ads_dev_t * dev, ads_packet_t * packets, uint8_t max, uint8_t * count)
+{
+	*count = 0;
+	
+	if(!dev->queued)
+		return ADS_ERR_BAD_PARAM;
+	
+	uint8_t tail = dev->queue_tail;
+	uint8_t used = (uint8_t)(ADS_LOAD_ACQUIRE(dev->queue_head) - tail);
+	uint8_t i;
+	
+	if(used > max)
+		used = max;
+	
+	for(i = 0; i < used; i++)
+	{
+		packets[i] = dev->queue[(uint8_t)(tail + i) & (ADS_QUEUE_LEN - 1)];
+	}
+	
+	// Hand the drained slots back to the interrupt
+	ADS_STORE_RELEASE(dev->queue_tail, (uint8_t)(tail + used));
+	
+	*count = used;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Decodes one packet into out, tracking the latest bend and stretch
+ *				sample in dev->sample. Used by ads_read_batch.
+ *
+ * @return	true if the packet was a sample, false if it was skipped
+ */
+static inline bool ads_decode_packet(ads_dev_t * dev, const uint8_t * packet, uint32_t timestamp, ads_sample_t * out)
+{
+	float * sample = dev->sample;
+	
+	if(packet[0] == ADS_SAMPLE)
+		sample[0] = ads_int16_decode(&packet[1]) * ADS_SAMPLE_SCALE;
+	else if(packet[0] == ADS_STRETCH_SAMPLE)
+		sample[1] = ads_int16_decode(&packet[1]) * ADS_SAMPLE_SCALE;
+	else
+	{
+		ads_capture_reply(dev, packet);
+		return false;
+	}
+	
+	out->sample[0] = sample[0];
+	out->sample[1] = dev->stretch_en ? sample[1] : 0.0f;
+	out->data_type = packet[0];
+	out->timestamp = timestamp;
+	
+	return true;
+}
+
+/**
+ * @brief Reads and decodes up to max samples in one call. In queued mode
+ *			drains the queue filled by the data ready interrupt, otherwise
+ *			reads back to back from an ADS in polled mode. Packets that are
+ *			not samples are skipped.
+ *
+ * @param	dev			ADS device
+ * @param	out[out]	array receiving the decoded samples, oldest first
+ * @param	max			size of out
+ * @param	count[out]	number of samples returned
+ * @return	ADS_OK if successful ADS_ERR_IO if a read failed, count holds
+ *			the samples read before the failure
+ */
+int ads_read_batch(ads_dev_t * dev, ads_sample_t * out, uint8_t max, uint8_t * count)
+{
+	uint8_t n = 0;
+	uint8_t i;
+	
+	if(dev->queued)
+	{
+		// Decode straight out of the queue, one index update for the whole batch
+		uint8_t tail = dev->queue_tail;
+		uint8_t used = (uint8_t)(ADS_LOAD_ACQUIRE(dev->queue_head) - tail);
+		
+		if(used > max)
+			used = max;
+		
+		for(i = 0; i < used; i++)
+		{
+			ads_packet_t * entry = &dev->queue[(uint8_t)(tail + i) & (ADS_QUEUE_LEN - 1)];
+			
+			if(ads_decode_packet(dev, entry->packet, entry->timestamp, &out[n]))
+				n++;
+		}
+		
+		ADS_STORE_RELEASE(dev->queue_tail, (uint8_t)(tail + used));
+		
+		*count = n;
+		return ADS_OK;
+	}
+	
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	for(i = 0; i < max; i++)
+	{
+		if(ads_hal_read_buffer(dev, buffer, ADS_TRANSFER_SIZE) != ADS_OK)
+		{
+			*count = n;
+			return ADS_ERR_IO;
+		}
 		
-		ads_data_callback(sample, buffer[0]);
+		if(ads_decode_packet(dev, buffer, ads_hal_micros(), &out[n]))
+			n++;
 	}
+	
+	*count = n;
+	return ADS_OK;
+}
+
+/**
+ * @brief Copies the bend sample interval statistics, measured from data ready
+ *			time stamps in interrupt and queued mode. Safe to call while the
+ *			interrupt runs.
+ *
+ * @param	dev			ADS device
+ * @param	stats[out]	interval statistics
+ * @return	ADS_OK
+ */
+int ads_get_interval_stats(ads_dev_t * dev, ads_interval_stats_t * stats)
+{
+	uint8_t seq;
+	
+	// Retry if the interrupt updated the statistics during the copy
+	do
+	{
+		seq = ADS_LOAD_ACQUIRE(dev->interval_seq);
+		*stats = dev->interval;
+		ADS_FENCE_ACQUIRE();
+	} while((seq & 1) || seq != dev->interval_seq);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Clears the bend sample interval statistics, from the next bend sample
+ *
+ * @param	dev			ADS device
+ */
+void ads_reset_interval_stats(ads_dev_t * dev)
+{
+	dev->interval_reset = true;
 }
 
 /**
  * @brief Reads ADS sample data when ADS is in polled mode
  *
+ * @param	dev			ADS device
  * @param	sample[out]		floating point array returns new sample 
  * @param	data_type[out]	returns if the data read is bend or stretch data
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_read_polled(float * sample, uint8_t * data_type)
+int ads_read_polled(ads_dev_t * dev, float * sample, uint8_t * data_type)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 	int16_t temp;
 	
 	// Read data from sensor
-	int ret_val = ads_hal_read_buffer(buffer, ADS_TRANSFER_SIZE);
+	int ret_val = ads_hal_read_buffer(dev, buffer, ADS_TRANSFER_SIZE);
 
 	// Parse data if successful read 
 	if(ret_val == ADS_OK)
@@ -74,6 +411,46 @@ int ads_read_polled(float * sample, uint8_t * data_type)
 		}
 		else 
 		{
+			ads_capture_reply(dev, buffer);
+			ret_val = ADS_ERR; // Set to general error, data packet not found
+		}
+	}
+	
+	return ret_val;
+}
+
+/**
+ * @brief Reads ADS sample data when ADS is in polled mode, in Q9.6 fixed point
+ *
+ * @param	dev			ADS device
+ * @param	sample[out]		fixed point array returns new sample 
+ * @param	data_type[out]	returns if the data read is bend or stretch data
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_read_polled_raw(ads_dev_t * dev, ads_q6_t * sample, uint8_t * data_type)
+{
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	// Read data from sensor
+	int ret_val = ads_hal_read_buffer(dev, buffer, ADS_TRANSFER_SIZE);
+
+	// Parse data if successful read 
+	if(ret_val == ADS_OK)
+	{
+		// Check that read packet is a data packet
+		if(buffer[0] == ADS_SAMPLE)
+		{
+			data_type[0] = buffer[0];
+			sample[0] = ads_int16_decode(&buffer[1]);
+		}
+		else if(buffer[0] == ADS_STRETCH_SAMPLE)
+		{
+			data_type[0] = buffer[0];
+			sample[1] = ads_int16_decode(&buffer[1]);
+		}
+		else 
+		{
+			ads_capture_reply(dev, buffer);
 			ret_val = ADS_ERR; // Set to general error, data packet not found
 		}
 	}
@@ -84,67 +461,90 @@ int ads_read_polled(float * sample, uint8_t * data_type)
 /**
  * @brief Places ADS in free run or sleep mode
  *
+ * @param	dev			ADS device
  * @param	run	true if activating ADS, false is putting in suspend mode
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_run(bool run)
+int ads_run(ads_dev_t * dev, bool run)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 		
 	buffer[0] = ADS_RUN;
 	buffer[1] = run;
+	
+	dev->interval_restart = true;
 		
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE);
 }
 
 /**
  * @brief Places ADS in poll mode. Each time sensor data is read a new sample is taken
  *
+ * @param	dev			ADS device
  * @param	poll	true if activating ADS, false is putting in suspend mode
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_polled(bool poll)
+int ads_polled(ads_dev_t * dev, bool poll)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 		
 	buffer[0] = ADS_POLLED_MODE;
 	buffer[1] = poll;
 		
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE);
 }
 
 /**
  * @brief Enables and Disables the reading of linear displacment data
  *
+ * @param	dev			ADS device
  * @param	enable	true if enabling ADS to read stretch, false is disabling
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_stretch_en(bool enable)
+int ads_stretch_en(ads_dev_t * dev, bool enable)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 		
 	buffer[0] = ADS_READ_STRETCH;
 	buffer[1] = enable;
 	
-	stretch_en = enable;
+	dev->stretch_en = enable;
 		
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE);
 }
 
 /**
  * @brief Sets the sample rate of the ADS in free run mode
  *
+ * @param	dev			ADS device
  * @param	sps ADS_SPS_T sample rate
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_set_sample_rate(ADS_SPS_T sps)
+int ads_set_sample_rate(ads_dev_t * dev, ADS_SPS_T sps)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 	
 	buffer[0] = ADS_SPS;
 	ads_uint16_encode(sps, &buffer[1]);
 	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	dev->sample_period_us = ADS_SPS_TO_US(sps);
+	dev->interval_restart = true;
+	
+	return ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE);
+}
+
+/**
+ * @brief Enables the ADS data ready interrupt line
+ *
+ * @param	dev			ADS device
+ * @param	enable	true if enabling the interrupt, false if disabling
+ * @return	ADS_OK
+ */
+int ads_enable_interrupt(ads_dev_t * dev, bool enable)
+{
+	ads_hal_pin_int_enable(dev, enable);
+	
+	return ADS_OK;
 }
 
 /**
@@ -152,48 +552,153 @@ int ads_set_sample_rate(ADS_SPS_T sps)
  *		  is 0x12. Use this function to program an ADS to allow multiple
  *		  devices on the same I2C bus.
  *
+ * @param	dev			ADS device
  * @param	address	new address of the ADS
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_update_device_address(uint8_t address)
+int ads_update_device_address(ads_dev_t * dev, uint8_t address)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 	
 	buffer[0] = ADS_SET_ADDRESS;
 	buffer[1] = address;
 	
-	if(ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE) != ADS_OK)
+	if(ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE) != ADS_OK)
 		return ADS_ERR_IO;
 	
-	ads_hal_set_address(address);
+	ads_hal_set_address(dev, address);
 	
 	return ADS_OK;
 }
 
 /**
- * @brief Initializes the hardware abstraction layer and sample rate of the ADS
+ * @brief Reads the device id packet of the ADS
  *
- * @param	ads_init_t	initialization structure of the ADS
- * @return	ADS_OK if successful ADS_ERR if failed
+ * @return	ADS_OK if a device id packet was read, ads_dev_type ADS_DEV_UNKNOWN
+ *			for an id not of ADS_DEV_TYPE_T, ADS_ERR_IO if the transfer failed,
+ *			ADS_ERR_DEV_ID if the packet read was not a device id
  */
-int ads_init(ads_init_t * ads_init)
+static int ads_read_dev_type(ads_dev_t * dev, ADS_DEV_TYPE_T * ads_dev_type)
 {
-	// If addr variable updated update address in HAL 
-	if(ads_init->addr != 0)
+	uint8_t buffer[ADS_TRANSFER_SIZE];
+	
+	buffer[0] = ADS_GET_DEV_ID;
+	*ads_dev_type = ADS_DEV_UNKNOWN;
+	
+	// Disable interrupt to prevent callback from reading out device id
+	ads_hal_pin_int_enable(dev, false);
+	
+	int ret_val = ads_hal_write_read(dev, buffer, ADS_TRANSFER_SIZE, buffer, ADS_TRANSFER_SIZE, 2);
+	
+	ads_hal_pin_int_enable(dev, true);
+	
+	if (ret_val != ADS_OK)
+		return ADS_ERR_IO;
+	
+	if (buffer[0] != ADS_DEV_ID)
+		return ADS_ERR_DEV_ID;
+	
+	switch (buffer[1])
 	{
-		ads_hal_set_address(ads_init->addr);
+	case ADS_DEV_ONE_AXIS_V1:
+	case ADS_DEV_ONE_AXIS_V2:
+	case ADS_DEV_TWO_AXIS_V1:
+		*ads_dev_type = static_cast<ADS_DEV_TYPE_T>(buffer[1]);
+		break;
 	}
 	
-	// Initialize the hardware abstraction layer
-	ads_hal_init(&ads_parse_read_buffer, ads_init->reset_pin, ads_init->datardy_pin);	
+	return ADS_OK;
+}
+
+/**
+ * @brief Waits for the ADS to boot after reset, probing for its device id
+ *			every ADS_INIT_PROBE_MS while the transfer fails. Any answer ends
+ *			the wait, the caller checks the device type. Records the time
+ *			taken in dev->startup_us.
+ *
+ * @return	ADS_OK if the ADS answered, ADS_ERR_DEV_ID if the answer was not a
+ *			device id, ADS_ERR_TIMEOUT if there was none in ADS_INIT_TIMEOUT_MS
+ */
+static int ads_wait_ready(ads_dev_t * dev, ADS_DEV_TYPE_T * ads_dev_type)
+{
+	uint32_t start = ads_hal_micros();
+	
+	for(;;)
+	{
+		int ret_val = ads_read_dev_type(dev, ads_dev_type);
+		
+		if(ret_val != ADS_ERR_IO)
+		{
+			dev->startup_us = ads_hal_micros() - start;
+			return ret_val;
+		}
+		
+		if(ads_hal_micros() - start >= ADS_INIT_TIMEOUT_MS * 1000UL)
+			return ADS_ERR_TIMEOUT;
+		
+		ads_hal_delay(ADS_INIT_PROBE_MS);
+	}
+}
+
+/**
+ * @brief Initializes the hardware abstraction layer and sample rate of the ADS.
+ *			Resets the ADS and probes for its device id until it answers,
+ *			the time taken is left in dev->startup_us.
+ *
+ * @param	dev			ADS device
+ * @param	ads_init_t	initialization structure of the ADS
+ * @return	ADS_OK if successful ADS_ERR if failed, ADS_ERR_TIMEOUT if the
+ *			ADS did not answer within ADS_INIT_TIMEOUT_MS, ADS_ERR_DEV_ID if
+ *			the device answering is not a one axis ADS
+ */
+int ads_init(ads_dev_t * dev, ads_init_t * ads_init)
+{
+	// Bus and address of the device, HAL selects the defaults if not set
+	dev->bus = ads_init->bus;
+	dev->addr = ads_init->addr;
+	
+	dev->stretch_en = false;
+	dev->sample[0] = dev->sample[1] = 0.0f;
 	
 	// Copy local pointer of callback to user application code 
-	ads_data_callback = ads_init->ads_sample_callback;
+	dev->sample_callback = ads_init->ads_sample_callback;
+	dev->raw_callback = ads_init->ads_raw_sample_callback;
+	dev->raw_sample[0] = dev->raw_sample[1] = 0;
+	dev->timestamped_callback = ads_init->ads_timestamped_sample_callback;
+	
+	// No asynchronous commands
+	dev->cmd_head = dev->cmd_tail = NULL;
+	dev->cmd_reply_type = ADS_CMD_NO_REPLY;
+	dev->cmd_replied = false;
+	
+	// No sample timing until the sample rate is set
+	memset(&dev->interval, 0, sizeof(dev->interval));
+	dev->sample_period_us = 0;
+	dev->interval_seq = 0;
+	dev->interval_restart = true;
+	dev->interval_reset = false;
+	
+	// Empty sample queue, packets are queued instead of parsed in queued mode
+	dev->queued = ads_init->queued;
+	dev->queue_head = dev->queue_tail = 0;
+	dev->queue_overflows = 0;
+	dev->queue_high_water = 0;
+	
+	// No firmware update timing learned
+	dev->dfu_ack_us = 0;
+	memset(&dev->dfu_stats, 0, sizeof(dev->dfu_stats));
+	
+	// Initialize the hardware abstraction layer
+	if(ads_hal_init(dev, dev->queued ? &ads_queue_read_buffer : &ads_parse_read_buffer,
+					ads_init->reset_pin, ads_init->datardy_pin) != ADS_OK)
+		return ADS_ERR;
 
-	// Check that the device type is a one axis
+	// Wait for the ADS to boot, and check that the device type is a one axis
 	ADS_DEV_TYPE_T ads_dev_type;
-	if (ads_get_dev_type(&ads_dev_type) != ADS_OK)
-		return ADS_ERR_DEV_ID;
+	int ret_val = ads_wait_ready(dev, &ads_dev_type);
+	
+	if (ret_val != ADS_OK)
+		return ret_val;
 
 	switch (ads_dev_type)
 	{
@@ -207,7 +712,7 @@ int ads_init(ads_init_t * ads_init)
 	ads_hal_delay(2);
  	
 	// Set the sample rate for interrupt mode 
- 	if(ads_set_sample_rate(ads_init->sps))
+ 	if(ads_set_sample_rate(dev, ads_init->sps))
 		return ADS_ERR;
 	
 	ads_hal_delay(2);
@@ -219,12 +724,13 @@ int ads_init(ads_init_t * ads_init)
  * @brief Calibrates one axis ADS. ADS_CALIBRATE_FIRST should be at 0 degrees on
  *				ADS_CALIBRATE_SECOND can be at 45 - 255 degrees, recommended 90 degrees.
  *
+ * @param	dev			ADS device
  * @param	ads_calibration_step 	ADS_CALIBRATE_STEP_T to perform
  * @param degrees uint8_t angle at which sensor is bent when performing 
  *				ADS_CALIBRATE_FIRST, and ADS_CALIBRATE_SECOND
  * @return	ADS_OK if successful ADS_ERR_IO or ADS_BAD_PARAM if failed
  */
-int ads_calibrate(ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees)
+int ads_calibrate(ads_dev_t * dev, ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 	
@@ -232,51 +738,56 @@ int ads_calibrate(ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees)
 	buffer[1] = ads_calibration_step;
 	buffer[2] = degrees;
 	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE);
 }
 
 /**
  * @brief Shutdown ADS. Requires reset to wake up from Shutdown. ~50nA in shutdwon
  *
+ * @param	dev			ADS device
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_shutdown(void)
+int ads_shutdown(ads_dev_t * dev)
 {
 	uint8_t buffer[ADS_TRANSFER_SIZE];
 	
 	buffer[0] = ADS_SHUTDOWN;
 	
-	return ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
+	return ads_hal_write_buffer(dev, buffer, ADS_TRANSFER_SIZE);
 }
 
 /**
- * @brief Wakes up ADS from shutdown. Delay is necessary for ADS to reinitialize 
- *			all settings on ADS will be reset to default. Reinitilaztion necessary
+ * @brief Wakes up ADS from shutdown. Waits until the ADS answers again, the
+ *			time taken is left in dev->startup_us. All settings on ADS will be
+ *			reset to default. Reinitilaztion necessary
  *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @param	dev			ADS device
+ * @return	ADS_OK if successful, ADS_ERR_TIMEOUT if the ADS did not answer
+ *			within ADS_INIT_TIMEOUT_MS
  */
-int ads_wake(void)
+int ads_wake(ads_dev_t * dev)
 {
-	// Reset ADS to wake from shutdown
-	ads_hal_reset();
+	ADS_DEV_TYPE_T ads_dev_type;
 	
-	// Allow time for ADS to reinitialize 
-	ads_hal_delay(100);	
+	// Reset ADS to wake from shutdown
+	ads_hal_reset(dev);
 	
-	return ADS_OK;
+	// Wait for ADS to reinitialize 
+	return ads_wait_ready(dev, &ads_dev_type);
 }
 
 /**
  * @brief Checks that the device id is ADS_ONE_AXIS. ADS should not be in free run
  * 			when this function is called.
  *
+ * @param	dev			ADS device
  * @return	ADS_OK if dev_id is ADS_ONE_AXIS, ADS_ERR_DEV_ID if not
  */
-int ads_get_dev_id(void)
+int ads_get_dev_id(ads_dev_t * dev)
 {
 	ADS_DEV_TYPE_T device_type;
 	
-	if (ads_get_dev_type(&device_type) == ADS_OK)
+	if (ads_get_dev_type(dev, &device_type) == ADS_OK)
 	{
 		switch (device_type)
 		{
@@ -293,36 +804,14 @@ int ads_get_dev_id(void)
  * @brief Returns the device type in device_type. ADS should not be in free run
  * 			when this function is called.
  *
+ * @param	dev			ADS device
  * @param device_type  recipient of the device type
  * @return	ADS_OK if dev_id is one of ADS_DEV_TYPE_T, ADS_ERR_DEV_ID if not
  */
-int ads_get_dev_type(ADS_DEV_TYPE_T * ads_dev_type)
+int ads_get_dev_type(ads_dev_t * dev, ADS_DEV_TYPE_T * ads_dev_type)
 {
-	uint8_t buffer[ADS_TRANSFER_SIZE];
-	
-	buffer[0] = ADS_GET_DEV_ID;
-	
-	// Disable interrupt to prevent callback from reading out device id
-	ads_hal_pin_int_enable(false);
-	
-	ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
-	ads_hal_delay(2);
-	ads_hal_read_buffer(buffer, ADS_TRANSFER_SIZE);
-	
-	ads_hal_pin_int_enable(true);
-	
-	if (buffer[0] == ADS_DEV_ID)
-	{
-		switch (buffer[1])
-		{
-		case ADS_DEV_ONE_AXIS_V1:
-		case ADS_DEV_ONE_AXIS_V2:
-		case ADS_DEV_TWO_AXIS_V1:
-			*ads_dev_type = static_cast<ADS_DEV_TYPE_T>(buffer[1]);
-			return ADS_OK;
-		}
-	}
+	if (ads_read_dev_type(dev, ads_dev_type) != ADS_OK || *ads_dev_type == ADS_DEV_UNKNOWN)
+		return ADS_ERR_DEV_ID;
 	
-	*ads_dev_type = ADS_DEV_UNKNOWN;
-	return ADS_ERR_DEV_ID;
+	return ADS_OK;
 }
@@ -0,0 +1,347 @@
+/**
+ * ads_decimate.cpp
+ *
+ * Anti-aliased FIR and CIC decimators
+ */
+
+#include <math.h>
+#include "ads_decimate.h"
+
+#define ADS_DECIMATE_PI			(3.14159265f)
+
+/**
+ * @brief Designs the FIR, a Blackman windowed sinc scaled to unity gain at
+ *			DC, with Q2.14 coefficients whose rounding error is taken up by
+ *			the center tap so they sum to exactly 1 too
+ */
+static void fir_design(ads_decimator_t * dec)
+{
+	float fc = ADS_DECIMATE_CUTOFF * 0.5f / dec->ratio;		// Cutoff over the input sample rate
+	float mid = (dec->taps - 1) * 0.5f;
+	float sum = 0;
+	int32_t sum_q14 = 0;
+	uint8_t i;
+	
+	for(i = 0; i < dec->taps; i++)
+	{
+		float t = i - mid;
+		float h = (t == 0) ? 2.0f * fc : sinf(2.0f * ADS_DECIMATE_PI * fc * t) / (ADS_DECIMATE_PI * t);
+		
+		if(dec->taps > 1)
+		{
+			float w = 2.0f * ADS_DECIMATE_PI * i / (dec->taps - 1);
+			
+			h *= 0.42f - 0.5f * cosf(w) + 0.08f * cosf(2.0f * w);
+		}
+		
+		dec->coef[i] = h;
+		sum += h;
+	}
+	
+	for(i = 0; i < dec->taps; i++)
+	{
+		dec->coef[i] /= sum;
+		dec->coef_q14[i] = (int16_t)ADS_Q14(dec->coef[i]);
+		sum_q14 += dec->coef_q14[i];
+	}
+	
+	dec->coef_q14[dec->taps / 2] += (int16_t)((1 << ADS_Q14_SHIFT) - sum_q14);
+}
+
+/**
+ * @brief Takes one Q9.6 sample into the CIC
+ */
+static bool cic_apply(ads_decimator_t * dec, ads_q6_t sample, ads_q6_t * out)
+{
+	uint32_t * integ = dec->acc.cic.integ;
+	uint32_t * comb = dec->acc.cic.comb;
+	uint8_t k;
+	
+	// Integrators at the input rate, wrapping is undone by the combs
+	integ[0] += (uint32_t)(int32_t)sample;
+	
+	for(k = 1; k < dec->taps; k++)
+		integ[k] += integ[k - 1];
+	
+	if(++dec->phase < dec->ratio)
+		return false;
+	
+	dec->phase = 0;
+	
+	// Combs at the output rate
+	uint32_t v = integ[dec->taps - 1];
+	
+	for(k = 0; k < dec->taps; k++)
+	{
+		uint32_t prev = comb[k];
+		
+		comb[k] = v;
+		v -= prev;
+	}
+	
+	// Divided by the gain, ratio^order, rounding to nearest. The rounding
+	// can take a full scale output past 32 bits
+	int64_t gain = 1;
+	
+	for(k = 0; k < dec->taps; k++)
+		gain *= dec->ratio;
+	
+	int64_t value = (int32_t)v;
+	
+	*out = (ads_q6_t)((value >= 0) ? (value + gain / 2) / gain : (value - gain / 2) / gain);
+	
+	return true;
+}
+
+/**
+ * @brief Settles the CIC at sample, one output per stage through it
+ */
+static void cic_settle(ads_decimator_t * dec, ads_q6_t sample)
+{
+	ads_q6_t out;
+	uint16_t i;
+	
+	memset(&dec->acc, 0, sizeof(dec->acc));
+	dec->phase = 0;
+	
+	for(i = 0; i < (uint16_t)dec->taps * dec->ratio; i++)
+		cic_apply(dec, sample, &out);
+}
+
+/**
+ * @brief Initializes a decimator. A decimator takes either float or Q9.6
+ *			samples, not both.
+ *
+ * @param dec			Decimator
+ * @param type			ADS_DECIMATE_FIR or ADS_DECIMATE_CIC
+ * @param ratio			Input samples per output sample, 2 or more
+ * @param taps			FIR taps, 1 to ADS_DECIMATE_MAX_TAPS, more for a
+ *						sharper cutoff, e.g. 8 * ratio + 1. CIC order, 1 to
+ *						ADS_DECIMATE_MAX_CIC_ORDER, with ratio^order at most 2^16
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_decimator_init(ads_decimator_t * dec, ADS_DECIMATE_TYPE_T type, uint8_t ratio, uint8_t taps)
+{
+	uint32_t gain = 1;
+	uint8_t k;
+	
+	if(ratio < 2 || taps == 0)
+		return ADS_ERR_BAD_PARAM;
+	
+	if(type == ADS_DECIMATE_FIR)
+	{
+		if(taps > ADS_DECIMATE_MAX_TAPS)
+			return ADS_ERR_BAD_PARAM;
+	}
+	else if(type == ADS_DECIMATE_CIC)
+	{
+		if(taps > ADS_DECIMATE_MAX_CIC_ORDER)
+			return ADS_ERR_BAD_PARAM;
+		
+		// The output must fit 32 bits with a 16 bit input
+		for(k = 0; k < taps; k++)
+			gain *= ratio;
+		
+		if(gain > 65536)
+			return ADS_ERR_BAD_PARAM;
+	}
+	else
+	{
+		return ADS_ERR_BAD_PARAM;
+	}
+	
+	memset(dec, 0, sizeof(*dec));
+	
+	dec->type = type;
+	dec->ratio = ratio;
+	dec->taps = taps;
+	dec->sums = (taps + ratio - 1) / ratio;
+	
+	if(type == ADS_DECIMATE_FIR)
+		fir_design(dec);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Clears the state, the next input settles it again
+ *
+ * @param dec			Decimator
+ */
+void ads_decimator_reset(ads_decimator_t * dec)
+{
+	memset(&dec->acc, 0, sizeof(dec->acc));
+	
+	dec->phase = 0;
+	dec->settled = false;
+}
+
+/**
+ * @brief Takes one sample. The first sample settles the state, so the output
+ *			starts there instead of rising from 0.
+ *
+ * @param dec			Decimator
+ * @param sample		New input sample
+ * @param out[out]		Output sample, set when true is returned
+ * @return	true every ratio'th input, when an output sample is ready
+ */
+bool ads_decimator_apply(ads_decimator_t * dec, float sample, float * out)
+{
+	uint16_t i, tap;
+	
+	// The CIC only runs on integers, its sums grow without bound
+	if(dec->type == ADS_DECIMATE_CIC)
+	{
+		ads_q6_t out_q6;
+		
+		if(!ads_decimator_apply_q6(dec, ads_float_to_q6(sample), &out_q6))
+			return false;
+		
+		*out = ads_q6_to_float(out_q6);
+		
+		return true;
+	}
+	
+	// Outputs in progress hold the taps of every earlier input, as if the
+	// first sample had always been the input
+	if(!dec->settled)
+	{
+		for(i = 0; i < dec->sums; i++)
+		{
+			dec->acc.f[i] = 0;
+			
+			for(tap = (i + 1) * dec->ratio; tap < dec->taps; tap++)
+				dec->acc.f[i] += dec->coef[tap] * sample;
+		}
+		
+		dec->settled = true;
+	}
+	
+	// Polyphase, the input meets one tap of each output it is part of
+	for(i = 0, tap = dec->ratio - 1 - dec->phase; tap < dec->taps; i++, tap += dec->ratio)
+		dec->acc.f[i] += dec->coef[tap] * sample;
+	
+	if(++dec->phase < dec->ratio)
+		return false;
+	
+	*out = dec->acc.f[0];
+	
+	for(i = 1; i < dec->sums; i++)
+		dec->acc.f[i - 1] = dec->acc.f[i];
+	
+	dec->acc.f[dec->sums - 1] = 0;
+	dec->phase = 0;
+	
+	return true;
+}
+
+/**
+ * @brief Takes one Q9.6 sample, without floating point
+ *
+ * @param dec			Decimator
+ * @param sample		New input sample
+ * @param out[out]		Output sample, set when true is returned
+ * @return	true every ratio'th input, when an output sample is ready
+ */
+bool ads_decimator_apply_q6(ads_decimator_t * dec, ads_q6_t sample, ads_q6_t * out)
+{
+	uint16_t i, tap;
+	
+	if(dec->type == ADS_DECIMATE_CIC)
+	{
+		if(!dec->settled)
+		{
+			cic_settle(dec, sample);
+			dec->settled = true;
+		}
+		
+		return cic_apply(dec, sample, out);
+	}
+	
+	if(!dec->settled)
+	{
+		for(i = 0; i < dec->sums; i++)
+		{
+			dec->acc.q[i] = 0;
+			
+			for(tap = (i + 1) * dec->ratio; tap < dec->taps; tap++)
+				dec->acc.q[i] += (int32_t)dec->coef_q14[tap] * sample;
+		}
+		
+		dec->settled = true;
+	}
+	
+	for(i = 0, tap = dec->ratio - 1 - dec->phase; tap < dec->taps; i++, tap += dec->ratio)
+		dec->acc.q[i] += (int32_t)dec->coef_q14[tap] * sample;
+	
+	if(++dec->phase < dec->ratio)
+		return false;
+	
+	// Arithmetic shift rounds toward -inf, half added first rounds to nearest
+	int32_t value = (dec->acc.q[0] + (1 << (ADS_Q14_SHIFT - 1))) >> ADS_Q14_SHIFT;
+	
+	if(value > 32767)
+		value = 32767;
+	else if(value < -32768)
+		value = -32768;
+	
+	*out = (ads_q6_t)value;
+	
+	for(i = 1; i < dec->sums; i++)
+		dec->acc.q[i - 1] = dec->acc.q[i];
+	
+	dec->acc.q[dec->sums - 1] = 0;
+	dec->phase = 0;
+	
+	return true;
+}
+
+/**
+ * @brief Group delay of the decimator, the age of the input an output
+ *			sample is centered on when it is returned
+ *
+ * @param dec			Decimator
+ * @return	delay in input samples, (taps - 1) / 2 for the FIR,
+ *			order * (ratio - 1) / 2 for the CIC
+ */
+float ads_decimator_delay(const ads_decimator_t * dec)
+{
+	if(dec->type == ADS_DECIMATE_CIC)
+		return dec->taps * (dec->ratio - 1) * 0.5f;
+	
+	return (dec->taps - 1) * 0.5f;
+}
+
+/**
+ * @brief Group delay of the decimator in time
+ *
+ * @param dec			Decimator
+ * @param period_us		Input sample period, e.g. dev->sample_period_us
+ * @return	delay in microseconds
+ */
+uint32_t ads_decimator_delay_us(const ads_decimator_t * dec, uint32_t period_us)
+{
+	return (uint32_t)(ads_decimator_delay(dec) * period_us + 0.5f);
+}
+
+static bool decimator_process(ads_stage_t * stage, float * sample)
+{
+	ads_stage_decimator_t * s = (ads_stage_decimator_t *)stage;
+	
+	return ads_decimator_apply(&s->dec, *sample, sample);
+}
+
+/**
+ * @brief Decimation stage, around stage->dec initialized with ads_decimator_init
+ *
+ * @param stage			Stage
+ * @return	&stage->stage, for ads_pipeline_add
+ */
+ads_stage_t * ads_stage_decimator(ads_stage_decimator_t * stage)
+{
+	memset(&stage->stage, 0, sizeof(stage->stage));
+	
+	stage->stage.process = decimator_process;
+	
+	return &stage->stage;
+}
@@ -0,0 +1,144 @@
+/**
+ * ads_decimate.h
+ *
+ * Anti-aliased decimation, to sample the ADS fast for low noise and latency,
+ * e.g. at ADS_500_HZ, and pass on every ratio'th sample, e.g. at 50 Hz.
+ * Keeping one sample of ratio folds everything above the output Nyquist
+ * frequency back into the band; these decimators filter it out first.
+ *
+ * The FIR decimator is a windowed sinc low pass in polyphase form: each
+ * input is multiplied only by the taps of the outputs it contributes to,
+ * taps / ratio multiplies per input, spread evenly over the inputs instead
+ * of a burst at each output. The CIC decimator needs no multiplies at all,
+ * at the cost of droop in the pass band, for targets without a fast
+ * multiplier. Both have a floating point path and an integer path for the
+ * Q9.6 samples of ads_fixed.h, and report their group delay.
+ */
+
+#ifndef ADS_DECIMATE_H_
+#define ADS_DECIMATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ads.h"
+#include "ads_fixed.h"
+#include "ads_pipeline.h"
+
+/* Longest FIR decimator */
+#ifndef ADS_DECIMATE_MAX_TAPS
+#define ADS_DECIMATE_MAX_TAPS		(48)
+#endif
+
+/* Highest CIC order, ratio^order must stay within 2^16 */
+#define ADS_DECIMATE_MAX_CIC_ORDER	(4)
+
+/* FIR cutoff as a fraction of the output Nyquist frequency, -6 dB */
+#ifndef ADS_DECIMATE_CUTOFF
+#define ADS_DECIMATE_CUTOFF			(0.8f)
+#endif
+
+/* Decimator type */
+typedef enum {
+	ADS_DECIMATE_FIR = 0,				// Windowed sinc low pass, polyphase
+	ADS_DECIMATE_CIC					// Cascaded integrator comb, no multiplies
+} ADS_DECIMATE_TYPE_T;
+
+typedef struct {
+	uint8_t type;						// ADS_DECIMATE_TYPE_T
+	uint8_t ratio;						// Input samples per output sample
+	uint8_t taps;						// FIR taps, or CIC order
+	uint8_t sums;						// FIR outputs in progress, taps / ratio rounded up
+	uint8_t phase;						// Input samples since the last output
+	bool settled;						// State settled, at the first input
+
+	/* FIR coefficients, unity gain at DC */
+	float coef[ADS_DECIMATE_MAX_TAPS];
+	int16_t coef_q14[ADS_DECIMATE_MAX_TAPS];	// Q2.14, integer path
+
+	union {
+		float f[ADS_DECIMATE_MAX_TAPS];		// FIR outputs in progress, the next first
+		int32_t q[ADS_DECIMATE_MAX_TAPS];	// The same scaled by 2^14, integer path
+		struct {
+			uint32_t integ[ADS_DECIMATE_MAX_CIC_ORDER];	// Integrators, wrapping
+			uint32_t comb[ADS_DECIMATE_MAX_CIC_ORDER];	// Comb delays
+		} cic;
+	} acc;
+} ads_decimator_t;
+
+/* Pipeline stage, initialize dec with ads_decimator_init */
+typedef struct {
+	ads_stage_t stage;
+	ads_decimator_t dec;
+} ads_stage_decimator_t;
+
+/**
+ * @brief Initializes a decimator. A decimator takes either float or Q9.6
+ *			samples, not both.
+ *
+ * @param dec			Decimator
+ * @param type			ADS_DECIMATE_FIR or ADS_DECIMATE_CIC
+ * @param ratio			Input samples per output sample, 2 or more
+ * @param taps			FIR taps, 1 to ADS_DECIMATE_MAX_TAPS, more for a
+ *						sharper cutoff, e.g. 8 * ratio + 1. CIC order, 1 to
+ *						ADS_DECIMATE_MAX_CIC_ORDER, with ratio^order at most 2^16
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_decimator_init(ads_decimator_t * dec, ADS_DECIMATE_TYPE_T type, uint8_t ratio, uint8_t taps);
+
+/**
+ * @brief Clears the state, the next input settles it again
+ *
+ * @param dec			Decimator
+ */
+void ads_decimator_reset(ads_decimator_t * dec);
+
+/**
+ * @brief Takes one sample. The first sample settles the state, so the output
+ *			starts there instead of rising from 0.
+ *
+ * @param dec			Decimator
+ * @param sample		New input sample
+ * @param out[out]		Output sample, set when true is returned
+ * @return	true every ratio'th input, when an output sample is ready
+ */
+bool ads_decimator_apply(ads_decimator_t * dec, float sample, float * out);
+
+/**
+ * @brief Takes one Q9.6 sample, without floating point
+ *
+ * @param dec			Decimator
+ * @param sample		New input sample
+ * @param out[out]		Output sample, set when true is returned
+ * @return	true every ratio'th input, when an output sample is ready
+ */
+bool ads_decimator_apply_q6(ads_decimator_t * dec, ads_q6_t sample, ads_q6_t * out);
+
+/**
+ * @brief Group delay of the decimator, the age of the input an output
+ *			sample is centered on when it is returned
+ *
+ * @param dec			Decimator
+ * @return	delay in input samples, (taps - 1) / 2 for the FIR,
+ *			order * (ratio - 1) / 2 for the CIC
+ */
+float ads_decimator_delay(const ads_decimator_t * dec);
+
+/**
+ * @brief Group delay of the decimator in time
+ *
+ * @param dec			Decimator
+ * @param period_us		Input sample period, e.g. dev->sample_period_us
+ * @return	delay in microseconds
+ */
+uint32_t ads_decimator_delay_us(const ads_decimator_t * dec, uint32_t period_us);
+
+/**
+ * @brief Decimation stage, around stage->dec initialized with ads_decimator_init
+ *
+ * @param stage			Stage
+ * @return	&stage->stage, for ads_pipeline_add
+ */
+ads_stage_t * ads_stage_decimator(ads_stage_decimator_t * stage);
+
+#endif /* ADS_DECIMATE_H_ */
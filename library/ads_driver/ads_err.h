@@ -15,6 +15,8 @@
 #define ADS_ERR_IO             (-4) /**< Error communicating with ads */
 #define ADS_ERR_DEV_ID         (-5) /**< Device ID does not match expected ID */
 #define ADS_ERR_TIMEOUT        (-6) /**< Operation timed out */
+#define ADS_ERR_CRC            (-7) /**< Firmware image does not match its CRC */
+#define ADS_ERR_NACK_DATA      (-8) /**< Write not acknowledged after its address, partly taken */
 
 
 #endif /* ADS_ERR_ */
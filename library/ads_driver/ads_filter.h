@@ -0,0 +1,176 @@
+/**
+ * ads_filter.h
+ *
+ * Butterworth low and high pass filters of any order up to
+ * ADS_FILTER_MAX_ORDER, as cascaded biquads designed for the sample rate of
+ * the ADS. A filter bound to a device follows dev->sample_period_us and is
+ * designed again when ads_set_sample_rate changes the rate, so its cutoff
+ * holds at any ADS_SPS_T. Fixed configurations can be designed by the
+ * compiler with ADS_FILTER_LOWPASS_BIQUAD and ADS_FILTER_HIGHPASS_BIQUAD.
+ */
+
+#ifndef ADS_FILTER_H_
+#define ADS_FILTER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "ads.h"
+
+/* Biquads per filter, each adds two to the order */
+#ifndef ADS_FILTER_MAX_STAGES
+#define ADS_FILTER_MAX_STAGES		(4)
+#endif
+
+#define ADS_FILTER_MAX_ORDER		(2 * ADS_FILTER_MAX_STAGES)
+
+/* Highest cutoff as a fraction of the sample rate, higher cutoffs are designed here */
+#define ADS_FILTER_MAX_CUTOFF		(0.45f)
+
+/* Q of a second order Butterworth section */
+#define ADS_FILTER_Q_BUTTERWORTH	(0.7071067811865476)
+
+/*
+ * Second order sections as ads_biquad_t initializers, for a fixed cutoff and
+ * sample rate. GCC folds tan of constant arguments, so with constant
+ * arguments the coefficients are computed at compile time and a static
+ * const initialized with them takes no code, e.g.
+ *	static const ads_biquad_t low_pass = ADS_FILTER_LOWPASS_BIQUAD(20, ADS_SPS_TO_HZ(ADS_100_HZ), ADS_FILTER_Q_BUTTERWORTH);
+ */
+#define ADS_FILTER_LOWPASS_BIQUAD(cutoff_hz, sample_hz, q) \
+	ADS_FILTER_LP_(tan(3.141592653589793 * (cutoff_hz) / (sample_hz)), (q))
+#define ADS_FILTER_HIGHPASS_BIQUAD(cutoff_hz, sample_hz, q) \
+	ADS_FILTER_HP_(tan(3.141592653589793 * (cutoff_hz) / (sample_hz)), (q))
+
+/* Bilinear transform of the sections, k = tan(pi * cutoff / sample rate) */
+#define ADS_FILTER_NORM_(k, q)		(1.0 + (k) / (q) + (k) * (k))
+#define ADS_FILTER_LP_(k, q) { \
+	(float)((k) * (k) / ADS_FILTER_NORM_(k, q)), \
+	(float)(2.0 * (k) * (k) / ADS_FILTER_NORM_(k, q)), \
+	(float)((k) * (k) / ADS_FILTER_NORM_(k, q)), \
+	(float)(2.0 * ((k) * (k) - 1.0) / ADS_FILTER_NORM_(k, q)), \
+	(float)((1.0 - (k) / (q) + (k) * (k)) / ADS_FILTER_NORM_(k, q)) }
+#define ADS_FILTER_HP_(k, q) { \
+	(float)(1.0 / ADS_FILTER_NORM_(k, q)), \
+	(float)(-2.0 / ADS_FILTER_NORM_(k, q)), \
+	(float)(1.0 / ADS_FILTER_NORM_(k, q)), \
+	(float)(2.0 * ((k) * (k) - 1.0) / ADS_FILTER_NORM_(k, q)), \
+	(float)((1.0 - (k) / (q) + (k) * (k)) / ADS_FILTER_NORM_(k, q)) }
+
+/* Filter response */
+typedef enum {
+	ADS_FILTER_LOWPASS = 0,
+	ADS_FILTER_HIGHPASS
+} ADS_FILTER_TYPE_T;
+
+/*
+ * Second order section, a0 = 1
+ *	y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+ * A first order section has b2 = a2 = 0.
+ */
+typedef struct {
+	float b0, b1, b2, a1, a2;
+} ads_biquad_t;
+
+/* Cascade of biquads filtering one channel, bend or stretch */
+typedef struct {
+	/* Design, kept to design the filter again for another rate */
+	uint8_t type;						// ADS_FILTER_TYPE_T
+	uint8_t order;						// Butterworth order, 0 for fixed coefficients
+	float cutoff_hz;					// Cutoff frequency, -3 dB
+	ads_dev_t * dev;					// Device whose sample rate is followed, NULL for a fixed rate
+	uint32_t period_us;					// Sample period the coefficients are designed for, 0 if unknown
+
+	/* Cascade, transposed direct form II */
+	uint8_t stages;						// Biquads in use, 0 passes samples through
+	ads_biquad_t coef[ADS_FILTER_MAX_STAGES];
+	float z[ADS_FILTER_MAX_STAGES][2];	// State of each biquad
+	float last;							// Last input, the state is settled at after a redesign
+	bool settled;						// State settled, at the first input unless ads_filter_reset
+} ads_filter_t;
+
+/**
+ * @brief Designs a Butterworth filter as cascaded biquads, the first order
+ *			section of an odd order last
+ *
+ * @param type			ADS_FILTER_LOWPASS or ADS_FILTER_HIGHPASS
+ * @param order			Filter order, 1 to ADS_FILTER_MAX_ORDER
+ * @param cutoff_hz		Cutoff frequency, limited to ADS_FILTER_MAX_CUTOFF * sample_hz
+ * @param sample_hz		Sample rate
+ * @param coef[out]		Biquads, (order + 1) / 2 of them
+ * @return	Number of biquads designed, 0 if a parameter is out of range
+ */
+uint8_t ads_filter_design(ADS_FILTER_TYPE_T type, uint8_t order, float cutoff_hz, float sample_hz, ads_biquad_t * coef);
+
+/**
+ * @brief Initializes a filter for a fixed sample rate
+ *
+ * @param filter		Filter
+ * @param type			ADS_FILTER_LOWPASS or ADS_FILTER_HIGHPASS
+ * @param order			Filter order, 1 to ADS_FILTER_MAX_ORDER
+ * @param cutoff_hz		Cutoff frequency
+ * @param sample_hz		Sample rate, e.g. the polling rate in polled mode
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_filter_init(ads_filter_t * filter, ADS_FILTER_TYPE_T type, uint8_t order, float cutoff_hz, float sample_hz);
+
+/**
+ * @brief Initializes a filter following the sample rate of a device in
+ *			interrupt mode. The filter is designed for dev->sample_period_us,
+ *			and again by ads_filter_apply when ads_set_sample_rate changes it.
+ *			Samples pass through until the device has a sample rate.
+ *
+ * @param filter		Filter
+ * @param type			ADS_FILTER_LOWPASS or ADS_FILTER_HIGHPASS
+ * @param order			Filter order, 1 to ADS_FILTER_MAX_ORDER
+ * @param cutoff_hz		Cutoff frequency
+ * @param dev			ADS device
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_filter_init_dev(ads_filter_t * filter, ADS_FILTER_TYPE_T type, uint8_t order, float cutoff_hz, ads_dev_t * dev);
+
+/**
+ * @brief Initializes a filter with fixed coefficients, e.g. made with
+ *			ADS_FILTER_LOWPASS_BIQUAD
+ *
+ * @param filter		Filter
+ * @param coef[in]		Biquads, copied
+ * @param stages		Number of biquads, 1 to ADS_FILTER_MAX_STAGES
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if stages is out of range
+ */
+int ads_filter_init_biquads(ads_filter_t * filter, const ads_biquad_t * coef, uint8_t stages);
+
+/**
+ * @brief Designs the filter again for another sample rate and stops
+ *			following the device, if any. The state is settled at the last
+ *			input, so the output does not jump.
+ *
+ * @param filter		Filter, initialized with ads_filter_init or ads_filter_init_dev
+ * @param sample_hz		Sample rate
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the filter has fixed
+ *			coefficients or sample_hz is not positive
+ */
+int ads_filter_set_rate(ads_filter_t * filter, float sample_hz);
+
+/**
+ * @brief Settles the filter as if value had been its input forever
+ *
+ * @param filter		Filter
+ * @param value			Constant input
+ */
+void ads_filter_reset(ads_filter_t * filter, float value);
+
+/**
+ * @brief Filters one sample. The first sample settles the state, so the
+ *			output starts there instead of rising from 0. A filter following
+ *			a device whose sample rate changed is designed again first, in
+ *			the caller's context.
+ *
+ * @param filter		Filter
+ * @param sample		New input sample
+ * @return	filtered sample
+ */
+float ads_filter_apply(ads_filter_t * filter, float sample);
+
+#endif /* ADS_FILTER_H_ */
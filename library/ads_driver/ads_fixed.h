@@ -0,0 +1,126 @@
+/**
+ * ads_fixed.h
+ *
+ * Q9.6 fixed point sample helpers and filters, for targets without a fast
+ * floating point unit. Samples stay ads_q6_t from the ADS to the consumer
+ * and are converted to float only where the application asks for it.
+ */
+
+#ifndef ADS_FIXED_H_
+#define ADS_FIXED_H_
+
+#include <stdint.h>
+#include "ads_dev.h"
+
+#define ADS_Q6_SHIFT			(6)
+#define ADS_Q6_ONE				(1 << ADS_Q6_SHIFT)		// 1 degree or 1 mm
+
+/* Filter coefficient in Q2.14, for literal constants, e.g. ADS_Q14(0.2065f) */
+#define ADS_Q14_SHIFT			(14)
+#define ADS_Q14(x)				((int32_t)((x) * (1 << ADS_Q14_SHIFT) + ((x) >= 0 ? 0.5f : -0.5f)))
+
+/**
+ * @brief Converts a fixed point sample to degrees or mm
+ */
+static inline float ads_q6_to_float(ads_q6_t sample)
+{
+	return (float)sample * (1.0f/ADS_Q6_ONE);
+}
+
+/**
+ * @brief Converts degrees or mm to a fixed point sample, saturating
+ */
+static inline ads_q6_t ads_float_to_q6(float value)
+{
+	float scaled = value * ADS_Q6_ONE;
+	
+	if(scaled >= 32767.0f)
+		return 32767;
+	if(scaled <= -32768.0f)
+		return -32768;
+	
+	return (ads_q6_t)(scaled + (scaled >= 0 ? 0.5f : -0.5f));
+}
+
+/*
+ * Second order IIR filter, direct form I, with Q2.14 coefficients and first
+ * order error feedback to hold the truncation error below 1 LSB.
+ *	y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+ * The 32 bit accumulator holds for |sample| * sum(|coefficients|) < 2^17,
+ * e.g. any low pass section over the +/-360 degree range of the ADS.
+ */
+typedef struct {
+	int32_t b0, b1, b2, a1, a2;			// Q2.14 coefficients, see ADS_Q14
+	ads_q6_t x1, x2, y1, y2;			// Filter history
+	int32_t err;						// Truncated fraction carried to the next sample
+} ads_q6_biquad_t;
+
+/**
+ * @brief Sets the coefficients of a biquad and clears its history
+ *
+ * @param filter		Biquad to initialize
+ * @param b0,b1,b2		Feed forward coefficients in Q2.14
+ * @param a1,a2			Feedback coefficients in Q2.14, a0 = 1
+ */
+static inline void ads_q6_biquad_init(ads_q6_biquad_t * filter, int32_t b0, int32_t b1, int32_t b2, int32_t a1, int32_t a2)
+{
+	filter->b0 = b0;
+	filter->b1 = b1;
+	filter->b2 = b2;
+	filter->a1 = a1;
+	filter->a2 = a2;
+	filter->x1 = filter->x2 = filter->y1 = filter->y2 = 0;
+	filter->err = 0;
+}
+
+/**
+ * @brief Filters one sample
+ *
+ * @param filter		Biquad
+ * @param sample		New input sample
+ * @return	filtered sample
+ */
+static inline ads_q6_t ads_q6_biquad(ads_q6_biquad_t * filter, ads_q6_t sample)
+{
+	int32_t acc = filter->err;
+	
+	acc += filter->b0 * sample + filter->b1 * filter->x1 + filter->b2 * filter->x2;
+	acc -= filter->a1 * filter->y1 + filter->a2 * filter->y2;
+	
+	// Arithmetic shift rounds toward -inf, the remainder is always positive
+	int32_t out = acc >> ADS_Q14_SHIFT;
+	filter->err = acc - (out << ADS_Q14_SHIFT);
+	
+	if(out > 32767)
+		out = 32767;
+	else if(out < -32768)
+		out = -32768;
+	
+	filter->x2 = filter->x1;
+	filter->x1 = sample;
+	filter->y2 = filter->y1;
+	filter->y1 = (ads_q6_t)out;
+	
+	return (ads_q6_t)out;
+}
+
+/**
+ * @brief Dead zone filter. Returns the previous output unless the sample
+ *			moved more than dead_zone away from it. Removes jitter.
+ *
+ * @param prev[in,out]	Previous output, updated
+ * @param sample		New input sample
+ * @param dead_zone		Width of the dead zone, e.g. ADS_Q6_ONE * 3 / 4
+ * @return	filtered sample
+ */
+static inline ads_q6_t ads_q6_deadzone(ads_q6_t * prev, ads_q6_t sample, ads_q6_t dead_zone)
+{
+	int32_t diff = (int32_t)sample - *prev;
+	
+	if(diff > dead_zone || diff < -dead_zone)
+		*prev = sample;
+	
+	return *prev;
+}
+
+#endif /* ADS_FIXED_H_ */
@@ -0,0 +1,333 @@
+/**
+ * ads_fleet.cpp
+ *
+ * Firmware update of many ADS sensors, see ads_fleet.h
+ */
+
+#include "ads_fleet.h"
+
+/**
+ * @brief Microsecond delay of any length.
+ */
+static void ads_fleet_delay_us(uint32_t delay_us)
+{
+	if(delay_us >= 1000)
+		ads_hal_delay((uint16_t)(delay_us / 1000));
+	
+	ads_hal_delay_us((uint16_t)(delay_us % 1000));
+}
+
+/**
+ * @brief Packet callback of the devices while held by the fleet.
+ */
+static void ads_fleet_read_callback(ads_dev_t * dev, uint8_t * buffer)
+{
+	(void)dev;
+	(void)buffer;
+}
+
+/**
+ * @brief Ends the update of the device a bus is on and holds it in reset
+ *			(internal function).
+ */
+static void ads_fleet_finish(ads_fleet_t * fleet, ads_fleet_bus_t * bus, ADS_FLEET_STATUS_T status, int error)
+{
+	ads_fleet_entry_t * entry = &fleet->entries[bus->index];
+
+	entry->status = status;
+	entry->error = error;
+	entry->time_us = ads_hal_micros() - bus->step_us;
+
+	ads_hal_hold_reset(entry->dev, true);
+
+	bus->index++;
+	bus->step = ADS_FLEET_NEXT;
+}
+
+/**
+ * @brief Advances the update of the device a bus is on.
+ *
+ * @param wait_us[out]	Time until the bus has work to do
+ * @return	true while the bus has devices left
+ */
+static bool ads_fleet_step(ads_fleet_t * fleet, ads_fleet_bus_t * bus, uint32_t * wait_us)
+{
+	ads_fleet_entry_t * entry;
+	ads_dev_t * dev;
+	int ret_val;
+
+	*wait_us = 0;
+
+	if(bus->step == ADS_FLEET_NEXT)
+	{
+		// Next device of this bus, in the order of the entries
+		while(bus->index < fleet->count && fleet->entries[bus->index].dev->bus != bus->bus)
+			bus->index++;
+
+		if(bus->index == fleet->count)
+		{
+			bus->step = ADS_FLEET_DONE;
+			return false;
+		}
+
+		entry = &fleet->entries[bus->index];
+		entry->status = ADS_FLEET_BUSY;
+
+		// The only device of the bus out of reset
+		ads_hal_hold_reset(entry->dev, false);
+
+		bus->step = ADS_FLEET_BOOT;
+		bus->step_us = bus->due_us = ads_hal_micros();
+		return true;
+	}
+
+	if(bus->step == ADS_FLEET_DONE)
+		return false;
+
+	entry = &fleet->entries[bus->index];
+	dev = entry->dev;
+
+	if(bus->step == ADS_FLEET_UPDATE)
+	{
+		ret_val = ads_dfu_step(dev, &bus->dfu, wait_us);
+
+		if(ret_val == ADS_OK)
+		{
+			// The new application boots after the last page
+			bus->step = ADS_FLEET_REBOOT;
+			bus->due_us = ads_hal_micros();
+		}
+		else if(ret_val != ADS_ERR_OP_IN_PROGRESS)
+			ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ret_val);
+
+		return true;
+	}
+
+	if((int32_t)(ads_hal_micros() - bus->due_us) < 0)
+	{
+		*wait_us = bus->due_us - ads_hal_micros();
+		return true;
+	}
+
+	if(bus->step == ADS_FLEET_BOOTLOADER)
+	{
+		bus->step = ADS_FLEET_UPDATE;
+		return true;
+	}
+
+	// Booting, the application or the new one after the update
+	ADS_DEV_TYPE_T dev_type;
+
+	if(ads_get_dev_type(dev, &dev_type) != ADS_OK)
+	{
+		if(ads_hal_micros() - bus->due_us >= ADS_INIT_TIMEOUT_MS * 1000UL)
+			ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ADS_ERR_TIMEOUT);
+		else
+			*wait_us = ADS_INIT_PROBE_MS * 1000UL;
+
+		return true;
+	}
+
+	if(bus->step == ADS_FLEET_BOOT)
+	{
+		entry->dev_type = dev_type;
+
+		if(ads_dfu_get_fw_ver(dev, &entry->fw_before) != ADS_OK)
+		{
+			ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ADS_ERR_IO);
+			return true;
+		}
+
+		entry->fw_after = entry->fw_before;
+
+		// A device type without an image can be neither checked nor updated
+		const ads_fw_image_t * image = fleet->images(dev_type);
+
+		if(image == NULL)
+		{
+			ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ADS_ERR_DEV_ID);
+			return true;
+		}
+
+		if(!fleet->force && !ads_dfu_check_image(dev, image))
+		{
+			ads_fleet_finish(fleet, bus, ADS_FLEET_CURRENT, ADS_OK);
+			return true;
+		}
+
+		// Image checked against its CRC while the application is still intact
+		ads_dfu_lz_t * lz = (fleet->lz != NULL) ? &fleet->lz[bus - fleet->buses] : NULL;
+
+		ret_val = ads_dfu_init_image(&bus->dfu, image, lz);
+		if(ret_val != ADS_OK)
+		{
+			ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ret_val);
+			return true;
+		}
+
+		bus->dfu.progress = fleet->progress;
+
+		if(ads_dfu_reset(dev) != ADS_OK)
+		{
+			ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ADS_ERR_IO);
+			return true;
+		}
+
+		bus->step = ADS_FLEET_BOOTLOADER;
+		bus->due_us = ads_hal_micros() + ADS_FLEET_BOOTLOADER_MS * 1000UL;
+		return true;
+	}
+
+	// Verify the new application is no older than the image
+	if(ads_dfu_get_fw_ver(dev, &entry->fw_after) != ADS_OK)
+		ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ADS_ERR_IO);
+	else if(dev_type != entry->dev_type || ads_dfu_check_image(dev, fleet->images(dev_type)))
+		ads_fleet_finish(fleet, bus, ADS_FLEET_FAILED, ADS_ERR);
+	else
+		ads_fleet_finish(fleet, bus, ADS_FLEET_UPDATED, ADS_OK);
+
+	return true;
+}
+
+/**
+ * @brief Prepares the update of a fleet of devices and holds every device
+ *			in reset. Devices are grouped by dev->bus as set by ads_hal_init,
+ *			NULL being the default bus, the devices of a bus are updated in
+ *			the order of the entries.
+ *
+ * @param fleet			Fleet
+ * @param entries		Devices, with dev, reset_pin and datardy_pin set.
+ *						Must stay valid during the update
+ * @param count			Number of entries
+ * @param images		Image for each device type, see ads_dfu_image
+ * @param lz			Decoders of compressed images, ADS_FLEET_MAX_BUSES of
+ *						them, NULL if the images are raw
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the devices are on more
+ *			than ADS_FLEET_MAX_BUSES buses, or the error of ads_hal_init
+ */
+int ads_fleet_init_images(ads_fleet_t * fleet, ads_fleet_entry_t * entries, uint8_t count,
+						  ads_dfu_image_lookup images, ads_dfu_lz_t * lz)
+{
+	uint8_t i, b;
+
+	memset(fleet, 0, sizeof(*fleet));
+
+	fleet->entries = entries;
+	fleet->count = count;
+	fleet->images = images;
+	fleet->lz = lz;
+
+	for(i = 0; i < count; i++)
+	{
+		ads_fleet_entry_t * entry = &entries[i];
+
+		entry->status = ADS_FLEET_PENDING;
+		entry->error = ADS_OK;
+		entry->dev_type = ADS_DEV_UNKNOWN;
+		entry->fw_before = entry->fw_after = 0;
+		entry->time_us = 0;
+
+		// Before grouping, ads_hal_init replaces a NULL bus with the default
+		int ret_val = ads_hal_init(entry->dev, &ads_fleet_read_callback, entry->reset_pin, entry->datardy_pin);
+
+		if(ret_val != ADS_OK)
+			return ret_val;
+
+		ads_hal_pin_int_enable(entry->dev, false);
+		ads_hal_hold_reset(entry->dev, true);
+
+		for(b = 0; b < fleet->bus_count; b++)
+		{
+			if(fleet->buses[b].bus == entry->dev->bus)
+				break;
+		}
+
+		if(b == fleet->bus_count)
+		{
+			if(b == ADS_FLEET_MAX_BUSES)
+				return ADS_ERR_BAD_PARAM;
+
+			fleet->buses[b].bus = entry->dev->bus;
+			fleet->bus_count++;
+		}
+	}
+
+	fleet->start_us = ads_hal_micros();
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Advances the update of every bus of the fleet without waiting. When
+ *			every device is done all are released from reset, to be
+ *			initialized again with ads_init.
+ *
+ * @param fleet			Fleet, prepared with ads_fleet_init or ads_fleet_init_images
+ * @param wait_us[out]	Time until the next call has work to do
+ * @return	ADS_ERR_OP_IN_PROGRESS while devices are left, ADS_OK if every
+ *			device is up to date, ADS_ERR if any failed or was not reached,
+ *			see the entries
+ */
+int ads_fleet_poll(ads_fleet_t * fleet, uint32_t * wait_us)
+{
+	bool busy = false;
+	uint8_t i;
+
+	*wait_us = 0xFFFFFFFF;
+
+	for(i = 0; i < fleet->bus_count; i++)
+	{
+		uint32_t bus_wait_us;
+
+		if(ads_fleet_step(fleet, &fleet->buses[i], &bus_wait_us))
+		{
+			busy = true;
+
+			if(bus_wait_us < *wait_us)
+				*wait_us = bus_wait_us;
+		}
+	}
+
+	if(busy)
+		return ADS_ERR_OP_IN_PROGRESS;
+
+	*wait_us = 0;
+
+	if(fleet->total_us == 0)
+	{
+		fleet->total_us = ads_hal_micros() - fleet->start_us;
+
+		for(i = 0; i < fleet->count; i++)
+			ads_hal_hold_reset(fleet->entries[i].dev, false);
+	}
+
+	// A device never reached was not updated either
+	for(i = 0; i < fleet->count; i++)
+	{
+		if(fleet->entries[i].status == ADS_FLEET_FAILED || fleet->entries[i].status == ADS_FLEET_PENDING)
+			return ADS_ERR;
+	}
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Updates every device of the fleet, sleeping while no bus has work
+ *			to do. See ads_fleet_poll.
+ *
+ * @param fleet			Fleet, prepared with ads_fleet_init or ads_fleet_init_images
+ * @return	ADS_OK if every device is up to date, ADS_ERR if any failed
+ */
+int ads_fleet_run(ads_fleet_t * fleet)
+{
+	uint32_t wait_us;
+	int ret_val;
+
+	while((ret_val = ads_fleet_poll(fleet, &wait_us)) == ADS_ERR_OP_IN_PROGRESS)
+	{
+		if(wait_us)
+			ads_fleet_delay_us(wait_us);
+	}
+
+	return ret_val;
+}
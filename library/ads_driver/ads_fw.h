@@ -1,5 +1,43 @@
-/* Created by cottley on 4/17/2018. */ #ifndef ADS_FW_#define ADS_FW_
-#include <stdint.h>
-const uint8_t ads_fw_rev = 47;
-const uint8_t ads_fw[] = {0xd0, 0x31, 0x00, 0x20, 0xf9, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0x51, 0x2e, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xed, 0x52, 0x00, 0x00, 0xfd, 0x52, 0x00, 0x00, 0x0d, 0x53, 0x00, 0x00, 0x1d, 0x53, 0x00, 0x00, 0x2d, 0x53, 0x00, 0x00, 0x3d, 0x53, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0x21, 0x25, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0xf5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xb5, 0x06, 0x4c, 0x23, 0x78, 0x00, 0x2b, 0x07, 0xd1, 0x05, 0x4b, 0x00, 0x2b, 0x02, 0xd0, 0x04, 0x48, 0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 0x23, 0x70, 0x10, 0xbd, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x6f, 0x00, 0x00, 0x08, 0x4b, 0x10, 0xb5, 0x00, 0x2b, 0x03, 0xd0, 0x07, 0x49, 0x08, 0x48, 0x00, 0xe0, 0x00, 0xbf, 0x07, 0x48, 0x03, 0x68, 0x00, 0x2b, 0x00, 0xd1, 0x10, 0xbd, 0x06, 0x4b, 0x00, 0x2b, 0xfb, 0xd0, 0x98, 0x47, 0xf9, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x20, 0xb8, 0x6f, 0x00, 0x00, 0xb8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x01, 0x71, 0xc0, 0x21, 0x49, 0x01, 0x00, 0x23, 0x00, 0x22, 0xc1, 0x80, 0x2a, 0x21, 0x02, 0x70, 0x42, 0x70, 0x82, 0x70, 0xc2, 0x70, 0x02, 0x83, 0x02, 0x62, 0xc2, 0x61, 0x03, 0x72, 0x43, 0x72, 0x83, 0x72, 0xc3, 0x72, 0x03, 0x73, 0x43, 0x54, 0x06, 0x39, 0x43, 0x73, 0x83, 0x73, 0xc3, 0x73, 0x02, 0x61, 0x03, 0x75, 0x43, 0x54, 0xc2, 0x84, 0x02, 0x85, 0x43, 0x75, 0x70, 0x47, 0xf0, 0xb5, 0x57, 0x46, 0x45, 0x46, 0xde, 0x46, 0x4e, 0x46, 0xe0, 0xb5, 0x01, 0x60, 0x05, 0x00, 0x08, 0x20, 0x17, 0x00, 0xbc, 0x4a, 0x9d, 0xb0, 0x13, 0x6a, 0x03, 0x43, 0x13, 0x62, 0x0b, 0x78, 0x03, 0x38, 0xdb, 0x07, 0x06, 0xd5, 0x1d, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x0b, 0x78, 0x1c, 0x20, 0x9b, 0x07, 0xf0, 0xd4, 0x7b, 0x78, 0x2b, 0x71, 0x00, 0x2b, 0x04, 0xd1, 0x04, 0x21, 0xaf, 0x4a, 0xd3, 0x69, 0x0b, 0x43, 0xd3, 0x61, 0x00, 0x23, 0x2b, 0x83, 0xab, 0x60, 0xeb, 0x60, 0x2b, 0x61, 0xab, 0x76, 0xeb, 0x76, 0x2b, 0x77, 0xaa, 0x4b, 0x1d, 0x60, 0x2a, 0x23, 0xfa, 0x5c, 0x00, 0x23, 0x00, 0x2a, 0x02, 0xd1, 0x3b, 0x7b, 0x01, 0x32, 0x53, 0x40, 0x6b, 0x77, 0x2b, 0x68, 0x02, 0xaa, 0x01, 0x93, 0x3b, 0x78, 0x11, 0x00, 0x13, 0x70, 0x1e, 0x20, 0xa2, 0x4b, 0x98, 0x47, 0x1e, 0x20, 0xa1, 0x4b, 0x98, 0x47, 0xa1, 0x4b, 0x3c, 0x79, 0x9a, 0x46, 0x19, 0x00, 0xa0, 0x4b, 0x60, 0x22, 0x04, 0xa8, 0x9b, 0x46, 0x98, 0x47, 0x13, 0x2c, 0x0e, 0xd8, 0x08, 0x22, 0x02, 0xab, 0x9b, 0x18, 0xa4, 0x00, 0x18, 0x59, 0x00, 0x23, 0x03, 0xa9, 0x4b, 0x70, 0xcb, 0x70, 0x8b, 0x70, 0x01, 0x33, 0x0b, 0x70, 0xc0, 0xb2, 0x97, 0x4b, 0x98, 0x47, 0xfc, 0x88, 0x60, 0x22, 0x51, 0x46, 0x04, 0xa8, 0xd8, 0x47, 0x13, 0x2c, 0x0e, 0xd8, 0x08, 0x22, 0x02, 0xab, 0x9b, 0x18, 0xa4, 0x00, 0x18, 0x59, 0x00, 0x23, 0x03, 0xa9, 0x4b, 0x70, 0xcb, 0x70, 0x8b, 0x70, 0x01, 0x33, 0x0b, 0x70, 0xc0, 0xb2, 0x8c, 0x4b, 0x98, 0x47, 0x01, 0x23, 0x99, 0x46, 0x8a, 0x4b, 0x00, 0x24, 0x03, 0xae, 0x98, 0x46, 0x02, 0xe0, 0x01, 0x34, 0x14, 0x2c, 0x17, 0xd0, 0x4b, 0x46, 0xa3, 0x40, 0x3a, 0x69, 0x1a, 0x42, 0xf7, 0xd0, 0x51, 0x46, 0x60, 0x22, 0x04, 0xa8, 0xd8, 0x47, 0x08, 0x21, 0x02, 0xaa, 0xa3, 0x00, 0x52, 0x18, 0xd0, 0x58, 0x00, 0x23, 0x73, 0x70, 0xf3, 0x70, 0xb3, 0x70, 0x4b, 0x46, 0xc0, 0xb2, 0x31, 0x00, 0x33, 0x70, 0xc0, 0x47, 0xe4, 0xe7, 0x7b, 0x7b, 0xba, 0x7b, 0x9b, 0x01, 0xd2, 0x01, 0x13, 0x43, 0x01, 0x99, 0xdb, 0xb2, 0x0b, 0x70, 0x3b, 0x7d, 0x7a, 0x78, 0xdb, 0x01, 0x13, 0x43, 0xdb, 0xb2, 0x8b, 0x70, 0xfb, 0x78, 0x34, 0x2b, 0x0f, 0xd8, 0x73, 0x4a, 0x9b, 0x00, 0xd3, 0x58, 0x9f, 0x46, 0x10, 0x20, 0x24, 0x23, 0x10, 0x21, 0x01, 0x9a, 0x13, 0x73, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x7b, 0x7d, 0x3f, 0x2b, 0x22, 0xd9, 0x17, 0x20, 0x53, 0xe7, 0x10, 0x20, 0x12, 0x23, 0x10, 0x21, 0xf0, 0xe7, 0x30, 0x20, 0x00, 0x23, 0x30, 0x21, 0xec, 0xe7, 0x00, 0x20, 0x00, 0x23, 0x00, 0x21, 0xe8, 0xe7, 0x20, 0x20, 0x00, 0x23, 0x20, 0x21, 0xe4, 0xe7, 0x10, 0x20, 0x08, 0x23, 0x10, 0x21, 0xe0, 0xe7, 0x70, 0x23, 0x7a, 0x7a, 0x10, 0x20, 0x12, 0x01, 0x13, 0x40, 0x3a, 0x7a, 0x10, 0x21, 0x13, 0x43, 0xd7, 0xe7, 0x10, 0x20, 0x16, 0x23, 0x10, 0x21, 0xd3, 0xe7, 0xfa, 0x7b, 0xd2, 0x01, 0x13, 0x43, 0x01, 0x9a, 0xdb, 0xb2, 0x53, 0x73, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0xbb, 0x78, 0x01, 0x9c, 0x63, 0x70, 0x24, 0x23, 0x3a, 0x7b, 0xfb, 0x5c, 0x92, 0x00, 0xdb, 0x00, 0x1a, 0x43, 0xfb, 0x7a, 0x13, 0x43, 0xba, 0x7a, 0x52, 0x00, 0x13, 0x43, 0x18, 0x43, 0x60, 0x81, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x3a, 0x8b, 0x00, 0x2a, 0x10, 0xd0, 0x10, 0x29, 0x5c, 0xd0, 0x43, 0xd9, 0x20, 0x29, 0x50, 0xd0, 0x30, 0x29, 0x09, 0xd1, 0xfb, 0x7a, 0x00, 0x2b, 0x00, 0xd0, 0x91, 0xe0, 0xfb, 0x69, 0xff, 0x2b, 0xad, 0xdc, 0x3b, 0x6a, 0xff, 0x2b, 0xaa, 0xdc, 0x01, 0x99, 0x4b, 0x89, 0x1a, 0x43, 0x4a, 0x81, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0xbb, 0x8b, 0x01, 0x9a, 0xd3, 0x81, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x3b, 0x8c, 0x01, 0x9a, 0x13, 0x82, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0xfa, 0x88, 0x3b, 0x79, 0x13, 0x43, 0x01, 0x9a, 0x13, 0x81, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x2a, 0x23, 0x01, 0x9a, 0xfb, 0x5c, 0xd3, 0x70, 0x07, 0x23, 0x13, 0x71, 0x1d, 0x33, 0xfb, 0x5c, 0x00, 0x2b, 0x2d, 0xd1, 0xe0, 0x21, 0x2c, 0x4b, 0xc9, 0x00, 0x1b, 0x68, 0x00, 0x20, 0x1a, 0x02, 0x9b, 0x06, 0x0a, 0x40, 0x5b, 0x0f, 0x13, 0x43, 0x01, 0x9a, 0x93, 0x85, 0xca, 0xe6, 0x00, 0x29, 0xc7, 0xd1, 0xfb, 0x7a, 0x00, 0x2b, 0x5d, 0xd1, 0xfb, 0x69, 0x24, 0x49, 0x8b, 0x42, 0x00, 0xdd, 0x6a, 0xe7, 0x3b, 0x6a, 0x8b, 0x42, 0xbc, 0xdd, 0x17, 0x20, 0xbb, 0xe6, 0xfb, 0x7a, 0x00, 0x2b, 0x61, 0xd1, 0xfb, 0x69, 0x1f, 0x49, 0x8b, 0x42, 0xf3, 0xdd, 0x17, 0x20, 0xb2, 0xe6, 0xfb, 0x7a, 0x00, 0x2b, 0x69, 0xd1, 0xfb, 0x69, 0x1b, 0x49, 0x8b, 0x42, 0xea, 0xdd, 0x17, 0x20, 0xa9, 0xe6, 0xfb, 0x8c, 0x16, 0x4a, 0x93, 0x42, 0x00, 0xd9, 0x4e, 0xe7, 0x01, 0x9a, 0x53, 0x82, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x80, 0x23, 0x3a, 0x8d, 0x1b, 0x01, 0xd3, 0x18, 0x0f, 0x49, 0x9b, 0xb2, 0x8b, 0x42, 0x00, 0xd9, 0x3f, 0xe7, 0x01, 0x9b, 0x9a, 0x82, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0xb6, 0xe7, 0x00, 0x04, 0x00, 0x40, 0x00, 0x14, 0x00, 0x40, 0x74, 0x01, 0x00, 0x20, 0xf9, 0x59, 0x00, 0x00, 0x39, 0x5a, 0x00, 0x00, 0xec, 0x6c, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0xf5, 0x5a, 0x00, 0x00, 0x18, 0x6c, 0x00, 0x00, 0x20, 0x60, 0x80, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfb, 0x69, 0x19, 0x00, 0x80, 0x31, 0xff, 0x29, 0x00, 0xd9, 0x18, 0xe7, 0x39, 0x6a, 0x80, 0x31, 0xff, 0x29, 0x00, 0xd8, 0x63, 0xe7, 0x17, 0x20, 0x67, 0xe6, 0x80, 0x21, 0xfb, 0x69, 0x09, 0x01, 0x18, 0x48, 0x59, 0x18, 0x81, 0x42, 0x00, 0xd9, 0x09, 0xe7, 0x80, 0x24, 0x24, 0x01, 0xa4, 0x46, 0x39, 0x6a, 0x61, 0x44, 0x81, 0x42, 0x93, 0xd9, 0x17, 0x20, 0x56, 0xe6, 0x80, 0x21, 0xfb, 0x69, 0x89, 0x00, 0x11, 0x48, 0x59, 0x18, 0x81, 0x42, 0x00, 0xd9, 0xf8, 0xe6, 0x80, 0x24, 0xa4, 0x00, 0xa4, 0x46, 0x39, 0x6a, 0x61, 0x44, 0x81, 0x42, 0x8f, 0xd9, 0x17, 0x20, 0x45, 0xe6, 0x80, 0x21, 0xfb, 0x69, 0x09, 0x02, 0x09, 0x48, 0x59, 0x18, 0x81, 0x42, 0x00, 0xd9, 0xe7, 0xe6, 0x80, 0x24, 0x24, 0x02, 0xa4, 0x46, 0x39, 0x6a, 0x61, 0x44, 0x81, 0x42, 0x00, 0xd8, 0x86, 0xe7, 0x17, 0x20, 0x33, 0xe6, 0xc0, 0x46, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x70, 0xb5, 0x2d, 0x4b, 0x1c, 0x68, 0x01, 0x23, 0x22, 0x68, 0x95, 0x79, 0xed, 0xb2, 0x2b, 0x42, 0x02, 0xd0, 0xe1, 0x7e, 0x0b, 0x42, 0x1c, 0xd1, 0x04, 0x23, 0x2b, 0x42, 0x05, 0xd0, 0x22, 0x68, 0x93, 0x71, 0xe2, 0x7e, 0x02, 0x3b, 0x13, 0x42, 0x0c, 0xd1, 0x02, 0x23, 0x2b, 0x42, 0x08, 0xd0, 0x22, 0x68, 0x93, 0x71, 0xe2, 0x7e, 0x02, 0x33, 0x13, 0x42, 0x02, 0xd0, 0xa2, 0x7e, 0x13, 0x42, 0x2c, 0xd1, 0x70, 0xbd, 0xa2, 0x7e, 0x13, 0x42, 0xef, 0xd0, 0x20, 0x00, 0xe3, 0x68, 0x98, 0x47, 0xeb, 0xe7, 0xa1, 0x7e, 0x0b, 0x42, 0xdf, 0xd0, 0x93, 0x71, 0x61, 0x69, 0x8a, 0x1c, 0x62, 0x61, 0x22, 0x68, 0x92, 0x8c, 0x92, 0xb2, 0x0a, 0x80, 0x22, 0x8b, 0x01, 0x3a, 0x92, 0xb2, 0x22, 0x83, 0x00, 0x2a, 0x17, 0xd0, 0x63, 0x7f, 0x00, 0x2b, 0xce, 0xd0, 0x22, 0x68, 0xd3, 0x79, 0x5b, 0xb2, 0x00, 0x2b, 0xc9, 0xdb, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x02, 0x21, 0x13, 0x7e, 0x0b, 0x43, 0x13, 0x76, 0x22, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0xbd, 0xe7, 0x23, 0x69, 0x20, 0x00, 0x98, 0x47, 0xce, 0xe7, 0x21, 0x7f, 0x05, 0x29, 0xb6, 0xd1, 0x22, 0x77, 0x22, 0x68, 0x20, 0x00, 0x13, 0x71, 0xa3, 0x68, 0x98, 0x47, 0xaf, 0xe7, 0x74, 0x01, 0x00, 0x20, 0x93, 0x1c, 0x9b, 0x00, 0x19, 0x50, 0x01, 0x23, 0x93, 0x40, 0x1a, 0x00, 0x83, 0x7e, 0x13, 0x43, 0x83, 0x76, 0x70, 0x47, 0x10, 0xb5, 0x04, 0x8b, 0x03, 0x00, 0x05, 0x20, 0x00, 0x2c, 0x00, 0xd0, 0x10, 0xbd, 0x1c, 0x7f, 0x05, 0x2c, 0xfb, 0xd0, 0x18, 0x77, 0x1a, 0x83, 0x01, 0x22, 0x59, 0x61, 0x19, 0x68, 0x4a, 0x71, 0x5a, 0x7f, 0x00, 0x2a, 0x01, 0xd1, 0x00, 0x20, 0xf0, 0xe7, 0x1a, 0x68, 0x11, 0x8c, 0x00, 0x29, 0xfc, 0xd1, 0x02, 0x20, 0x11, 0x7e, 0x01, 0x43, 0x11, 0x76, 0x1a, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x00, 0x20, 0xe2, 0xe7, 0xc0, 0x46, 0x00, 0x23, 0x06, 0x22, 0x03, 0x70, 0x42, 0x70, 0x83, 0x70, 0x70, 0x47, 0x80, 0x23, 0x70, 0xb5, 0x15, 0x00, 0x13, 0x4a, 0x01, 0x60, 0x04, 0x00, 0xd0, 0x69, 0x5b, 0x01, 0x03, 0x43, 0xd3, 0x61, 0x0b, 0x78, 0x82, 0xb0, 0x1c, 0x20, 0x9b, 0x07, 0x01, 0xd5, 0x02, 0xb0, 0x70, 0xbd, 0x01, 0x26, 0x0b, 0x78, 0x17, 0x38, 0x1e, 0x40, 0xf8, 0xd1, 0xab, 0x78, 0x01, 0xa9, 0x0b, 0x70, 0x1b, 0x30, 0x08, 0x4b, 0x98, 0x47, 0x20, 0x20, 0x08, 0x4b, 0x98, 0x47, 0x66, 0x71, 0xa6, 0x71, 0x2a, 0x78, 0x6b, 0x78, 0x00, 0x20, 0x13, 0x43, 0x22, 0x68, 0x53, 0x70, 0x6b, 0x78, 0x23, 0x71, 0xe4, 0xe7, 0x00, 0x04, 0x00, 0x40, 0xf9, 0x59, 0x00, 0x00, 0x39, 0x5a, 0x00, 0x00, 0x03, 0x68, 0x9a, 0x68, 0x00, 0x2a, 0xfc, 0xd1, 0x01, 0x21, 0x1a, 0x78, 0x0a, 0x43, 0x1a, 0x70, 0x70, 0x47, 0xc0, 0x46, 0x03, 0x68, 0x9a, 0x68, 0x00, 0x2a, 0xfc, 0xd1, 0x02, 0x21, 0x1a, 0x78, 0x0a, 0x43, 0x1a, 0x70, 0x02, 0x79, 0x06, 0x2a, 0x10, 0xd0, 0x02, 0x22, 0x99, 0x89, 0x0a, 0x42, 0x04, 0xd0, 0x01, 0x21, 0xda, 0x79, 0x11, 0x42, 0xfc, 0xd0, 0x70, 0x47, 0xd9, 0x89, 0x0a, 0x42, 0xfb, 0xd0, 0x02, 0x21, 0xda, 0x79, 0x11, 0x42, 0xfc, 0xd0, 0xf6, 0xe7, 0x04, 0x20, 0x02, 0x49, 0xca, 0x69, 0x02, 0x43, 0xca, 0x61, 0xe8, 0xe7, 0x00, 0x14, 0x00, 0x40, 0x00, 0x23, 0x08, 0x22, 0x03, 0x70, 0x83, 0x70, 0xc3, 0x70, 0x02, 0x33, 0x42, 0x70, 0x03, 0x71, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x23, 0x70, 0xb5, 0x82, 0xb0, 0x0c, 0x00, 0x01, 0xa9, 0x06, 0x00, 0x15, 0x00, 0x4b, 0x70, 0xcb, 0x70, 0x8b, 0x70, 0x00, 0x2c, 0x1c, 0xd0, 0x01, 0x2c, 0x20, 0xd0, 0x6b, 0x78, 0x2a, 0x78, 0x31, 0x68, 0x1a, 0x43, 0xab, 0x78, 0x00, 0x2b, 0x01, 0xd0, 0x40, 0x23, 0x1a, 0x43, 0xeb, 0x78, 0x00, 0x2b, 0x01, 0xd0, 0x80, 0x23, 0x1a, 0x43, 0xf0, 0x20, 0x2b, 0x79, 0x00, 0x01, 0x1b, 0x02, 0x03, 0x40, 0x04, 0x34, 0x13, 0x43, 0x64, 0x00, 0x9b, 0xb2, 0x0c, 0x19, 0xa3, 0x80, 0x02, 0xb0, 0x70, 0xbd, 0x01, 0x33, 0x0b, 0x70, 0x02, 0x20, 0x03, 0x4b, 0x98, 0x47, 0xde, 0xe7, 0x05, 0x20, 0x01, 0x4b, 0x0c, 0x70, 0x98, 0x47, 0xd9, 0xe7, 0xf5, 0x5a, 0x00, 0x00, 0x02, 0x22, 0x4b, 0x00, 0x01, 0x68, 0xc9, 0x18, 0x8b, 0x89, 0x13, 0x43, 0x8b, 0x81, 0x70, 0x47, 0x10, 0xb5, 0x03, 0x68, 0x9c, 0x68, 0x00, 0x2c, 0xfc, 0xd1, 0x40, 0x18, 0x40, 0x79, 0x08, 0x31, 0x49, 0x00, 0x00, 0x28, 0x02, 0xd1, 0xca, 0x52, 0x00, 0x20, 0x10, 0xbd, 0x59, 0x18, 0x8a, 0x80, 0xfa, 0xe7, 0xc0, 0x46, 0x01, 0x00, 0x04, 0x20, 0x10, 0xb5, 0x1b, 0x4a, 0x93, 0x69, 0x03, 0x43, 0x93, 0x61, 0x20, 0x23, 0x19, 0x4a, 0xff, 0x33, 0x13, 0x83, 0x13, 0x7d, 0x01, 0x30, 0xdb, 0x07, 0x00, 0xd4, 0x10, 0xbd, 0xc0, 0x20, 0x0b, 0x78, 0x80, 0x00, 0x1b, 0x02, 0x03, 0x40, 0x1e, 0x20, 0x8c, 0x78, 0x64, 0x00, 0x20, 0x40, 0x80, 0x24, 0x03, 0x43, 0x48, 0x78, 0xe4, 0x02, 0xc0, 0x01, 0x03, 0x43, 0xc8, 0x78, 0x80, 0x04, 0x20, 0x40, 0xc0, 0x24, 0x03, 0x43, 0x08, 0x79, 0xa4, 0x02, 0x00, 0x04, 0x20, 0x40, 0x08, 0x24, 0x03, 0x43, 0x53, 0x60, 0x93, 0x68, 0x08, 0x48, 0x5b, 0x03, 0x5b, 0x0f, 0x9c, 0x40, 0x04, 0x80, 0x93, 0x68, 0x43, 0x80, 0x4b, 0x78, 0x03, 0x71, 0x10, 0x8b, 0xc0, 0x05, 0xc0, 0x0f, 0x00, 0x01, 0xd4, 0xe7, 0x00, 0x04, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x2c, 0x00, 0x00, 0x20, 0x10, 0xb5, 0x24, 0x4a, 0x14, 0x88, 0x53, 0x88, 0x63, 0x43, 0x8b, 0x42, 0x05, 0xd2, 0x80, 0x22, 0x21, 0x4b, 0x92, 0x01, 0xcb, 0x18, 0x93, 0x42, 0x0f, 0xd8, 0x80, 0x22, 0x1f, 0x4b, 0xd2, 0x02, 0x5c, 0x68, 0x22, 0x43, 0x5a, 0x60, 0x20, 0x22, 0xff, 0x32, 0x1a, 0x83, 0x1a, 0x7d, 0xd2, 0x07, 0x0a, 0xd4, 0x5c, 0x60, 0x05, 0x23, 0x18, 0x00, 0x10, 0xbd, 0x19, 0x4a, 0x19, 0x4c, 0x8a, 0x18, 0x18, 0x23, 0xa2, 0x42, 0xf7, 0xd8, 0xe8, 0xe7, 0x45, 0x28, 0x1b, 0xd8, 0x16, 0x4a, 0x83, 0x00, 0xd3, 0x58, 0x9f, 0x46, 0x11, 0x4b, 0x1a, 0x8b, 0xd2, 0x05, 0x17, 0xd4, 0x89, 0x08, 0x49, 0x00, 0xd9, 0x61, 0xa5, 0x23, 0x01, 0x21, 0x1b, 0x02, 0x0c, 0x4a, 0x18, 0x43, 0x10, 0x80, 0x13, 0x7d, 0x19, 0x42, 0xfc, 0xd0, 0x54, 0x60, 0x00, 0x23, 0xdd, 0xe7, 0x89, 0x08, 0x07, 0x4b, 0x49, 0x00, 0xd9, 0x61, 0xee, 0xe7, 0x05, 0x4b, 0x5c, 0x60, 0x17, 0x23, 0xd4, 0xe7, 0x5c, 0x60, 0x10, 0x23, 0xd1, 0xe7, 0xc0, 0x46, 0x2c, 0x00, 0x00, 0x20, 0x00, 0xc0, 0x7f, 0xff, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x4c, 0x6d, 0x00, 0x00, 0xf0, 0xb5, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0xc0, 0xb5, 0x54, 0x4c, 0x82, 0xb0, 0x25, 0x88, 0x63, 0x88, 0x6b, 0x43, 0x83, 0x42, 0x0c, 0xd2, 0x51, 0x4b, 0x52, 0x4e, 0xc3, 0x18, 0xb3, 0x42, 0x3d, 0xd9, 0x18, 0x23, 0x18, 0x00, 0x02, 0xb0, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x00, 0x27, 0x6b, 0x1e, 0x18, 0x42, 0xf3, 0xd1, 0x17, 0x23, 0x95, 0x42, 0xf1, 0xd3, 0x49, 0x4d, 0x12, 0x3b, 0x2e, 0x7d, 0xf6, 0x07, 0xec, 0xd5, 0x01, 0x26, 0x47, 0x4b, 0x2b, 0x80, 0x2b, 0x7d, 0x1e, 0x42, 0xfc, 0xd0, 0x20, 0x23, 0xff, 0x33, 0x2b, 0x83, 0x45, 0x08, 0x00, 0x2a, 0x6b, 0xd0, 0x53, 0x1e, 0x98, 0x46, 0x6b, 0x00, 0x9a, 0x46, 0x00, 0x23, 0x0c, 0xe0, 0x35, 0x1c, 0x6e, 0x46, 0xf5, 0x80, 0xf6, 0x88, 0x55, 0x46, 0x2e, 0x80, 0x02, 0x25, 0xac, 0x46, 0x02, 0x33, 0x9b, 0xb2, 0xe2, 0x44, 0x9a, 0x42, 0x0c, 0xd9, 0xce, 0x5c, 0xb1, 0x46, 0x43, 0x45, 0xee, 0xda, 0x4d, 0x46, 0xce, 0x18, 0x76, 0x78, 0x36, 0x02, 0x35, 0x43, 0x2e, 0x00, 0xeb, 0xe7, 0x01, 0x27, 0xc8, 0xe7, 0x23, 0x79, 0x00, 0x2b, 0x46, 0xd1, 0x3f, 0x2a, 0x44, 0xd8, 0x22, 0x88, 0x63, 0x88, 0x53, 0x43, 0x00, 0x2f, 0x1b, 0xd1, 0x98, 0x42, 0x0a, 0xd9, 0x80, 0x22, 0x2c, 0x4b, 0x92, 0x01, 0xc3, 0x18, 0x93, 0x42, 0x04, 0xd9, 0x26, 0x4b, 0x26, 0x4a, 0xc3, 0x18, 0x93, 0x42, 0xa8, 0xd8, 0x80, 0x22, 0x25, 0x4b, 0xd2, 0x02, 0x5c, 0x68, 0x22, 0x43, 0x5a, 0x60, 0x20, 0x22, 0xff, 0x32, 0x1a, 0x83, 0x1a, 0x7d, 0xd2, 0x07, 0x2d, 0xd4, 0x5c, 0x60, 0x05, 0x23, 0x9a, 0xe7, 0x98, 0x42, 0x0b, 0xd9, 0x80, 0x22, 0x1e, 0x4b, 0x92, 0x01, 0xc3, 0x18, 0x93, 0x42, 0x05, 0xd9, 0x18, 0x4b, 0x18, 0x4a, 0xc3, 0x18, 0x93, 0x42, 0x00, 0xd9, 0x8b, 0xe7, 0x80, 0x22, 0x16, 0x4b, 0xd2, 0x02, 0x5c, 0x68, 0x22, 0x43, 0x5a, 0x60, 0x20, 0x22, 0xff, 0x32, 0x1a, 0x83, 0x1a, 0x7d, 0xd2, 0x07, 0xe2, 0xd5, 0x01, 0x21, 0x80, 0x08, 0x13, 0x4a, 0x40, 0x00, 0xd8, 0x61, 0x1a, 0x80, 0x1a, 0x7d, 0x11, 0x42, 0xfc, 0xd0, 0x5c, 0x60, 0x00, 0x23, 0x74, 0xe7, 0x23, 0x79, 0x00, 0x2b, 0xb5, 0xd0, 0x00, 0x23, 0x6f, 0xe7, 0x01, 0x21, 0x80, 0x08, 0x0b, 0x4a, 0x40, 0x00, 0xd8, 0x61, 0x1a, 0x80, 0x1a, 0x7d, 0x11, 0x42, 0xfc, 0xd0, 0x5c, 0x60, 0xed, 0xe7, 0xc0, 0x46, 0x2c, 0x00, 0x00, 0x20, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x41, 0x44, 0xa5, 0xff, 0xff, 0x00, 0xc0, 0x7f, 0xff, 0x1c, 0xa5, 0xff, 0xff, 0x04, 0xa5, 0xff, 0xff, 0x70, 0xb5, 0x19, 0x4b, 0x1c, 0x88, 0x5b, 0x88, 0x63, 0x43, 0x83, 0x42, 0x07, 0xd2, 0x17, 0x4b, 0x17, 0x4e, 0xc3, 0x18, 0x18, 0x25, 0xb3, 0x42, 0x01, 0xd9, 0x28, 0x00, 0x70, 0xbd, 0x63, 0x1e, 0x18, 0x25, 0x18, 0x42, 0xf9, 0xd1, 0x01, 0x3d, 0x94, 0x42, 0xf6, 0xd3, 0x11, 0x4b, 0x12, 0x3d, 0x1c, 0x7d, 0xe4, 0x07, 0xf1, 0xd5, 0x20, 0x24, 0xff, 0x34, 0x1c, 0x83, 0x40, 0x08, 0x00, 0x2a, 0x0f, 0xd0, 0x00, 0x23, 0x56, 0x1e, 0x40, 0x00, 0x04, 0x88, 0xa4, 0xb2, 0xcc, 0x54, 0xb3, 0x42, 0x02, 0xda, 0xcd, 0x18, 0x24, 0x0a, 0x6c, 0x70, 0x02, 0x33, 0x9b, 0xb2, 0x02, 0x30, 0x9a, 0x42, 0xf2, 0xd8, 0x00, 0x25, 0xd9, 0xe7, 0xc0, 0x46, 0x2c, 0x00, 0x00, 0x20, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x41, 0x10, 0xb5, 0x19, 0x4a, 0x01, 0x00, 0x13, 0x88, 0x52, 0x88, 0x5a, 0x43, 0x82, 0x42, 0x06, 0xd2, 0x16, 0x4a, 0x17, 0x4c, 0x8a, 0x18, 0x18, 0x20, 0xa2, 0x42, 0x21, 0xd9, 0x10, 0xbd, 0x00, 0x22, 0x9b, 0x00, 0x01, 0x3b, 0x18, 0x20, 0x19, 0x42, 0xf8, 0xd1, 0x12, 0x4b, 0x13, 0x38, 0x1c, 0x7d, 0xe4, 0x07, 0xf3, 0xd5, 0x20, 0x20, 0x89, 0x08, 0xff, 0x30, 0x49, 0x00, 0x18, 0x83, 0xd9, 0x61, 0x00, 0x2a, 0x0f, 0xd1, 0x0c, 0x4b, 0x01, 0x21, 0x0a, 0x4a, 0x13, 0x80, 0x13, 0x7d, 0x19, 0x42, 0xfc, 0xd0, 0x1c, 0x20, 0x13, 0x8b, 0x18, 0x40, 0x43, 0x1e, 0x98, 0x41, 0x80, 0x00, 0xdd, 0xe7, 0x01, 0x22, 0xdd, 0xe7, 0x05, 0x4b, 0xee, 0xe7, 0x2c, 0x00, 0x00, 0x20, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x41, 0x02, 0xa5, 0x00, 0x00, 0x1a, 0xa5, 0x00, 0x00, 0x20, 0x22, 0x08, 0x21, 0x10, 0xb5, 0x16, 0x4b, 0xff, 0x32, 0x1a, 0x83, 0x9b, 0x68, 0x19, 0x3a, 0x1c, 0x0c, 0xff, 0x3a, 0x14, 0x40, 0xa1, 0x40, 0x43, 0x80, 0x1b, 0x0d, 0x83, 0x81, 0x11, 0x4b, 0x01, 0x70, 0x1b, 0x88, 0x1b, 0x09, 0x1a, 0x40, 0x07, 0x2a, 0x0f, 0xd0, 0x06, 0x23, 0x9a, 0x1a, 0x02, 0x3b, 0x93, 0x40, 0x07, 0x22, 0x43, 0x60, 0x0a, 0x4b, 0x1b, 0x88, 0x13, 0x40, 0x07, 0x2b, 0x0c, 0xd0, 0xd3, 0x1a, 0x03, 0x3a, 0x9a, 0x40, 0x82, 0x60, 0x10, 0xbd, 0x00, 0x23, 0x07, 0x22, 0x43, 0x60, 0x04, 0x4b, 0x1b, 0x88, 0x13, 0x40, 0x07, 0x2b, 0xf2, 0xd1, 0x00, 0x22, 0xf3, 0xe7, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x80, 0x00, 0x04, 0x21, 0x08, 0x4b, 0x02, 0x68, 0x19, 0x60, 0x01, 0x68, 0x0b, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0x02, 0x21, 0x13, 0x88, 0x0b, 0x43, 0x13, 0x80, 0x02, 0x68, 0x13, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0x70, 0x47, 0xc0, 0x46, 0x00, 0xe1, 0x00, 0xe0, 0x10, 0xb5, 0x80, 0x22, 0x04, 0x24, 0x09, 0x49, 0x03, 0x68, 0x8c, 0x50, 0x01, 0x68, 0x0a, 0x69, 0x00, 0x2a, 0xfc, 0xd1, 0x02, 0x21, 0x06, 0x4a, 0x1a, 0x81, 0x9a, 0x81, 0x1a, 0x88, 0x8a, 0x43, 0x1a, 0x80, 0x02, 0x68, 0x13, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0x10, 0xbd, 0x00, 0xe1, 0x00, 0xe0, 0xff, 0x81, 0xff, 0xff, 0x70, 0xb5, 0x01, 0x60, 0x80, 0x21, 0x03, 0x00, 0x43, 0x48, 0x49, 0x00, 0x44, 0x69, 0x04, 0x25, 0x21, 0x43, 0x41, 0x61, 0x01, 0x20, 0x41, 0x49, 0x41, 0x4c, 0x08, 0x61, 0x80, 0x21, 0x18, 0x68, 0x65, 0x50, 0x1c, 0x68, 0x21, 0x69, 0x00, 0x29, 0xfc, 0xd1, 0x02, 0x24, 0x3d, 0x49, 0x01, 0x81, 0x81, 0x81, 0x01, 0x88, 0xa1, 0x43, 0x01, 0x80, 0x1c, 0x68, 0x21, 0x69, 0x00, 0x29, 0xfc, 0xd1, 0x99, 0x86, 0xd9, 0x86, 0x21, 0x69, 0x00, 0x29, 0xfc, 0xd1, 0x01, 0x24, 0x01, 0x88, 0x21, 0x43, 0x01, 0x80, 0x18, 0x68, 0x01, 0x69, 0x00, 0x29, 0xfc, 0xd1, 0x91, 0x78, 0x19, 0x71, 0x32, 0x49, 0x0b, 0x60, 0x11, 0x79, 0x14, 0x88, 0xc9, 0x03, 0x18, 0x68, 0x21, 0x43, 0x89, 0xb2, 0x01, 0x80, 0x91, 0x78, 0x00, 0x29, 0x20, 0xd0, 0x01, 0x29, 0x01, 0xd0, 0x17, 0x20, 0x70, 0xbd, 0x01, 0x88, 0x89, 0xb2, 0x01, 0x80, 0xd1, 0x78, 0x00, 0x29, 0x39, 0xd1, 0x90, 0x68, 0x19, 0x68, 0x0a, 0x69, 0x00, 0x2a, 0xfc, 0xd1, 0x1a, 0x79, 0x00, 0x2a, 0x08, 0xd0, 0x01, 0x2a, 0x04, 0xd1, 0x08, 0x62, 0x1a, 0x68, 0x13, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0x00, 0x20, 0xe7, 0xe7, 0x1f, 0x4a, 0x90, 0x42, 0xfa, 0xd8, 0x80, 0xb2, 0x08, 0x84, 0xf3, 0xe7, 0x04, 0x24, 0x01, 0x88, 0x21, 0x43, 0x01, 0x80, 0xd1, 0x78, 0x17, 0x20, 0x00, 0x29, 0xd9, 0xd1, 0x00, 0x20, 0x1c, 0x68, 0x17, 0x4e, 0x08, 0x32, 0x15, 0x68, 0x21, 0x69, 0x00, 0x29, 0xfc, 0xd1, 0x19, 0x79, 0x00, 0x29, 0x14, 0xd0, 0x01, 0x29, 0x07, 0xd1, 0x01, 0x00, 0x08, 0x31, 0x89, 0x00, 0x0d, 0x51, 0x1c, 0x68, 0x21, 0x69, 0x00, 0x29, 0xfc, 0xd1, 0x01, 0x30, 0x04, 0x32, 0x02, 0x28, 0xea, 0xd1, 0x00, 0x20, 0xbe, 0xe7, 0x80, 0x24, 0x01, 0x88, 0x21, 0x43, 0x01, 0x80, 0xc0, 0xe7, 0xb5, 0x42, 0xf2, 0xd8, 0x01, 0x00, 0x10, 0x31, 0xad, 0xb2, 0x49, 0x00, 0x0d, 0x53, 0xe8, 0xe7, 0x00, 0x04, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0xe1, 0x00, 0xe0, 0xff, 0x81, 0xff, 0xff, 0x78, 0x01, 0x00, 0x20, 0xff, 0xff, 0x00, 0x00, 0x10, 0xb5, 0x02, 0x68, 0x13, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0x03, 0x79, 0x00, 0x2b, 0x0a, 0xd0, 0x01, 0x2b, 0x02, 0xd0, 0x17, 0x23, 0x18, 0x00, 0x10, 0xbd, 0x91, 0x61, 0x02, 0x68, 0x13, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0xf7, 0xe7, 0x03, 0x4c, 0x17, 0x23, 0xa1, 0x42, 0xf3, 0xd8, 0x89, 0xb2, 0x11, 0x83, 0xf3, 0xe7, 0xff, 0xff, 0x00, 0x00, 0x30, 0xb5, 0x04, 0x68, 0x23, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0x03, 0x79, 0x00, 0x2b, 0x0f, 0xd0, 0x01, 0x2b, 0x02, 0xd0, 0x1a, 0x23, 0x18, 0x00, 0x30, 0xbd, 0x16, 0x33, 0x01, 0x2a, 0xfa, 0xd8, 0x08, 0x32, 0x92, 0x00, 0x11, 0x51, 0x02, 0x68, 0x13, 0x69, 0x00, 0x2b, 0xfc, 0xd1, 0xf2, 0xe7, 0x17, 0x23, 0x02, 0x2a, 0xef, 0xd8, 0x04, 0x4d, 0xa9, 0x42, 0xec, 0xd8, 0x10, 0x32, 0x89, 0xb2, 0x52, 0x00, 0x11, 0x53, 0xef, 0xe7, 0xc0, 0x46, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x2a, 0x01, 0xd0, 0x07, 0x2a, 0x0b, 0xd8, 0x93, 0x1c, 0x9b, 0x00, 0x19, 0x50, 0x01, 0x23, 0x93, 0x40, 0x81, 0x8e, 0x0b, 0x43, 0x9b, 0xb2, 0x83, 0x86, 0x00, 0x23, 0x18, 0x00, 0x70, 0x47, 0x03, 0x79, 0x00, 0x2b, 0x05, 0xd0, 0x01, 0x2b, 0x05, 0xd1, 0x16, 0x33, 0x09, 0x2a, 0xf5, 0xd8, 0xea, 0xe7, 0x0a, 0x2a, 0xe8, 0xd9, 0x17, 0x23, 0xf0, 0xe7, 0xc0, 0x46, 0x30, 0xb5, 0x04, 0x68, 0x0a, 0x29, 0x17, 0xd0, 0x07, 0x29, 0x10, 0xd9, 0x01, 0x23, 0x0a, 0x00, 0x1d, 0x00, 0x08, 0x3a, 0x95, 0x40, 0x2a, 0x02, 0xc0, 0x25, 0x8b, 0x40, 0xad, 0x00, 0x2a, 0x40, 0x62, 0x81, 0x1a, 0x00, 0xc3, 0x8e, 0x13, 0x43, 0x9b, 0xb2, 0xc3, 0x86, 0x30, 0xbd, 0x01, 0x22, 0x8a, 0x40, 0x93, 0xb2, 0x63, 0x81, 0xf5, 0xe7, 0x80, 0x22, 0x02, 0x4b, 0xd2, 0x00, 0x63, 0x81, 0xf0, 0xe7, 0xc0, 0x46, 0x00, 0x80, 0xff, 0xff, 0xf8, 0xb5, 0x3a, 0x4b, 0x1f, 0x68, 0xfb, 0x8e, 0x3d, 0x68, 0xbe, 0x8e, 0x1e, 0x40, 0xab, 0x89, 0x6c, 0x89, 0x1c, 0x40, 0x23, 0xb2, 0x00, 0x2b, 0x51, 0xdb, 0xff, 0x23, 0x23, 0x42, 0x42, 0xd0, 0xfe, 0x3b, 0x23, 0x42, 0x03, 0xd0, 0x33, 0x42, 0x01, 0xd0, 0xbb, 0x68, 0x98, 0x47, 0x01, 0x23, 0xab, 0x81, 0xa2, 0x07, 0x04, 0xd5, 0x72, 0x10, 0x13, 0x42, 0x01, 0xd0, 0xfb, 0x68, 0x98, 0x47, 0x02, 0x23, 0xab, 0x81, 0x63, 0x07, 0x03, 0xd5, 0x73, 0x07, 0x01, 0xd5, 0x3b, 0x69, 0x98, 0x47, 0x04, 0x23, 0xab, 0x81, 0x23, 0x07, 0x03, 0xd5, 0x33, 0x07, 0x01, 0xd5, 0x7b, 0x69, 0x98, 0x47, 0x08, 0x23, 0xab, 0x81, 0xe3, 0x06, 0x03, 0xd5, 0xf3, 0x06, 0x01, 0xd5, 0xbb, 0x69, 0x98, 0x47, 0x10, 0x23, 0xab, 0x81, 0xa3, 0x06, 0x03, 0xd5, 0xb3, 0x06, 0x01, 0xd5, 0xfb, 0x69, 0x98, 0x47, 0x20, 0x23, 0xab, 0x81, 0x63, 0x06, 0x03, 0xd5, 0x73, 0x06, 0x01, 0xd5, 0x3b, 0x6a, 0x98, 0x47, 0x40, 0x23, 0xab, 0x81, 0x23, 0x06, 0x03, 0xd5, 0x33, 0x06, 0x01, 0xd5, 0x7b, 0x6a, 0x98, 0x47, 0x80, 0x23, 0xab, 0x81, 0xf8, 0xbd, 0x80, 0x23, 0x5b, 0x00, 0x1c, 0x42, 0x0c, 0xd0, 0x1e, 0x42, 0x01, 0xd0, 0xbb, 0x6a, 0x98, 0x47, 0x80, 0x23, 0x5b, 0x00, 0xab, 0x81, 0xf2, 0xe7, 0x73, 0x05, 0x0c, 0xd4, 0x0b, 0x4b, 0xab, 0x81, 0xed, 0xe7, 0x80, 0x23, 0x9b, 0x00, 0x1c, 0x42, 0xe9, 0xd0, 0x1e, 0x42, 0x08, 0xd1, 0x80, 0x23, 0x9b, 0x00, 0xab, 0x81, 0xe3, 0xe7, 0x3b, 0x6b, 0x98, 0x47, 0x03, 0x4b, 0xab, 0x81, 0xde, 0xe7, 0xfb, 0x6a, 0x98, 0x47, 0xf3, 0xe7, 0x78, 0x01, 0x00, 0x20, 0x00, 0x80, 0xff, 0xff, 0xf0, 0xb5, 0x47, 0x46, 0xce, 0x46, 0x05, 0x00, 0x02, 0x26, 0x80, 0xb5, 0x29, 0x60, 0x0b, 0x68, 0x83, 0xb0, 0x0c, 0x00, 0x17, 0x00, 0x1c, 0x20, 0x1e, 0x42, 0x04, 0xd0, 0x03, 0xb0, 0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd, 0x01, 0x22, 0x0b, 0x68, 0x90, 0x46, 0x17, 0x38, 0x1a, 0x42, 0xf4, 0xd1, 0x4e, 0x4b, 0x08, 0x00, 0x99, 0x46, 0x98, 0x47, 0x4d, 0x4a, 0x05, 0x28, 0x00, 0xd1, 0x80, 0xe0, 0x43, 0x46, 0x83, 0x40, 0xd1, 0x69, 0x12, 0x30, 0x0b, 0x43, 0xd3, 0x61, 0xc6, 0xb2, 0x6a, 0x46, 0x7b, 0x7e, 0x69, 0x46, 0x13, 0x70, 0x30, 0x00, 0x46, 0x4b, 0x98, 0x47, 0x30, 0x00, 0x45, 0x4b, 0x98, 0x47, 0x00, 0x21, 0x45, 0x4b, 0x78, 0x7e, 0x98, 0x47, 0x28, 0x68, 0xc8, 0x47, 0x06, 0x00, 0x43, 0x4b, 0x43, 0x49, 0x98, 0x47, 0x43, 0x4b, 0xb6, 0x00, 0xf5, 0x50, 0x24, 0x22, 0x00, 0x23, 0xab, 0x54, 0x01, 0x32, 0xab, 0x54, 0xeb, 0x84, 0x3b, 0x7e, 0x00, 0x22, 0x6b, 0x72, 0x10, 0x23, 0x23, 0x60, 0x3b, 0x89, 0x2c, 0x68, 0xeb, 0x80, 0x3b, 0x7c, 0x2b, 0x72, 0x80, 0x23, 0x01, 0xad, 0xf8, 0x69, 0x2b, 0x70, 0x7f, 0x3b, 0x6a, 0x70, 0xab, 0x70, 0xea, 0x70, 0x3e, 0x6a, 0x00, 0x28, 0x4f, 0xd0, 0x02, 0x23, 0x28, 0x70, 0x6b, 0x70, 0x00, 0x0c, 0x33, 0x4b, 0xc0, 0xb2, 0x29, 0x00, 0x98, 0x46, 0x98, 0x47, 0x00, 0x2e, 0x49, 0xd0, 0x02, 0x23, 0x2e, 0x70, 0x36, 0x0c, 0xf0, 0xb2, 0x29, 0x00, 0x99, 0x46, 0x6b, 0x70, 0xc0, 0x47, 0xbb, 0x7e, 0x00, 0x2b, 0x36, 0xd1, 0x4a, 0x46, 0x2b, 0x4b, 0x9b, 0x78, 0x1a, 0x42, 0x31, 0xd1, 0x80, 0x20, 0x00, 0x22, 0x00, 0x05, 0x25, 0x23, 0xfb, 0x5c, 0x79, 0x69, 0x00, 0x2b, 0x04, 0xd1, 0x80, 0x23, 0x9b, 0x04, 0x99, 0x42, 0x00, 0xd0, 0x10, 0x00, 0x24, 0x23, 0x26, 0x22, 0xfb, 0x5c, 0xba, 0x5c, 0x9b, 0x07, 0xd2, 0x05, 0x13, 0x43, 0x7a, 0x68, 0x25, 0x68, 0x13, 0x43, 0x2b, 0x43, 0x03, 0x43, 0x0b, 0x43, 0x23, 0x60, 0x80, 0x23, 0x7a, 0x89, 0x5b, 0x00, 0x13, 0x43, 0x63, 0x60, 0xbb, 0x89, 0xfa, 0x89, 0x5b, 0x00, 0x52, 0x04, 0x13, 0x43, 0x7a, 0x7c, 0x00, 0x20, 0x13, 0x43, 0x3a, 0x7c, 0xd2, 0x03, 0x13, 0x43, 0x63, 0x62, 0x6b, 0xe7, 0x13, 0x6a, 0x1e, 0x43, 0x16, 0x62, 0x18, 0x26, 0x80, 0xe7, 0x11, 0x48, 0x80, 0x22, 0xcd, 0xe7, 0x00, 0x21, 0x20, 0x00, 0x0f, 0x4b, 0x98, 0x47, 0xaa, 0xe7, 0x01, 0x21, 0x20, 0x00, 0x0d, 0x4b, 0x98, 0x47, 0x06, 0x00, 0xaf, 0xe7, 0xc0, 0x46, 0x0d, 0x52, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xf9, 0x59, 0x00, 0x00, 0x39, 0x5a, 0x00, 0x00, 0x69, 0x50, 0x00, 0x00, 0x75, 0x52, 0x00, 0x00, 0x4d, 0x31, 0x00, 0x00, 0xb0, 0x11, 0x00, 0x20, 0xf5, 0x5a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x80, 0x00, 0x00, 0x08, 0xb1, 0x50, 0x00, 0x00, 0x93, 0x1c, 0x9b, 0x00, 0xc3, 0x18, 0x10, 0xb5, 0x59, 0x60, 0x01, 0x23, 0x24, 0x21, 0x93, 0x40, 0x44, 0x5c, 0x23, 0x43, 0xdb, 0xb2, 0x43, 0x54, 0x10, 0xbd, 0xc0, 0x46, 0x02, 0x8d, 0x03, 0x00, 0x05, 0x20, 0x00, 0x2a, 0x00, 0xd0, 0x70, 0x47, 0x4a, 0x68, 0xda, 0x62, 0x0a, 0x88, 0x1a, 0x85, 0x0a, 0x88, 0xda, 0x84, 0x31, 0x22, 0x98, 0x54, 0x1b, 0x68, 0x2a, 0x3a, 0x9a, 0x75, 0x00, 0x20, 0xf1, 0xe7, 0xc0, 0x46, 0x02, 0x8d, 0x03, 0x00, 0x05, 0x20, 0x00, 0x2a, 0x00, 0xd0, 0x70, 0x47, 0x4a, 0x68, 0xda, 0x62, 0x0a, 0x88, 0x1a, 0x85, 0x0a, 0x88, 0xda, 0x84, 0x31, 0x22, 0x98, 0x54, 0x1b, 0x68, 0x2a, 0x3a, 0x9a, 0x75, 0x00, 0x20, 0xf1, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0xc6, 0x46, 0x00, 0xb5, 0x92, 0x4b, 0x80, 0x00, 0xc4, 0x58, 0x24, 0x21, 0x25, 0x23, 0xe2, 0x5c, 0x66, 0x5c, 0x25, 0x68, 0x16, 0x40, 0x02, 0x22, 0x29, 0x7e, 0x0a, 0x42, 0x4a, 0xd0, 0xe3, 0x8c, 0x21, 0x8d, 0x8b, 0x42, 0x00, 0xd1, 0x8d, 0xe0, 0x30, 0x23, 0xe3, 0x5c, 0xdb, 0xb2, 0x00, 0x2b, 0x00, 0xd0, 0x87, 0xe0, 0x31, 0x21, 0x63, 0x54, 0xe3, 0x84, 0x23, 0x85, 0x32, 0x42, 0x02, 0xd0, 0x23, 0x69, 0x20, 0x00, 0x98, 0x47, 0x43, 0x22, 0x6b, 0x8b, 0x1a, 0x42, 0x05, 0xd0, 0x31, 0x23, 0x33, 0x3a, 0xe2, 0x54, 0xb3, 0x06, 0x00, 0xd5, 0x94, 0xe0, 0x63, 0x7a, 0x00, 0x2b, 0x00, 0xd0, 0x9d, 0xe0, 0x08, 0x22, 0x6b, 0x8b, 0x13, 0x40, 0x00, 0xd0, 0x81, 0xe0, 0x30, 0x21, 0x63, 0x54, 0x32, 0x42, 0x00, 0xd0, 0xc4, 0xe0, 0xe5, 0x8c, 0xad, 0xb2, 0x00, 0x2d, 0x00, 0xd0, 0x85, 0xe0, 0x74, 0x4e, 0x27, 0x68, 0xb0, 0x47, 0x80, 0x23, 0xdb, 0x02, 0x7d, 0x83, 0x7b, 0x60, 0x71, 0x4d, 0xa8, 0x47, 0x23, 0x68, 0x1a, 0x7e, 0xd2, 0x07, 0x01, 0xd5, 0x01, 0x22, 0x1a, 0x76, 0x02, 0x22, 0x1a, 0x76, 0x24, 0x68, 0xb0, 0x47, 0x00, 0x23, 0x63, 0x83, 0x63, 0x60, 0xa8, 0x47, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0x01, 0x21, 0x28, 0x7e, 0x01, 0x42, 0x25, 0xd0, 0x29, 0x76, 0x04, 0x31, 0x29, 0x75, 0xe1, 0x5c, 0x49, 0x07, 0x03, 0xd4, 0xe3, 0x5c, 0x1b, 0x07, 0x00, 0xd4, 0x2a, 0x75, 0x31, 0x23, 0xe2, 0x5c, 0x1e, 0x2a, 0xea, 0xd0, 0xe2, 0x5c, 0x10, 0x2a, 0xe7, 0xd0, 0x00, 0x22, 0xe2, 0x54, 0xe2, 0x84, 0x22, 0x85, 0xb3, 0x07, 0x04, 0xd5, 0x30, 0x23, 0xe3, 0x5c, 0x00, 0x2b, 0x00, 0xd1, 0xa7, 0xe0, 0xf3, 0x07, 0xda, 0xd5, 0x30, 0x23, 0xe3, 0x5c, 0x01, 0x2b, 0xd6, 0xd1, 0xe3, 0x68, 0x20, 0x00, 0x98, 0x47, 0xd2, 0xe7, 0x04, 0x23, 0x2a, 0x7e, 0x13, 0x42, 0xce, 0xd0, 0x22, 0x8d, 0x00, 0x2a, 0x54, 0xd0, 0x30, 0x21, 0x61, 0x5c, 0x01, 0x29, 0x4a, 0xd0, 0xe3, 0x8c, 0x00, 0x2b, 0xc4, 0xd0, 0x30, 0x23, 0xe3, 0x5c, 0x00, 0x2b, 0x00, 0xd1, 0x7f, 0xe0, 0xe3, 0x6a, 0x5a, 0x1c, 0xe2, 0x62, 0x28, 0x22, 0x1b, 0x78, 0xdb, 0xb2, 0xab, 0x54, 0x23, 0x8d, 0x01, 0x3b, 0x23, 0x85, 0xb4, 0xe7, 0xe3, 0x8c, 0x99, 0x42, 0x00, 0xd1, 0x7c, 0xe7, 0x30, 0x23, 0xe3, 0x5c, 0xdb, 0xb2, 0x01, 0x2b, 0x00, 0xd0, 0x76, 0xe7, 0x00, 0x22, 0x31, 0x21, 0x62, 0x54, 0xe2, 0x84, 0x22, 0x85, 0x33, 0x42, 0x00, 0xd1, 0x6e, 0xe7, 0xe3, 0x68, 0x20, 0x00, 0x98, 0x47, 0x6a, 0xe7, 0x30, 0x23, 0x07, 0x3a, 0xe2, 0x54, 0x73, 0x07, 0x00, 0xd4, 0x7c, 0xe7, 0x63, 0x69, 0x20, 0x00, 0x98, 0x47, 0x78, 0xe7, 0x23, 0x6a, 0x20, 0x00, 0x98, 0x47, 0x66, 0xe7, 0x31, 0x4e, 0x25, 0x68, 0xb0, 0x47, 0x00, 0x23, 0x6b, 0x83, 0x6b, 0x60, 0x2f, 0x4d, 0xa8, 0x47, 0x79, 0xe7, 0x2c, 0x4e, 0x25, 0x68, 0xb0, 0x47, 0x00, 0x23, 0x6b, 0x83, 0x80, 0x23, 0xdb, 0x02, 0x6b, 0x60, 0x29, 0x4d, 0xa8, 0x47, 0x6e, 0xe7, 0xe1, 0x8c, 0x8a, 0x42, 0xb1, 0xd2, 0x6a, 0x8b, 0x13, 0x42, 0xae, 0xd0, 0x00, 0x23, 0x23, 0x85, 0xe3, 0x84, 0x98, 0x46, 0x30, 0x23, 0xe7, 0x5c, 0x21, 0x4b, 0xff, 0xb2, 0x00, 0x2f, 0x19, 0xd1, 0x98, 0x47, 0x80, 0x23, 0xdb, 0x02, 0x6f, 0x83, 0x6b, 0x60, 0x1d, 0x4b, 0x98, 0x47, 0x80, 0x23, 0x6a, 0x68, 0x9b, 0x02, 0x13, 0x43, 0x6b, 0x60, 0x1e, 0x22, 0x31, 0x23, 0xe2, 0x54, 0xf3, 0x06, 0x00, 0xd4, 0x5a, 0xe7, 0xe3, 0x69, 0x20, 0x00, 0x98, 0x47, 0x56, 0xe7, 0xa3, 0x69, 0x20, 0x00, 0x98, 0x47, 0x36, 0xe7, 0x98, 0x47, 0x43, 0x46, 0x6b, 0x83, 0x80, 0x23, 0xdb, 0x02, 0x6b, 0x60, 0x10, 0x4b, 0x98, 0x47, 0x80, 0x23, 0x6a, 0x68, 0x9b, 0x02, 0x13, 0x43, 0x6b, 0x60, 0x00, 0x22, 0x31, 0x23, 0xe2, 0x54, 0x2d, 0x3b, 0x2b, 0x75, 0x3f, 0xe7, 0xe2, 0x6a, 0x53, 0x1c, 0xe3, 0x62, 0x28, 0x23, 0xeb, 0x5c, 0xdb, 0xb2, 0x13, 0x70, 0x23, 0x8d, 0x01, 0x3b, 0x23, 0x85, 0x34, 0xe7, 0x23, 0x69, 0x20, 0x00, 0x98, 0x47, 0x30, 0xe7, 0xc0, 0x46, 0xb0, 0x11, 0x00, 0x20, 0xed, 0x55, 0x00, 0x00, 0x29, 0x56, 0x00, 0x00, 0xf0, 0xb5, 0x45, 0x46, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46, 0xe0, 0xb5, 0x5e, 0x4d, 0x83, 0xb0, 0x2b, 0x89, 0x00, 0x2b, 0x00, 0xd1, 0xb2, 0xe0, 0x04, 0x22, 0x90, 0x46, 0x5b, 0x4a, 0x93, 0x46, 0x42, 0x46, 0x16, 0x1f, 0xb6, 0xb2, 0xb2, 0x01, 0x92, 0x46, 0x51, 0x46, 0x6a, 0x68, 0x57, 0x5c, 0xff, 0x2f, 0x19, 0xd0, 0x43, 0x45, 0x3c, 0xd9, 0x80, 0x22, 0x52, 0x44, 0x00, 0x92, 0x40, 0x22, 0x44, 0x46, 0xb6, 0x08, 0x52, 0x44, 0xf6, 0xb2, 0x01, 0x92, 0x36, 0x02, 0x5a, 0x1e, 0x94, 0x42, 0x06, 0xd0, 0x68, 0x68, 0xa2, 0x01, 0x82, 0x5c, 0xff, 0x2a, 0x01, 0xd0, 0x97, 0x42, 0x0a, 0xd0, 0x04, 0x34, 0xa4, 0xb2, 0x9c, 0x42, 0xf1, 0xd3, 0x42, 0x46, 0x04, 0x32, 0x92, 0xb2, 0x98, 0x45, 0x1f, 0xd2, 0x90, 0x46, 0xd4, 0xe7, 0x52, 0x46, 0x00, 0x9b, 0x82, 0x5c, 0xc3, 0x5c, 0x9a, 0x42, 0x11, 0xd0, 0x01, 0x9a, 0x82, 0x5c, 0x9a, 0x42, 0x0d, 0xd0, 0xa3, 0x08, 0xdb, 0xb2, 0x1b, 0x02, 0x99, 0x46, 0x00, 0xe0, 0x68, 0x68, 0x48, 0x44, 0x3c, 0x4b, 0x98, 0x47, 0x05, 0x28, 0xf9, 0xd0, 0x2b, 0x89, 0xdd, 0xe7, 0x68, 0x68, 0x80, 0x19, 0xd8, 0x47, 0x05, 0x28, 0xfa, 0xd0, 0x2b, 0x89, 0xd6, 0xe7, 0x00, 0x2b, 0x63, 0xd0, 0x00, 0x22, 0xaf, 0x7a, 0x69, 0x68, 0x5c, 0x1e, 0xa2, 0x42, 0x07, 0xd0, 0x08, 0x78, 0x86, 0xb2, 0xff, 0x2e, 0x03, 0xd0, 0xbe, 0x42, 0x01, 0xd2, 0x28, 0x18, 0xc2, 0x72, 0x01, 0x32, 0x90, 0xb2, 0x40, 0x31, 0x83, 0x42, 0xf0, 0xd8, 0x9b, 0x08, 0x9c, 0x46, 0x3f, 0x22, 0x87, 0x23, 0xea, 0x54, 0x63, 0x46, 0x00, 0x2b, 0x41, 0xd0, 0x6b, 0x68, 0x02, 0x22, 0x98, 0x46, 0x47, 0x46, 0xc0, 0x33, 0x9b, 0x46, 0x40, 0x37, 0x46, 0x46, 0x00, 0x20, 0x21, 0xe0, 0x31, 0x78, 0xff, 0x39, 0x4b, 0x42, 0x4b, 0x41, 0xdb, 0xb2, 0x9a, 0x46, 0x53, 0x1e, 0xa3, 0x42, 0x20, 0xd0, 0x3b, 0x78, 0xff, 0x2b, 0x1d, 0xd0, 0x94, 0x42, 0x08, 0xd0, 0x00, 0x23, 0x9a, 0x46, 0x93, 0x01, 0x99, 0x46, 0x43, 0x46, 0x49, 0x46, 0xcb, 0x5c, 0xff, 0x2b, 0x14, 0xd0, 0x80, 0x23, 0x5b, 0x00, 0x99, 0x46, 0x01, 0x30, 0x80, 0xb2, 0x04, 0x32, 0xcb, 0x44, 0xff, 0x18, 0xf6, 0x18, 0x60, 0x45, 0x15, 0xd0, 0x91, 0x1e, 0x8c, 0x42, 0xda, 0xd1, 0x01, 0x23, 0x9a, 0x46, 0x53, 0x1e, 0xa3, 0x42, 0xde, 0xd1, 0xa2, 0x42, 0xe3, 0xd1, 0x53, 0x1c, 0xa3, 0x42, 0x03, 0xd0, 0x5b, 0x46, 0x1b, 0x78, 0xff, 0x2b, 0xe3, 0xd1, 0x53, 0x46, 0x00, 0x2b, 0xe0, 0xd0, 0x87, 0x23, 0xe8, 0x54, 0x03, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x3f, 0x22, 0x87, 0x23, 0xea, 0x54, 0xf4, 0xe7, 0xc0, 0x46, 0x34, 0x00, 0x00, 0x20, 0xd5, 0x2a, 0x00, 0x00, 0xf0, 0xb5, 0x45, 0x46, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46, 0xc8, 0x23, 0xe0, 0xb5, 0x95, 0x4d, 0x89, 0xb0, 0x01, 0x90, 0x02, 0x91, 0xeb, 0x5c, 0x00, 0x2b, 0x11, 0xd0, 0x88, 0x23, 0xeb, 0x5c, 0x83, 0x42, 0x0d, 0xd0, 0xeb, 0x18, 0xdc, 0x7a, 0x8f, 0x4e, 0xa4, 0x01, 0x6b, 0x68, 0x00, 0x22, 0x19, 0x19, 0x04, 0x20, 0xb0, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x00, 0x22, 0xc8, 0x23, 0xea, 0x54, 0x01, 0x9b, 0x6c, 0x68, 0xeb, 0x18, 0xdb, 0x7a, 0x99, 0x46, 0x03, 0x23, 0x49, 0x46, 0x4a, 0x46, 0x19, 0x40, 0x9a, 0x43, 0x4b, 0x46, 0x9b, 0x01, 0x98, 0x46, 0xe3, 0x5c, 0xff, 0x2b, 0x00, 0xd1, 0x91, 0xe0, 0x4b, 0x1c, 0x04, 0x2b, 0x1a, 0xd0, 0x9b, 0x18, 0xdb, 0xb2, 0x98, 0x01, 0x80, 0x46, 0x20, 0x5c, 0xff, 0x28, 0x00, 0xd1, 0x85, 0xe0, 0x8b, 0x1c, 0x04, 0x2b, 0x0f, 0xd0, 0x9b, 0x18, 0xdb, 0xb2, 0x98, 0x01, 0x80, 0x46, 0x20, 0x5c, 0xff, 0x28, 0x7b, 0xd0, 0x01, 0x29, 0x06, 0xd0, 0xd3, 0x1c, 0xdb, 0xb2, 0x99, 0x01, 0x88, 0x46, 0x61, 0x5c, 0xff, 0x29, 0x72, 0xd0, 0x4b, 0x46, 0x9b, 0x08, 0x05, 0x93, 0x1b, 0x02, 0x9a, 0x46, 0xe3, 0x18, 0x19, 0x78, 0x06, 0xa8, 0x01, 0x71, 0x42, 0x71, 0x40, 0x20, 0x18, 0x5c, 0x06, 0xae, 0x06, 0xaf, 0xb0, 0x71, 0x56, 0x1c, 0xfe, 0x71, 0x80, 0x26, 0xc0, 0x27, 0x9e, 0x5d, 0xdb, 0x5d, 0x98, 0x46, 0xb1, 0x42, 0x00, 0xd1, 0xb1, 0xe0, 0x41, 0x45, 0x00, 0xd1, 0xb6, 0xe0, 0xb0, 0x42, 0x00, 0xd1, 0xb9, 0xe0, 0x40, 0x45, 0x00, 0xd1, 0xbc, 0xe0, 0xc8, 0x23, 0xea, 0x5c, 0x00, 0x23, 0x9b, 0x46, 0x87, 0x23, 0xeb, 0x5c, 0x5f, 0x4e, 0x9b, 0x00, 0x5b, 0x44, 0x5e, 0x4f, 0xb1, 0x46, 0x03, 0x93, 0x00, 0x2a, 0x00, 0xd0, 0x72, 0xe0, 0x5b, 0x46, 0x07, 0xaa, 0x5b, 0x00, 0xd2, 0x5c, 0x01, 0x99, 0x04, 0x92, 0x91, 0x42, 0x00, 0xd1, 0x85, 0xe0, 0x07, 0xaa, 0x94, 0x46, 0x63, 0x44, 0x5e, 0x78, 0x88, 0x23, 0x98, 0x46, 0xb6, 0x01, 0xa8, 0x44, 0x20, 0x00, 0x00, 0xe0, 0x68, 0x68, 0x80, 0x19, 0x40, 0x22, 0x41, 0x46, 0xb8, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x6c, 0x68, 0x2e, 0x00, 0x03, 0x9b, 0x20, 0x00, 0x9b, 0x01, 0x88, 0x36, 0x1c, 0x00, 0x00, 0xe0, 0x68, 0x68, 0x00, 0x19, 0x40, 0x22, 0x31, 0x00, 0xc8, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x6a, 0x46, 0x04, 0x9b, 0x12, 0x7b, 0xeb, 0x18, 0xda, 0x72, 0x01, 0x23, 0x9c, 0x46, 0xc8, 0x22, 0xe3, 0x44, 0xab, 0x54, 0x5b, 0x46, 0x02, 0x2b, 0x32, 0xd1, 0x56, 0x46, 0x41, 0x4c, 0x6b, 0x68, 0x98, 0x19, 0xa0, 0x47, 0x05, 0x28, 0xfa, 0xd0, 0x6a, 0x46, 0x87, 0x23, 0x12, 0x7d, 0xea, 0x54, 0x1e, 0xe0, 0x99, 0x46, 0x6a, 0x46, 0x88, 0x23, 0x28, 0x00, 0x2f, 0x00, 0x12, 0x79, 0x8c, 0x30, 0xea, 0x54, 0x02, 0x99, 0x3c, 0x22, 0x37, 0x4b, 0x98, 0x47, 0x88, 0x37, 0x20, 0x00, 0x32, 0x4e, 0x44, 0x46, 0x00, 0xe0, 0x68, 0x68, 0x00, 0x19, 0x40, 0x22, 0x39, 0x00, 0xb0, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x01, 0x9b, 0xef, 0x18, 0x4b, 0x46, 0xfb, 0x72, 0x01, 0x22, 0xc8, 0x23, 0xea, 0x54, 0x00, 0x20, 0x09, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x87, 0x23, 0x01, 0x22, 0xeb, 0x5c, 0x6c, 0x68, 0x9b, 0x00, 0x5b, 0x44, 0x03, 0x93, 0x00, 0x2a, 0x00, 0xd1, 0x8c, 0xe7, 0x88, 0x23, 0xeb, 0x5c, 0x21, 0x00, 0xeb, 0x18, 0xde, 0x7a, 0xb6, 0x01, 0x00, 0xe0, 0x69, 0x68, 0x89, 0x19, 0x00, 0x22, 0x04, 0x20, 0x1a, 0x4b, 0x98, 0x47, 0x05, 0x28, 0xf7, 0xd0, 0x00, 0x23, 0xc8, 0x22, 0xab, 0x54, 0x5b, 0x46, 0x07, 0xaa, 0x5b, 0x00, 0xd2, 0x5c, 0x01, 0x99, 0x6c, 0x68, 0x04, 0x92, 0x91, 0x42, 0x00, 0xd0, 0x79, 0xe7, 0x6a, 0x46, 0x88, 0x23, 0x28, 0x00, 0x12, 0x79, 0x02, 0x99, 0xea, 0x54, 0x8c, 0x30, 0x3c, 0x22, 0x12, 0x4b, 0x98, 0x47, 0x80, 0xe7, 0x97, 0x1c, 0xbc, 0x46, 0x63, 0x46, 0x06, 0xaf, 0x7b, 0x71, 0x41, 0x45, 0x00, 0xd0, 0x48, 0xe7, 0xd1, 0x1c, 0x06, 0xab, 0x59, 0x71, 0xb0, 0x42, 0x00, 0xd0, 0x45, 0xe7, 0x91, 0x1c, 0x06, 0xae, 0xf1, 0x71, 0x40, 0x45, 0x00, 0xd0, 0x42, 0xe7, 0x03, 0x32, 0x06, 0xab, 0xda, 0x71, 0x3e, 0xe7, 0x34, 0x00, 0x00, 0x20, 0x35, 0x28, 0x00, 0x00, 0xe1, 0x28, 0x00, 0x00, 0x5d, 0x2a, 0x00, 0x00, 0xd5, 0x2a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0x01, 0x23, 0x00, 0x22, 0xf0, 0xb5, 0x9d, 0xb0, 0x03, 0xac, 0x63, 0x70, 0x33, 0x4b, 0x22, 0x70, 0x5b, 0x68, 0x33, 0x4d, 0xdb, 0x06, 0x1b, 0x0f, 0xa3, 0x70, 0xe2, 0x70, 0x22, 0x71, 0x20, 0x00, 0xa8, 0x47, 0x05, 0x28, 0xfb, 0xd0, 0x08, 0xa8, 0x2e, 0x4b, 0x98, 0x47, 0x09, 0x9b, 0x16, 0x20, 0x0b, 0x2b, 0x01, 0xd8, 0x1d, 0xb0, 0xf0, 0xbd, 0x1a, 0x00, 0x2b, 0x4c, 0x08, 0x3a, 0x52, 0x08, 0xa2, 0x72, 0x80, 0x22, 0x92, 0x02, 0x94, 0x46, 0x23, 0x81, 0x1b, 0x04, 0x9b, 0x0a, 0x5b, 0x42, 0x63, 0x44, 0x63, 0x60, 0x00, 0x22, 0xc8, 0x23, 0xe2, 0x54, 0x24, 0x4b, 0x98, 0x47, 0x87, 0x23, 0xe3, 0x5c, 0x1a, 0x20, 0x3f, 0x2b, 0xe5, 0xd0, 0x05, 0xae, 0x32, 0x00, 0x20, 0x4b, 0x21, 0x4f, 0x23, 0xcb, 0x23, 0xc2, 0x25, 0x89, 0x01, 0x3d, 0xad, 0xb2, 0xad, 0x01, 0x63, 0x68, 0x40, 0x22, 0x58, 0x19, 0x0c, 0xa9, 0xb8, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x0c, 0x9b, 0x05, 0x9a, 0x01, 0x93, 0x93, 0x42, 0x20, 0xd1, 0x0d, 0x9b, 0x72, 0x68, 0x01, 0x93, 0x93, 0x42, 0x1b, 0xd1, 0x0e, 0x9b, 0x01, 0x93, 0x01, 0x9a, 0xb3, 0x68, 0x9a, 0x42, 0x15, 0xd1, 0x37, 0x22, 0x02, 0xab, 0x9b, 0x18, 0x1b, 0x78, 0x10, 0x20, 0x01, 0x2b, 0xbd, 0xd1, 0x02, 0xab, 0x03, 0x3a, 0x9b, 0x18, 0x1b, 0x78, 0x01, 0x2b, 0xb7, 0xd1, 0x35, 0x21, 0x02, 0xaa, 0x52, 0x18, 0x12, 0x78, 0x00, 0x2a, 0xb1, 0xd1, 0x23, 0x70, 0x00, 0x20, 0xae, 0xe7, 0x1a, 0x20, 0xac, 0xe7, 0xc0, 0x46, 0x00, 0x40, 0x00, 0x41, 0xb5, 0x27, 0x00, 0x00, 0x55, 0x2b, 0x00, 0x00, 0x34, 0x00, 0x00, 0x20, 0xa9, 0x33, 0x00, 0x00, 0x64, 0x6e, 0x00, 0x00, 0x5d, 0x2a, 0x00, 0x00, 0xf0, 0xb5, 0x4e, 0x46, 0xde, 0x46, 0x57, 0x46, 0x45, 0x46, 0x00, 0x22, 0x87, 0x23, 0xe0, 0xb5, 0x4d, 0x4c, 0x4e, 0x4e, 0x93, 0xb0, 0xe2, 0x54, 0x60, 0x68, 0xb0, 0x47, 0x05, 0x28, 0xfb, 0xd0, 0x22, 0x89, 0x04, 0x2a, 0x00, 0xd8, 0x85, 0xe0, 0x00, 0x23, 0x00, 0x93, 0x02, 0xab, 0x98, 0x46, 0x47, 0x4b, 0x04, 0x25, 0x01, 0x93, 0x47, 0x4b, 0x57, 0x1e, 0x9a, 0x46, 0x46, 0x4b, 0x99, 0x46, 0x03, 0x23, 0x9b, 0x46, 0xbd, 0x42, 0x32, 0xd0, 0x5b, 0x46, 0x2b, 0x40, 0x00, 0xd0, 0x6e, 0xe0, 0xaf, 0x08, 0xff, 0xb2, 0x3f, 0x02, 0x63, 0x68, 0xd8, 0x19, 0xb0, 0x47, 0x05, 0x28, 0xfa, 0xd0, 0x40, 0x22, 0x40, 0x46, 0x01, 0x9b, 0xff, 0x21, 0x98, 0x47, 0x43, 0x46, 0x6a, 0x46, 0xaf, 0x01, 0xa8, 0x46, 0x1d, 0x00, 0x12, 0x78, 0x1a, 0x70, 0x63, 0x68, 0x40, 0x22, 0xd8, 0x19, 0x29, 0x00, 0xd0, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x4b, 0x46, 0xc1, 0x46, 0xa8, 0x46, 0x1d, 0x00, 0x63, 0x68, 0x00, 0x22, 0xd9, 0x19, 0x04, 0x20, 0xa8, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x2b, 0x00, 0x4d, 0x46, 0x99, 0x46, 0x00, 0x9b, 0x01, 0x33, 0x9b, 0xb2, 0x00, 0x93, 0x22, 0x89, 0x57, 0x1e, 0x01, 0x35, 0xad, 0xb2, 0x95, 0x42, 0xc6, 0xd3, 0x40, 0x22, 0x01, 0x9b, 0xff, 0x21, 0x40, 0x46, 0x98, 0x47, 0x42, 0x46, 0x26, 0x4b, 0x02, 0x93, 0x26, 0x4b, 0x53, 0x60, 0x26, 0x4b, 0x93, 0x60, 0x26, 0x4b, 0xfa, 0x17, 0x05, 0x93, 0x03, 0x23, 0x13, 0x40, 0xdf, 0x19, 0xbf, 0x05, 0x3f, 0x0e, 0x3f, 0x02, 0x63, 0x68, 0xd8, 0x19, 0xb0, 0x47, 0x05, 0x28, 0xfa, 0xd0, 0x46, 0x46, 0x57, 0x46, 0x25, 0x89, 0x01, 0x3d, 0xad, 0xb2, 0xad, 0x01, 0x63, 0x68, 0x40, 0x22, 0x58, 0x19, 0x31, 0x00, 0xb8, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x4e, 0x46, 0x25, 0x89, 0x01, 0x3d, 0xad, 0xb2, 0xad, 0x01, 0x63, 0x68, 0x00, 0x22, 0x59, 0x19, 0x04, 0x20, 0xb0, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x13, 0x4b, 0x98, 0x47, 0x13, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x01, 0x2b, 0xbd, 0xd1, 0x95, 0xe7, 0x02, 0xab, 0x98, 0x46, 0x05, 0x4b, 0x57, 0x1e, 0x01, 0x93, 0x05, 0x4b, 0x9a, 0x46, 0x05, 0x4b, 0x99, 0x46, 0xb6, 0xe7, 0x34, 0x00, 0x00, 0x20, 0xd5, 0x2a, 0x00, 0x00, 0x07, 0x6c, 0x00, 0x00, 0xe1, 0x28, 0x00, 0x00, 0x35, 0x28, 0x00, 0x00, 0x45, 0x45, 0x74, 0x41, 0x4d, 0x4f, 0x52, 0x50, 0x2e, 0x75, 0x6d, 0x45, 0x01, 0x00, 0x00, 0x01, 0xa9, 0x33, 0x00, 0x00, 0x10, 0xb5, 0x07, 0x4a, 0x1f, 0x23, 0x14, 0x78, 0x00, 0x2c, 0x01, 0xd1, 0x18, 0x00, 0x10, 0xbd, 0x92, 0x7a, 0x07, 0x3b, 0x82, 0x42, 0xf9, 0xd9, 0x02, 0x4b, 0x98, 0x47, 0x03, 0x00, 0xf5, 0xe7, 0x34, 0x00, 0x00, 0x20, 0x39, 0x35, 0x00, 0x00, 0xf0, 0xb5, 0x18, 0x4c, 0x91, 0xb0, 0x22, 0x78, 0x0d, 0x00, 0x1f, 0x23, 0x00, 0x2a, 0x02, 0xd1, 0x18, 0x00, 0x11, 0xb0, 0xf0, 0xbd, 0xa2, 0x7a, 0x07, 0x3b, 0x82, 0x42, 0xf8, 0xd9, 0xb0, 0x33, 0xe3, 0x5c, 0x00, 0x2b, 0x03, 0xd0, 0x88, 0x23, 0xe3, 0x5c, 0x83, 0x42, 0x11, 0xd0, 0x20, 0x18, 0xc6, 0x7a, 0x0d, 0x4f, 0xb6, 0x01, 0x63, 0x68, 0x40, 0x22, 0x98, 0x19, 0x69, 0x46, 0xb8, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x09, 0x4b, 0x3c, 0x22, 0x01, 0xa9, 0x28, 0x00, 0x98, 0x47, 0x00, 0x23, 0xde, 0xe7, 0x21, 0x00, 0x05, 0x4b, 0x8c, 0x31, 0x3c, 0x22, 0x28, 0x00, 0x98, 0x47, 0x00, 0x23, 0xd6, 0xe7, 0xc0, 0x46, 0x34, 0x00, 0x00, 0x20, 0x5d, 0x2a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0xc8, 0x23, 0x70, 0xb5, 0x0b, 0x4c, 0xe3, 0x5c, 0x00, 0x2b, 0x01, 0xd1, 0x00, 0x20, 0x70, 0xbd, 0x88, 0x23, 0xe3, 0x5c, 0x08, 0x4e, 0xe3, 0x18, 0xdd, 0x7a, 0xad, 0x01, 0x63, 0x68, 0x00, 0x22, 0x59, 0x19, 0x04, 0x20, 0xb0, 0x47, 0x05, 0x28, 0xf8, 0xd0, 0x00, 0x22, 0xc8, 0x23, 0xe2, 0x54, 0xec, 0xe7, 0xc0, 0x46, 0x34, 0x00, 0x00, 0x20, 0x35, 0x28, 0x00, 0x00, 0x01, 0x22, 0x01, 0x4b, 0x1a, 0x70, 0x70, 0x47, 0x03, 0x01, 0x00, 0x20, 0x01, 0x22, 0x01, 0x4b, 0x1a, 0x70, 0x70, 0x47, 0x18, 0x01, 0x00, 0x20, 0xf0, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x80, 0xb5, 0x91, 0xb0, 0x01, 0xaf, 0x34, 0x4b, 0x06, 0xae, 0x98, 0x47, 0x38, 0x00, 0x33, 0x4b, 0x0b, 0xad, 0x98, 0x47, 0x30, 0x00, 0x32, 0x4b, 0x98, 0x47, 0x28, 0x00, 0x32, 0x4b, 0x98, 0x47, 0x80, 0x23, 0x9b, 0x03, 0x01, 0x93, 0x06, 0x93, 0x80, 0x23, 0x5b, 0x03, 0x0b, 0x93, 0xc0, 0x23, 0xdb, 0x02, 0x6b, 0x60, 0x80, 0x23, 0x5b, 0x01, 0x03, 0x93, 0xc0, 0x23, 0x5b, 0x01, 0x08, 0x93, 0x2a, 0x4b, 0x00, 0x24, 0x0d, 0x93, 0x01, 0x23, 0x98, 0x46, 0xab, 0x73, 0x42, 0x46, 0x2b, 0x73, 0xab, 0x74, 0xbb, 0x73, 0x3b, 0x73, 0x6b, 0x46, 0x5c, 0x70, 0x9a, 0x70, 0xdc, 0x70, 0x1a, 0x70, 0x23, 0x4b, 0x69, 0x46, 0x06, 0x20, 0x6c, 0x73, 0x99, 0x46, 0x7c, 0x60, 0x74, 0x60, 0x7c, 0x73, 0x74, 0x73, 0xb4, 0x73, 0x34, 0x73, 0x98, 0x47, 0x42, 0x46, 0x6b, 0x46, 0x69, 0x46, 0x29, 0x20, 0x1a, 0x70, 0xc8, 0x47, 0x38, 0x00, 0x1a, 0x4b, 0x6c, 0x74, 0x7c, 0x74, 0x74, 0x74, 0x98, 0x47, 0x30, 0x00, 0x18, 0x4b, 0x98, 0x47, 0x28, 0x00, 0x18, 0x4b, 0x98, 0x47, 0x00, 0x20, 0x17, 0x4d, 0xa8, 0x47, 0x17, 0x4c, 0x00, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x01, 0x20, 0xa8, 0x47, 0x01, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x02, 0x20, 0xa8, 0x47, 0x02, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x80, 0x21, 0x0f, 0x4a, 0x13, 0x78, 0x0b, 0x43, 0x13, 0x70, 0x11, 0xb0, 0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd, 0xc0, 0x46, 0x4d, 0x53, 0x00, 0x00, 0x89, 0x53, 0x00, 0x00, 0xad, 0x53, 0x00, 0x00, 0xd1, 0x53, 0x00, 0x00, 0x00, 0x10, 0x00, 0xc0, 0xf5, 0x5a, 0x00, 0x00, 0xf5, 0x53, 0x00, 0x00, 0x5d, 0x54, 0x00, 0x00, 0xc5, 0x54, 0x00, 0x00, 0x2d, 0x55, 0x00, 0x00, 0x95, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x43, 0xf0, 0xb5, 0x91, 0xb0, 0x01, 0xae, 0x06, 0xad, 0x30, 0x00, 0x25, 0x4b, 0x0b, 0xac, 0x98, 0x47, 0x28, 0x00, 0x24, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x23, 0x4b, 0x98, 0x47, 0x00, 0x23, 0x80, 0x22, 0x03, 0x93, 0x92, 0x03, 0x08, 0x93, 0x0d, 0x93, 0x20, 0x4f, 0x00, 0x20, 0x01, 0x92, 0x06, 0x92, 0x0b, 0x92, 0x6b, 0x60, 0x63, 0x60, 0x6b, 0x73, 0x63, 0x73, 0xab, 0x73, 0xa3, 0x73, 0x2b, 0x73, 0x23, 0x73, 0xab, 0x74, 0xa3, 0x74, 0x6b, 0x74, 0x63, 0x74, 0x73, 0x60, 0x73, 0x73, 0xb3, 0x73, 0x33, 0x73, 0xb3, 0x74, 0x73, 0x74, 0xb8, 0x47, 0x01, 0x20, 0xb8, 0x47, 0x02, 0x20, 0xb8, 0x47, 0x30, 0x00, 0x13, 0x4b, 0x98, 0x47, 0x28, 0x00, 0x12, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x12, 0x4b, 0x98, 0x47, 0x00, 0x20, 0x11, 0x4d, 0xa8, 0x47, 0x11, 0x4c, 0x00, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x01, 0x20, 0xa8, 0x47, 0x01, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x02, 0x20, 0xa8, 0x47, 0x02, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x11, 0xb0, 0xf0, 0xbd, 0xc0, 0x46, 0x89, 0x53, 0x00, 0x00, 0xad, 0x53, 0x00, 0x00, 0xd1, 0x53, 0x00, 0x00, 0x61, 0x55, 0x00, 0x00, 0xf5, 0x53, 0x00, 0x00, 0x5d, 0x54, 0x00, 0x00, 0xc5, 0x54, 0x00, 0x00, 0x2d, 0x55, 0x00, 0x00, 0x95, 0x55, 0x00, 0x00, 0xf0, 0xb5, 0x91, 0xb0, 0x01, 0xae, 0x06, 0xad, 0x30, 0x00, 0x29, 0x4b, 0x0b, 0xac, 0x98, 0x47, 0x28, 0x00, 0x28, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x27, 0x4b, 0x98, 0x47, 0xc0, 0x22, 0xd2, 0x02, 0x62, 0x60, 0x80, 0x22, 0x80, 0x23, 0x52, 0x01, 0x03, 0x92, 0xc0, 0x22, 0x9b, 0x03, 0x01, 0x93, 0x06, 0x93, 0x80, 0x23, 0x52, 0x01, 0x08, 0x92, 0x20, 0x4a, 0x5b, 0x03, 0x0b, 0x93, 0x0d, 0x92, 0x00, 0x23, 0x01, 0x22, 0x1e, 0x4f, 0x00, 0x20, 0xa2, 0x73, 0x22, 0x73, 0xa2, 0x74, 0xb2, 0x73, 0x32, 0x73, 0x6b, 0x60, 0x6b, 0x73, 0x63, 0x73, 0xab, 0x73, 0x2b, 0x73, 0x6b, 0x74, 0x63, 0x74, 0x73, 0x60, 0x73, 0x73, 0x73, 0x74, 0xb8, 0x47, 0x01, 0x20, 0xb8, 0x47, 0x02, 0x20, 0xb8, 0x47, 0x30, 0x00, 0x14, 0x4b, 0x98, 0x47, 0x28, 0x00, 0x13, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x13, 0x4b, 0x98, 0x47, 0x00, 0x20, 0x12, 0x4d, 0xa8, 0x47, 0x12, 0x4c, 0x00, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x01, 0x20, 0xa8, 0x47, 0x01, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x02, 0x20, 0xa8, 0x47, 0x02, 0x20, 0xa0, 0x47, 0x00, 0x28, 0xfb, 0xd0, 0x11, 0xb0, 0xf0, 0xbd, 0xc0, 0x46, 0x89, 0x53, 0x00, 0x00, 0xad, 0x53, 0x00, 0x00, 0xd1, 0x53, 0x00, 0x00, 0x00, 0x10, 0x00, 0xc0, 0x61, 0x55, 0x00, 0x00, 0xf5, 0x53, 0x00, 0x00, 0x5d, 0x54, 0x00, 0x00, 0xc5, 0x54, 0x00, 0x00, 0x2d, 0x55, 0x00, 0x00, 0x95, 0x55, 0x00, 0x00, 0xf0, 0xb5, 0x00, 0x25, 0x01, 0x26, 0x8f, 0xb0, 0x01, 0xac, 0x21, 0x00, 0x08, 0x20, 0x37, 0x4f, 0xa5, 0x70, 0x66, 0x70, 0x26, 0x70, 0xb8, 0x47, 0x21, 0x00, 0x15, 0x20, 0xb8, 0x47, 0x80, 0x22, 0x33, 0x4b, 0x52, 0x00, 0x5a, 0x61, 0x80, 0x22, 0x92, 0x03, 0x02, 0xac, 0x9a, 0x61, 0x31, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x30, 0x4b, 0x98, 0x47, 0x1f, 0x23, 0x23, 0x71, 0x1a, 0x3b, 0x25, 0x70, 0xa5, 0x70, 0x63, 0x70, 0x65, 0x73, 0x2f, 0x33, 0x2c, 0x4d, 0xe3, 0x70, 0x2c, 0x3b, 0x23, 0x72, 0x22, 0x00, 0x2b, 0x4b, 0x2b, 0x49, 0x28, 0x00, 0x66, 0x72, 0x98, 0x47, 0x2b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x80, 0x21, 0x28, 0x4a, 0xc9, 0x03, 0x11, 0x60, 0x07, 0x22, 0x02, 0x21, 0x1a, 0x71, 0x9a, 0x71, 0x1a, 0x78, 0x0a, 0x43, 0x1a, 0x70, 0x2a, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x28, 0x00, 0x00, 0x22, 0x21, 0x49, 0x21, 0x4b, 0x98, 0x47, 0x01, 0x22, 0xeb, 0x7e, 0x20, 0x49, 0x13, 0x43, 0xeb, 0x76, 0x20, 0x48, 0x20, 0x4b, 0x98, 0x47, 0x20, 0x4a, 0x21, 0x49, 0x21, 0x48, 0x22, 0x4b, 0x98, 0x47, 0x01, 0x26, 0x00, 0x22, 0x00, 0x23, 0xa6, 0x70, 0x26, 0x71, 0x04, 0x92, 0x05, 0x93, 0x80, 0x23, 0x1e, 0x4d, 0x5b, 0x00, 0x23, 0x80, 0x22, 0x00, 0x1d, 0x49, 0x28, 0x00, 0x1d, 0x4b, 0xe6, 0x70, 0x98, 0x47, 0x08, 0x22, 0x1c, 0x49, 0x28, 0x00, 0x1c, 0x4b, 0x98, 0x47, 0x28, 0x00, 0x08, 0x21, 0x1b, 0x4b, 0x98, 0x47, 0x1b, 0x4b, 0x00, 0x22, 0x19, 0x88, 0x28, 0x00, 0x1a, 0x4b, 0x98, 0x47, 0x0f, 0xb0, 0xf0, 0xbd, 0xc0, 0x46, 0xc5, 0x55, 0x00, 0x00, 0x00, 0x28, 0x00, 0x40, 0x09, 0x3b, 0x00, 0x00, 0x15, 0x21, 0x00, 0x00, 0x5c, 0x11, 0x00, 0x20, 0x55, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x43, 0x00, 0xe1, 0x00, 0xe0, 0xf1, 0x3a, 0x00, 0x00, 0xdd, 0x25, 0x00, 0x00, 0x04, 0x01, 0x00, 0x20, 0x04, 0x00, 0x00, 0x20, 0x25, 0x4b, 0x00, 0x00, 0x10, 0x01, 0x00, 0x20, 0x08, 0x01, 0x00, 0x20, 0x08, 0x00, 0x00, 0x20, 0xc5, 0x4b, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x19, 0x2c, 0x00, 0x00, 0xfd, 0x3a, 0x00, 0x00, 0xcd, 0x2d, 0x00, 0x00, 0x09, 0x2e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x81, 0x2d, 0x00, 0x00, 0xf0, 0xb5, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0xc0, 0xb5, 0x82, 0xb0, 0x02, 0x28, 0x00, 0xd1, 0x8e, 0xe0, 0x18, 0xd9, 0x04, 0x28, 0x44, 0xd0, 0x00, 0xd2, 0x7c, 0xe0, 0x55, 0x28, 0x0c, 0xd1, 0x50, 0x4c, 0x51, 0x4b, 0x24, 0x68, 0x51, 0x4a, 0x51, 0x49, 0x52, 0x48, 0x1b, 0x68, 0x12, 0x68, 0x09, 0x68, 0x00, 0x68, 0x00, 0x94, 0x50, 0x4c, 0xa0, 0x47, 0x02, 0xb0, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x00, 0x28, 0x5e, 0xd0, 0x01, 0x28, 0xf5, 0xd1, 0x4b, 0x4a, 0x4b, 0x4b, 0x17, 0x78, 0x00, 0x25, 0x5d, 0x5f, 0x4a, 0x4b, 0x51, 0x70, 0x5d, 0x80, 0x4a, 0x4c, 0xc8, 0x1b, 0x00, 0x26, 0x9e, 0x5f, 0xa0, 0x47, 0x80, 0x46, 0xa8, 0x1b, 0xa0, 0x47, 0x47, 0x4b, 0x01, 0x1c, 0x40, 0x46, 0x98, 0x47, 0x3f, 0x4b, 0x05, 0x1c, 0x18, 0x60, 0x38, 0x00, 0xa0, 0x47, 0x07, 0x1c, 0x30, 0x00, 0xa0, 0x47, 0x29, 0x1c, 0x41, 0x4b, 0x98, 0x47, 0x41, 0x4b, 0x01, 0x1c, 0x38, 0x1c, 0x98, 0x47, 0x36, 0x4b, 0x01, 0x1c, 0x18, 0x60, 0x28, 0x1c, 0x3e, 0x4b, 0x98, 0x47, 0xcb, 0xe7, 0x3e, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0xc7, 0xd0, 0x2f, 0x4b, 0x08, 0x00, 0x1e, 0x68, 0x3b, 0x4b, 0x98, 0x47, 0x01, 0x1c, 0xfe, 0x20, 0x34, 0x4b, 0x80, 0x05, 0x98, 0x47, 0x39, 0x4b, 0x07, 0x1c, 0x00, 0x20, 0x18, 0x5e, 0x30, 0x4b, 0x98, 0x46, 0x98, 0x47, 0x31, 0x1c, 0x31, 0x4b, 0x98, 0x47, 0x2f, 0x4c, 0x39, 0x1c, 0xa0, 0x47, 0x24, 0x4b, 0x05, 0x1c, 0x18, 0x60, 0x28, 0x4b, 0x00, 0x20, 0x18, 0x5e, 0xc0, 0x47, 0x23, 0x4b, 0x19, 0x68, 0xa0, 0x47, 0x20, 0x4b, 0x19, 0x68, 0x2d, 0x4b, 0x98, 0x47, 0x39, 0x1c, 0xa0, 0x47, 0x1a, 0x4b, 0x02, 0x1c, 0x18, 0x60, 0x31, 0x1c, 0x28, 0x1c, 0x2a, 0x4b, 0x98, 0x47, 0x98, 0xe7, 0x1c, 0x4b, 0x19, 0x70, 0x1c, 0x4b, 0x1a, 0x88, 0x1c, 0x4b, 0x1a, 0x80, 0x91, 0xe7, 0x21, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x00, 0xd1, 0x8c, 0xe7, 0x20, 0x4b, 0x00, 0x20, 0x18, 0x5e, 0x18, 0x4b, 0x98, 0x47, 0x0f, 0x4b, 0x18, 0x60, 0x84, 0xe7, 0x0e, 0x4b, 0x0d, 0x4d, 0x9a, 0x46, 0x0e, 0x4b, 0x0e, 0x4f, 0x98, 0x46, 0x09, 0x4e, 0x52, 0x46, 0x2b, 0x00, 0x41, 0x46, 0x38, 0x00, 0x00, 0x96, 0x19, 0x4c, 0xa0, 0x47, 0x43, 0x46, 0x38, 0x68, 0x19, 0x68, 0x11, 0x4b, 0x98, 0x47, 0x53, 0x46, 0x32, 0x68, 0x18, 0x68, 0x29, 0x68, 0x13, 0x4b, 0x98, 0x47, 0x6a, 0xe7, 0x10, 0x01, 0x00, 0x20, 0x08, 0x01, 0x00, 0x20, 0x08, 0x00, 0x00, 0x20, 0x04, 0x01, 0x00, 0x20, 0x04, 0x00, 0x00, 0x20, 0x79, 0x4d, 0x00, 0x00, 0x20, 0x01, 0x00, 0x20, 0x14, 0x01, 0x00, 0x20, 0x1c, 0x01, 0x00, 0x20, 0x45, 0x6a, 0x00, 0x00, 0xfd, 0x61, 0x00, 0x00, 0x8d, 0x64, 0x00, 0x00, 0xcd, 0x66, 0x00, 0x00, 0x95, 0x4b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x20, 0xe5, 0x6a, 0x00, 0x00, 0x16, 0x01, 0x00, 0x20, 0xd9, 0x5e, 0x00, 0x00, 0x59, 0x4c, 0x00, 0x00, 0x25, 0x4d, 0x00, 0x00, 0x00, 0x48, 0x70, 0x47, 0x0c, 0x01, 0x00, 0x20, 0x10, 0xb5, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x00, 0x20, 0x01, 0x21, 0x2f, 0x24, 0x07, 0x4b, 0x07, 0x4a, 0x19, 0x70, 0x10, 0x70, 0x5c, 0x70, 0x98, 0x70, 0x11, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x80, 0x22, 0x03, 0x4b, 0x92, 0x03, 0x5a, 0x61, 0x10, 0xbd, 0x0c, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x00, 0x28, 0x00, 0x40, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x02, 0x21, 0x00, 0x20, 0x08, 0x4b, 0x08, 0x4a, 0x19, 0x70, 0x01, 0x39, 0x10, 0x70, 0x59, 0x70, 0x98, 0x70, 0x11, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x80, 0x22, 0x04, 0x4b, 0x92, 0x03, 0x5a, 0x61, 0x70, 0x47, 0xc0, 0x46, 0x0c, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x00, 0x28, 0x00, 0x40, 0x70, 0xb5, 0x07, 0x4b, 0x07, 0x4d, 0x08, 0x4c, 0x28, 0x80, 0x18, 0x80, 0x00, 0x21, 0x20, 0x00, 0x06, 0x4b, 0x98, 0x47, 0x29, 0x88, 0x00, 0x22, 0x20, 0x00, 0x05, 0x4b, 0x98, 0x47, 0x70, 0xbd, 0x00, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00, 0x20, 0x7c, 0x01, 0x00, 0x20, 0x49, 0x2d, 0x00, 0x00, 0x81, 0x2d, 0x00, 0x00, 0x70, 0xb5, 0x27, 0x4b, 0x82, 0xb0, 0x1a, 0x78, 0x82, 0x42, 0x0b, 0xd0, 0x18, 0x70, 0x00, 0x28, 0x0a, 0xd1, 0x01, 0x22, 0x23, 0x4b, 0x24, 0x48, 0x1a, 0x70, 0x24, 0x4b, 0x98, 0x47, 0x24, 0x48, 0x24, 0x4b, 0x98, 0x47, 0x02, 0xb0, 0x70, 0xbd, 0x01, 0x25, 0x00, 0x26, 0x1d, 0x4b, 0x1e, 0x4c, 0x1d, 0x70, 0x21, 0x4b, 0x00, 0x21, 0x1e, 0x70, 0x20, 0x00, 0x20, 0x4b, 0x98, 0x47, 0x20, 0x4b, 0x00, 0x22, 0x19, 0x88, 0x20, 0x00, 0x1f, 0x4b, 0x98, 0x47, 0x08, 0x21, 0x20, 0x00, 0x1e, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x1d, 0x4b, 0x98, 0x47, 0x68, 0x46, 0x1d, 0x4b, 0x98, 0x47, 0x6a, 0x46, 0x02, 0x23, 0x13, 0x4c, 0x53, 0x70, 0x93, 0x70, 0x1a, 0x49, 0x20, 0x00, 0x1a, 0x4b, 0x98, 0x47, 0x68, 0x46, 0x1a, 0x4b, 0x98, 0x47, 0x6b, 0x46, 0x6a, 0x46, 0x5e, 0x70, 0x9d, 0x70, 0x20, 0x00, 0x00, 0x21, 0x17, 0x4b, 0x98, 0x47, 0x00, 0x21, 0x20, 0x00, 0x16, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x15, 0x4b, 0x98, 0x47, 0x15, 0x4a, 0x00, 0x21, 0x20, 0x00, 0x15, 0x4b, 0x98, 0x47, 0xc1, 0xe7, 0x02, 0x01, 0x00, 0x20, 0x18, 0x01, 0x00, 0x20, 0x7c, 0x01, 0x00, 0x20, 0xe5, 0x2b, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x20, 0xa5, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x49, 0x2d, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x20, 0x81, 0x2d, 0x00, 0x00, 0x09, 0x2e, 0x00, 0x00, 0xbd, 0x2b, 0x00, 0x00, 0x39, 0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x42, 0x45, 0x26, 0x00, 0x00, 0x01, 0x27, 0x00, 0x00, 0x15, 0x27, 0x00, 0x00, 0x81, 0x27, 0x00, 0x00, 0xb9, 0x26, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x91, 0x27, 0x00, 0x00, 0x70, 0xb5, 0x24, 0x4b, 0x82, 0xb0, 0x1a, 0x78, 0x82, 0x42, 0x0b, 0xd0, 0x18, 0x70, 0x00, 0x28, 0x0a, 0xd1, 0x01, 0x22, 0x20, 0x4b, 0x21, 0x48, 0x1a, 0x70, 0x21, 0x4b, 0x98, 0x47, 0x21, 0x48, 0x21, 0x4b, 0x98, 0x47, 0x02, 0xb0, 0x70, 0xbd, 0x80, 0x22, 0x01, 0x25, 0x00, 0x26, 0x1f, 0x4b, 0x92, 0x03, 0x9a, 0x61, 0x18, 0x4b, 0x19, 0x4c, 0x1d, 0x70, 0x1d, 0x4b, 0x08, 0x21, 0x1e, 0x70, 0x20, 0x00, 0x1c, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x1b, 0x4b, 0x98, 0x47, 0x68, 0x46, 0x1b, 0x4b, 0x98, 0x47, 0x6a, 0x46, 0x02, 0x23, 0x13, 0x4c, 0x53, 0x70, 0x93, 0x70, 0x18, 0x49, 0x20, 0x00, 0x18, 0x4b, 0x98, 0x47, 0x68, 0x46, 0x18, 0x4b, 0x98, 0x47, 0x6b, 0x46, 0x6a, 0x46, 0x5e, 0x70, 0x9d, 0x70, 0x20, 0x00, 0x00, 0x21, 0x15, 0x4b, 0x98, 0x47, 0x00, 0x21, 0x20, 0x00, 0x14, 0x4b, 0x98, 0x47, 0x20, 0x00, 0x13, 0x4b, 0x98, 0x47, 0x13, 0x4a, 0x00, 0x21, 0x20, 0x00, 0x13, 0x4b, 0x98, 0x47, 0xc7, 0xe7, 0x00, 0x01, 0x00, 0x20, 0x18, 0x01, 0x00, 0x20, 0x7c, 0x01, 0x00, 0x20, 0xe5, 0x2b, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x20, 0xa5, 0x26, 0x00, 0x00, 0x00, 0x28, 0x00, 0x40, 0x02, 0x01, 0x00, 0x20, 0x09, 0x2e, 0x00, 0x00, 0xbd, 0x2b, 0x00, 0x00, 0x39, 0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x42, 0x45, 0x26, 0x00, 0x00, 0x01, 0x27, 0x00, 0x00, 0x15, 0x27, 0x00, 0x00, 0x81, 0x27, 0x00, 0x00, 0xb9, 0x26, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x91, 0x27, 0x00, 0x00, 0x01, 0x4b, 0x18, 0x70, 0x70, 0x47, 0xc0, 0x46, 0x01, 0x01, 0x00, 0x20, 0xf0, 0xb5, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0x78, 0x4b, 0xc0, 0xb5, 0x98, 0x47, 0x80, 0x22, 0x77, 0x4b, 0x92, 0x03, 0x77, 0x4f, 0x9a, 0x61, 0x3b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x1f, 0x21, 0x1a, 0x89, 0x8a, 0x43, 0x1d, 0x39, 0x0a, 0x43, 0x1a, 0x81, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x6f, 0x4b, 0x01, 0x32, 0xff, 0x32, 0x9a, 0x61, 0x6f, 0x4b, 0xff, 0x3a, 0x19, 0x00, 0x98, 0x46, 0x6e, 0x4b, 0x38, 0x00, 0x9a, 0x46, 0x98, 0x47, 0x6d, 0x4e, 0x6d, 0x4c, 0x33, 0x78, 0x00, 0x2b, 0x16, 0xd1, 0x80, 0x22, 0x00, 0x25, 0x02, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x25, 0x70, 0x50, 0x70, 0x53, 0x78, 0x02, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x33, 0x78, 0x00, 0x2b, 0xed, 0xd0, 0x43, 0x46, 0x60, 0x4a, 0x1b, 0x88, 0x91, 0x46, 0x99, 0x44, 0x00, 0x23, 0x5f, 0x4d, 0x33, 0x70, 0x2b, 0x78, 0x00, 0x2b, 0x18, 0xd1, 0x00, 0x23, 0x80, 0x22, 0x9c, 0x46, 0x04, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x63, 0x46, 0x23, 0x70, 0x50, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x2b, 0x78, 0x00, 0x2b, 0xec, 0xd0, 0x00, 0x23, 0x2b, 0x70, 0x3b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x1f, 0x21, 0x1a, 0x89, 0x8a, 0x43, 0x18, 0x39, 0x0a, 0x43, 0x1a, 0x81, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x41, 0x4b, 0x01, 0x32, 0xff, 0x32, 0x5a, 0x61, 0x41, 0x46, 0xff, 0x3a, 0x38, 0x00, 0xd0, 0x47, 0x33, 0x78, 0x00, 0x2b, 0x18, 0xd1, 0x00, 0x23, 0x80, 0x22, 0x9c, 0x46, 0x02, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x63, 0x46, 0x23, 0x70, 0x50, 0x70, 0x53, 0x78, 0x02, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x33, 0x78, 0x00, 0x2b, 0xec, 0xd0, 0x43, 0x46, 0x18, 0x88, 0x34, 0x4b, 0x9c, 0x46, 0x4b, 0x46, 0x60, 0x44, 0x18, 0x1a, 0x34, 0x4b, 0x00, 0xb2, 0x18, 0x80, 0x33, 0x4b, 0x98, 0x47, 0x33, 0x4b, 0x19, 0x68, 0x33, 0x4b, 0x98, 0x47, 0x33, 0x4b, 0x19, 0x68, 0x33, 0x4b, 0x98, 0x47, 0x85, 0x21, 0x33, 0x4b, 0xc9, 0x05, 0x98, 0x47, 0x32, 0x4b, 0x98, 0x47, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x03, 0x21, 0x30, 0x4b, 0x00, 0x22, 0x58, 0x70, 0x00, 0x0a, 0x19, 0x70, 0x98, 0x70, 0x01, 0x23, 0x22, 0x70, 0x23, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x80, 0x21, 0x1a, 0x4b, 0x89, 0x03, 0x59, 0x61, 0x29, 0x4b, 0x32, 0x70, 0x98, 0x47, 0x3b, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x1f, 0x21, 0x1a, 0x89, 0x8a, 0x43, 0x0a, 0x43, 0x1a, 0x81, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x2b, 0x78, 0x00, 0x2b, 0x16, 0xd1, 0x80, 0x22, 0x00, 0x26, 0x04, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x26, 0x70, 0x50, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x2b, 0x78, 0x00, 0x2b, 0xed, 0xd0, 0x00, 0x23, 0x2b, 0x70, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x19, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x40, 0x5c, 0x11, 0x00, 0x20, 0xbc, 0x01, 0x00, 0x20, 0xf1, 0x25, 0x00, 0x00, 0x03, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x00, 0xc0, 0xff, 0xff, 0x18, 0x01, 0x00, 0x20, 0x16, 0x01, 0x00, 0x20, 0x45, 0x6a, 0x00, 0x00, 0x08, 0x01, 0x00, 0x20, 0xcd, 0x66, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0xfd, 0x61, 0x00, 0x00, 0x8d, 0x64, 0x00, 0x00, 0x6d, 0x5d, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x20, 0xdd, 0x3c, 0x00, 0x00, 0xf8, 0xb5, 0xde, 0x46, 0x4e, 0x46, 0x57, 0x46, 0x45, 0x46, 0x76, 0x4b, 0xe0, 0xb5, 0x98, 0x47, 0x75, 0x4e, 0x33, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x1f, 0x21, 0x1a, 0x89, 0x8a, 0x43, 0x1d, 0x39, 0x0a, 0x43, 0x1a, 0x81, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x6f, 0x4b, 0x01, 0x32, 0xff, 0x32, 0x9a, 0x61, 0x6e, 0x4b, 0xff, 0x3a, 0x6e, 0x49, 0x30, 0x00, 0x99, 0x46, 0x98, 0x47, 0x6d, 0x4d, 0x6e, 0x4c, 0x2b, 0x78, 0x00, 0x2b, 0x16, 0xd1, 0x80, 0x22, 0x00, 0x27, 0x02, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x27, 0x70, 0x50, 0x70, 0x53, 0x78, 0x02, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x2b, 0x78, 0x00, 0x2b, 0xed, 0xd0, 0x61, 0x4a, 0x5e, 0x4b, 0x90, 0x46, 0x1b, 0x88, 0x98, 0x44, 0x00, 0x23, 0x2b, 0x70, 0x33, 0x68, 0x1a, 0x8c, 0x00, 0x2a, 0xfc, 0xd1, 0x1f, 0x21, 0x1a, 0x89, 0x8a, 0x43, 0x18, 0x39, 0x0a, 0x43, 0x1a, 0x81, 0x1f, 0x8c, 0xbf, 0xb2, 0x00, 0x2f, 0xfb, 0xd1, 0x58, 0x4b, 0x00, 0x21, 0x9b, 0x46, 0x18, 0x00, 0x57, 0x4b, 0x98, 0x47, 0x08, 0x21, 0x56, 0x4b, 0x00, 0x22, 0x58, 0x46, 0x98, 0x47, 0x55, 0x49, 0x0f, 0x70, 0x0b, 0x78, 0x00, 0x2b, 0x18, 0xd1, 0x00, 0x23, 0x80, 0x22, 0x9a, 0x46, 0x04, 0x27, 0x01, 0x20, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x53, 0x46, 0x23, 0x70, 0x57, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x20, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x0b, 0x78, 0x00, 0x2b, 0xec, 0xd0, 0x00, 0x23, 0x80, 0x22, 0x0b, 0x70, 0x3c, 0x4b, 0x52, 0x00, 0x5a, 0x61, 0x3c, 0x49, 0xff, 0x3a, 0x30, 0x00, 0xc8, 0x47, 0x2b, 0x78, 0x00, 0x2b, 0x16, 0xd1, 0x80, 0x22, 0x00, 0x27, 0x02, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x27, 0x70, 0x50, 0x70, 0x53, 0x78, 0x02, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x2b, 0x78, 0x00, 0x2b, 0xed, 0xd0, 0x2d, 0x4b, 0x18, 0x88, 0x2f, 0x4b, 0x9c, 0x46, 0x43, 0x46, 0x60, 0x44, 0x18, 0x1a, 0x32, 0x4b, 0x00, 0xb2, 0x18, 0x80, 0x31, 0x4b, 0x98, 0x47, 0x31, 0x4b, 0x19, 0x68, 0x31, 0x4b, 0x98, 0x47, 0x31, 0x4b, 0x19, 0x68, 0x31, 0x4b, 0x98, 0x47, 0x85, 0x21, 0x31, 0x4b, 0xc9, 0x05, 0x98, 0x47, 0x30, 0x4b, 0x98, 0x47, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x03, 0x21, 0x2e, 0x4b, 0x00, 0x22, 0x58, 0x70, 0x00, 0x0a, 0x19, 0x70, 0x98, 0x70, 0x01, 0x23, 0x22, 0x70, 0x23, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x29, 0x4b, 0x2a, 0x70, 0x98, 0x47, 0x32, 0x68, 0x13, 0x8c, 0x00, 0x2b, 0xfc, 0xd1, 0x1f, 0x21, 0x13, 0x89, 0x8b, 0x43, 0x0b, 0x43, 0x13, 0x81, 0x13, 0x8c, 0x9b, 0xb2, 0x00, 0x2b, 0xfb, 0xd1, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x80, 0x22, 0x23, 0x70, 0xd2, 0x05, 0x04, 0x33, 0x53, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x03, 0x3b, 0x23, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf8, 0xbd, 0xc0, 0x46, 0x19, 0x3c, 0x00, 0x00, 0x5c, 0x11, 0x00, 0x20, 0x00, 0x28, 0x00, 0x40, 0xf1, 0x25, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x20, 0x03, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x00, 0xc0, 0xff, 0xff, 0x7c, 0x01, 0x00, 0x20, 0x49, 0x2d, 0x00, 0x00, 0x81, 0x2d, 0x00, 0x00, 0x18, 0x01, 0x00, 0x20, 0x16, 0x01, 0x00, 0x20, 0x45, 0x6a, 0x00, 0x00, 0x08, 0x01, 0x00, 0x20, 0xcd, 0x66, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0xfd, 0x61, 0x00, 0x00, 0x8d, 0x64, 0x00, 0x00, 0x6d, 0x5d, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x20, 0xdd, 0x3c, 0x00, 0x00, 0xf8, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0x45, 0x46, 0xde, 0x46, 0xb5, 0x4b, 0xe0, 0xb5, 0x99, 0x46, 0xb4, 0x4b, 0x02, 0x27, 0x9a, 0x46, 0xb4, 0x4b, 0xb4, 0x4d, 0x98, 0x46, 0xb4, 0x4c, 0xb5, 0x4e, 0xb5, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x00, 0xd0, 0x8f, 0xe0, 0xb4, 0x4b, 0x1b, 0x78, 0xdb, 0xb2, 0x00, 0x2b, 0x00, 0xd1, 0x3f, 0xe1, 0x80, 0x22, 0xb1, 0x4b, 0x52, 0x00, 0x9a, 0x61, 0xb1, 0x49, 0xb1, 0x4b, 0xff, 0x3a, 0xb1, 0x48, 0x98, 0x47, 0x2b, 0x78, 0x00, 0x2b, 0x15, 0xd1, 0x80, 0x22, 0x00, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x20, 0x70, 0x57, 0x70, 0x53, 0x78, 0x02, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x2b, 0x78, 0x00, 0x2b, 0xed, 0xd0, 0xa2, 0x4b, 0x18, 0x88, 0xa4, 0x4b, 0x9c, 0x46, 0xa4, 0x4b, 0x60, 0x44, 0x00, 0xb2, 0x18, 0x80, 0xa3, 0x4b, 0x98, 0x47, 0x4b, 0x46, 0x19, 0x68, 0xa2, 0x4b, 0x98, 0x47, 0x53, 0x46, 0x19, 0x68, 0xa1, 0x4b, 0x98, 0x47, 0xa1, 0x4b, 0x83, 0x46, 0x1b, 0x78, 0x00, 0x2b, 0x16, 0xd0, 0x9f, 0x4b, 0x00, 0x20, 0x18, 0x5e, 0x9a, 0x4b, 0x98, 0x47, 0x9e, 0x4b, 0x01, 0x1c, 0x18, 0x68, 0x9d, 0x4b, 0x98, 0x47, 0x9d, 0x4b, 0x19, 0x68, 0x9d, 0x4b, 0x98, 0x47, 0x9d, 0x4b, 0x19, 0x68, 0x94, 0x4b, 0x98, 0x47, 0x94, 0x4b, 0x01, 0x1c, 0x58, 0x46, 0x98, 0x47, 0x83, 0x46, 0x85, 0x21, 0x90, 0x4b, 0xc9, 0x05, 0x58, 0x46, 0x98, 0x47, 0x97, 0x4b, 0x98, 0x47, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x42, 0x46, 0x00, 0x23, 0x50, 0x70, 0x00, 0x0a, 0x13, 0x70, 0x90, 0x70, 0x01, 0x22, 0x23, 0x70, 0x22, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x80, 0x21, 0x7e, 0x4a, 0x49, 0x00, 0x2b, 0x70, 0x51, 0x61, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x80, 0x22, 0x23, 0x70, 0xd2, 0x05, 0x04, 0x33, 0x53, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x03, 0x3b, 0x23, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x7c, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x00, 0xd1, 0x71, 0xe7, 0x81, 0x4b, 0x98, 0x47, 0x6d, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x00, 0xd1, 0x6f, 0xe7, 0x80, 0x22, 0x6c, 0x4b, 0x92, 0x03, 0x9a, 0x61, 0x80, 0x22, 0x52, 0x00, 0x9a, 0x61, 0x6a, 0x49, 0x6b, 0x4b, 0xff, 0x3a, 0x6b, 0x48, 0x98, 0x47, 0x2b, 0x78, 0x00, 0x2b, 0x15, 0xd1, 0x80, 0x22, 0x00, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x20, 0x70, 0x57, 0x70, 0x53, 0x78, 0x02, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x2b, 0x78, 0x00, 0x2b, 0xed, 0xd0, 0x5b, 0x4b, 0x18, 0x88, 0x5d, 0x4b, 0x9c, 0x46, 0x5d, 0x4b, 0x60, 0x44, 0x00, 0xb2, 0x18, 0x80, 0x5c, 0x4b, 0x98, 0x47, 0x4b, 0x46, 0x19, 0x68, 0x5b, 0x4b, 0x98, 0x47, 0x53, 0x46, 0x19, 0x68, 0x5a, 0x4b, 0x98, 0x47, 0x5a, 0x4b, 0x83, 0x46, 0x1b, 0x78, 0x00, 0x2b, 0x16, 0xd0, 0x59, 0x4b, 0x00, 0x20, 0x18, 0x5e, 0x53, 0x4b, 0x98, 0x47, 0x57, 0x4b, 0x01, 0x1c, 0x18, 0x68, 0x57, 0x4b, 0x98, 0x47, 0x57, 0x4b, 0x19, 0x68, 0x57, 0x4b, 0x98, 0x47, 0x57, 0x4b, 0x19, 0x68, 0x4e, 0x4b, 0x98, 0x47, 0x4e, 0x4b, 0x01, 0x1c, 0x58, 0x46, 0x98, 0x47, 0x83, 0x46, 0x85, 0x21, 0x4a, 0x4b, 0xc9, 0x05, 0x58, 0x46, 0x98, 0x47, 0x51, 0x4b, 0x98, 0x47, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x42, 0x46, 0x00, 0x23, 0x50, 0x70, 0x00, 0x0a, 0x13, 0x70, 0x90, 0x70, 0x01, 0x22, 0x23, 0x70, 0x22, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x80, 0x21, 0x38, 0x4a, 0x89, 0x03, 0x51, 0x61, 0x2b, 0x70, 0x33, 0x78, 0x00, 0x2b, 0x18, 0xd1, 0x00, 0x23, 0x80, 0x22, 0x9c, 0x46, 0x04, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x63, 0x46, 0x23, 0x70, 0x50, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x33, 0x78, 0x00, 0x2b, 0xec, 0xd0, 0x00, 0x23, 0x80, 0x22, 0x33, 0x70, 0x26, 0x4b, 0x52, 0x00, 0x5a, 0x61, 0x33, 0x78, 0x00, 0x2b, 0x18, 0xd1, 0x00, 0x23, 0x80, 0x22, 0x9c, 0x46, 0x04, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x63, 0x46, 0x23, 0x70, 0x50, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x33, 0x78, 0x00, 0x2b, 0xec, 0xd0, 0x00, 0x23, 0x33, 0x70, 0x1f, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x00, 0xd1, 0xb7, 0xe6, 0x25, 0x4b, 0x98, 0x47, 0xb4, 0xe6, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x80, 0x22, 0x23, 0x70, 0x04, 0x23, 0xd2, 0x05, 0x53, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x03, 0x3b, 0x23, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0xa0, 0xe6, 0xc0, 0x46, 0x04, 0x00, 0x00, 0x20, 0x04, 0x01, 0x00, 0x20, 0x0c, 0x01, 0x00, 0x20, 0x03, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x18, 0x01, 0x00, 0x20, 0x02, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x20, 0x00, 0x28, 0x00, 0x40, 0xbc, 0x01, 0x00, 0x20, 0xf1, 0x25, 0x00, 0x00, 0x5c, 0x11, 0x00, 0x20, 0x00, 0xc0, 0xff, 0xff, 0x14, 0x01, 0x00, 0x20, 0x45, 0x6a, 0x00, 0x00, 0x8d, 0x64, 0x00, 0x00, 0xd9, 0x5e, 0x00, 0x00, 0x01, 0x01, 0x00, 0x20, 0x16, 0x01, 0x00, 0x20, 0x08, 0x01, 0x00, 0x20, 0xcd, 0x66, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0xfd, 0x61, 0x00, 0x00, 0x10, 0x01, 0x00, 0x20, 0x6d, 0x5d, 0x00, 0x00, 0x7d, 0x45, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x10, 0xb5, 0x05, 0x4c, 0xa0, 0x47, 0x16, 0x28, 0x05, 0xd0, 0x00, 0x28, 0x02, 0xd0, 0x03, 0x4b, 0x98, 0x47, 0xa0, 0x47, 0x10, 0xbd, 0xfe, 0xe7, 0xb5, 0x37, 0x00, 0x00, 0xad, 0x38, 0x00, 0x00, 0x70, 0xb5, 0x04, 0x00, 0x90, 0xb0, 0x14, 0x4b, 0x0e, 0x00, 0x00, 0x20, 0x01, 0xa9, 0x98, 0x47, 0x04, 0x22, 0x01, 0xa9, 0x20, 0x00, 0x11, 0x4d, 0xa8, 0x47, 0x20, 0x68, 0x10, 0x4b, 0x98, 0x47, 0x00, 0x28, 0x05, 0xd1, 0x04, 0x22, 0x02, 0xa9, 0x30, 0x00, 0xa8, 0x47, 0x10, 0xb0, 0x70, 0xbd, 0x0c, 0x4b, 0x21, 0x00, 0x23, 0x60, 0x00, 0x23, 0x04, 0x22, 0x33, 0x60, 0x01, 0xa8, 0xa8, 0x47, 0x04, 0x22, 0x31, 0x00, 0x02, 0xa8, 0xa8, 0x47, 0x01, 0xa9, 0x07, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x06, 0x4b, 0x98, 0x47, 0xea, 0xe7, 0xc0, 0x46, 0x45, 0x3a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0x59, 0x5d, 0x00, 0x00, 0xcd, 0xcc, 0x4c, 0x3d, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0x30, 0xb5, 0x91, 0xb0, 0x05, 0x1c, 0x0c, 0x1c, 0x06, 0x4b, 0x01, 0xa9, 0x00, 0x20, 0x98, 0x47, 0x01, 0xa9, 0x01, 0x95, 0x02, 0x94, 0x04, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x03, 0x4b, 0x98, 0x47, 0x11, 0xb0, 0x30, 0xbd, 0x45, 0x3a, 0x00, 0x00, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0xf0, 0xb5, 0x91, 0xb0, 0x05, 0x00, 0x1d, 0x4b, 0x0f, 0x00, 0x00, 0x20, 0x01, 0xa9, 0x16, 0x00, 0x98, 0x47, 0x15, 0x23, 0x6b, 0x44, 0x19, 0x00, 0x04, 0x22, 0x28, 0x00, 0x18, 0x4c, 0xa0, 0x47, 0x28, 0x68, 0x18, 0x4b, 0x98, 0x47, 0x00, 0x28, 0x0b, 0xd1, 0x19, 0x21, 0x04, 0x22, 0x69, 0x44, 0x38, 0x00, 0xa0, 0x47, 0x1d, 0x21, 0x04, 0x22, 0x69, 0x44, 0x30, 0x00, 0xa0, 0x47, 0x11, 0xb0, 0xf0, 0xbd, 0x11, 0x4b, 0x29, 0x00, 0x2b, 0x60, 0x00, 0x23, 0x3b, 0x60, 0x33, 0x60, 0x15, 0x23, 0x6b, 0x44, 0x18, 0x00, 0x04, 0x22, 0xa0, 0x47, 0x19, 0x20, 0x39, 0x00, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x1d, 0x20, 0x04, 0x22, 0x31, 0x00, 0x68, 0x44, 0xa0, 0x47, 0x01, 0xa9, 0x07, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x06, 0x4b, 0x98, 0x47, 0xe1, 0xe7, 0xc0, 0x46, 0x45, 0x3a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0x59, 0x5d, 0x00, 0x00, 0xcd, 0xcc, 0x4c, 0x3d, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0x10, 0xb5, 0x94, 0xb0, 0x0f, 0x4b, 0x03, 0x90, 0x02, 0x91, 0x00, 0x20, 0x05, 0xa9, 0x01, 0x92, 0x98, 0x47, 0x25, 0x20, 0x0c, 0x4c, 0x03, 0xa9, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x29, 0x20, 0x02, 0xa9, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x2d, 0x20, 0x04, 0x22, 0x01, 0xa9, 0x68, 0x44, 0xa0, 0x47, 0x05, 0xa9, 0x05, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x05, 0x4b, 0x98, 0x47, 0x14, 0xb0, 0x10, 0xbd, 0xc0, 0x46, 0x45, 0x3a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0x10, 0xb5, 0x90, 0xb0, 0x01, 0xac, 0x21, 0x00, 0x06, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x01, 0x22, 0x3b, 0x23, 0x21, 0x00, 0xe2, 0x54, 0x00, 0x20, 0x03, 0x4b, 0x98, 0x47, 0x03, 0x4b, 0x98, 0x47, 0x10, 0xb0, 0x10, 0xbd, 0x45, 0x3a, 0x00, 0x00, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0x30, 0xb5, 0x05, 0x00, 0x91, 0xb0, 0x01, 0xac, 0x21, 0x00, 0x06, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x21, 0x00, 0x05, 0x4b, 0x00, 0x20, 0x25, 0x72, 0x98, 0x47, 0x04, 0x4b, 0x98, 0x47, 0x11, 0xb0, 0x30, 0xbd, 0xc0, 0x46, 0x45, 0x3a, 0x00, 0x00, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0x10, 0xb5, 0x90, 0xb0, 0x01, 0xac, 0x21, 0x00, 0x02, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x20, 0x7a, 0x10, 0xb0, 0x10, 0xbd, 0x45, 0x3a, 0x00, 0x00, 0xf0, 0xb5, 0x91, 0xb0, 0x04, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x01, 0xa9, 0x0f, 0x4b, 0x00, 0x20, 0x16, 0x00, 0x98, 0x47, 0x0d, 0x21, 0x04, 0x22, 0x69, 0x44, 0x20, 0x00, 0x0c, 0x4c, 0xa0, 0x47, 0x11, 0x21, 0x04, 0x22, 0x69, 0x44, 0x38, 0x00, 0xa0, 0x47, 0x21, 0x21, 0x04, 0x22, 0x69, 0x44, 0x30, 0x00, 0xa0, 0x47, 0x25, 0x21, 0x04, 0x22, 0x69, 0x44, 0x28, 0x00, 0xa0, 0x47, 0x29, 0x21, 0x04, 0x22, 0x69, 0x44, 0x16, 0x98, 0xa0, 0x47, 0x11, 0xb0, 0xf0, 0xbd, 0x45, 0x3a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0x10, 0xb5, 0x94, 0xb0, 0x03, 0x90, 0x02, 0x91, 0x00, 0x93, 0x05, 0xa9, 0x12, 0x4b, 0x00, 0x20, 0x01, 0x92, 0x98, 0x47, 0x1d, 0x20, 0x11, 0x4c, 0x03, 0xa9, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x21, 0x20, 0x02, 0xa9, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x31, 0x20, 0x01, 0xa9, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x35, 0x20, 0x69, 0x46, 0x04, 0x22, 0x68, 0x44, 0xa0, 0x47, 0x39, 0x20, 0x04, 0x22, 0x16, 0xa9, 0x68, 0x44, 0xa0, 0x47, 0x05, 0xa9, 0x05, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x04, 0x4b, 0x98, 0x47, 0x14, 0xb0, 0x10, 0xbd, 0x45, 0x3a, 0x00, 0x00, 0xf5, 0x6b, 0x00, 0x00, 0x1d, 0x3a, 0x00, 0x00, 0xb5, 0x3a, 0x00, 0x00, 0xbf, 0xf3, 0x4f, 0x8f, 0x02, 0x4a, 0x03, 0x4b, 0xda, 0x60, 0xbf, 0xf3, 0x4f, 0x8f, 0xfe, 0xe7, 0x04, 0x00, 0xfa, 0x05, 0x00, 0xed, 0x00, 0xe0, 0x80, 0x22, 0x02, 0x4b, 0x92, 0x03, 0x9a, 0x61, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x28, 0x00, 0x40, 0x70, 0xb5, 0x08, 0x4b, 0x08, 0x4c, 0x05, 0x00, 0x19, 0x68, 0x03, 0x22, 0x20, 0x00, 0x07, 0x4b, 0x98, 0x47, 0x03, 0x23, 0x06, 0x49, 0x28, 0x00, 0x0b, 0x80, 0x06, 0x4b, 0x4c, 0x60, 0x98, 0x47, 0x70, 0xbd, 0xc0, 0x46, 0x24, 0x01, 0x00, 0x20, 0x34, 0x01, 0x00, 0x20, 0xf5, 0x6b, 0x00, 0x00, 0x28, 0x01, 0x00, 0x20, 0x25, 0x31, 0x00, 0x00, 0x03, 0x23, 0x10, 0xb5, 0x03, 0x49, 0x0b, 0x80, 0x03, 0x4b, 0x4b, 0x60, 0x03, 0x4b, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46, 0x28, 0x01, 0x00, 0x20, 0x30, 0x01, 0x00, 0x20, 0xfd, 0x30, 0x00, 0x00, 0x10, 0xb5, 0x25, 0x4b, 0x5a, 0x68, 0x13, 0x78, 0x0a, 0x2b, 0x05, 0xd8, 0x23, 0x49, 0x9b, 0x00, 0xcb, 0x58, 0x9f, 0x46, 0x22, 0x4b, 0x98, 0x47, 0x10, 0xbd, 0x22, 0x4b, 0x98, 0x47, 0x22, 0x4b, 0x98, 0x47, 0x50, 0x78, 0x43, 0xb2, 0x00, 0x2b, 0xf6, 0xdd, 0x20, 0x4b, 0x98, 0x47, 0x1e, 0x4b, 0x98, 0x47, 0x50, 0x78, 0x1e, 0x4b, 0x98, 0x47, 0xee, 0xe7, 0x1e, 0x4b, 0x98, 0x47, 0xeb, 0xe7, 0x91, 0x78, 0x50, 0x78, 0x1c, 0x4b, 0x98, 0x47, 0xe6, 0xe7, 0x50, 0x78, 0x1b, 0x4b, 0x98, 0x47, 0xe2, 0xe7, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x00, 0x23, 0x80, 0x22, 0x18, 0x49, 0xd2, 0x05, 0x0b, 0x70, 0x06, 0x33, 0x53, 0x70, 0x53, 0x78, 0x06, 0x2b, 0xfc, 0xd1, 0x05, 0x3b, 0x0b, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0xcc, 0xe7, 0x50, 0x78, 0x10, 0x4b, 0x98, 0x47, 0xc8, 0xe7, 0x93, 0x78, 0x50, 0x78, 0x1b, 0x02, 0x18, 0x43, 0xc3, 0xd0, 0x0d, 0x4b, 0x98, 0x47, 0xc0, 0xe7, 0xc0, 0x46, 0x28, 0x01, 0x00, 0x20, 0x70, 0x6e, 0x00, 0x00, 0xf9, 0x40, 0x00, 0x00, 0xad, 0x4c, 0x00, 0x00, 0xe1, 0x4d, 0x00, 0x00, 0xdd, 0x4c, 0x00, 0x00, 0x59, 0x42, 0x00, 0x00, 0xc1, 0x40, 0x00, 0x00, 0x05, 0x3f, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x20, 0x65, 0x41, 0x00, 0x00, 0x31, 0x41, 0x00, 0x00, 0x70, 0xb5, 0x8a, 0xb0, 0x00, 0x23, 0x6a, 0x46, 0x13, 0x70, 0x80, 0x22, 0x92, 0x03, 0x01, 0x92, 0x23, 0x4a, 0x69, 0x46, 0x02, 0x92, 0x6a, 0x46, 0x13, 0x74, 0x53, 0x74, 0x13, 0x76, 0x53, 0x76, 0x93, 0x76, 0x24, 0x22, 0x8b, 0x54, 0x01, 0x32, 0x8b, 0x54, 0x01, 0x32, 0x03, 0x93, 0x05, 0x93, 0x07, 0x93, 0x08, 0x93, 0x8b, 0x54, 0x1b, 0x4b, 0x98, 0x47, 0x43, 0xb2, 0x00, 0x2b, 0x2a, 0xdd, 0x80, 0xb2, 0x6b, 0x46, 0x6a, 0x46, 0x98, 0x81, 0x00, 0x23, 0x53, 0x81, 0x16, 0x4b, 0x01, 0x24, 0x07, 0x93, 0x16, 0x4b, 0x16, 0x4e, 0x08, 0x93, 0x02, 0x23, 0x16, 0x49, 0x53, 0x76, 0x30, 0x00, 0x15, 0x4b, 0x94, 0x76, 0x98, 0x47, 0x35, 0x68, 0x14, 0x4b, 0x28, 0x00, 0x98, 0x47, 0x1f, 0x23, 0x18, 0x40, 0x84, 0x40, 0x03, 0x22, 0x12, 0x4b, 0x1c, 0x60, 0x31, 0x68, 0xcb, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x02, 0x22, 0x2b, 0x68, 0x13, 0x43, 0x2b, 0x60, 0x0e, 0x4b, 0x98, 0x47, 0x0e, 0x4b, 0x18, 0x60, 0x0a, 0xb0, 0x70, 0xbd, 0x12, 0x20, 0x0c, 0x4b, 0x98, 0x47, 0x12, 0x20, 0xd0, 0xe7, 0xff, 0xff, 0x00, 0x00, 0x0d, 0x4d, 0x00, 0x00, 0x03, 0x00, 0x16, 0x00, 0x03, 0x00, 0x17, 0x00, 0x7c, 0x11, 0x00, 0x20, 0x00, 0x04, 0x00, 0x43, 0x45, 0x2f, 0x00, 0x00, 0xbd, 0x52, 0x00, 0x00, 0x00, 0xe1, 0x00, 0xe0, 0xb9, 0x40, 0x00, 0x00, 0x24, 0x01, 0x00, 0x20, 0xdd, 0x4c, 0x00, 0x00, 0xf8, 0xb5, 0x14, 0x4c, 0x25, 0x25, 0x14, 0x4e, 0x20, 0x00, 0x02, 0x22, 0x13, 0x49, 0xb0, 0x47, 0x04, 0x22, 0x02, 0x27, 0x63, 0x5d, 0x20, 0x00, 0x13, 0x43, 0x63, 0x55, 0x23, 0x68, 0x01, 0x3a, 0x9f, 0x75, 0x0f, 0x49, 0xb0, 0x47, 0x08, 0x22, 0x63, 0x5d, 0x20, 0x00, 0x13, 0x43, 0x63, 0x55, 0x23, 0x68, 0x07, 0x3a, 0x9f, 0x75, 0x0b, 0x49, 0xb0, 0x47, 0x02, 0x22, 0x63, 0x5d, 0x0a, 0x49, 0x13, 0x43, 0x20, 0x00, 0x00, 0x22, 0x63, 0x55, 0xb0, 0x47, 0x01, 0x22, 0x63, 0x5d, 0x13, 0x43, 0x63, 0x55, 0xf8, 0xbd, 0x7c, 0x11, 0x00, 0x20, 0xe1, 0x30, 0x00, 0x00, 0x09, 0x4e, 0x00, 0x00, 0x41, 0x4e, 0x00, 0x00, 0x61, 0x4e, 0x00, 0x00, 0xf9, 0x4d, 0x00, 0x00, 0x30, 0xb5, 0x0e, 0x4c, 0x83, 0xb0, 0x23, 0x78, 0x05, 0x00, 0x00, 0x2b, 0x06, 0xd0, 0x00, 0x29, 0x04, 0xd1, 0x63, 0x78, 0x83, 0x42, 0x0f, 0xd0, 0x1d, 0x20, 0x0b, 0xe0, 0x01, 0xa9, 0x11, 0x20, 0x07, 0x4b, 0x0d, 0x70, 0x98, 0x47, 0x11, 0x20, 0x06, 0x4b, 0x98, 0x47, 0x01, 0x23, 0x00, 0x20, 0x65, 0x70, 0x23, 0x70, 0x03, 0xb0, 0x30, 0xbd, 0x00, 0x20, 0xfb, 0xe7, 0x38, 0x01, 0x00, 0x20, 0xf9, 0x59, 0x00, 0x00, 0x39, 0x5a, 0x00, 0x00, 0x3a, 0x4b, 0x98, 0x42, 0x44, 0xd0, 0x0a, 0xd9, 0x39, 0x4b, 0x98, 0x42, 0x18, 0xd0, 0x39, 0x4b, 0x98, 0x42, 0x33, 0xd0, 0x38, 0x4b, 0x98, 0x42, 0x1c, 0xd0, 0x00, 0x20, 0x70, 0x47, 0x84, 0x23, 0xdb, 0x05, 0x98, 0x42, 0x20, 0xd0, 0x35, 0x4b, 0x98, 0x42, 0xf6, 0xd1, 0x01, 0x29, 0x43, 0xd0, 0x00, 0x29, 0x3f, 0xd0, 0x02, 0x29, 0x3b, 0xd0, 0x03, 0x29, 0xee, 0xd1, 0x30, 0x48, 0xed, 0xe7, 0x01, 0x29, 0x31, 0xd0, 0x00, 0x29, 0x2d, 0xd0, 0x02, 0x29, 0x2f, 0xd0, 0x03, 0x29, 0xe4, 0xd1, 0x2c, 0x48, 0xe3, 0xe7, 0x01, 0x29, 0x3f, 0xd0, 0x00, 0x29, 0x3b, 0xd0, 0x02, 0x29, 0x37, 0xd0, 0x03, 0x29, 0xda, 0xd1, 0x28, 0x48, 0xd9, 0xe7, 0x01, 0x29, 0x3d, 0xd0, 0x00, 0x29, 0x39, 0xd0, 0x02, 0x29, 0x2b, 0xd0, 0x03, 0x29, 0xd0, 0xd1, 0x24, 0x48, 0xcf, 0xe7, 0x01, 0x29, 0x23, 0xd0, 0x00, 0x29, 0x1f, 0xd0, 0x02, 0x29, 0x1b, 0xd0, 0x03, 0x29, 0xc6, 0xd1, 0x20, 0x48, 0xc5, 0xe7, 0x01, 0x29, 0x25, 0xd0, 0x00, 0x29, 0x21, 0xd0, 0x02, 0x29, 0x0f, 0xd0, 0x03, 0x29, 0xbc, 0xd1, 0x1c, 0x48, 0xbb, 0xe7, 0x1c, 0x48, 0xb9, 0xe7, 0x1c, 0x48, 0xb7, 0xe7, 0x1c, 0x48, 0xb5, 0xe7, 0x1c, 0x48, 0xb3, 0xe7, 0x03, 0x20, 0xb1, 0xe7, 0x1b, 0x48, 0xaf, 0xe7, 0x1b, 0x48, 0xad, 0xe7, 0x1b, 0x48, 0xab, 0xe7, 0x1b, 0x48, 0xa9, 0xe7, 0x1b, 0x48, 0xa7, 0xe7, 0x1b, 0x48, 0xa5, 0xe7, 0x1b, 0x48, 0xa3, 0xe7, 0x1b, 0x48, 0xa1, 0xe7, 0x1b, 0x48, 0x9f, 0xe7, 0x1b, 0x48, 0x9d, 0xe7, 0x1b, 0x48, 0x9b, 0xe7, 0x1b, 0x48, 0x99, 0xe7, 0x1b, 0x48, 0x97, 0xe7, 0x00, 0x08, 0x00, 0x42, 0x00, 0x10, 0x00, 0x42, 0x00, 0x04, 0x00, 0x43, 0x00, 0x0c, 0x00, 0x42, 0x00, 0x04, 0x00, 0x42, 0x03, 0x00, 0x1f, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x13, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x00, 0x19, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x18, 0x00, 0x03, 0x00, 0x16, 0x00, 0x03, 0x00, 0x17, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x12, 0x00, 0x03, 0x00, 0x10, 0x00, 0x03, 0x00, 0x11, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x09, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x05, 0x00, 0x70, 0xb5, 0x86, 0xb0, 0x01, 0x00, 0x68, 0x46, 0x15, 0x4b, 0x70, 0xcb, 0x70, 0xc0, 0x70, 0xcb, 0x70, 0xc0, 0x00, 0x9b, 0x8b, 0x42, 0x11, 0xd0, 0x01, 0x9b, 0x8b, 0x42, 0x11, 0xd0, 0x02, 0x9b, 0x8b, 0x42, 0x11, 0xd0, 0x03, 0x9b, 0x8b, 0x42, 0x11, 0xd0, 0x04, 0x9b, 0x8b, 0x42, 0x11, 0xd0, 0x05, 0x9b, 0x00, 0x20, 0x8b, 0x42, 0x10, 0xd0, 0x06, 0xb0, 0x70, 0xbd, 0x00, 0x20, 0xc0, 0xb2, 0xfa, 0xe7, 0x01, 0x20, 0xc0, 0xb2, 0xf7, 0xe7, 0x02, 0x20, 0xc0, 0xb2, 0xf4, 0xe7, 0x03, 0x20, 0xc0, 0xb2, 0xf1, 0xe7, 0x04, 0x20, 0xc0, 0xb2, 0xee, 0xe7, 0x05, 0x30, 0xc0, 0xb2, 0xeb, 0xe7, 0x9c, 0x6e, 0x00, 0x00, 0x70, 0x47, 0xc0, 0x46, 0xf8, 0xb5, 0x0c, 0x4e, 0x05, 0x00, 0x33, 0x78, 0x0f, 0x00, 0x0b, 0x4c, 0x00, 0x2b, 0x0d, 0xd1, 0x0a, 0x4b, 0x18, 0x22, 0x23, 0x60, 0x63, 0x60, 0xa3, 0x60, 0xe3, 0x60, 0x23, 0x61, 0x63, 0x61, 0x00, 0x21, 0x07, 0x4b, 0x07, 0x48, 0x98, 0x47, 0x01, 0x23, 0x33, 0x70, 0xad, 0x00, 0x67, 0x51, 0xf8, 0xbd, 0xc0, 0x46, 0x3a, 0x01, 0x00, 0x20, 0x3c, 0x01, 0x00, 0x20, 0x71, 0x52, 0x00, 0x00, 0x07, 0x6c, 0x00, 0x00, 0xb0, 0x11, 0x00, 0x20, 0x00, 0xb5, 0x83, 0xb0, 0x6a, 0x46, 0x08, 0x23, 0x13, 0x70, 0x01, 0x33, 0x53, 0x70, 0x01, 0x33, 0x93, 0x70, 0x01, 0x33, 0xd3, 0x70, 0x01, 0x33, 0x13, 0x71, 0x01, 0x33, 0x53, 0x71, 0x03, 0x4b, 0x98, 0x47, 0x6b, 0x46, 0x18, 0x56, 0x03, 0xb0, 0x00, 0xbd, 0xc0, 0x46, 0x0d, 0x52, 0x00, 0x00, 0x10, 0xb5, 0x02, 0x4b, 0x00, 0x20, 0x1b, 0x68, 0x98, 0x47, 0x10, 0xbd, 0x3c, 0x01, 0x00, 0x20, 0x10, 0xb5, 0x02, 0x4b, 0x01, 0x20, 0x5b, 0x68, 0x98, 0x47, 0x10, 0xbd, 0x3c, 0x01, 0x00, 0x20, 0x10, 0xb5, 0x02, 0x4b, 0x02, 0x20, 0x9b, 0x68, 0x98, 0x47, 0x10, 0xbd, 0x3c, 0x01, 0x00, 0x20, 0x10, 0xb5, 0x02, 0x4b, 0x03, 0x20, 0xdb, 0x68, 0x98, 0x47, 0x10, 0xbd, 0x3c, 0x01, 0x00, 0x20, 0x10, 0xb5, 0x02, 0x4b, 0x04, 0x20, 0x1b, 0x69, 0x98, 0x47, 0x10, 0xbd, 0x3c, 0x01, 0x00, 0x20, 0x10, 0xb5, 0x02, 0x4b, 0x05, 0x20, 0x5b, 0x69, 0x98, 0x47, 0x10, 0xbd, 0x3c, 0x01, 0x00, 0x20, 0x00, 0x23, 0x00, 0xb5, 0x83, 0xb0, 0x01, 0xa8, 0x03, 0x70, 0x09, 0x4b, 0x98, 0x47, 0x40, 0x21, 0x08, 0x4a, 0x13, 0x6a, 0x0b, 0x43, 0x13, 0x62, 0x07, 0x4b, 0x3f, 0x39, 0x1a, 0x78, 0x0a, 0x43, 0x1a, 0x70, 0x1a, 0x78, 0x01, 0x31, 0x0a, 0x43, 0x1a, 0x70, 0x03, 0xb0, 0x00, 0xbd, 0xc0, 0x46, 0xe9, 0x56, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x18, 0x00, 0x43, 0x00, 0x23, 0x80, 0x22, 0x03, 0x73, 0x43, 0x73, 0x83, 0x73, 0xc3, 0x73, 0x03, 0x74, 0x43, 0x74, 0x83, 0x74, 0x43, 0x60, 0x02, 0x4b, 0x92, 0x03, 0x02, 0x60, 0x83, 0x60, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x40, 0x00, 0x23, 0x80, 0x22, 0x03, 0x73, 0x43, 0x73, 0x83, 0x73, 0xc3, 0x73, 0x03, 0x74, 0x43, 0x74, 0x83, 0x74, 0x43, 0x60, 0x02, 0x4b, 0x92, 0x03, 0x02, 0x60, 0x83, 0x60, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x40, 0x00, 0x23, 0x80, 0x22, 0x03, 0x73, 0x43, 0x73, 0x83, 0x73, 0xc3, 0x73, 0x03, 0x74, 0x43, 0x74, 0x83, 0x74, 0x43, 0x60, 0x02, 0x4b, 0x92, 0x03, 0x02, 0x60, 0x83, 0x60, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x40, 0x03, 0x7b, 0x00, 0x2b, 0x28, 0xd1, 0x80, 0x22, 0x00, 0x21, 0x92, 0x00, 0x43, 0x7b, 0x00, 0x2b, 0x00, 0xd1, 0x0a, 0x00, 0x83, 0x7b, 0x00, 0x2b, 0x02, 0xd0, 0x80, 0x23, 0x5b, 0x00, 0x1a, 0x43, 0xc3, 0x7b, 0x00, 0x2b, 0x01, 0xd0, 0x80, 0x23, 0x1a, 0x43, 0x03, 0x7c, 0x00, 0x2b, 0x01, 0xd0, 0x40, 0x23, 0x1a, 0x43, 0x83, 0x7c, 0x00, 0x2b, 0x01, 0xd0, 0x04, 0x23, 0x1a, 0x43, 0x41, 0x68, 0x03, 0x68, 0x0b, 0x43, 0x41, 0x89, 0x0b, 0x43, 0x41, 0x7c, 0x0b, 0x43, 0x01, 0x89, 0x0b, 0x43, 0x13, 0x43, 0x04, 0x4a, 0x53, 0x60, 0x70, 0x47, 0xc0, 0x22, 0x80, 0x21, 0xd2, 0x00, 0xc9, 0x00, 0xd4, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x43, 0x03, 0x7b, 0x00, 0x2b, 0x28, 0xd1, 0x80, 0x22, 0x00, 0x21, 0x92, 0x00, 0x43, 0x7b, 0x00, 0x2b, 0x00, 0xd1, 0x0a, 0x00, 0x83, 0x7b, 0x00, 0x2b, 0x02, 0xd0, 0x80, 0x23, 0x5b, 0x00, 0x1a, 0x43, 0xc3, 0x7b, 0x00, 0x2b, 0x01, 0xd0, 0x80, 0x23, 0x1a, 0x43, 0x03, 0x7c, 0x00, 0x2b, 0x01, 0xd0, 0x40, 0x23, 0x1a, 0x43, 0x83, 0x7c, 0x00, 0x2b, 0x01, 0xd0, 0x04, 0x23, 0x1a, 0x43, 0x41, 0x68, 0x03, 0x68, 0x0b, 0x43, 0x41, 0x89, 0x0b, 0x43, 0x41, 0x7c, 0x0b, 0x43, 0x01, 0x89, 0x0b, 0x43, 0x13, 0x43, 0x04, 0x4a, 0x93, 0x60, 0x70, 0x47, 0xc0, 0x22, 0x80, 0x21, 0xd2, 0x00, 0xc9, 0x00, 0xd4, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x43, 0x03, 0x7b, 0x00, 0x2b, 0x28, 0xd1, 0x80, 0x22, 0x00, 0x21, 0x92, 0x00, 0x43, 0x7b, 0x00, 0x2b, 0x00, 0xd1, 0x0a, 0x00, 0x83, 0x7b, 0x00, 0x2b, 0x02, 0xd0, 0x80, 0x23, 0x5b, 0x00, 0x1a, 0x43, 0xc3, 0x7b, 0x00, 0x2b, 0x01, 0xd0, 0x80, 0x23, 0x1a, 0x43, 0x03, 0x7c, 0x00, 0x2b, 0x01, 0xd0, 0x40, 0x23, 0x1a, 0x43, 0x83, 0x7c, 0x00, 0x2b, 0x01, 0xd0, 0x04, 0x23, 0x1a, 0x43, 0x41, 0x68, 0x03, 0x68, 0x0b, 0x43, 0x41, 0x89, 0x0b, 0x43, 0x41, 0x7c, 0x0b, 0x43, 0x01, 0x89, 0x0b, 0x43, 0x13, 0x43, 0x04, 0x4a, 0xd3, 0x60, 0x70, 0x47, 0xc0, 0x22, 0x80, 0x21, 0xd2, 0x00, 0xc9, 0x00, 0xd4, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x43, 0x00, 0x28, 0x08, 0xd0, 0x01, 0x28, 0x0c, 0xd0, 0x02, 0x28, 0x03, 0xd1, 0x08, 0x4a, 0xd3, 0x68, 0x18, 0x43, 0xd0, 0x60, 0x70, 0x47, 0x02, 0x21, 0x05, 0x4a, 0x53, 0x68, 0x0b, 0x43, 0x53, 0x60, 0xf8, 0xe7, 0x02, 0x21, 0x02, 0x4a, 0x93, 0x68, 0x0b, 0x43, 0x93, 0x60, 0xf2, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x43, 0x00, 0x28, 0x08, 0xd0, 0x01, 0x28, 0x0c, 0xd0, 0x02, 0x28, 0x03, 0xd1, 0x08, 0x4a, 0xd3, 0x68, 0x83, 0x43, 0xd3, 0x60, 0x70, 0x47, 0x02, 0x21, 0x05, 0x4a, 0x53, 0x68, 0x8b, 0x43, 0x53, 0x60, 0xf8, 0xe7, 0x02, 0x21, 0x02, 0x4a, 0x93, 0x68, 0x8b, 0x43, 0x93, 0x60, 0xf2, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x43, 0x03, 0x1e, 0x09, 0xd0, 0x01, 0x28, 0x0c, 0xd0, 0x00, 0x20, 0x02, 0x2b, 0x03, 0xd1, 0x07, 0x4b, 0x98, 0x78, 0x40, 0x07, 0xc0, 0x0f, 0x70, 0x47, 0x04, 0x4b, 0x98, 0x78, 0xc0, 0x07, 0xc0, 0x0f, 0xf9, 0xe7, 0x02, 0x4b, 0x98, 0x78, 0x80, 0x07, 0xc0, 0x0f, 0xf4, 0xe7, 0x00, 0x18, 0x00, 0x43, 0x80, 0x22, 0x00, 0xb5, 0x83, 0xb0, 0x01, 0xab, 0x1a, 0x70, 0x0a, 0x78, 0x5a, 0x70, 0x4a, 0x78, 0x9a, 0x70, 0x8a, 0x78, 0x19, 0x00, 0xda, 0x70, 0x01, 0x4b, 0x98, 0x47, 0x03, 0xb0, 0x00, 0xbd, 0xf5, 0x5a, 0x00, 0x00, 0x70, 0x47, 0xc0, 0x46, 0x0b, 0x4b, 0x1a, 0x68, 0x00, 0x2a, 0x05, 0xd1, 0xef, 0xf3, 0x10, 0x81, 0x00, 0x29, 0x05, 0xd0, 0x08, 0x49, 0x0a, 0x70, 0x1a, 0x68, 0x01, 0x32, 0x1a, 0x60, 0x70, 0x47, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x05, 0x4a, 0x11, 0x70, 0x03, 0x4a, 0x01, 0x31, 0x11, 0x70, 0xf2, 0xe7, 0xc0, 0x46, 0x54, 0x01, 0x00, 0x20, 0x58, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x08, 0x4b, 0x1a, 0x68, 0x01, 0x3a, 0x1a, 0x60, 0x1b, 0x68, 0x00, 0x2b, 0x09, 0xd1, 0x06, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x05, 0xd0, 0x01, 0x22, 0x04, 0x4b, 0x1a, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x70, 0x47, 0x54, 0x01, 0x00, 0x20, 0x58, 0x01, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x20, 0x10, 0xb5, 0x08, 0x28, 0x2d, 0xd8, 0x1c, 0x4b, 0x80, 0x00, 0x1b, 0x58, 0x9f, 0x46, 0x80, 0x20, 0x00, 0x02, 0x10, 0xbd, 0x19, 0x4b, 0x58, 0x69, 0xfb, 0xe7, 0x19, 0x4b, 0x18, 0x7d, 0x00, 0x07, 0x80, 0x0f, 0x43, 0x1c, 0x17, 0x48, 0x58, 0x43, 0xf3, 0xe7, 0x14, 0x4c, 0x00, 0x20, 0x23, 0x68, 0x9b, 0x07, 0xee, 0xd5, 0x80, 0x22, 0x12, 0x49, 0x52, 0x00, 0xcb, 0x68, 0x13, 0x42, 0xfc, 0xd0, 0x23, 0x68, 0x5b, 0x07, 0x0f, 0xd4, 0x10, 0x48, 0xe3, 0xe7, 0x0c, 0x4b, 0x18, 0x69, 0xe0, 0xe7, 0x28, 0x23, 0x0b, 0x4a, 0x00, 0x20, 0xd3, 0x5c, 0x9b, 0x07, 0xda, 0xd5, 0x07, 0x4b, 0xd8, 0x68, 0xd7, 0xe7, 0x00, 0x20, 0xd5, 0xe7, 0x09, 0x4b, 0x00, 0x20, 0x98, 0x47, 0xa3, 0x68, 0x1b, 0x04, 0x1b, 0x0c, 0x58, 0x43, 0xcd, 0xe7, 0xc0, 0x46, 0xb4, 0x6e, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x20, 0x00, 0x0c, 0x00, 0x40, 0x00, 0x09, 0x3d, 0x00, 0x00, 0x6c, 0xdc, 0x02, 0x71, 0x5a, 0x00, 0x00, 0x01, 0x22, 0x00, 0x78, 0x04, 0x49, 0x02, 0x40, 0xcb, 0x69, 0x04, 0x48, 0xd2, 0x03, 0x03, 0x40, 0x13, 0x43, 0xcb, 0x61, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x10, 0x00, 0x40, 0xff, 0x7f, 0xff, 0xff, 0xf0, 0xb5, 0x80, 0x22, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0x1e, 0x21, 0x4d, 0x4b, 0xc0, 0xb5, 0x52, 0x00, 0x9a, 0x60, 0x4c, 0x4b, 0xfd, 0x3a, 0x9a, 0x60, 0x4c, 0x4a, 0x84, 0xb0, 0x53, 0x68, 0x8b, 0x43, 0x1a, 0x39, 0x0b, 0x43, 0x53, 0x60, 0x80, 0x23, 0xdb, 0x05, 0x9a, 0x78, 0x02, 0x2a, 0x0a, 0xd0, 0x9a, 0x78, 0x52, 0xb2, 0x00, 0x2a, 0x06, 0xdb, 0x01, 0x22, 0x9a, 0x71, 0x01, 0x32, 0x9a, 0x70, 0x9a, 0x79, 0x00, 0x2a, 0xfc, 0xd0, 0x04, 0x21, 0x41, 0x4a, 0x02, 0x26, 0x93, 0x69, 0x01, 0xac, 0x0b, 0x43, 0x04, 0x31, 0x8b, 0x43, 0xf8, 0x21, 0xc9, 0x00, 0x0b, 0x43, 0x3d, 0x49, 0x00, 0x20, 0x0b, 0x40, 0x93, 0x61, 0x93, 0x69, 0x21, 0x00, 0x33, 0x43, 0x93, 0x61, 0x01, 0x23, 0x63, 0x60, 0x00, 0x23, 0x63, 0x70, 0x23, 0x72, 0x63, 0x72, 0x03, 0x33, 0x23, 0x70, 0x36, 0x4b, 0x30, 0x4d, 0x98, 0x46, 0x98, 0x47, 0x0c, 0x22, 0x2b, 0x7d, 0xb3, 0x43, 0x2b, 0x75, 0x2b, 0x7d, 0x13, 0x43, 0x40, 0x22, 0x13, 0x43, 0x7f, 0x22, 0x13, 0x40, 0x2b, 0x75, 0x2b, 0x7d, 0x7d, 0x3a, 0x13, 0x43, 0x2b, 0x75, 0x0e, 0x32, 0xeb, 0x68, 0x1a, 0x42, 0xfc, 0xd0, 0x00, 0x26, 0x01, 0x27, 0x06, 0x23, 0x21, 0x00, 0x00, 0x20, 0x99, 0x46, 0x23, 0x70, 0x67, 0x60, 0x66, 0x70, 0x26, 0x72, 0x66, 0x72, 0xc0, 0x47, 0x80, 0x22, 0x2b, 0x7d, 0x13, 0x43, 0x2b, 0x75, 0x23, 0x4b, 0x98, 0x47, 0x4b, 0x46, 0x21, 0x00, 0x02, 0x20, 0x23, 0x70, 0x67, 0x60, 0x66, 0x70, 0x66, 0x72, 0x27, 0x72, 0xc0, 0x47, 0x1f, 0x4b, 0x02, 0x20, 0x9a, 0x46, 0x98, 0x47, 0x4b, 0x46, 0x1d, 0x4d, 0x21, 0x00, 0xaf, 0x71, 0x00, 0x20, 0x6f, 0x71, 0x2f, 0x71, 0x23, 0x70, 0x67, 0x60, 0x66, 0x70, 0x26, 0x72, 0x66, 0x72, 0xc0, 0x47, 0x00, 0x20, 0xd0, 0x47, 0x17, 0x4b, 0x00, 0x20, 0x98, 0x47, 0x29, 0x79, 0x16, 0x4b, 0xc9, 0xb2, 0x98, 0x47, 0x16, 0x4b, 0x98, 0x42, 0x0d, 0xd8, 0x80, 0x22, 0xd2, 0x05, 0x93, 0x78, 0x00, 0x2b, 0x08, 0xd0, 0x93, 0x78, 0x5b, 0xb2, 0x00, 0x2b, 0x04, 0xdb, 0x97, 0x71, 0x96, 0x70, 0x93, 0x79, 0x00, 0x2b, 0xfc, 0xd0, 0x04, 0xb0, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x00, 0x0c, 0x00, 0x40, 0x00, 0x14, 0x00, 0x40, 0x00, 0x40, 0x00, 0x41, 0x00, 0x10, 0x00, 0x40, 0xff, 0xef, 0xff, 0xff, 0xa1, 0x58, 0x00, 0x00, 0x7d, 0x58, 0x00, 0x00, 0x4d, 0x59, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x8d, 0x59, 0x00, 0x00, 0xc1, 0x5d, 0x00, 0x00, 0x00, 0x1b, 0xb7, 0x00, 0x40, 0x21, 0x06, 0x4a, 0x53, 0x69, 0x0b, 0x43, 0x53, 0x61, 0x01, 0x23, 0x04, 0x4a, 0x3f, 0x39, 0x13, 0x70, 0x13, 0x78, 0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47, 0xc0, 0x46, 0x00, 0x04, 0x00, 0x40, 0x00, 0x18, 0x00, 0x40, 0x70, 0xb5, 0x4b, 0x78, 0x04, 0x00, 0x0d, 0x78, 0x00, 0x2b, 0x02, 0xd0, 0x80, 0x23, 0xdb, 0x00, 0x1d, 0x43, 0x4b, 0x7a, 0x00, 0x2b, 0x02, 0xd0, 0x80, 0x23, 0x1b, 0x01, 0x1d, 0x43, 0x48, 0x68, 0x01, 0x28, 0x0f, 0xd9, 0x43, 0x1e, 0x18, 0x42, 0x2f, 0xd1, 0x02, 0x28, 0x33, 0xd0, 0x02, 0x23, 0x00, 0x22, 0x01, 0x32, 0x5b, 0x00, 0x98, 0x42, 0xfb, 0xd8, 0x12, 0x04, 0x80, 0x23, 0x5b, 0x01, 0x1d, 0x43, 0x15, 0x43, 0x0b, 0x7a, 0x00, 0x2b, 0x02, 0xd0, 0x80, 0x23, 0x9b, 0x01, 0x1d, 0x43, 0x04, 0x26, 0xa6, 0x40, 0x11, 0x49, 0x12, 0x4a, 0x4b, 0x68, 0x13, 0x40, 0x1e, 0x42, 0xfb, 0xd1, 0x10, 0x4b, 0x98, 0x47, 0x0d, 0x4b, 0x80, 0x22, 0x9c, 0x46, 0x61, 0x46, 0xa4, 0x00, 0x64, 0x44, 0x23, 0x6a, 0x52, 0x00, 0x13, 0x40, 0x1d, 0x43, 0x09, 0x4a, 0x25, 0x62, 0x4b, 0x68, 0x13, 0x40, 0x1e, 0x42, 0xfb, 0xd1, 0x08, 0x4b, 0x98, 0x47, 0x70, 0xbd, 0x80, 0x23, 0x00, 0x04, 0x9b, 0x00, 0x18, 0x43, 0x05, 0x43, 0xd6, 0xe7, 0x00, 0x22, 0xd0, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x40, 0xfc, 0x07, 0x00, 0x00, 0xed, 0x55, 0x00, 0x00, 0x29, 0x56, 0x00, 0x00, 0x04, 0x22, 0x10, 0xb5, 0x82, 0x40, 0x04, 0x00, 0x09, 0x49, 0x0a, 0x48, 0x43, 0x68, 0x0b, 0x40, 0x1a, 0x42, 0xfb, 0xd1, 0x08, 0x4b, 0x98, 0x47, 0x06, 0x4b, 0xa0, 0x00, 0x9c, 0x46, 0x80, 0x23, 0x60, 0x44, 0x02, 0x6a, 0x5b, 0x00, 0x13, 0x43, 0x03, 0x62, 0x04, 0x4b, 0x98, 0x47, 0x10, 0xbd, 0xfc, 0x07, 0x00, 0x00, 0x00, 0x18, 0x00, 0x40, 0xed, 0x55, 0x00, 0x00, 0x29, 0x56, 0x00, 0x00, 0x04, 0x22, 0xf8, 0xb5, 0x82, 0x40, 0x04, 0x00, 0x12, 0x4e, 0x13, 0x49, 0x73, 0x68, 0x0b, 0x40, 0x1a, 0x42, 0xfb, 0xd1, 0x08, 0x34, 0xa4, 0x00, 0x10, 0x4b, 0x98, 0x47, 0xa0, 0x59, 0x10, 0x4b, 0x00, 0x07, 0x00, 0x0f, 0x98, 0x47, 0xa5, 0x59, 0xa4, 0x59, 0xed, 0x04, 0x0d, 0x4b, 0xed, 0x0f, 0x07, 0x00, 0x24, 0x0c, 0x98, 0x47, 0x00, 0x2d, 0x03, 0xd0, 0x01, 0x34, 0xe7, 0x40, 0x38, 0x00, 0xf8, 0xbd, 0x01, 0x2c, 0xfb, 0xd9, 0x38, 0x00, 0x21, 0x00, 0x07, 0x4b, 0x98, 0x47, 0x07, 0x00, 0xf5, 0xe7, 0xc0, 0x46, 0x00, 0x18, 0x00, 0x40, 0xfc, 0x07, 0x00, 0x00, 0xed, 0x55, 0x00, 0x00, 0x59, 0x56, 0x00, 0x00, 0x29, 0x56, 0x00, 0x00, 0xc1, 0x5d, 0x00, 0x00, 0x70, 0xb5, 0x0c, 0x4b, 0x04, 0x00, 0x0e, 0x00, 0x98, 0x47, 0x0b, 0x4b, 0x80, 0x22, 0x9c, 0x46, 0x40, 0x21, 0x80, 0x25, 0xa4, 0x00, 0x64, 0x44, 0xa3, 0x58, 0x8b, 0x43, 0xa3, 0x50, 0x40, 0x3a, 0x63, 0x59, 0x1a, 0x42, 0xfc, 0xd1, 0x05, 0x4b, 0x98, 0x47, 0x0f, 0x23, 0x32, 0x78, 0x13, 0x40, 0x63, 0x51, 0x70, 0xbd, 0xed, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x40, 0x29, 0x56, 0x00, 0x00, 0x10, 0xb5, 0x0a, 0x4b, 0x04, 0x00, 0x98, 0x47, 0x09, 0x4b, 0x80, 0x22, 0x9c, 0x46, 0x40, 0x21, 0xa0, 0x00, 0x60, 0x44, 0x83, 0x58, 0x0b, 0x43, 0x83, 0x50, 0x40, 0x31, 0x40, 0x3a, 0x43, 0x58, 0x1a, 0x42, 0xfc, 0xd0, 0x03, 0x4b, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46, 0xed, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x40, 0x29, 0x56, 0x00, 0x00, 0xf0, 0xb5, 0xc6, 0x46, 0x04, 0x00, 0x00, 0xb5, 0x18, 0x4e, 0x19, 0x4d, 0x20, 0x34, 0xb0, 0x47, 0xa4, 0x00, 0x18, 0x4f, 0x64, 0x59, 0xb8, 0x47, 0x04, 0x22, 0x24, 0x07, 0x24, 0x0f, 0xa2, 0x40, 0x15, 0x49, 0x6b, 0x68, 0x0b, 0x40, 0x1a, 0x42, 0xfb, 0xd1, 0x08, 0x34, 0xa4, 0x00, 0xb0, 0x47, 0x60, 0x59, 0x12, 0x4b, 0x00, 0x07, 0x00, 0x0f, 0x98, 0x47, 0x66, 0x59, 0x64, 0x59, 0xf6, 0x04, 0xf6, 0x0f, 0x80, 0x46, 0x24, 0x0c, 0xb8, 0x47, 0x00, 0x2e, 0x07, 0xd0, 0x43, 0x46, 0x01, 0x34, 0xe3, 0x40, 0x98, 0x46, 0x40, 0x46, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0x01, 0x2c, 0xf9, 0xd9, 0x40, 0x46, 0x21, 0x00, 0x06, 0x4b, 0x98, 0x47, 0x80, 0x46, 0xf3, 0xe7, 0xed, 0x55, 0x00, 0x00, 0x00, 0x18, 0x00, 0x40, 0x29, 0x56, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x59, 0x56, 0x00, 0x00, 0xc1, 0x5d, 0x00, 0x00, 0x70, 0xb5, 0xc2, 0x09, 0x00, 0x23, 0x00, 0x2a, 0x04, 0xd1, 0x2f, 0x4a, 0x43, 0x09, 0x94, 0x46, 0xdb, 0x01, 0x63, 0x44, 0x1f, 0x22, 0x10, 0x40, 0x1e, 0x3a, 0x82, 0x40, 0xc8, 0x78, 0x00, 0x28, 0x31, 0xd1, 0x08, 0x78, 0x80, 0x28, 0x47, 0xd0, 0x80, 0x24, 0x00, 0x06, 0x64, 0x02, 0x20, 0x43, 0x4c, 0x78, 0x02, 0x25, 0x26, 0x00, 0xae, 0x43, 0x07, 0xd1, 0x8c, 0x78, 0x00, 0x2c, 0x37, 0xd1, 0x80, 0x24, 0xa4, 0x02, 0x20, 0x43, 0x5a, 0x60, 0x4c, 0x78, 0x01, 0x3c, 0x01, 0x2c, 0x35, 0xd9, 0xa0, 0x24, 0x15, 0x04, 0x2d, 0x0c, 0xe4, 0x05, 0x2c, 0x43, 0x04, 0x43, 0x9c, 0x62, 0xd0, 0x24, 0x15, 0x0c, 0x24, 0x06, 0x2c, 0x43, 0x04, 0x43, 0x9c, 0x62, 0xcc, 0x78, 0x00, 0x2c, 0x09, 0xd1, 0x40, 0x03, 0x03, 0xd5, 0x88, 0x78, 0x01, 0x28, 0x23, 0xd0, 0x5a, 0x61, 0x49, 0x78, 0x01, 0x39, 0x01, 0x29, 0x13, 0xd9, 0x70, 0xbd, 0xa0, 0x20, 0x14, 0x04, 0x24, 0x0c, 0xc0, 0x05, 0x20, 0x43, 0x5a, 0x60, 0x98, 0x62, 0xd0, 0x20, 0x14, 0x0c, 0x00, 0x06, 0x20, 0x43, 0x98, 0x62, 0xc8, 0x78, 0x00, 0x28, 0xef, 0xd1, 0x49, 0x78, 0x01, 0x39, 0x01, 0x29, 0xeb, 0xd8, 0x9a, 0x60, 0xe9, 0xe7, 0xc0, 0x24, 0xe4, 0x02, 0x20, 0x43, 0xc6, 0xe7, 0x00, 0x20, 0xb9, 0xe7, 0x03, 0x4c, 0x20, 0x40, 0xc6, 0xe7, 0x9a, 0x61, 0xda, 0xe7, 0xc0, 0x46, 0x00, 0x28, 0x00, 0x40, 0xff, 0xff, 0xfb, 0xff, 0x70, 0x47, 0xc0, 0x46, 0x10, 0xb5, 0x05, 0x4b, 0x98, 0x47, 0x05, 0x4b, 0x98, 0x47, 0x05, 0x4b, 0x98, 0x47, 0x05, 0x4b, 0x98, 0x47, 0x05, 0x4b, 0x98, 0x47, 0x10, 0xbd, 0x09, 0x57, 0x00, 0x00, 0xe9, 0x55, 0x00, 0x00, 0xc5, 0x5b, 0x00, 0x00, 0xc5, 0x5b, 0x00, 0x00, 0xc5, 0x5b, 0x00, 0x00, 0xfe, 0xe7, 0xc0, 0x46, 0x14, 0x49, 0x15, 0x48, 0x10, 0xb5, 0x81, 0x42, 0x09, 0xd0, 0x14, 0x4b, 0x98, 0x42, 0x06, 0xd2, 0xc2, 0x43, 0xd2, 0x18, 0x92, 0x08, 0x01, 0x32, 0x92, 0x00, 0x11, 0x4b, 0x98, 0x47, 0x11, 0x48, 0x11, 0x4b, 0x98, 0x42, 0x07, 0xd2, 0xc2, 0x43, 0xd2, 0x18, 0x92, 0x08, 0x01, 0x32, 0x92, 0x00, 0x00, 0x21, 0x0e, 0x4b, 0x98, 0x47, 0xff, 0x21, 0x0d, 0x4b, 0x0e, 0x4a, 0x8b, 0x43, 0x93, 0x60, 0x0d, 0x4a, 0x7f, 0x39, 0x53, 0x68, 0x0b, 0x43, 0x53, 0x60, 0x0c, 0x4b, 0x98, 0x47, 0x0c, 0x4b, 0x98, 0x47, 0xfe, 0xe7, 0xb8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x20, 0xf5, 0x6b, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0xd0, 0x11, 0x00, 0x20, 0x07, 0x6c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xed, 0x00, 0xe0, 0x00, 0x40, 0x00, 0x41, 0xad, 0x6b, 0x00, 0x00, 0x7d, 0x5c, 0x00, 0x00, 0x30, 0xb5, 0x80, 0x24, 0x00, 0x25, 0xe4, 0x05, 0x2b, 0x4b, 0x83, 0xb0, 0x25, 0x70, 0x98, 0x47, 0x02, 0x21, 0x2a, 0x4a, 0x13, 0x69, 0x8b, 0x43, 0x13, 0x61, 0xb1, 0x23, 0x23, 0x81, 0xa3, 0x78, 0x00, 0x2b, 0x3e, 0xd1, 0x01, 0x21, 0x26, 0x4c, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x00, 0x22, 0x24, 0x4b, 0x1a, 0x70, 0x5a, 0x70, 0x9a, 0x70, 0xda, 0x70, 0x19, 0x71, 0xef, 0xf3, 0x10, 0x80, 0x45, 0x42, 0x68, 0x41, 0x01, 0x90, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x22, 0x70, 0x1a, 0x79, 0x01, 0x98, 0x01, 0x32, 0x1a, 0x71, 0x00, 0x28, 0x03, 0xd0, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0x18, 0x4b, 0x98, 0x47, 0x18, 0x4b, 0x98, 0x47, 0x18, 0x4b, 0x98, 0x47, 0x18, 0x4b, 0x98, 0x47, 0x18, 0x4b, 0x98, 0x47, 0x80, 0x22, 0x00, 0x25, 0x04, 0x20, 0x01, 0x21, 0xd2, 0x05, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x25, 0x70, 0x50, 0x70, 0x53, 0x78, 0x04, 0x2b, 0xfc, 0xd1, 0x21, 0x70, 0xbf, 0xf3, 0x5f, 0x8f, 0x62, 0xb6, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0xef, 0xe7, 0xa3, 0x78, 0x5b, 0xb2, 0x00, 0x2b, 0xbc, 0xdb, 0x01, 0x23, 0xa3, 0x71, 0xa5, 0x70, 0xa3, 0x79, 0x00, 0x2b, 0xfc, 0xd0, 0xb5, 0xe7, 0xc9, 0x5b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x0e, 0x00, 0x00, 0x20, 0xc8, 0x11, 0x00, 0x20, 0x05, 0x4b, 0x00, 0x00, 0x2d, 0x4f, 0x00, 0x00, 0xfd, 0x4f, 0x00, 0x00, 0xb5, 0x3d, 0x00, 0x00, 0xb9, 0x47, 0x00, 0x00, 0xff, 0x22, 0x43, 0x00, 0x5b, 0x08, 0x01, 0x20, 0xd2, 0x05, 0x93, 0x42, 0x00, 0xdc, 0x00, 0x20, 0x70, 0x47, 0xc0, 0x46, 0x42, 0x00, 0x12, 0x0e, 0x11, 0x00, 0x10, 0xb5, 0x01, 0x24, 0xc3, 0x17, 0x7f, 0x39, 0x23, 0x43, 0x1e, 0x29, 0x0e, 0xdc, 0x00, 0x29, 0x18, 0xdb, 0x80, 0x24, 0x40, 0x02, 0x40, 0x0a, 0x24, 0x04, 0x04, 0x43, 0x16, 0x29, 0x09, 0xdd, 0x20, 0x00, 0x96, 0x3a, 0x90, 0x40, 0x43, 0x43, 0x18, 0x00, 0x10, 0xbd, 0x00, 0xf0, 0x31, 0xfe, 0x03, 0x00, 0xf9, 0xe7, 0x80, 0x20, 0xc0, 0x03, 0x08, 0x41, 0x17, 0x22, 0x00, 0x19, 0x51, 0x1a, 0xc8, 0x40, 0xf0, 0xe7, 0x4a, 0x1c, 0xef, 0xd0, 0x00, 0x23, 0xed, 0xe7, 0xc0, 0x46, 0x00, 0x22, 0x43, 0x08, 0x8b, 0x42, 0x74, 0xd3, 0x03, 0x09, 0x8b, 0x42, 0x5f, 0xd3, 0x03, 0x0a, 0x8b, 0x42, 0x44, 0xd3, 0x03, 0x0b, 0x8b, 0x42, 0x28, 0xd3, 0x03, 0x0c, 0x8b, 0x42, 0x0d, 0xd3, 0xff, 0x22, 0x09, 0x02, 0x12, 0xba, 0x03, 0x0c, 0x8b, 0x42, 0x02, 0xd3, 0x12, 0x12, 0x09, 0x02, 0x65, 0xd0, 0x03, 0x0b, 0x8b, 0x42, 0x19, 0xd3, 0x00, 0xe0, 0x09, 0x0a, 0xc3, 0x0b, 0x8b, 0x42, 0x01, 0xd3, 0xcb, 0x03, 0xc0, 0x1a, 0x52, 0x41, 0x83, 0x0b, 0x8b, 0x42, 0x01, 0xd3, 0x8b, 0x03, 0xc0, 0x1a, 0x52, 0x41, 0x43, 0x0b, 0x8b, 0x42, 0x01, 0xd3, 0x4b, 0x03, 0xc0, 0x1a, 0x52, 0x41, 0x03, 0x0b, 0x8b, 0x42, 0x01, 0xd3, 0x0b, 0x03, 0xc0, 0x1a, 0x52, 0x41, 0xc3, 0x0a, 0x8b, 0x42, 0x01, 0xd3, 0xcb, 0x02, 0xc0, 0x1a, 0x52, 0x41, 0x83, 0x0a, 0x8b, 0x42, 0x01, 0xd3, 0x8b, 0x02, 0xc0, 0x1a, 0x52, 0x41, 0x43, 0x0a, 0x8b, 0x42, 0x01, 0xd3, 0x4b, 0x02, 0xc0, 0x1a, 0x52, 0x41, 0x03, 0x0a, 0x8b, 0x42, 0x01, 0xd3, 0x0b, 0x02, 0xc0, 0x1a, 0x52, 0x41, 0xcd, 0xd2, 0xc3, 0x09, 0x8b, 0x42, 0x01, 0xd3, 0xcb, 0x01, 0xc0, 0x1a, 0x52, 0x41, 0x83, 0x09, 0x8b, 0x42, 0x01, 0xd3, 0x8b, 0x01, 0xc0, 0x1a, 0x52, 0x41, 0x43, 0x09, 0x8b, 0x42, 0x01, 0xd3, 0x4b, 0x01, 0xc0, 0x1a, 0x52, 0x41, 0x03, 0x09, 0x8b, 0x42, 0x01, 0xd3, 0x0b, 0x01, 0xc0, 0x1a, 0x52, 0x41, 0xc3, 0x08, 0x8b, 0x42, 0x01, 0xd3, 0xcb, 0x00, 0xc0, 0x1a, 0x52, 0x41, 0x83, 0x08, 0x8b, 0x42, 0x01, 0xd3, 0x8b, 0x00, 0xc0, 0x1a, 0x52, 0x41, 0x43, 0x08, 0x8b, 0x42, 0x01, 0xd3, 0x4b, 0x00, 0xc0, 0x1a, 0x52, 0x41, 0x41, 0x1a, 0x00, 0xd2, 0x01, 0x46, 0x52, 0x41, 0x10, 0x46, 0x70, 0x47, 0xff, 0xe7, 0x01, 0xb5, 0x00, 0x20, 0x00, 0xf0, 0x06, 0xf8, 0x02, 0xbd, 0xc0, 0x46, 0x00, 0x29, 0xf7, 0xd0, 0x76, 0xe7, 0x70, 0x47, 0x70, 0x47, 0xc0, 0x46, 0xf0, 0xb5, 0xc6, 0x46, 0x4e, 0x02, 0x47, 0x02, 0x76, 0x0a, 0x7b, 0x0a, 0x44, 0x00, 0xc5, 0x0f, 0xf7, 0x00, 0x48, 0x00, 0x98, 0x46, 0x00, 0xb5, 0x24, 0x0e, 0x2a, 0x00, 0xdb, 0x00, 0x00, 0x0e, 0xc9, 0x0f, 0xbc, 0x46, 0x8d, 0x42, 0x67, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xdc, 0xa5, 0xe0, 0x00, 0x28, 0x3a, 0xd1, 0x00, 0x2f, 0x00, 0xd1, 0x93, 0xe0, 0x51, 0x1e, 0x00, 0x29, 0x00, 0xd0, 0xbc, 0xe0, 0x01, 0x24, 0xdb, 0x1b, 0x5a, 0x01, 0x46, 0xd5, 0x9b, 0x01, 0x9e, 0x09, 0x30, 0x00, 0x00, 0xf0, 0x22, 0xfe, 0x05, 0x38, 0x86, 0x40, 0x84, 0x42, 0x00, 0xdd, 0x9d, 0xe0, 0x04, 0x1b, 0x32, 0x00, 0x20, 0x20, 0x01, 0x34, 0xe2, 0x40, 0x04, 0x1b, 0xa6, 0x40, 0x33, 0x00, 0x5e, 0x1e, 0xb3, 0x41, 0x00, 0x24, 0x13, 0x43, 0x5a, 0x07, 0x04, 0xd0, 0x0f, 0x22, 0x1a, 0x40, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0x29, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x81, 0xe0, 0x2a, 0x00, 0x9b, 0x01, 0x5b, 0x0a, 0xe4, 0xb2, 0x5b, 0x02, 0xe4, 0x05, 0x58, 0x0a, 0xd2, 0x07, 0x20, 0x43, 0x10, 0x43, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0xff, 0x2c, 0xe3, 0xd0, 0x80, 0x21, 0x38, 0x00, 0xc9, 0x04, 0x08, 0x43, 0x84, 0x46, 0x1b, 0x2a, 0x00, 0xdd, 0x82, 0xe0, 0x20, 0x20, 0x61, 0x46, 0xd1, 0x40, 0x82, 0x1a, 0x60, 0x46, 0x90, 0x40, 0x02, 0x00, 0x50, 0x1e, 0x82, 0x41, 0x0a, 0x43, 0x9b, 0x1a, 0x5a, 0x01, 0xb8, 0xd4, 0x5a, 0x07, 0xce, 0xd1, 0xde, 0x08, 0x2a, 0x00, 0xff, 0x2c, 0x3a, 0xd1, 0x00, 0x2e, 0x00, 0xd1, 0xae, 0xe0, 0x80, 0x23, 0xdb, 0x03, 0x33, 0x43, 0x5b, 0x02, 0x5b, 0x0a, 0xff, 0x24, 0xcf, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x52, 0xdd, 0x00, 0x28, 0x31, 0xd0, 0xff, 0x2c, 0xb7, 0xd0, 0x80, 0x20, 0x3e, 0x00, 0xc0, 0x04, 0x06, 0x43, 0xb4, 0x46, 0x1b, 0x29, 0x00, 0xdd, 0xaa, 0xe0, 0x20, 0x26, 0x60, 0x46, 0xc8, 0x40, 0x71, 0x1a, 0x66, 0x46, 0x8e, 0x40, 0x31, 0x00, 0x4e, 0x1e, 0xb1, 0x41, 0x01, 0x43, 0x5b, 0x18, 0x59, 0x01, 0xd3, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x87, 0xe0, 0x01, 0x22, 0x78, 0x49, 0x1a, 0x40, 0x5b, 0x08, 0x0b, 0x40, 0x13, 0x43, 0x97, 0xe7, 0x00, 0x2c, 0x00, 0xd0, 0xa7, 0xe0, 0x00, 0x2b, 0x00, 0xd0, 0xb6, 0xe0, 0x3b, 0x1e, 0x62, 0xd1, 0x00, 0x26, 0x00, 0x22, 0x73, 0x02, 0x5b, 0x0a, 0xe4, 0xb2, 0x9a, 0xe7, 0x14, 0x00, 0x87, 0xe7, 0x00, 0x2f, 0x4d, 0xd0, 0x48, 0x1e, 0x00, 0x28, 0x57, 0xd1, 0x63, 0x44, 0x01, 0x24, 0x5a, 0x01, 0xaf, 0xd5, 0x02, 0x24, 0xdd, 0xe7, 0x00, 0x2a, 0x24, 0xd1, 0x62, 0x1c, 0xd2, 0xb2, 0x01, 0x2a, 0xde, 0xdd, 0xde, 0x1b, 0x72, 0x01, 0x35, 0xd5, 0xfe, 0x1a, 0x0d, 0x00, 0x5c, 0xe7, 0x2a, 0x00, 0x00, 0x23, 0x7e, 0xe7, 0x33, 0x00, 0x60, 0x4a, 0x24, 0x1a, 0x13, 0x40, 0x68, 0xe7, 0x00, 0x29, 0x63, 0xd1, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4e, 0xdd, 0xff, 0x29, 0x49, 0xd0, 0x63, 0x44, 0x5b, 0x08, 0x0c, 0x00, 0x5c, 0xe7, 0xff, 0x2a, 0x41, 0xd0, 0x0a, 0x00, 0x79, 0xe7, 0x01, 0x22, 0x9b, 0x1a, 0x84, 0xe7, 0x00, 0x2c, 0x1d, 0xd0, 0xff, 0x28, 0x22, 0xd0, 0x80, 0x24, 0xe4, 0x04, 0x52, 0x42, 0x23, 0x43, 0x1b, 0x2a, 0x00, 0xdd, 0x8a, 0xe0, 0x1c, 0x00, 0x20, 0x25, 0xd4, 0x40, 0xaa, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0x93, 0x41, 0x23, 0x43, 0x62, 0x46, 0x04, 0x00, 0xd3, 0x1a, 0x0d, 0x00, 0x25, 0xe7, 0x00, 0x2e, 0x00, 0xd0, 0x26, 0xe7, 0x00, 0x22, 0x00, 0x24, 0xa9, 0xe7, 0x0c, 0x00, 0x35, 0xe7, 0x00, 0x2b, 0x4d, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xed, 0xd0, 0xff, 0x28, 0xe0, 0xd1, 0x63, 0x46, 0xff, 0x24, 0x0d, 0x00, 0x2a, 0xe7, 0xff, 0x29, 0x0f, 0xd0, 0x01, 0x00, 0x73, 0xe7, 0x00, 0x2b, 0x61, 0xd0, 0xff, 0x24, 0x00, 0x2f, 0x00, 0xd1, 0x20, 0xe7, 0x80, 0x22, 0x41, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x02, 0xd0, 0x16, 0x42, 0x00, 0xd1, 0x3b, 0x00, 0xff, 0x24, 0x16, 0xe7, 0xff, 0x24, 0x00, 0x23, 0x24, 0xe7, 0x00, 0x2c, 0xea, 0xd1, 0x00, 0x2b, 0x58, 0xd0, 0x00, 0x2f, 0x00, 0xd1, 0x0c, 0xe7, 0x63, 0x44, 0x5a, 0x01, 0x00, 0xd4, 0x39, 0xe7, 0x2e, 0x4a, 0x0c, 0x00, 0x13, 0x40, 0x04, 0xe7, 0x01, 0x21, 0x5c, 0xe7, 0x00, 0x2c, 0x1e, 0xd1, 0x00, 0x2b, 0x40, 0xd0, 0xc9, 0x43, 0x00, 0x29, 0x0b, 0xd0, 0xff, 0x28, 0x36, 0xd0, 0x1b, 0x29, 0x47, 0xdc, 0x1c, 0x00, 0x20, 0x26, 0xcc, 0x40, 0x71, 0x1a, 0x8b, 0x40, 0x59, 0x1e, 0x8b, 0x41, 0x23, 0x43, 0x63, 0x44, 0x04, 0x00, 0x47, 0xe7, 0x00, 0x2b, 0x18, 0xd1, 0x3b, 0x1e, 0x2d, 0xd0, 0x0d, 0x00, 0xff, 0x24, 0xe5, 0xe6, 0x3b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0xe1, 0xe6, 0xff, 0x28, 0x1c, 0xd0, 0x80, 0x24, 0xe4, 0x04, 0x49, 0x42, 0x23, 0x43, 0xe0, 0xe7, 0x00, 0x2f, 0x00, 0xd1, 0xd7, 0xe6, 0xde, 0x1b, 0x72, 0x01, 0x1f, 0xd5, 0xfb, 0x1a, 0x0d, 0x00, 0xd1, 0xe6, 0xff, 0x24, 0x00, 0x2f, 0x00, 0xd1, 0xcd, 0xe6, 0x80, 0x22, 0x40, 0x46, 0xd2, 0x03, 0x10, 0x42, 0xaf, 0xd0, 0x16, 0x42, 0xad, 0xd1, 0x3b, 0x00, 0x0d, 0x00, 0xff, 0x24, 0xc2, 0xe6, 0x63, 0x46, 0xff, 0x24, 0xbf, 0xe6, 0x01, 0x23, 0x7a, 0xe7, 0x3b, 0x00, 0x04, 0x00, 0xba, 0xe6, 0x80, 0x26, 0x00, 0x22, 0xf6, 0x03, 0xf0, 0xe6, 0x3b, 0x00, 0xb4, 0xe6, 0x33, 0x1e, 0x00, 0xd0, 0xe2, 0xe6, 0x00, 0x22, 0x21, 0xe7, 0x01, 0x23, 0xbd, 0xe7, 0xc0, 0x46, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0xde, 0x46, 0x45, 0x46, 0xe0, 0xb5, 0x44, 0x02, 0x43, 0x00, 0xc6, 0x0f, 0x83, 0xb0, 0x0f, 0x1c, 0x64, 0x0a, 0x1b, 0x0e, 0xb2, 0x46, 0x53, 0xd0, 0xff, 0x2b, 0x27, 0xd0, 0x80, 0x22, 0xe4, 0x00, 0xd2, 0x04, 0x14, 0x43, 0x7f, 0x22, 0x52, 0x42, 0x90, 0x46, 0x98, 0x44, 0x00, 0x23, 0x99, 0x46, 0x9b, 0x46, 0x7d, 0x02, 0x78, 0x00, 0xfb, 0x0f, 0x6d, 0x0a, 0x00, 0x0e, 0x00, 0x93, 0x24, 0xd0, 0xff, 0x28, 0x46, 0xd0, 0x80, 0x23, 0x00, 0x21, 0xed, 0x00, 0xdb, 0x04, 0x1d, 0x43, 0x7f, 0x38, 0x47, 0x46, 0x38, 0x1a, 0x4f, 0x46, 0x0f, 0x43, 0xbf, 0x00, 0xb9, 0x46, 0x33, 0x00, 0x00, 0x9a, 0x87, 0x4f, 0x53, 0x40, 0x4a, 0x46, 0xba, 0x58, 0x01, 0x93, 0x97, 0x46, 0x00, 0x2c, 0x4e, 0xd1, 0x08, 0x23, 0x99, 0x46, 0xf7, 0x33, 0x98, 0x46, 0xfd, 0x3b, 0x9b, 0x46, 0x7d, 0x02, 0x78, 0x00, 0xfb, 0x0f, 0x6d, 0x0a, 0x00, 0x0e, 0x00, 0x93, 0xda, 0xd1, 0x00, 0x2d, 0x26, 0xd1, 0x00, 0x20, 0x01, 0x21, 0x33, 0x00, 0x00, 0x9a, 0x7a, 0x4f, 0x53, 0x40, 0x42, 0x46, 0x10, 0x1a, 0x4a, 0x46, 0x0a, 0x43, 0x92, 0x00, 0xba, 0x58, 0x1d, 0x00, 0x97, 0x46, 0x00, 0x9b, 0x2c, 0x00, 0x9a, 0x46, 0x8b, 0x46, 0x5b, 0x46, 0x02, 0x2b, 0x31, 0xd1, 0x53, 0x46, 0xff, 0x21, 0x00, 0x24, 0x38, 0xe0, 0x00, 0x2c, 0x17, 0xd1, 0x04, 0x23, 0x99, 0x46, 0x00, 0x23, 0x98, 0x46, 0x01, 0x33, 0x9b, 0x46, 0xaf, 0xe7, 0xff, 0x20, 0x00, 0x2d, 0x0b, 0xd1, 0x02, 0x21, 0xda, 0xe7, 0x28, 0x00, 0x00, 0xf0, 0x46, 0xfc, 0x43, 0x1f, 0x9d, 0x40, 0x76, 0x23, 0x5b, 0x42, 0x18, 0x1a, 0x00, 0x21, 0xaf, 0xe7, 0x03, 0x21, 0xad, 0xe7, 0x20, 0x00, 0x00, 0xf0, 0x3a, 0xfc, 0x43, 0x1f, 0x9c, 0x40, 0x76, 0x23, 0x5b, 0x42, 0x1b, 0x1a, 0x98, 0x46, 0x00, 0x23, 0x99, 0x46, 0x9b, 0x46, 0x91, 0xe7, 0x0c, 0x23, 0x99, 0x46, 0xf3, 0x33, 0x98, 0x46, 0xfc, 0x3b, 0x9b, 0x46, 0x8a, 0xe7, 0x03, 0x2b, 0x00, 0xd1, 0xa5, 0xe0, 0x55, 0x46, 0x01, 0x2b, 0x00, 0xd0, 0x81, 0xe0, 0x01, 0x23, 0x00, 0x21, 0x00, 0x24, 0x2b, 0x40, 0x64, 0x02, 0xc9, 0x05, 0x60, 0x0a, 0xdb, 0x07, 0x08, 0x43, 0x18, 0x43, 0x03, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x80, 0x24, 0x00, 0x23, 0xe4, 0x03, 0xff, 0x21, 0xed, 0xe7, 0xff, 0x21, 0x00, 0x24, 0xea, 0xe7, 0x01, 0x23, 0x59, 0x1a, 0x1b, 0x29, 0x66, 0xdd, 0x01, 0x9a, 0x13, 0x40, 0x00, 0x21, 0x00, 0x24, 0xe1, 0xe7, 0x80, 0x23, 0xdb, 0x03, 0x1c, 0x42, 0x38, 0xd0, 0x1d, 0x42, 0x51, 0xd0, 0x1c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x33, 0x00, 0xff, 0x21, 0xd5, 0xe7, 0x63, 0x01, 0x6c, 0x01, 0xa3, 0x42, 0x3b, 0xd2, 0x1b, 0x26, 0x00, 0x21, 0x01, 0x38, 0x01, 0x25, 0x1f, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x00, 0x2f, 0x01, 0xdb, 0x9c, 0x42, 0x01, 0xd8, 0x1b, 0x1b, 0x29, 0x43, 0x01, 0x3e, 0x00, 0x2e, 0xf3, 0xd1, 0x1c, 0x00, 0x63, 0x1e, 0x9c, 0x41, 0x0c, 0x43, 0x01, 0x00, 0x7f, 0x31, 0x00, 0x29, 0xce, 0xdd, 0x63, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0x23, 0x40, 0x04, 0x2b, 0x00, 0xd0, 0x04, 0x34, 0x23, 0x01, 0x03, 0xd5, 0x01, 0x00, 0x2c, 0x4b, 0x80, 0x31, 0x1c, 0x40, 0xfe, 0x29, 0x0d, 0xdd, 0x01, 0x23, 0x01, 0x9a, 0xff, 0x21, 0x13, 0x40, 0x00, 0x24, 0xa4, 0xe7, 0x80, 0x23, 0xdb, 0x03, 0x1c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x33, 0x00, 0xff, 0x21, 0x9c, 0xe7, 0x01, 0x23, 0x01, 0x9a, 0xa4, 0x01, 0x64, 0x0a, 0xc9, 0xb2, 0x13, 0x40, 0x95, 0xe7, 0x1b, 0x1b, 0x1a, 0x26, 0x01, 0x21, 0xc2, 0xe7, 0x00, 0x9b, 0x8b, 0x46, 0x9a, 0x46, 0x00, 0x24, 0x4c, 0xe7, 0x63, 0x02, 0xe5, 0xd5, 0x00, 0x25, 0x80, 0x24, 0xe4, 0x03, 0x2c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x00, 0x9b, 0xff, 0x21, 0x81, 0xe7, 0x01, 0x95, 0xc1, 0xe7, 0x23, 0x00, 0x20, 0x20, 0xcb, 0x40, 0x41, 0x1a, 0x8c, 0x40, 0x61, 0x1e, 0x8c, 0x41, 0x1c, 0x43, 0x63, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0x23, 0x40, 0x04, 0x2b, 0x00, 0xd0, 0x04, 0x34, 0x63, 0x01, 0x05, 0xd5, 0x01, 0x23, 0x01, 0x9a, 0x01, 0x21, 0x13, 0x40, 0x00, 0x24, 0x68, 0xe7, 0x01, 0x23, 0x01, 0x9a, 0xa4, 0x01, 0x64, 0x0a, 0x13, 0x40, 0x00, 0x21, 0x61, 0xe7, 0x80, 0x23, 0xdb, 0x03, 0x1c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x53, 0x46, 0xff, 0x21, 0x59, 0xe7, 0xd8, 0x6e, 0x00, 0x00, 0x18, 0x6f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xf8, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0x45, 0x46, 0xde, 0x46, 0xe0, 0xb5, 0x47, 0x02, 0x46, 0x00, 0x88, 0x46, 0x7f, 0x0a, 0x36, 0x0e, 0xc4, 0x0f, 0x00, 0x2e, 0x47, 0xd0, 0xff, 0x2e, 0x24, 0xd0, 0xfb, 0x00, 0x80, 0x27, 0xff, 0x04, 0x1f, 0x43, 0x00, 0x23, 0x99, 0x46, 0x9a, 0x46, 0x7f, 0x3e, 0x43, 0x46, 0x5d, 0x02, 0x58, 0x00, 0xdb, 0x0f, 0x6d, 0x0a, 0x00, 0x0e, 0x98, 0x46, 0x43, 0xd0, 0xff, 0x28, 0x3b, 0xd0, 0xeb, 0x00, 0x80, 0x25, 0x00, 0x22, 0xed, 0x04, 0x1d, 0x43, 0x7f, 0x38, 0x36, 0x18, 0x73, 0x1c, 0x41, 0x46, 0x9b, 0x46, 0x4b, 0x46, 0x61, 0x40, 0x13, 0x43, 0x0f, 0x2b, 0x64, 0xd8, 0x75, 0x48, 0x9b, 0x00, 0xc3, 0x58, 0x9f, 0x46, 0x00, 0x2f, 0x42, 0xd1, 0x08, 0x23, 0x99, 0x46, 0x06, 0x3b, 0xff, 0x26, 0x9a, 0x46, 0xda, 0xe7, 0x41, 0x46, 0x02, 0x2a, 0x28, 0xd0, 0x03, 0x2a, 0x00, 0xd1, 0xce, 0xe0, 0x01, 0x2a, 0x00, 0xd0, 0xac, 0xe0, 0x11, 0x40, 0x00, 0x20, 0x00, 0x22, 0xcc, 0xb2, 0x40, 0x02, 0xd2, 0x05, 0x40, 0x0a, 0xe4, 0x07, 0x10, 0x43, 0x20, 0x43, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf8, 0xbd, 0x00, 0x2f, 0x15, 0xd1, 0x04, 0x23, 0x99, 0x46, 0x03, 0x3b, 0x00, 0x26, 0x9a, 0x46, 0xb9, 0xe7, 0xff, 0x20, 0x02, 0x22, 0x00, 0x2d, 0xc5, 0xd0, 0x03, 0x22, 0xc3, 0xe7, 0x00, 0x2d, 0x19, 0xd1, 0x00, 0x20, 0x01, 0x22, 0xbe, 0xe7, 0x01, 0x24, 0xff, 0x22, 0x0c, 0x40, 0x00, 0x20, 0xdb, 0xe7, 0x38, 0x00, 0x00, 0xf0, 0x01, 0xfb, 0x76, 0x26, 0x43, 0x1f, 0x9f, 0x40, 0x00, 0x23, 0x76, 0x42, 0x36, 0x1a, 0x99, 0x46, 0x9a, 0x46, 0x9d, 0xe7, 0x0c, 0x23, 0x99, 0x46, 0x09, 0x3b, 0xff, 0x26, 0x9a, 0x46, 0x97, 0xe7, 0x28, 0x00, 0x00, 0xf0, 0xef, 0xfa, 0x43, 0x1f, 0x9d, 0x40, 0x76, 0x23, 0x5b, 0x42, 0x18, 0x1a, 0x00, 0x22, 0x9d, 0xe7, 0x80, 0x20, 0x00, 0x24, 0xc0, 0x03, 0xff, 0x22, 0xba, 0xe7, 0x3d, 0x00, 0x52, 0x46, 0xab, 0xe7, 0x3d, 0x00, 0x21, 0x00, 0x52, 0x46, 0xa7, 0xe7, 0x3b, 0x0c, 0x9c, 0x46, 0x2a, 0x04, 0x12, 0x0c, 0x2b, 0x0c, 0x14, 0x00, 0x60, 0x46, 0x65, 0x46, 0x3f, 0x04, 0x3f, 0x0c, 0x7c, 0x43, 0x42, 0x43, 0x5d, 0x43, 0x7b, 0x43, 0x27, 0x0c, 0x9b, 0x18, 0xff, 0x18, 0xba, 0x42, 0x03, 0xd9, 0x80, 0x23, 0x5b, 0x02, 0x9c, 0x46, 0x65, 0x44, 0x24, 0x04, 0x3a, 0x04, 0x24, 0x0c, 0x12, 0x19, 0x93, 0x01, 0x5c, 0x1e, 0xa3, 0x41, 0x3f, 0x0c, 0x92, 0x0e, 0x7d, 0x19, 0x1a, 0x43, 0xad, 0x01, 0x15, 0x43, 0x2b, 0x01, 0x04, 0xd5, 0x01, 0x23, 0x5e, 0x46, 0x6a, 0x08, 0x1d, 0x40, 0x15, 0x43, 0x32, 0x00, 0x7f, 0x32, 0x00, 0x2a, 0x25, 0xdd, 0x6b, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0x2b, 0x40, 0x04, 0x2b, 0x00, 0xd0, 0x04, 0x35, 0x2b, 0x01, 0x03, 0xd5, 0x32, 0x00, 0x27, 0x4b, 0x80, 0x32, 0x1d, 0x40, 0xfe, 0x2a, 0x94, 0xdc, 0x01, 0x24, 0xa8, 0x01, 0x40, 0x0a, 0xd2, 0xb2, 0x0c, 0x40, 0x6f, 0xe7, 0x80, 0x20, 0xc0, 0x03, 0x07, 0x42, 0x07, 0xd0, 0x05, 0x42, 0x05, 0xd1, 0x28, 0x43, 0x40, 0x02, 0x40, 0x0a, 0x44, 0x46, 0xff, 0x22, 0x63, 0xe7, 0x38, 0x43, 0x40, 0x02, 0x40, 0x0a, 0xff, 0x22, 0x5e, 0xe7, 0x01, 0x24, 0xa3, 0x1a, 0x1b, 0x2b, 0x05, 0xdd, 0x0c, 0x40, 0x00, 0x22, 0x00, 0x20, 0x56, 0xe7, 0x5e, 0x46, 0xcb, 0xe7, 0x2a, 0x00, 0x20, 0x20, 0xda, 0x40, 0xc3, 0x1a, 0x9d, 0x40, 0x2b, 0x00, 0x5d, 0x1e, 0xab, 0x41, 0x13, 0x43, 0x5a, 0x07, 0x04, 0xd0, 0x0f, 0x22, 0x1a, 0x40, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0x04, 0xd5, 0x01, 0x24, 0x01, 0x22, 0x0c, 0x40, 0x00, 0x20, 0x3d, 0xe7, 0x01, 0x24, 0x9b, 0x01, 0x58, 0x0a, 0x0c, 0x40, 0x00, 0x22, 0x37, 0xe7, 0x80, 0x20, 0x01, 0x24, 0xc0, 0x03, 0x28, 0x43, 0x40, 0x02, 0x40, 0x0a, 0x0c, 0x40, 0xff, 0x22, 0x2e, 0xe7, 0xc0, 0x46, 0x58, 0x6f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xf0, 0xb5, 0x4f, 0x46, 0xd6, 0x46, 0x46, 0x46, 0x44, 0x00, 0xc0, 0xb5, 0xc2, 0x0f, 0x47, 0x02, 0x48, 0x02, 0x40, 0x0a, 0x84, 0x46, 0x66, 0x46, 0x7b, 0x0a, 0x48, 0x00, 0xc9, 0x0f, 0x9a, 0x46, 0x24, 0x0e, 0x15, 0x00, 0xdb, 0x00, 0x00, 0x0e, 0x89, 0x46, 0xf6, 0x00, 0xff, 0x28, 0x00, 0xd1, 0x8f, 0xe0, 0x01, 0x21, 0x4f, 0x46, 0x4f, 0x40, 0x39, 0x00, 0x91, 0x42, 0x66, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xdc, 0x9d, 0xe0, 0x00, 0x28, 0x3d, 0xd1, 0x00, 0x2e, 0x00, 0xd1, 0x8b, 0xe0, 0x51, 0x1e, 0x00, 0x29, 0x00, 0xd0, 0xb5, 0xe0, 0x01, 0x24, 0x9b, 0x1b, 0x5a, 0x01, 0x44, 0xd5, 0x9b, 0x01, 0x9f, 0x09, 0x38, 0x00, 0x00, 0xf0, 0x1d, 0xfa, 0x05, 0x38, 0x87, 0x40, 0x84, 0x42, 0x00, 0xdd, 0x96, 0xe0, 0x04, 0x1b, 0x3a, 0x00, 0x20, 0x20, 0x01, 0x34, 0xe2, 0x40, 0x04, 0x1b, 0xa7, 0x40, 0x3b, 0x00, 0x5f, 0x1e, 0xbb, 0x41, 0x00, 0x24, 0x13, 0x43, 0x5a, 0x07, 0x04, 0xd0, 0x0f, 0x22, 0x1a, 0x40, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0x27, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x79, 0xe0, 0x01, 0x22, 0x9b, 0x01, 0x5b, 0x0a, 0xe4, 0xb2, 0x2a, 0x40, 0x5b, 0x02, 0xe4, 0x05, 0x58, 0x0a, 0xd2, 0x07, 0x20, 0x43, 0x10, 0x43, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0xff, 0x2c, 0xe0, 0xd0, 0x80, 0x21, 0xc9, 0x04, 0x0e, 0x43, 0x1b, 0x2a, 0x7b, 0xdc, 0x31, 0x00, 0x20, 0x20, 0xd1, 0x40, 0x82, 0x1a, 0x96, 0x40, 0x72, 0x1e, 0x96, 0x41, 0x0e, 0x43, 0x9b, 0x1b, 0x5a, 0x01, 0xba, 0xd4, 0x5a, 0x07, 0xd0, 0xd1, 0x01, 0x22, 0xdf, 0x08, 0x2a, 0x40, 0xff, 0x2c, 0x33, 0xd1, 0x00, 0x2f, 0x00, 0xd1, 0xa8, 0xe0, 0x80, 0x23, 0xdb, 0x03, 0x3b, 0x43, 0x5b, 0x02, 0x5b, 0x0a, 0xff, 0x24, 0xd1, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x4c, 0xdd, 0x00, 0x28, 0x2a, 0xd0, 0xff, 0x2c, 0xb8, 0xd0, 0x80, 0x20, 0xc0, 0x04, 0x06, 0x43, 0x1b, 0x29, 0x00, 0xdd, 0xaf, 0xe0, 0x30, 0x00, 0x20, 0x27, 0xc8, 0x40, 0x79, 0x1a, 0x8e, 0x40, 0x71, 0x1e, 0x8e, 0x41, 0x06, 0x43, 0x9b, 0x19, 0x59, 0x01, 0xd6, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x85, 0xe0, 0x01, 0x22, 0x7a, 0x49, 0x1a, 0x40, 0x5b, 0x08, 0x0b, 0x40, 0x13, 0x43, 0x9c, 0xe7, 0x00, 0x2e, 0x00, 0xd0, 0x70, 0xe7, 0x6b, 0xe7, 0x3b, 0x1e, 0xc5, 0xd1, 0x00, 0x22, 0x7b, 0x02, 0x5b, 0x0a, 0xe4, 0xb2, 0xa3, 0xe7, 0x14, 0x00, 0x8f, 0xe7, 0x00, 0x2e, 0x4d, 0xd0, 0x48, 0x1e, 0x00, 0x28, 0x57, 0xd1, 0x9b, 0x19, 0x01, 0x24, 0x5a, 0x01, 0xb5, 0xd5, 0x02, 0x24, 0xe0, 0xe7, 0x00, 0x2a, 0x25, 0xd1, 0x62, 0x1c, 0xd2, 0xb2, 0x01, 0x2a, 0x72, 0xdd, 0x9f, 0x1b, 0x7a, 0x01, 0x35, 0xd5, 0xf7, 0x1a, 0x0d, 0x00, 0x64, 0xe7, 0x01, 0x22, 0x00, 0x23, 0x2a, 0x40, 0x86, 0xe7, 0x3b, 0x00, 0x63, 0x4a, 0x24, 0x1a, 0x13, 0x40, 0x6f, 0xe7, 0x00, 0x29, 0x6c, 0xd1, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4e, 0xdd, 0xff, 0x29, 0x49, 0xd0, 0x9b, 0x19, 0x5b, 0x08, 0x0c, 0x00, 0x63, 0xe7, 0xff, 0x2a, 0x41, 0xd0, 0x0a, 0x00, 0x81, 0xe7, 0x01, 0x26, 0x9b, 0x1b, 0x89, 0xe7, 0x00, 0x2c, 0x1c, 0xd0, 0xff, 0x28, 0x21, 0xd0, 0x80, 0x24, 0xe4, 0x04, 0x52, 0x42, 0x23, 0x43, 0x1b, 0x2a, 0x00, 0xdd, 0x96, 0xe0, 0x1c, 0x00, 0x20, 0x25, 0xd4, 0x40, 0xaa, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0x93, 0x41, 0x23, 0x43, 0xf3, 0x1a, 0x04, 0x00, 0x0d, 0x00, 0x2d, 0xe7, 0x00, 0x2f, 0x00, 0xd0, 0x2e, 0xe7, 0x00, 0x22, 0x00, 0x24, 0xa9, 0xe7, 0x0c, 0x00, 0x3d, 0xe7, 0x00, 0x2b, 0x58, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xee, 0xd0, 0xff, 0x28, 0xe1, 0xd1, 0x33, 0x00, 0xff, 0x24, 0x0d, 0x00, 0x32, 0xe7, 0xff, 0x29, 0x10, 0xd0, 0x01, 0x00, 0x78, 0xe7, 0x00, 0x2b, 0x6e, 0xd0, 0xff, 0x24, 0x00, 0x2e, 0x00, 0xd1, 0x28, 0xe7, 0x80, 0x22, 0x51, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x03, 0xd0, 0x61, 0x46, 0x11, 0x42, 0x00, 0xd1, 0x33, 0x00, 0xff, 0x24, 0x1d, 0xe7, 0xff, 0x24, 0x00, 0x23, 0x2c, 0xe7, 0x00, 0x2c, 0xe9, 0xd1, 0x00, 0x2b, 0x63, 0xd0, 0x00, 0x2e, 0x00, 0xd1, 0x13, 0xe7, 0x9b, 0x19, 0x5a, 0x01, 0x00, 0xd4, 0x3e, 0xe7, 0x31, 0x4a, 0x0c, 0x00, 0x13, 0x40, 0x0b, 0xe7, 0x00, 0x2c, 0x1e, 0xd1, 0x00, 0x2b, 0x2f, 0xd1, 0x00, 0x2e, 0x4f, 0xd0, 0x33, 0x00, 0x0d, 0x00, 0x02, 0xe7, 0x01, 0x26, 0x55, 0xe7, 0x00, 0x2c, 0x1f, 0xd1, 0x00, 0x2b, 0x43, 0xd0, 0xc9, 0x43, 0x00, 0x29, 0x0b, 0xd0, 0xff, 0x28, 0x39, 0xd0, 0x1b, 0x29, 0x44, 0xdc, 0x1c, 0x00, 0x20, 0x27, 0xcc, 0x40, 0x79, 0x1a, 0x8b, 0x40, 0x59, 0x1e, 0x8b, 0x41, 0x23, 0x43, 0x9b, 0x19, 0x04, 0x00, 0x40, 0xe7, 0x00, 0x2b, 0x1a, 0xd1, 0x00, 0x2e, 0x24, 0xd1, 0x80, 0x27, 0x00, 0x22, 0xff, 0x03, 0x1b, 0xe7, 0x33, 0x00, 0x04, 0x00, 0x0d, 0x00, 0xde, 0xe6, 0xff, 0x28, 0x1e, 0xd0, 0x80, 0x24, 0xe4, 0x04, 0x49, 0x42, 0x23, 0x43, 0xdf, 0xe7, 0x00, 0x2e, 0x00, 0xd1, 0xd4, 0xe6, 0x9f, 0x1b, 0x7a, 0x01, 0x00, 0xd4, 0x37, 0xe7, 0xf3, 0x1a, 0x0d, 0x00, 0xcd, 0xe6, 0xff, 0x24, 0x00, 0x2e, 0x00, 0xd1, 0xc9, 0xe6, 0x80, 0x22, 0x50, 0x46, 0xd2, 0x03, 0x10, 0x42, 0xa4, 0xd0, 0x60, 0x46, 0x10, 0x42, 0xa1, 0xd1, 0x33, 0x00, 0x0d, 0x00, 0xff, 0x24, 0xbd, 0xe6, 0x33, 0x00, 0xff, 0x24, 0xba, 0xe6, 0x01, 0x23, 0x6e, 0xe7, 0x33, 0x00, 0x04, 0x00, 0xb5, 0xe6, 0x00, 0x27, 0x00, 0x22, 0x1c, 0xe7, 0x33, 0x00, 0xb0, 0xe6, 0x01, 0x23, 0xc0, 0xe7, 0xc0, 0x46, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xfb, 0x41, 0x02, 0x43, 0x00, 0xc2, 0x0f, 0x49, 0x0a, 0x1b, 0x0e, 0x00, 0x20, 0x7e, 0x2b, 0x0d, 0xdd, 0x9d, 0x2b, 0x0c, 0xdc, 0x80, 0x20, 0x00, 0x04, 0x01, 0x43, 0x95, 0x2b, 0x0a, 0xdc, 0x96, 0x20, 0xc3, 0x1a, 0xd9, 0x40, 0x48, 0x42, 0x00, 0x2a, 0x00, 0xd1, 0x08, 0x00, 0x70, 0x47, 0x03, 0x4b, 0xd0, 0x18, 0xfb, 0xe7, 0x96, 0x3b, 0x99, 0x40, 0xf4, 0xe7, 0xc0, 0x46, 0xff, 0xff, 0xff, 0x7f, 0x70, 0xb5, 0x00, 0x28, 0x30, 0xd0, 0xc3, 0x17, 0xc4, 0x18, 0x5c, 0x40, 0xc5, 0x0f, 0x20, 0x00, 0x00, 0xf0, 0x8c, 0xf8, 0x9e, 0x23, 0x1b, 0x1a, 0x96, 0x2b, 0x0d, 0xdc, 0x96, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0x2a, 0x00, 0x64, 0x02, 0x64, 0x0a, 0xdb, 0xb2, 0x64, 0x02, 0xdb, 0x05, 0x60, 0x0a, 0xd2, 0x07, 0x18, 0x43, 0x10, 0x43, 0x70, 0xbd, 0x99, 0x2b, 0x19, 0xdc, 0x99, 0x22, 0xd2, 0x1a, 0x00, 0x2a, 0x29, 0xdd, 0x94, 0x40, 0x22, 0x00, 0x14, 0x4c, 0x14, 0x40, 0x51, 0x07, 0x04, 0xd0, 0x0f, 0x21, 0x0a, 0x40, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x34, 0x62, 0x01, 0x13, 0xd4, 0xa4, 0x01, 0x64, 0x0a, 0xdb, 0xb2, 0x2a, 0x00, 0xe0, 0xe7, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0xdc, 0xe7, 0x05, 0x22, 0x21, 0x00, 0x12, 0x1a, 0xd1, 0x40, 0xb9, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0x62, 0x1e, 0x94, 0x41, 0x0c, 0x43, 0xda, 0xe7, 0x05, 0x4b, 0x2a, 0x00, 0x1c, 0x40, 0x9f, 0x23, 0xa4, 0x01, 0x1b, 0x1a, 0x64, 0x0a, 0xdb, 0xb2, 0xc8, 0xe7, 0x22, 0x00, 0xd5, 0xe7, 0xff, 0xff, 0xff, 0xfb, 0x10, 0xb5, 0x04, 0x1e, 0x27, 0xd0, 0x00, 0xf0, 0x41, 0xf8, 0x9e, 0x23, 0x1b, 0x1a, 0x96, 0x2b, 0x0a, 0xdc, 0x96, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0x64, 0x02, 0x64, 0x0a, 0xdb, 0xb2, 0x64, 0x02, 0xdb, 0x05, 0x60, 0x0a, 0x18, 0x43, 0x10, 0xbd, 0x99, 0x2b, 0x17, 0xdc, 0x99, 0x22, 0xd2, 0x1a, 0x00, 0x2a, 0x27, 0xdd, 0x94, 0x40, 0x22, 0x00, 0x13, 0x4c, 0x14, 0x40, 0x51, 0x07, 0x04, 0xd0, 0x0f, 0x21, 0x0a, 0x40, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x34, 0x62, 0x01, 0x12, 0xd4, 0xa4, 0x01, 0x64, 0x0a, 0xdb, 0xb2, 0xe3, 0xe7, 0x00, 0x23, 0x00, 0x24, 0xe0, 0xe7, 0xb9, 0x22, 0x21, 0x00, 0xd2, 0x1a, 0x91, 0x40, 0x0a, 0x00, 0x51, 0x1e, 0x8a, 0x41, 0x05, 0x21, 0x09, 0x1a, 0xcc, 0x40, 0x14, 0x43, 0xdb, 0xe7, 0x04, 0x4b, 0x1c, 0x40, 0x9f, 0x23, 0xa4, 0x01, 0x1b, 0x1a, 0x64, 0x0a, 0xdb, 0xb2, 0xcc, 0xe7, 0x22, 0x00, 0xd7, 0xe7, 0xff, 0xff, 0xff, 0xfb, 0x1c, 0x21, 0x01, 0x23, 0x1b, 0x04, 0x98, 0x42, 0x01, 0xd3, 0x00, 0x0c, 0x10, 0x39, 0x1b, 0x0a, 0x98, 0x42, 0x01, 0xd3, 0x00, 0x0a, 0x08, 0x39, 0x1b, 0x09, 0x98, 0x42, 0x01, 0xd3, 0x00, 0x09, 0x04, 0x39, 0x02, 0xa2, 0x10, 0x5c, 0x40, 0x18, 0x70, 0x47, 0xc0, 0x46, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xb5, 0x00, 0x26, 0x0c, 0x4d, 0x0d, 0x4c, 0x64, 0x1b, 0xa4, 0x10, 0xa6, 0x42, 0x09, 0xd1, 0x00, 0x26, 0x00, 0xf0, 0xeb, 0xf9, 0x0a, 0x4d, 0x0a, 0x4c, 0x64, 0x1b, 0xa4, 0x10, 0xa6, 0x42, 0x05, 0xd1, 0x70, 0xbd, 0xb3, 0x00, 0xeb, 0x58, 0x98, 0x47, 0x01, 0x36, 0xee, 0xe7, 0xb3, 0x00, 0xeb, 0x58, 0x98, 0x47, 0x01, 0x36, 0xf2, 0xe7, 0xa4, 0x6f, 0x00, 0x00, 0xa4, 0x6f, 0x00, 0x00, 0xa4, 0x6f, 0x00, 0x00, 0xa8, 0x6f, 0x00, 0x00, 0x00, 0x23, 0x10, 0xb5, 0x9a, 0x42, 0x00, 0xd1, 0x10, 0xbd, 0xcc, 0x5c, 0xc4, 0x54, 0x01, 0x33, 0xf8, 0xe7, 0x03, 0x00, 0x82, 0x18, 0x93, 0x42, 0x00, 0xd1, 0x70, 0x47, 0x19, 0x70, 0x01, 0x33, 0xf9, 0xe7, 0x00, 0x00, 0xe2, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xf2, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xea, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xce, 0x22, 0x00, 0x00, 0xda, 0x22, 0x00, 0x00, 0xd2, 0x22, 0x00, 0x00, 0xb6, 0x22, 0x00, 0x00, 0x0c, 0x23, 0x00, 0x00, 0xfa, 0x22, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xae, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xae, 0x28, 0x00, 0x00, 0x88, 0x28, 0x00, 0x00, 0x88, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xae, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xae, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0xae, 0x28, 0x00, 0x00, 0xae, 0x28, 0x00, 0x00, 0x96, 0x28, 0x00, 0x00, 0x96, 0x28, 0x00, 0x00, 0x96, 0x28, 0x00, 0x00, 0x96, 0x28, 0x00, 0x00, 0x45, 0x45, 0x74, 0x41, 0x4d, 0x4f, 0x52, 0x50, 0x2e, 0x75, 0x6d, 0x45, 0xde, 0x4e, 0x00, 0x00, 0xe6, 0x4e, 0x00, 0x00, 0x7e, 0x4e, 0x00, 0x00, 0x7a, 0x4e, 0x00, 0x00, 0x82, 0x4e, 0x00, 0x00, 0x92, 0x4e, 0x00, 0x00, 0x9a, 0x4e, 0x00, 0x00, 0xa0, 0x4e, 0x00, 0x00, 0xaa, 0x4e, 0x00, 0x00, 0xb2, 0x4e, 0x00, 0x00, 0x74, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x04, 0x00, 0x42, 0x00, 0x08, 0x00, 0x42, 0x00, 0x0c, 0x00, 0x42, 0x00, 0x10, 0x00, 0x42, 0x00, 0x04, 0x00, 0x43, 0xa2, 0x56, 0x00, 0x00, 0xba, 0x56, 0x00, 0x00, 0xba, 0x56, 0x00, 0x00, 0x66, 0x56, 0x00, 0x00, 0x66, 0x56, 0x00, 0x00, 0x6c, 0x56, 0x00, 0x00, 0x72, 0x56, 0x00, 0x00, 0x82, 0x56, 0x00, 0x00, 0xa8, 0x56, 0x00, 0x00, 0x88, 0x63, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x6a, 0x63, 0x00, 0x00, 0xac, 0x62, 0x00, 0x00, 0x6a, 0x63, 0x00, 0x00, 0x4e, 0x63, 0x00, 0x00, 0x6a, 0x63, 0x00, 0x00, 0xac, 0x62, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x4e, 0x63, 0x00, 0x00, 0xac, 0x62, 0x00, 0x00, 0xb4, 0x62, 0x00, 0x00, 0xb4, 0x62, 0x00, 0x00, 0xb4, 0x62, 0x00, 0x00, 0x70, 0x63, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x2c, 0x63, 0x00, 0x00, 0x10, 0x64, 0x00, 0x00, 0x2c, 0x63, 0x00, 0x00, 0x4e, 0x63, 0x00, 0x00, 0x2c, 0x63, 0x00, 0x00, 0x10, 0x64, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x58, 0x63, 0x00, 0x00, 0x4e, 0x63, 0x00, 0x00, 0x10, 0x64, 0x00, 0x00, 0xb4, 0x62, 0x00, 0x00, 0xb4, 0x62, 0x00, 0x00, 0xb4, 0x62, 0x00, 0x00, 0x1a, 0x64, 0x00, 0x00, 0xb8, 0x65, 0x00, 0x00, 0x08, 0x65, 0x00, 0x00, 0x08, 0x65, 0x00, 0x00, 0x06, 0x65, 0x00, 0x00, 0xaa, 0x65, 0x00, 0x00, 0xaa, 0x65, 0x00, 0x00, 0xa0, 0x65, 0x00, 0x00, 0x06, 0x65, 0x00, 0x00, 0xaa, 0x65, 0x00, 0x00, 0xa0, 0x65, 0x00, 0x00, 0xaa, 0x65, 0x00, 0x00, 0x06, 0x65, 0x00, 0x00, 0xb0, 0x65, 0x00, 0x00, 0xb0, 0x65, 0x00, 0x00, 0xb0, 0x65, 0x00, 0x00, 0x40, 0x66, 0x00, 0x00, 0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0xdd, 0x20, 0x00, 0x00, 0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0xb5, 0x20, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x20, 0x41, 0xa3, 0x00, 0x01, 0x00};
-#endif /* ADS_FW_ */
+/**
+ * ads_fw.h
+ *
+ * Firmware images for ads_dfu_update. Each image is defined once, in its own
+ * translation unit, ads_fw.cpp, ads_fw_v2.cpp and their compressed versions
+ * ads_fw_lz.cpp and ads_fw_v2_lz.cpp, and described by an ads_fw_image_t.
+ * An image takes flash only if it is referenced, through the ADS_FW_INCLUDE_*
+ * options of ads_dfu.h, when linking with --gc-sections as Arduino does.
+ *
+ * All of them are generated from the vendor .bin with
+ * portable/tools/ads_fw_pack.c, which computes the CRC from the .bin. The
+ * CRC is checked before an in-memory image is flashed, and again as it is
+ * sent, see ads_dfu_init_image.
+ */
+
+#ifndef ADS_FW_
+#define ADS_FW_
+
+#include <stdint.h>
+#include "ads_util.h"
+
+/* Encoding of the image data */
+typedef enum {
+	ADS_FW_RAW = 0,						// As written to the bootloader
+	ADS_FW_LZ							// Compressed, see ads_dfu_lz.h
+} ADS_FW_FORMAT_T;
+
+/* Firmware image and its descriptor */
+typedef struct {
+	uint16_t rev;						// Firmware version, as read by ads_dfu_get_fw_ver
+	uint32_t len;						// Length of the image written to the bootloader
+	uint32_t crc;						// CRC-32 of the image written to the bootloader, see ads_dfu_crc32
+	uint8_t format;						// ADS_FW_FORMAT_T of data
+	const uint8_t * data;				// Image data
+	uint32_t size;						// Bytes at data
+} ads_fw_image_t;
+
+extern const ads_fw_image_t ads_fw_image;			// One axis version 1
+extern const ads_fw_image_t ads_fw_v2_image;		// One axis version 2
+extern const ads_fw_image_t ads_fw_lz_image;		// One axis version 1, compressed
+extern const ads_fw_image_t ads_fw_v2_lz_image;		// One axis version 2, compressed
+
+#endif /* ADS_FW_ */
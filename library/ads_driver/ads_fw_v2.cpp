@@ -0,0 +1,1236 @@
+/* Generated by ads_fw_pack from ads_fw_v2.bin, see ads_fw.h */
+#include "ads_fw.h"
+
+static const uint8_t ads_fw_v2_data[] = {
+	0x00, 0x09, 0x00, 0x20, 0xfd, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xa9, 0x3e, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0x61, 0x41, 0x00, 0x00, 0x11, 0x42, 0x00, 0x00,
+	0xc1, 0x42, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xad, 0x38, 0x00, 0x00, 0xf9, 0x38, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00, 0xf9, 0x23, 0x00, 0x00,
+	0xf9, 0x23, 0x00, 0x00, 0x10, 0xb5, 0x40, 0xf2, 0x18, 0x04, 0xc2, 0xf2, 0x00, 0x04, 0x23, 0x78,
+	0x63, 0xb9, 0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x2b, 0xb1, 0x45, 0xf6, 0x40, 0x40,
+	0xc0, 0xf2, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 0x23, 0x70, 0x10, 0xbd, 0xc0, 0x46,
+	0x40, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x10, 0xb5, 0x4b, 0xb1, 0x40, 0xf2, 0x1c, 0x01,
+	0x45, 0xf6, 0x40, 0x40, 0xc2, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xbf,
+	0x45, 0xf6, 0x40, 0x40, 0xc0, 0xf2, 0x00, 0x00, 0x03, 0x68, 0x03, 0xb9, 0x10, 0xbd, 0x40, 0xf2,
+	0x00, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x00, 0x2b, 0xf8, 0xd0, 0x98, 0x47, 0xf6, 0xe7, 0xc0, 0x46,
+	0x42, 0xf2, 0x89, 0x43, 0x10, 0xb5, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46,
+	0xf0, 0xb5, 0x4e, 0x46, 0x45, 0x46, 0x57, 0x46, 0xde, 0x46, 0xe0, 0xb5, 0x45, 0xf2, 0xe8, 0x76,
+	0x43, 0xf6, 0xed, 0x39, 0xc0, 0xf2, 0x00, 0x06, 0x35, 0x00, 0x00, 0x24, 0x40, 0xf2, 0x00, 0x08,
+	0x40, 0xf2, 0x00, 0x0a, 0xc3, 0xb0, 0x01, 0x90, 0xc0, 0xf2, 0x00, 0x09, 0x40, 0xf2, 0x00, 0x12,
+	0x02, 0xa9, 0x28, 0x68, 0xc8, 0x47, 0x00, 0x28, 0x00, 0xd0, 0x7a, 0xe0, 0x2b, 0x79, 0x9c, 0x46,
+	0xfb, 0xb1, 0x62, 0x46, 0x50, 0x00, 0xab, 0x68, 0x60, 0x44, 0x40, 0x00, 0x18, 0x18, 0x06, 0xe0,
+	0x59, 0x88, 0x91, 0x42, 0x00, 0xd0, 0x6c, 0xe0, 0x06, 0x33, 0x98, 0x42, 0x11, 0xd0, 0x1f, 0x88,
+	0x02, 0xa9, 0x8b, 0x46, 0x3a, 0x00, 0x5a, 0x44, 0x51, 0x78, 0x5a, 0x46, 0xd2, 0x5d, 0x09, 0x02,
+	0x0a, 0x43, 0x99, 0x88, 0x91, 0x42, 0xeb, 0xd1, 0x01, 0x34, 0x06, 0x33, 0xe4, 0xb2, 0x98, 0x42,
+	0xed, 0xd1, 0x63, 0x46, 0x40, 0xf2, 0x01, 0x0c, 0x43, 0x44, 0xdb, 0xb2, 0xe2, 0x44, 0x98, 0x46,
+	0x53, 0x46, 0x0c, 0x35, 0x02, 0x2b, 0xc9, 0xd1, 0xa0, 0x45, 0x44, 0xd0, 0x43, 0xf6, 0xd9, 0x2b,
+	0x43, 0xf6, 0x1d, 0x37, 0x40, 0xf2, 0x00, 0x0a, 0xc0, 0xf2, 0x00, 0x0b, 0xc0, 0xf2, 0x00, 0x07,
+	0x34, 0x68, 0x40, 0xf2, 0x00, 0x12, 0x02, 0xa9, 0x20, 0x00, 0xc8, 0x47, 0x32, 0x79, 0x8a, 0xb1,
+	0x50, 0x00, 0xb3, 0x68, 0x80, 0x18, 0x40, 0x00, 0x18, 0x18, 0x02, 0xad, 0xac, 0x46, 0x1a, 0x88,
+	0x99, 0x88, 0xa9, 0x54, 0x1a, 0x88, 0x99, 0x88, 0x62, 0x44, 0x09, 0x0a, 0x06, 0x33, 0x51, 0x70,
+	0x98, 0x42, 0xf2, 0xd1, 0x20, 0x00, 0xd8, 0x47, 0x63, 0x1c, 0xff, 0x33, 0x98, 0x46, 0x02, 0xad,
+	0x29, 0x00, 0x20, 0x00, 0x40, 0x22, 0x40, 0x34, 0xb8, 0x47, 0x40, 0x35, 0x44, 0x45, 0xf7, 0xd1,
+	0x40, 0xf2, 0x01, 0x0c, 0xe2, 0x44, 0x53, 0x46, 0x0c, 0x36, 0x02, 0x2b, 0xd0, 0xd1, 0x40, 0xf2,
+	0xdf, 0x23, 0x01, 0x20, 0x01, 0x9a, 0x13, 0x80, 0x43, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46,
+	0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x40, 0xf2, 0xdf, 0x23, 0x01, 0x9a, 0x00, 0x20, 0x13, 0x80,
+	0xf2, 0xe7, 0x40, 0xf2, 0xde, 0x23, 0x01, 0x9a, 0x00, 0x20, 0x13, 0x80, 0xec, 0xe7, 0xc0, 0x46,
+	0xbf, 0xf3, 0x4f, 0x8f, 0x4e, 0xf6, 0x00, 0x53, 0x04, 0x22, 0xce, 0xf2, 0x00, 0x03, 0xc0, 0xf2,
+	0xfa, 0x52, 0xda, 0x60, 0xbf, 0xf3, 0x4f, 0x8f, 0xc0, 0x46, 0xfd, 0xe7, 0x40, 0xf2, 0x34, 0x03,
+	0x01, 0x22, 0xc2, 0xf2, 0x00, 0x03, 0x1a, 0x70, 0x70, 0x47, 0xc0, 0x46, 0x40, 0xf2, 0x34, 0x03,
+	0x01, 0x22, 0xc2, 0xf2, 0x00, 0x03, 0x5a, 0x70, 0x70, 0x47, 0xc0, 0x46, 0xf0, 0xb5, 0xce, 0x46,
+	0x47, 0x46, 0x80, 0xb5, 0x03, 0x78, 0x83, 0xb0, 0x04, 0x00, 0x64, 0x2b, 0x37, 0xd8, 0xdc, 0x4a,
+	0x9b, 0x00, 0xd3, 0x58, 0x9f, 0x46, 0x63, 0x78, 0x80, 0x78, 0x03, 0x2b, 0x00, 0xd1, 0xf9, 0xe1,
+	0x00, 0xd9, 0x30, 0xe1, 0x01, 0x2b, 0x00, 0xd1, 0x1a, 0xe2, 0x00, 0xd9, 0x03, 0xe2, 0x40, 0xf2,
+	0x34, 0x04, 0x45, 0xf2, 0xad, 0x63, 0xc2, 0xf2, 0x00, 0x04, 0x25, 0x6a, 0xc0, 0xf2, 0x00, 0x03,
+	0x20, 0x77, 0xa5, 0x62, 0x98, 0x47, 0x45, 0xf2, 0x0d, 0x63, 0x06, 0x1c, 0xc0, 0xf2, 0x00, 0x03,
+	0x28, 0x00, 0x98, 0x47, 0x45, 0xf2, 0x59, 0x03, 0x21, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x45, 0xf2, 0xb1, 0x23, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x03, 0x30, 0x1c, 0x98, 0x47, 0xa0, 0x63,
+	0x20, 0x00, 0x42, 0xf2, 0x05, 0x53, 0x30, 0x30, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x03, 0xb0,
+	0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd, 0x42, 0xf2, 0x51, 0x63, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x41, 0xf2, 0xb1, 0x23, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x42, 0xf2, 0x95, 0x63,
+	0x40, 0x78, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x28, 0xe8, 0xd1, 0xf1, 0xe7, 0x40, 0xf2,
+	0x34, 0x04, 0xc2, 0xf2, 0x00, 0x04, 0x43, 0x78, 0x22, 0x7e, 0x93, 0x42, 0xdf, 0xd0, 0x23, 0x76,
+	0x00, 0x2b, 0x00, 0xd0, 0x23, 0xe1, 0x01, 0x23, 0x23, 0x70, 0x74, 0xe0, 0x45, 0xf2, 0xd7, 0x73,
+	0x01, 0xac, 0xc0, 0xf2, 0x00, 0x03, 0x03, 0x22, 0xff, 0x21, 0x20, 0x00, 0x98, 0x47, 0x01, 0x23,
+	0x23, 0x70, 0x2e, 0x33, 0x63, 0x70, 0x00, 0x23, 0xa3, 0x70, 0x40, 0xf2, 0x34, 0x03, 0xc2, 0xf2,
+	0x00, 0x03, 0x9a, 0x78, 0x03, 0x21, 0x53, 0x1e, 0x9a, 0x41, 0x44, 0xf2, 0xd9, 0x63, 0xd2, 0xb2,
+	0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xb9, 0xe7, 0x40, 0xf2, 0x34, 0x03, 0x64, 0x21,
+	0xc2, 0xf2, 0x00, 0x03, 0x42, 0x78, 0x58, 0x5c, 0x90, 0x42, 0xb0, 0xd0, 0x5a, 0x54, 0x00, 0x2a,
+	0xad, 0xd1, 0x01, 0x32, 0x1a, 0x70, 0xaa, 0xe7, 0x43, 0xf2, 0x6d, 0x13, 0x06, 0x20, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0xa3, 0xe7, 0x45, 0xf2, 0xd7, 0x73, 0x01, 0xac, 0xc0, 0xf2, 0x00, 0x03,
+	0x03, 0x22, 0xff, 0x21, 0x20, 0x00, 0x98, 0x47, 0x02, 0x23, 0x23, 0x70, 0x0a, 0x33, 0xc9, 0xe7,
+	0x42, 0x78, 0x53, 0x1e, 0x09, 0x2b, 0x92, 0xd8, 0x40, 0xf2, 0x34, 0x03, 0xc2, 0xf2, 0x00, 0x03,
+	0x18, 0x00, 0x5c, 0x33, 0x1a, 0x70, 0x42, 0xf2, 0x05, 0x53, 0x30, 0x30, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0xa1, 0x33, 0x61, 0x78, 0xc0, 0xf2, 0x00, 0x03,
+	0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x7a, 0xe7, 0x40, 0xf2, 0x34, 0x04, 0xc2, 0xf2, 0x00, 0x04,
+	0x43, 0x78, 0xa2, 0x78, 0x93, 0x42, 0x00, 0xd1, 0x71, 0xe7, 0xa3, 0x70, 0xa3, 0x78, 0x00, 0x2b,
+	0x00, 0xd0, 0xef, 0xe0, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0x25, 0x33, 0xc2, 0xf2, 0x00, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0x81, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x40, 0xf2, 0x64, 0x20, 0x42, 0xf6, 0xf9, 0x43, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2,
+	0x00, 0x00, 0x98, 0x47, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0xa1, 0x13, 0x00, 0x21, 0xc0, 0xf2,
+	0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x49, 0xe7, 0x82, 0x78, 0x43, 0x78, 0x12, 0x02,
+	0x13, 0x43, 0x00, 0x2b, 0x00, 0xd1, 0x42, 0xe7, 0x40, 0xf2, 0x00, 0x04, 0xc2, 0xf2, 0x00, 0x04,
+	0x23, 0x80, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0x25, 0x33, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0xb1, 0x23, 0xc2, 0xf2, 0x00, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0xa5, 0x63, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x42, 0xf2, 0x00, 0x41, 0x02, 0x00, 0x43, 0xf2, 0x69, 0x23, 0x40, 0xf2, 0x88, 0x20, 0xc4, 0xf2,
+	0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x40, 0xf2, 0x88, 0x20,
+	0x43, 0xf2, 0x69, 0x33, 0x21, 0x88, 0xc0, 0xf2, 0x00, 0x03, 0x89, 0xb2, 0xc2, 0xf2, 0x00, 0x00,
+	0x98, 0x47, 0x40, 0xf2, 0x34, 0x03, 0xc2, 0xf2, 0x00, 0x03, 0x9b, 0x78, 0x00, 0x2b, 0x00, 0xd1,
+	0x05, 0xe7, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0xe1, 0x23, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0xfb, 0xe6, 0x55, 0x2b, 0x00, 0xd1, 0x23, 0xe1, 0x56, 0x2b, 0x00, 0xd1,
+	0x14, 0xe1, 0x04, 0x2b, 0x00, 0xd0, 0xf2, 0xe6, 0x40, 0xf2, 0x34, 0x04, 0x64, 0x23, 0xc2, 0xf2,
+	0x00, 0x04, 0xe3, 0x5c, 0x00, 0x2b, 0x00, 0xd1, 0xe9, 0xe6, 0x45, 0xf2, 0xad, 0x63, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x45, 0xf2, 0x0d, 0x66, 0x07, 0x1c, 0xc0, 0xf2, 0x00, 0x06, 0x60, 0x6a,
+	0xb0, 0x47, 0x45, 0xf2, 0xb1, 0x23, 0x44, 0xf6, 0x89, 0x45, 0xc0, 0xf2, 0x00, 0x03, 0xe1, 0x6b,
+	0x98, 0x47, 0xc0, 0xf2, 0x00, 0x05, 0x39, 0x1c, 0xa8, 0x47, 0x60, 0x63, 0x20, 0x6a, 0xb0, 0x47,
+	0x45, 0xf2, 0x59, 0x03, 0x21, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x44, 0xf6, 0x71, 0x13,
+	0xa1, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x39, 0x1c, 0xa8, 0x47, 0x65, 0x23, 0xe3, 0x5c,
+	0x20, 0x64, 0x00, 0x2b, 0x00, 0xd1, 0xb3, 0xe6, 0xa3, 0x6e, 0xa3, 0x65, 0xb0, 0xe6, 0xc0, 0x23,
+	0x48, 0xf2, 0x00, 0x02, 0xdb, 0x05, 0x9a, 0x61, 0x01, 0x23, 0x23, 0x70, 0x00, 0x23, 0x40, 0xf2,
+	0x64, 0x20, 0xa3, 0x70, 0x42, 0xf6, 0xc1, 0x43, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2,
+	0x00, 0x00, 0x98, 0x47, 0x40, 0xf2, 0xfe, 0x13, 0x40, 0xf2, 0x64, 0x20, 0x42, 0xf6, 0x31, 0x55,
+	0x01, 0xaa, 0x13, 0x80, 0xfe, 0x3b, 0x00, 0x21, 0xff, 0x3b, 0xc0, 0xf2, 0x00, 0x05, 0xc2, 0xf2,
+	0x00, 0x00, 0xa8, 0x47, 0x43, 0xf6, 0x6d, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x40, 0xf2,
+	0x38, 0x20, 0x42, 0xf6, 0x59, 0x13, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00,
+	0x98, 0x47, 0x44, 0xf2, 0x51, 0x43, 0x20, 0x1d, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x7e, 0xe6,
+	0x28, 0x58, 0x00, 0x00, 0x40, 0xf2, 0x64, 0x20, 0x42, 0xf6, 0xc1, 0x43, 0x00, 0x21, 0xc0, 0xf2,
+	0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x40, 0xf2, 0xfe, 0x13, 0x40, 0xf2, 0x64, 0x20,
+	0x42, 0xf6, 0x31, 0x55, 0x01, 0xaa, 0x13, 0x80, 0xfe, 0x3b, 0x00, 0x21, 0xff, 0x3b, 0xc0, 0xf2,
+	0x00, 0x05, 0xc2, 0xf2, 0x00, 0x00, 0xa8, 0x47, 0x43, 0xf6, 0x6d, 0x43, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x59, 0x13, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03,
+	0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x40, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x03, 0x19, 0x88,
+	0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0x69, 0x33, 0x89, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2,
+	0x00, 0x00, 0x98, 0x47, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0xe1, 0x23, 0xc2, 0xf2, 0x00, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x44, 0xf2, 0x51, 0x43, 0x20, 0x1d, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x34, 0xe6, 0x40, 0xf2, 0x34, 0x04, 0x64, 0x23, 0xc2, 0xf2, 0x00, 0x04, 0xe3, 0x5c,
+	0x00, 0x2b, 0x00, 0xd1, 0x2b, 0xe6, 0x45, 0xf2, 0x0d, 0x63, 0x60, 0x6a, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0xe0, 0x63, 0x1c, 0xe6, 0x40, 0xf2, 0x34, 0x00, 0xc2, 0xf2, 0x00, 0x00, 0xc3, 0x6c,
+	0x30, 0x30, 0x83, 0x60, 0x03, 0x6a, 0xc3, 0x60, 0x43, 0x69, 0x03, 0x60, 0x83, 0x69, 0x43, 0x60,
+	0x43, 0x6a, 0x03, 0x61, 0x42, 0xf2, 0x05, 0x53, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x0e, 0xe6,
+	0x40, 0xf2, 0x34, 0x04, 0x45, 0xf2, 0x0d, 0x65, 0xc2, 0xf2, 0x00, 0x04, 0x23, 0x7f, 0x26, 0x6a,
+	0xc0, 0xf2, 0x00, 0x05, 0x60, 0x77, 0xe6, 0x62, 0xc0, 0x1a, 0x98, 0x46, 0xa8, 0x47, 0xa7, 0x6a,
+	0x81, 0x46, 0xf0, 0x1b, 0xa8, 0x47, 0x44, 0xf6, 0x89, 0x43, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x03,
+	0x48, 0x46, 0x98, 0x47, 0x06, 0x1c, 0x20, 0x63, 0x40, 0x46, 0xa8, 0x47, 0x80, 0x46, 0x38, 0x00,
+	0xa8, 0x47, 0x45, 0xf2, 0x59, 0x03, 0x31, 0x1c, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x45, 0xf2,
+	0xb1, 0x23, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x03, 0x40, 0x46, 0xd7, 0xe5, 0x40, 0xf2, 0x34, 0x03,
+	0x40, 0xf2, 0x00, 0x21, 0x5e, 0x22, 0xc2, 0xf2, 0x00, 0x03, 0x99, 0x52, 0x01, 0x21, 0x0e, 0x32,
+	0x99, 0x54, 0xd4, 0xe5, 0x40, 0xf2, 0x34, 0x00, 0xc2, 0xf2, 0x00, 0x00, 0x83, 0x6b, 0x30, 0x30,
+	0xc3, 0x61, 0xc3, 0x68, 0x03, 0x62, 0x03, 0x68, 0x43, 0x61, 0x43, 0x68, 0x83, 0x61, 0x03, 0x69,
+	0x43, 0x62, 0x42, 0xf2, 0x05, 0x53, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xbf, 0xe5, 0xc0, 0x46,
+	0xf0, 0xb5, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x09, 0x46, 0x83, 0xb0, 0x00, 0x23, 0x18, 0x22,
+	0x05, 0x21, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x06, 0xb0, 0x47, 0xc0, 0x23, 0x08, 0x22,
+	0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x71, 0x35, 0x40, 0xf2, 0x34, 0x04, 0x43, 0xf2, 0x6d, 0x17,
+	0xdb, 0x05, 0x9a, 0x61, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x05, 0xc2, 0xf2, 0x00, 0x04,
+	0xa8, 0x47, 0x63, 0x78, 0xc0, 0xf2, 0x00, 0x07, 0x02, 0x20, 0x23, 0xb9, 0xb8, 0x47, 0x63, 0x78,
+	0x02, 0x20, 0x00, 0x2b, 0xfa, 0xd0, 0x23, 0x78, 0x13, 0xb9, 0x02, 0x30, 0xb8, 0x47, 0xf6, 0xe7,
+	0x40, 0xf2, 0x38, 0x20, 0x00, 0x23, 0x18, 0x22, 0x1e, 0x21, 0xc2, 0xf2, 0x00, 0x00, 0x63, 0x70,
+	0x23, 0x70, 0xb0, 0x47, 0xc0, 0x23, 0x08, 0x22, 0x40, 0xf2, 0x38, 0x20, 0xdb, 0x05, 0x5a, 0x61,
+	0xc2, 0xf2, 0x00, 0x00, 0xa8, 0x47, 0x63, 0x78, 0x43, 0xb9, 0x43, 0xf2, 0x6d, 0x15, 0xc0, 0xf2,
+	0x00, 0x05, 0x02, 0x20, 0xa8, 0x47, 0x63, 0x78, 0x00, 0x2b, 0xfa, 0xd0, 0x00, 0x23, 0x40, 0xf2,
+	0x38, 0x20, 0x42, 0xf6, 0x6d, 0x25, 0x63, 0x70, 0x01, 0xaa, 0x04, 0x33, 0x00, 0x21, 0xc2, 0xf2,
+	0x00, 0x00, 0xc0, 0xf2, 0x00, 0x05, 0xa8, 0x47, 0xa3, 0x78, 0x9b, 0xb9, 0x23, 0x78, 0x6b, 0xb9,
+	0x43, 0xf2, 0x6d, 0x15, 0x44, 0xf2, 0x69, 0x66, 0xc0, 0xf2, 0x00, 0x05, 0xc0, 0xf2, 0x00, 0x06,
+	0xb0, 0x47, 0x04, 0x20, 0xa8, 0x47, 0x23, 0x78, 0x00, 0x2b, 0xf9, 0xd0, 0x00, 0x23, 0x23, 0x70,
+	0x03, 0xb0, 0xf0, 0xbd, 0x6b, 0x46, 0x98, 0x88, 0xdb, 0x88, 0x6a, 0x46, 0xc0, 0x1a, 0x03, 0x23,
+	0x13, 0x70, 0x45, 0xf2, 0x0d, 0x63, 0x45, 0xf2, 0xb1, 0x25, 0xc0, 0xf2, 0x00, 0x03, 0x60, 0x62,
+	0x98, 0x47, 0xc0, 0xf2, 0x00, 0x05, 0xe1, 0x6b, 0xa8, 0x47, 0x44, 0xf6, 0x89, 0x43, 0x61, 0x6b,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x65, 0x23, 0xe3, 0x5c, 0x06, 0x1c, 0x63, 0xb3, 0xa1, 0x6d,
+	0xa0, 0x6e, 0xa8, 0x47, 0x45, 0xf2, 0x59, 0x05, 0x4c, 0xf6, 0xcd, 0x41, 0xc0, 0xf2, 0x00, 0x05,
+	0xc3, 0xf6, 0xcc, 0x51, 0xa8, 0x47, 0x44, 0xf6, 0x71, 0x13, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x03,
+	0x30, 0x1c, 0x98, 0x47, 0x06, 0x1c, 0x85, 0x21, 0x30, 0x1c, 0xc9, 0x05, 0xa8, 0x47, 0x44, 0xf6,
+	0xa9, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x6b, 0x46, 0xa2, 0x78, 0x58, 0x70, 0x00, 0x0a,
+	0x98, 0x70, 0x53, 0x1e, 0x9a, 0x41, 0x44, 0xf2, 0xd9, 0x63, 0xd2, 0xb2, 0x03, 0x21, 0x68, 0x46,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xa1, 0xe7, 0x45, 0xf2, 0x59, 0x05, 0xc0, 0xf2, 0x00, 0x05,
+	0xe1, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0x40, 0xf2, 0x38, 0x20,
+	0xc0, 0xb5, 0x42, 0xf6, 0x09, 0x46, 0x82, 0xb0, 0x00, 0x23, 0x18, 0x22, 0x05, 0x21, 0xc2, 0xf2,
+	0x00, 0x00, 0xc0, 0xf2, 0x00, 0x06, 0xb0, 0x47, 0xc0, 0x23, 0x08, 0x22, 0x40, 0xf2, 0x38, 0x20,
+	0x42, 0xf6, 0x71, 0x37, 0x40, 0xf2, 0x34, 0x04, 0xdb, 0x05, 0x9a, 0x61, 0xc2, 0xf2, 0x00, 0x00,
+	0xc0, 0xf2, 0x00, 0x07, 0xc2, 0xf2, 0x00, 0x04, 0xb8, 0x47, 0x63, 0x78, 0x43, 0xb9, 0x43, 0xf2,
+	0x6d, 0x15, 0xc0, 0xf2, 0x00, 0x05, 0x02, 0x20, 0xa8, 0x47, 0x63, 0x78, 0x00, 0x2b, 0xfa, 0xd0,
+	0x40, 0xf2, 0x38, 0x20, 0x00, 0x23, 0x18, 0x22, 0x1e, 0x21, 0xc2, 0xf2, 0x00, 0x00, 0x63, 0x70,
+	0xb0, 0x47, 0x43, 0xf6, 0x81, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0x6d, 0x43,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xc0, 0x23, 0x08, 0x22, 0x40, 0xf2, 0x38, 0x20, 0xdb, 0x05,
+	0x5a, 0x61, 0xc2, 0xf2, 0x00, 0x00, 0xb8, 0x47, 0x63, 0x78, 0x43, 0xb9, 0x43, 0xf2, 0x6d, 0x15,
+	0xc0, 0xf2, 0x00, 0x05, 0x02, 0x20, 0xa8, 0x47, 0x63, 0x78, 0x00, 0x2b, 0xfa, 0xd0, 0x00, 0x23,
+	0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x6d, 0x25, 0x6a, 0x46, 0x00, 0x21, 0x63, 0x70, 0xc0, 0xf2,
+	0x00, 0x05, 0x04, 0x33, 0xc2, 0xf2, 0x00, 0x00, 0xa8, 0x47, 0x6b, 0x46, 0x18, 0x88, 0x5b, 0x88,
+	0x01, 0xad, 0xc0, 0x1a, 0x03, 0x23, 0x2b, 0x70, 0x45, 0xf2, 0x0d, 0x63, 0x45, 0xf2, 0xb1, 0x26,
+	0xc0, 0xf2, 0x00, 0x03, 0x60, 0x62, 0x98, 0x47, 0xc0, 0xf2, 0x00, 0x06, 0xe1, 0x6b, 0xb0, 0x47,
+	0x44, 0xf6, 0x89, 0x43, 0x61, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x65, 0x23, 0xe3, 0x5c,
+	0x07, 0x1c, 0x00, 0x2b, 0x5a, 0xd0, 0xa1, 0x6d, 0xa0, 0x6e, 0xb0, 0x47, 0x45, 0xf2, 0x59, 0x06,
+	0x4c, 0xf6, 0xcd, 0x41, 0xc0, 0xf2, 0x00, 0x06, 0xc3, 0xf6, 0xcc, 0x51, 0xb0, 0x47, 0x44, 0xf6,
+	0x71, 0x13, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x03, 0x38, 0x1c, 0x98, 0x47, 0x07, 0x1c, 0x85, 0x21,
+	0x38, 0x1c, 0xc9, 0x05, 0xb0, 0x47, 0x44, 0xf6, 0xa9, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0xa2, 0x78, 0x42, 0xf6, 0x65, 0x48, 0x53, 0x1e, 0x9a, 0x41, 0x44, 0xf2, 0xd9, 0x63, 0x42, 0xf6,
+	0x75, 0x47, 0xc0, 0x26, 0x43, 0xf2, 0x00, 0x09, 0x68, 0x70, 0x00, 0x0a, 0xa8, 0x70, 0xd2, 0xb2,
+	0x03, 0x21, 0x28, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xc0, 0xf2, 0x00, 0x08, 0xc0, 0xf2,
+	0x00, 0x07, 0xf6, 0x05, 0xc4, 0xf2, 0x00, 0x09, 0x48, 0xf2, 0x00, 0x0a, 0x0a, 0xe0, 0x44, 0xf2,
+	0x69, 0x63, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf2, 0x6d, 0x13, 0x04, 0x20, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x28, 0x00, 0xc0, 0x47, 0x4b, 0x46, 0x34, 0x68, 0x1a, 0x6a, 0x33, 0x69,
+	0x28, 0x00, 0x53, 0x40, 0x1c, 0x40, 0x54, 0x40, 0xb8, 0x47, 0x53, 0x46, 0x23, 0x42, 0xe6, 0xd0,
+	0x02, 0xb0, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x45, 0xf2, 0x59, 0x06,
+	0xc0, 0xf2, 0x00, 0x06, 0xb3, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0xc6, 0x46, 0x40, 0xf2, 0x38, 0x20,
+	0x42, 0xf6, 0xa1, 0x36, 0x00, 0xb5, 0x00, 0x21, 0x82, 0xb0, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
+	0x00, 0x06, 0xb0, 0x47, 0x42, 0xf6, 0xd5, 0x37, 0x40, 0xf2, 0x38, 0x20, 0x00, 0x21, 0xc2, 0xf2,
+	0x00, 0x00, 0xc0, 0xf2, 0x00, 0x07, 0xb8, 0x47, 0x42, 0xf6, 0x09, 0x44, 0x40, 0xf2, 0x38, 0x20,
+	0x00, 0x23, 0x18, 0x22, 0x18, 0x21, 0xc0, 0xf2, 0x00, 0x04, 0xc2, 0xf2, 0x00, 0x00, 0xa0, 0x47,
+	0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x71, 0x33, 0x40, 0xf2, 0x34, 0x04, 0xc0, 0xf2, 0x00, 0x03,
+	0xc2, 0xf2, 0x00, 0x00, 0xc2, 0xf2, 0x00, 0x04, 0x98, 0x47, 0x63, 0x78, 0x43, 0xb9, 0x43, 0xf2,
+	0x6d, 0x15, 0xc0, 0xf2, 0x00, 0x05, 0x02, 0x20, 0xa8, 0x47, 0x63, 0x78, 0x00, 0x2b, 0xfa, 0xd0,
+	0x00, 0x23, 0x63, 0x70, 0x06, 0x33, 0x6b, 0x44, 0x98, 0x46, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6,
+	0x6d, 0x25, 0x42, 0x46, 0x00, 0x21, 0x02, 0x23, 0xc0, 0xf2, 0x00, 0x05, 0xc2, 0xf2, 0x00, 0x00,
+	0xa8, 0x47, 0x43, 0x46, 0x45, 0xf2, 0xad, 0x65, 0x18, 0x88, 0xc0, 0xf2, 0x00, 0x05, 0xa8, 0x47,
+	0x80, 0x46, 0xa0, 0x89, 0xa8, 0x47, 0x45, 0xf2, 0xb1, 0x23, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x03,
+	0x40, 0x46, 0x98, 0x47, 0x45, 0xf2, 0x59, 0x03, 0x61, 0x69, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x44, 0xf6, 0x71, 0x13, 0x61, 0x68, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x44, 0xf2, 0x79, 0x53,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x05, 0x1c, 0x40, 0xf2, 0x38, 0x20, 0x5c, 0x34, 0x21, 0x78,
+	0xc2, 0xf2, 0x00, 0x00, 0xb0, 0x47, 0x40, 0xf2, 0x38, 0x20, 0x05, 0x21, 0xc2, 0xf2, 0x00, 0x00,
+	0xb8, 0x47, 0x28, 0x1c, 0x02, 0xb0, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0xf0, 0xb5, 0xc6, 0x46,
+	0x40, 0xf2, 0x80, 0x08, 0x40, 0xf6, 0x00, 0x03, 0x41, 0x46, 0x00, 0xb5, 0xc4, 0xf2, 0x00, 0x03,
+	0xda, 0x69, 0x40, 0xf2, 0x34, 0x04, 0x0a, 0x43, 0xda, 0x61, 0x41, 0xf6, 0x00, 0x43, 0xc0, 0x22,
+	0xc4, 0xf2, 0x00, 0x03, 0x3e, 0x39, 0x99, 0x50, 0x00, 0x23, 0x84, 0xb0, 0xc2, 0xf2, 0x00, 0x04,
+	0x02, 0x93, 0x40, 0xf2, 0x38, 0x25, 0x40, 0xf2, 0x70, 0x23, 0x01, 0x27, 0x22, 0x00, 0x41, 0xf6,
+	0x00, 0x41, 0x42, 0xf2, 0xf5, 0x76, 0xc2, 0xf2, 0x00, 0x05, 0xc2, 0xf2, 0x00, 0x03, 0x01, 0x93,
+	0x74, 0x32, 0xc4, 0xf2, 0x00, 0x21, 0x00, 0x97, 0x00, 0x23, 0x28, 0x00, 0xc0, 0xf2, 0x00, 0x06,
+	0xb0, 0x47, 0x22, 0x00, 0x42, 0xf6, 0x9d, 0x04, 0x78, 0x32, 0x80, 0x23, 0x00, 0x21, 0x28, 0x00,
+	0xc0, 0xf2, 0x00, 0x04, 0xa0, 0x47, 0xc0, 0x23, 0x42, 0x46, 0xdb, 0x05, 0x5a, 0x60, 0x43, 0xf2,
+	0x00, 0x03, 0xc4, 0xf2, 0x00, 0x02, 0xc4, 0xf2, 0x00, 0x03, 0x9a, 0x62, 0xc0, 0x22, 0x47, 0x21,
+	0x01, 0x20, 0x12, 0x06, 0x9a, 0x62, 0x5a, 0x5c, 0x42, 0xf6, 0xe9, 0x14, 0xba, 0x43, 0x02, 0x43,
+	0x5a, 0x54, 0x0f, 0x22, 0x14, 0x39, 0x58, 0x5c, 0xc0, 0xf2, 0x00, 0x04, 0x02, 0x40, 0x10, 0x20,
+	0x02, 0x43, 0x5a, 0x54, 0x41, 0xf2, 0xdd, 0x23, 0x00, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0x00, 0x21,
+	0x28, 0x00, 0xa0, 0x47, 0x04, 0xb0, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0xf8, 0xb5, 0xde, 0x46,
+	0x57, 0x46, 0x4e, 0x46, 0x45, 0x46, 0xe0, 0xb5, 0xc0, 0x27, 0x08, 0x23, 0x43, 0xf2, 0x00, 0x04,
+	0xff, 0x05, 0xc4, 0xf2, 0x00, 0x04, 0x7b, 0x61, 0xbb, 0x60, 0xc4, 0xf2, 0x00, 0x03, 0xa3, 0x62,
+	0xc0, 0x23, 0x43, 0x22, 0x01, 0x26, 0x1b, 0x06, 0xa3, 0x62, 0x99, 0x46, 0xa3, 0x5c, 0x41, 0xf2,
+	0xed, 0x20, 0xb3, 0x43, 0xa3, 0x54, 0x44, 0xf2, 0x39, 0x73, 0x40, 0xf2, 0x00, 0x28, 0x40, 0xf6,
+	0x00, 0x05, 0xc0, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x42, 0x46, 0xc4, 0xf2,
+	0x00, 0x05, 0x6b, 0x69, 0x40, 0xf2, 0x40, 0x0b, 0x13, 0x43, 0x6b, 0x61, 0x43, 0xf6, 0xa5, 0x63,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x42, 0xf2, 0x00, 0x41, 0x02, 0x00, 0x43, 0xf2, 0x69, 0x23,
+	0x40, 0xf2, 0x88, 0x20, 0xc4, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00,
+	0x98, 0x47, 0x40, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x03, 0x19, 0x88, 0x40, 0xf2, 0x88, 0x20,
+	0x43, 0xf2, 0x69, 0x33, 0x89, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47,
+	0x40, 0xf2, 0xb4, 0x01, 0x80, 0x23, 0xc2, 0xf2, 0x00, 0x01, 0xce, 0x50, 0x41, 0xf2, 0xcd, 0x23,
+	0x84, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0x8b, 0x50, 0x01, 0x23, 0x40, 0xf2, 0x88, 0x20, 0x9a, 0x46,
+	0x43, 0xf2, 0x9d, 0x33, 0x78, 0x31, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00, 0x0e, 0x74,
+	0x98, 0x47, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0xe1, 0x23, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0x25, 0x33, 0xc2, 0xf2, 0x00, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x40, 0xf2, 0x00, 0x12, 0xeb, 0x69, 0x59, 0x46, 0x13, 0x43,
+	0xeb, 0x61, 0x41, 0xf6, 0x00, 0x43, 0x38, 0x3a, 0xc4, 0xf2, 0x00, 0x03, 0x99, 0x50, 0x40, 0xf2,
+	0x64, 0x20, 0x42, 0xf2, 0x00, 0x01, 0x42, 0xf6, 0x81, 0x43, 0xc4, 0xf2, 0x00, 0x21, 0xc0, 0xf2,
+	0x00, 0x03, 0xc2, 0xf2, 0x00, 0x00, 0x98, 0x47, 0x41, 0xf2, 0x00, 0x02, 0xeb, 0x69, 0x13, 0x43,
+	0xeb, 0x61, 0x43, 0xf6, 0x3d, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x5b, 0x46, 0x7b, 0x60,
+	0xc4, 0xf2, 0x00, 0x03, 0xa3, 0x62, 0x4b, 0x46, 0x46, 0x22, 0x51, 0x46, 0xa3, 0x62, 0xa3, 0x5c,
+	0x50, 0x46, 0xb3, 0x43, 0x0b, 0x43, 0x33, 0x21, 0xdb, 0xb2, 0xa3, 0x54, 0x63, 0x5c, 0x37, 0x3a,
+	0x93, 0x43, 0x03, 0x43, 0xdb, 0xb2, 0x63, 0x54, 0x02, 0x23, 0x7b, 0x60, 0xc4, 0xf2, 0x00, 0x03,
+	0xa3, 0x62, 0x4b, 0x46, 0x0e, 0x31, 0xa3, 0x62, 0x63, 0x5c, 0xb3, 0x43, 0x03, 0x43, 0xdb, 0xb2,
+	0x63, 0x54, 0x30, 0x23, 0xe1, 0x5c, 0x04, 0x20, 0x0a, 0x40, 0x10, 0x21, 0x0a, 0x43, 0xe2, 0x54,
+	0x43, 0xf2, 0x00, 0x03, 0xc4, 0xf2, 0x00, 0x23, 0x99, 0x68, 0x40, 0xf2, 0x34, 0x04, 0x01, 0x43,
+	0x99, 0x60, 0xda, 0x68, 0xc2, 0xf2, 0x00, 0x04, 0x02, 0x43, 0xda, 0x60, 0x41, 0xf6, 0x3d, 0x43,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x42, 0xf2, 0xdd, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x20, 0x00, 0x42, 0xf2, 0x81, 0x53, 0x30, 0x30, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x05, 0x00,
+	0xb0, 0xb9, 0x23, 0x00, 0x5c, 0x33, 0x19, 0x78, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0xa1, 0x33,
+	0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x45, 0xf2, 0xd7, 0x73, 0x6c, 0x34,
+	0xc0, 0xf2, 0x00, 0x03, 0x08, 0x22, 0x00, 0x21, 0x20, 0x00, 0x98, 0x47, 0x43, 0x46, 0xe3, 0x80,
+	0x28, 0x00, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf8, 0xbd, 0xc0, 0x46,
+	0x03, 0x78, 0x02, 0x2b, 0x34, 0xd0, 0x29, 0xd9, 0x03, 0x2b, 0x10, 0xd0, 0x04, 0x2b, 0x0c, 0xd1,
+	0x47, 0xf6, 0xfe, 0x72, 0x43, 0x88, 0x93, 0x42, 0x42, 0xd8, 0x40, 0xf2, 0xff, 0x31, 0xc2, 0x88,
+	0x8a, 0x42, 0x4b, 0xd0, 0x01, 0x32, 0xc2, 0x80, 0x83, 0x80, 0x00, 0x20, 0x70, 0x47, 0x47, 0xf6,
+	0xfe, 0x72, 0x43, 0x88, 0x93, 0x42, 0x2d, 0xd8, 0x22, 0x49, 0x47, 0xf6, 0xff, 0x72, 0x8c, 0x46,
+	0xd2, 0x1a, 0x83, 0x88, 0x63, 0x44, 0xd9, 0x17, 0x5b, 0x18, 0x4b, 0x40, 0x9a, 0x42, 0x02, 0xdd,
+	0xc3, 0x88, 0x01, 0x33, 0xc3, 0x80, 0x00, 0x23, 0x03, 0x70, 0xe6, 0xe7, 0x01, 0x2b, 0xe4, 0xd1,
+	0x40, 0xf2, 0x00, 0x23, 0xc3, 0x80, 0x00, 0x23, 0x83, 0x80, 0x02, 0x33, 0x03, 0x70, 0xdc, 0xe7,
+	0x47, 0xf6, 0xfe, 0x73, 0x42, 0x88, 0x9a, 0x42, 0x07, 0xd8, 0x04, 0x21, 0xc3, 0x88, 0x01, 0x33,
+	0x9b, 0xb2, 0x01, 0x70, 0xc3, 0x80, 0x82, 0x80, 0xcf, 0xe7, 0xc3, 0x88, 0x03, 0x21, 0x01, 0x3b,
+	0x9b, 0xb2, 0xf6, 0xe7, 0xc2, 0x88, 0x92, 0xb1, 0x01, 0x3a, 0xc2, 0x80, 0x83, 0x80, 0xc4, 0xe7,
+	0x08, 0x4a, 0x94, 0x46, 0x82, 0x88, 0x63, 0x44, 0x62, 0x44, 0xd1, 0x17, 0x52, 0x18, 0x4a, 0x40,
+	0x93, 0x42, 0xd0, 0xdd, 0xc3, 0x88, 0x01, 0x3b, 0xc3, 0x80, 0xcc, 0xe7, 0x00, 0x22, 0x02, 0x70,
+	0x83, 0x80, 0xb2, 0xe7, 0x01, 0x80, 0xff, 0xff, 0xf0, 0xb5, 0xc6, 0x46, 0x40, 0xf2, 0x38, 0x20,
+	0x42, 0xf6, 0x09, 0x44, 0x00, 0xb5, 0x00, 0x23, 0x82, 0xb0, 0x18, 0x22, 0x1f, 0x21, 0xc0, 0xf2,
+	0x00, 0x04, 0xc2, 0xf2, 0x00, 0x00, 0xa0, 0x47, 0x40, 0xf2, 0x34, 0x04, 0xc2, 0xf2, 0x00, 0x04,
+	0x22, 0x00, 0x40, 0xf2, 0x64, 0x20, 0x42, 0xf6, 0x31, 0x55, 0x5e, 0x32, 0x01, 0x23, 0x00, 0x21,
+	0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x05, 0xa8, 0x47, 0xc0, 0x23, 0x08, 0x22, 0xdb, 0x05,
+	0x9a, 0x61, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x71, 0x33, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x63, 0x78, 0x43, 0xb9, 0x43, 0xf2, 0x6d, 0x15, 0xc0, 0xf2, 0x00, 0x05,
+	0x02, 0x20, 0xa8, 0x47, 0x63, 0x78, 0x00, 0x2b, 0xfa, 0xd0, 0x6a, 0x46, 0x40, 0xf2, 0x38, 0x20,
+	0x42, 0xf6, 0x6d, 0x25, 0x00, 0x26, 0x02, 0x23, 0x02, 0x32, 0x00, 0x21, 0xc2, 0xf2, 0x00, 0x00,
+	0xc0, 0xf2, 0x00, 0x05, 0x66, 0x70, 0xa8, 0x47, 0xa3, 0x78, 0x00, 0x2b, 0x47, 0xd1, 0x6c, 0x25,
+	0x63, 0x5d, 0x5b, 0xbb, 0x23, 0x78, 0x6b, 0xb9, 0x43, 0xf2, 0x6d, 0x15, 0x44, 0xf2, 0x69, 0x66,
+	0xc0, 0xf2, 0x00, 0x05, 0xc0, 0xf2, 0x00, 0x06, 0xb0, 0x47, 0x04, 0x20, 0xa8, 0x47, 0x23, 0x78,
+	0x00, 0x2b, 0xf9, 0xd0, 0x00, 0x23, 0x23, 0x70, 0xc0, 0x23, 0x08, 0x22, 0xdb, 0x05, 0x5a, 0x61,
+	0x23, 0x78, 0x6b, 0xb9, 0x43, 0xf2, 0x6d, 0x15, 0x44, 0xf2, 0x69, 0x66, 0xc0, 0xf2, 0x00, 0x05,
+	0xc0, 0xf2, 0x00, 0x06, 0xb0, 0x47, 0x04, 0x20, 0xa8, 0x47, 0x23, 0x78, 0x00, 0x2b, 0xf9, 0xd0,
+	0x00, 0x23, 0x23, 0x70, 0x02, 0xb0, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0x6b, 0x46, 0x26, 0x00,
+	0x5b, 0x88, 0x6c, 0x36, 0x73, 0x80, 0x41, 0xf6, 0x21, 0x73, 0x30, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x5e, 0x23, 0xf2, 0x88, 0xe2, 0x52, 0x63, 0x5d, 0x00, 0x2b, 0xc2, 0xd1, 0x20, 0x00,
+	0x42, 0xf2, 0x05, 0x53, 0x30, 0x30, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xba, 0xe7, 0x6b, 0x46,
+	0x01, 0xad, 0x45, 0xf2, 0x0d, 0x67, 0x2e, 0x70, 0x45, 0xf2, 0x59, 0x06, 0x58, 0x88, 0xc0, 0xf2,
+	0x00, 0x07, 0x20, 0x62, 0xb8, 0x47, 0xc0, 0xf2, 0x00, 0x06, 0x21, 0x6b, 0xb0, 0x47, 0x44, 0xf6,
+	0x71, 0x13, 0xa1, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x64, 0x23, 0xe3, 0x5c, 0x80, 0x46,
+	0x9b, 0xb1, 0x60, 0x6a, 0xb8, 0x47, 0x45, 0xf2, 0xb1, 0x27, 0xe1, 0x6b, 0xc0, 0xf2, 0x00, 0x07,
+	0xb8, 0x47, 0x44, 0xf6, 0x89, 0x43, 0x61, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x21, 0x6c,
+	0xb0, 0x47, 0x01, 0x1c, 0x40, 0x46, 0xb8, 0x47, 0x80, 0x46, 0x85, 0x21, 0x40, 0x46, 0xc9, 0x05,
+	0xb0, 0x47, 0x44, 0xf6, 0xa9, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xa2, 0x78, 0x68, 0x70,
+	0x53, 0x1e, 0x9a, 0x41, 0x44, 0xf2, 0xd9, 0x63, 0x00, 0x0a, 0xa8, 0x70, 0xd2, 0xb2, 0x03, 0x21,
+	0x28, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x71, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0xd6, 0x46,
+	0x4f, 0x46, 0x46, 0x46, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x09, 0x44, 0xc0, 0xb5, 0x00, 0x23,
+	0x82, 0xb0, 0x18, 0x22, 0x1f, 0x21, 0xc0, 0xf2, 0x00, 0x04, 0xc2, 0xf2, 0x00, 0x00, 0xa0, 0x47,
+	0x40, 0xf2, 0x34, 0x04, 0xc2, 0xf2, 0x00, 0x04, 0x22, 0x00, 0x40, 0xf2, 0x64, 0x20, 0x42, 0xf6,
+	0x31, 0x55, 0x5e, 0x32, 0x01, 0x23, 0x00, 0x21, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x05,
+	0xa8, 0x47, 0xc0, 0x23, 0x08, 0x22, 0xdb, 0x05, 0x9a, 0x61, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6,
+	0x71, 0x33, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x63, 0x78, 0x43, 0xb9,
+	0x43, 0xf2, 0x6d, 0x15, 0xc0, 0xf2, 0x00, 0x05, 0x02, 0x20, 0xa8, 0x47, 0x63, 0x78, 0x00, 0x2b,
+	0xfa, 0xd0, 0x6a, 0x46, 0x40, 0xf2, 0x38, 0x20, 0x42, 0xf6, 0x6d, 0x25, 0x00, 0x26, 0x02, 0x32,
+	0x00, 0x21, 0x02, 0x23, 0xc0, 0xf2, 0x00, 0x05, 0xc2, 0xf2, 0x00, 0x00, 0x66, 0x70, 0xa8, 0x47,
+	0x6b, 0x46, 0x01, 0xad, 0x45, 0xf2, 0x0d, 0x67, 0x2e, 0x70, 0x45, 0xf2, 0x59, 0x06, 0x58, 0x88,
+	0xc0, 0xf2, 0x00, 0x07, 0x20, 0x62, 0xb8, 0x47, 0xc0, 0xf2, 0x00, 0x06, 0x21, 0x6b, 0xb0, 0x47,
+	0x44, 0xf6, 0x71, 0x13, 0xa1, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x64, 0x23, 0xe3, 0x5c,
+	0x80, 0x46, 0x9b, 0xb1, 0x60, 0x6a, 0xb8, 0x47, 0x45, 0xf2, 0xb1, 0x27, 0xe1, 0x6b, 0xc0, 0xf2,
+	0x00, 0x07, 0xb8, 0x47, 0x44, 0xf6, 0x89, 0x43, 0x61, 0x6b, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x21, 0x6c, 0xb0, 0x47, 0x01, 0x1c, 0x40, 0x46, 0xb8, 0x47, 0x80, 0x46, 0x85, 0x21, 0x40, 0x46,
+	0xc9, 0x05, 0xb0, 0x47, 0x44, 0xf6, 0xa9, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xa2, 0x78,
+	0x6c, 0x26, 0x53, 0x1e, 0x9a, 0x41, 0x44, 0xf2, 0xd9, 0x63, 0x68, 0x70, 0x00, 0x0a, 0xa8, 0x70,
+	0xc0, 0xf2, 0x00, 0x03, 0xd2, 0xb2, 0x03, 0x21, 0x28, 0x00, 0x98, 0x47, 0xa3, 0x5d, 0x00, 0x2b,
+	0x31, 0xd1, 0xc0, 0x26, 0x08, 0x23, 0x42, 0xf6, 0x65, 0x48, 0x42, 0xf6, 0x75, 0x47, 0x43, 0xf2,
+	0x00, 0x09, 0xf6, 0x05, 0x73, 0x61, 0xc0, 0xf2, 0x00, 0x08, 0xc0, 0xf2, 0x00, 0x07, 0xc4, 0xf2,
+	0x00, 0x09, 0x48, 0xf2, 0x00, 0x0a, 0x0a, 0xe0, 0x44, 0xf2, 0x69, 0x63, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x43, 0xf2, 0x6d, 0x13, 0x04, 0x20, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x00,
+	0xc0, 0x47, 0x4b, 0x46, 0x34, 0x68, 0x1a, 0x6a, 0x33, 0x69, 0x28, 0x00, 0x53, 0x40, 0x1c, 0x40,
+	0x54, 0x40, 0xb8, 0x47, 0x53, 0x46, 0x23, 0x42, 0xe6, 0xd0, 0x02, 0xb0, 0x1c, 0xbc, 0x90, 0x46,
+	0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x6b, 0x46, 0x27, 0x00, 0x5b, 0x88, 0x6c, 0x37, 0x7b, 0x80,
+	0x41, 0xf6, 0x21, 0x73, 0x38, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x5e, 0x23, 0xfa, 0x88,
+	0xe2, 0x52, 0xa3, 0x5d, 0x00, 0x2b, 0xbc, 0xd1, 0x20, 0x00, 0x42, 0xf2, 0x05, 0x53, 0x30, 0x30,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xb4, 0xe7, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0x45, 0x46,
+	0xde, 0x46, 0x41, 0xf2, 0xf1, 0x73, 0xe0, 0xb5, 0xc0, 0xf2, 0x00, 0x03, 0x83, 0xb0, 0x01, 0x93,
+	0x41, 0xf6, 0x75, 0x13, 0x40, 0xf2, 0x34, 0x04, 0x41, 0xf6, 0x39, 0x39, 0x41, 0xf6, 0xe9, 0x77,
+	0x42, 0xf2, 0x9d, 0x18, 0x44, 0xf2, 0x69, 0x6b, 0x43, 0xf2, 0x6d, 0x1a, 0x65, 0x26, 0x64, 0x25,
+	0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2, 0x00, 0x04, 0xc0, 0xf2, 0x00, 0x09, 0xc0, 0xf2, 0x00, 0x07,
+	0xc0, 0xf2, 0x00, 0x08, 0x00, 0x93, 0xc0, 0xf2, 0x00, 0x0b, 0xc0, 0xf2, 0x00, 0x0a, 0xa3, 0x78,
+	0x6b, 0xb1, 0xa3, 0x5d, 0xd3, 0xb9, 0xb8, 0x47, 0x63, 0x5d, 0x00, 0x2b, 0xf7, 0xd0, 0xa3, 0x78,
+	0x00, 0x2b, 0xf4, 0xd0, 0x01, 0x9b, 0x98, 0x47, 0xa3, 0x78, 0x00, 0x2b, 0xf1, 0xd1, 0x23, 0x7e,
+	0x43, 0xb1, 0xa3, 0x5d, 0x6b, 0xb9, 0xc0, 0x47, 0x63, 0x5d, 0x00, 0x2b, 0xe7, 0xd0, 0x00, 0x9b,
+	0x98, 0x47, 0xe4, 0xe7, 0xd8, 0x47, 0x04, 0x20, 0xd0, 0x47, 0xe0, 0xe7, 0xc8, 0x47, 0xa0, 0x66,
+	0xe1, 0xe7, 0xc8, 0x47, 0xa0, 0x66, 0xee, 0xe7, 0xfe, 0xe7, 0xc0, 0x46, 0x45, 0xf6, 0x40, 0x41,
+	0x40, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x01, 0xc2, 0xf2, 0x00, 0x00, 0x10, 0xb5, 0x81, 0x42,
+	0x0f, 0xd0, 0x40, 0xf2, 0x18, 0x03, 0xc2, 0xf2, 0x00, 0x03, 0x98, 0x42, 0x09, 0xd2, 0xc2, 0x43,
+	0xd2, 0x18, 0x45, 0xf2, 0xc5, 0x73, 0x92, 0x08, 0x01, 0x32, 0x92, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x40, 0xf2, 0x18, 0x00, 0x40, 0xf2, 0xfc, 0x23, 0xc2, 0xf2, 0x00, 0x00, 0xc2, 0xf2,
+	0x00, 0x03, 0x98, 0x42, 0x0a, 0xd2, 0xc2, 0x43, 0xd2, 0x18, 0x45, 0xf2, 0xd7, 0x73, 0x92, 0x08,
+	0x01, 0x32, 0x92, 0x00, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x41, 0xf2, 0x00, 0x03,
+	0x7f, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0x93, 0x43, 0x4e, 0xf6, 0x00, 0x52, 0xce, 0xf2, 0x00, 0x02,
+	0x93, 0x60, 0x45, 0xf2, 0x75, 0x73, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x44, 0xf2, 0x21, 0x43,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xfe, 0xe7, 0x43, 0xf6, 0x4d, 0x13, 0x70, 0xb5, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0xc0, 0x22, 0x08, 0x23, 0xd2, 0x05, 0x53, 0x61, 0x08, 0x21, 0x93, 0x60,
+	0xc0, 0x24, 0x43, 0xf2, 0x00, 0x03, 0x43, 0x25, 0x01, 0x20, 0xc4, 0xf2, 0x00, 0x03, 0x24, 0x06,
+	0xc4, 0xf2, 0x00, 0x01, 0x99, 0x62, 0x9c, 0x62, 0x59, 0x5d, 0x81, 0x43, 0x59, 0x55, 0x48, 0xf2,
+	0x00, 0x01, 0x91, 0x61, 0x91, 0x60, 0x48, 0xf2, 0x00, 0x02, 0x4f, 0x21, 0xc4, 0xf2, 0x00, 0x02,
+	0x9a, 0x62, 0x9c, 0x62, 0x5a, 0x5c, 0x82, 0x43, 0x5a, 0x54, 0x70, 0xbd, 0x40, 0xf6, 0x00, 0x03,
+	0x80, 0x21, 0x10, 0xb5, 0xc4, 0xf2, 0x00, 0x03, 0x1a, 0x69, 0x0a, 0x43, 0x1a, 0x61, 0x9a, 0x69,
+	0x7c, 0x39, 0x0a, 0x43, 0x9a, 0x61, 0x43, 0xf6, 0xd5, 0x23, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x10, 0xbd, 0xc0, 0x46, 0x45, 0xf2, 0xd7, 0x73, 0xf0, 0xb5, 0xc1, 0xb0, 0x40, 0xf2, 0x00, 0x12,
+	0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03, 0x04, 0x00, 0x68, 0x46, 0x98, 0x47, 0x80, 0x20, 0x43, 0xf6,
+	0xed, 0x33, 0x40, 0xf2, 0x00, 0x12, 0x69, 0x46, 0xc0, 0x03, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x08, 0xb1, 0x41, 0xb0, 0xf0, 0xbd, 0x80, 0x20, 0x43, 0xf6, 0xd9, 0x23, 0xc0, 0x03, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x45, 0xf2, 0xc5, 0x73, 0x21, 0x00, 0x34, 0x22, 0x68, 0x46, 0xc0, 0xf2,
+	0x00, 0x03, 0x80, 0x25, 0x43, 0xf6, 0x1d, 0x36, 0x98, 0x47, 0x00, 0x24, 0x40, 0xf2, 0x00, 0x17,
+	0xed, 0x03, 0xc0, 0xf2, 0x00, 0x06, 0x21, 0x00, 0x2d, 0x19, 0x40, 0x22, 0x69, 0x44, 0x28, 0x00,
+	0xb0, 0x47, 0x00, 0x28, 0xdd, 0xd1, 0x40, 0x34, 0xbc, 0x42, 0xf4, 0xd1, 0xd9, 0xe7, 0xc0, 0x46,
+	0x45, 0xf2, 0xd7, 0x73, 0x70, 0xb5, 0x34, 0x22, 0x82, 0xb0, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03,
+	0x04, 0x00, 0x98, 0x47, 0x80, 0x20, 0x43, 0xf6, 0xed, 0x33, 0x34, 0x22, 0x21, 0x00, 0xc0, 0x03,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x05, 0x00, 0x10, 0xb1, 0x28, 0x00, 0x02, 0xb0, 0x70, 0xbd,
+	0x44, 0xf6, 0x95, 0x03, 0x20, 0x68, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xb0, 0xb9, 0x2c, 0x22,
+	0xa3, 0x5c, 0x01, 0x3b, 0x09, 0x2b, 0x39, 0xd9, 0x08, 0x23, 0xa3, 0x54, 0x1f, 0x4a, 0xf9, 0x33,
+	0x94, 0x46, 0xff, 0x33, 0xe3, 0x85, 0x23, 0x8e, 0x63, 0x44, 0x01, 0x2b, 0x23, 0xd8, 0x42, 0xf2,
+	0x05, 0x53, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xde, 0xe7, 0x44, 0xf2, 0x88, 0x53,
+	0xcb, 0xf6, 0x4a, 0x53, 0x23, 0x60, 0x63, 0x61, 0x00, 0x23, 0xcc, 0xf2, 0x48, 0x33, 0x63, 0x60,
+	0xa3, 0x61, 0x00, 0x23, 0xe3, 0x60, 0x23, 0x62, 0xa3, 0x60, 0xe3, 0x61, 0x23, 0x61, 0x63, 0x62,
+	0x00, 0x23, 0xc4, 0xf2, 0xc8, 0x13, 0xa3, 0x62, 0x08, 0x22, 0x2c, 0x23, 0xe2, 0x54, 0xd5, 0x33,
+	0xff, 0x33, 0xe3, 0x85, 0x25, 0x86, 0x6b, 0x46, 0x9e, 0x1d, 0x41, 0xf2, 0x71, 0x13, 0x30, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x33, 0x88, 0x23, 0x86, 0xd0, 0xe7, 0x03, 0x4a, 0x23, 0x8e,
+	0x94, 0x46, 0x63, 0x44, 0x01, 0x2b, 0xb0, 0xd9, 0xed, 0xe7, 0xc0, 0x46, 0x22, 0xfd, 0xff, 0xff,
+	0x10, 0xb5, 0x40, 0xf2, 0x00, 0x14, 0x43, 0xf6, 0xd9, 0x23, 0xc0, 0xf2, 0x40, 0x04, 0x90, 0xb0,
+	0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x45, 0xf2, 0xd7, 0x73, 0x40, 0x22, 0x00, 0x21,
+	0x68, 0x46, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x6a, 0x46, 0x73, 0x23, 0x13, 0x70, 0x43, 0xf6,
+	0x1d, 0x33, 0x40, 0x22, 0x69, 0x46, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x10, 0xb0,
+	0x10, 0xbd, 0xc0, 0x46, 0x10, 0xb5, 0x43, 0xb2, 0x90, 0xb0, 0x04, 0x00, 0x00, 0x2b, 0x22, 0xdd,
+	0x40, 0xf2, 0x00, 0x20, 0x43, 0xf6, 0xd9, 0x23, 0xc0, 0xf2, 0x40, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x45, 0xf2, 0xd7, 0x73, 0x40, 0x22, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x03, 0x68, 0x46,
+	0x98, 0x47, 0x6b, 0x46, 0x6a, 0x46, 0x1c, 0x70, 0x73, 0x23, 0x40, 0xf2, 0x00, 0x20, 0x53, 0x70,
+	0x43, 0xf6, 0x1d, 0x33, 0x40, 0x22, 0x69, 0x46, 0xc0, 0xf2, 0x40, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x10, 0xb0, 0x10, 0xbd, 0x0d, 0x20, 0x40, 0x42, 0xfa, 0xe7, 0xf0, 0xb5, 0x43, 0xf6,
+	0xed, 0x33, 0x06, 0x00, 0x40, 0xf2, 0x00, 0x20, 0xa1, 0xb0, 0x02, 0x22, 0x69, 0x46, 0xc0, 0xf2,
+	0x40, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x04, 0x00, 0x28, 0xbb, 0x6b, 0x46, 0x5b, 0x78,
+	0x73, 0x2b, 0x24, 0xd0, 0x40, 0xf2, 0x00, 0x20, 0x43, 0xf6, 0xd9, 0x23, 0xc0, 0xf2, 0x40, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x45, 0xf2, 0xd7, 0x73, 0x10, 0xad, 0x40, 0x22, 0x00, 0x21,
+	0xc0, 0xf2, 0x00, 0x03, 0x28, 0x00, 0x98, 0x47, 0x73, 0x23, 0x40, 0xf2, 0x00, 0x20, 0x6b, 0x70,
+	0x43, 0xf6, 0x1d, 0x33, 0x12, 0x27, 0x40, 0x22, 0x29, 0x00, 0xc0, 0xf2, 0x40, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x2f, 0x70, 0x98, 0x47, 0x37, 0x70, 0x20, 0x00, 0x21, 0xb0, 0xf0, 0xbd, 0x6b, 0x46,
+	0x1b, 0x78, 0x33, 0x70, 0xf8, 0xe7, 0xc0, 0x46, 0x83, 0x69, 0x10, 0xb5, 0x03, 0xb1, 0x98, 0x47,
+	0x10, 0xbd, 0xc0, 0x46, 0xc3, 0x69, 0x10, 0xb5, 0x03, 0xb1, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46,
+	0xf0, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x80, 0xb5, 0x03, 0x6a, 0x83, 0xb0, 0x5b, 0x5c, 0x90, 0x46,
+	0x5c, 0x00, 0xe4, 0x18, 0x83, 0x6a, 0xe4, 0x00, 0x9c, 0x46, 0x64, 0x44, 0x23, 0x1d, 0x99, 0x46,
+	0x13, 0x1c, 0x6a, 0x46, 0x43, 0xf2, 0xb5, 0x57, 0xd3, 0x71, 0x05, 0x00, 0x0e, 0x00, 0x48, 0x46,
+	0xd1, 0x79, 0xc0, 0xf2, 0x00, 0x07, 0xb8, 0x47, 0x43, 0xf2, 0xcd, 0x73, 0x28, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x01, 0x28, 0x12, 0xd9, 0x43, 0x46, 0x48, 0x46, 0x19, 0x0a, 0xb8, 0x47,
+	0xa3, 0x8a, 0x01, 0x33, 0x9b, 0xb2, 0x01, 0x33, 0xa3, 0x82, 0x23, 0x68, 0x13, 0xb1, 0x31, 0x00,
+	0x28, 0x00, 0x98, 0x47, 0x03, 0xb0, 0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd, 0xa3, 0x8a,
+	0xf1, 0xe7, 0xc0, 0x46, 0xf8, 0xb5, 0x47, 0x46, 0xce, 0x46, 0x06, 0x00, 0x80, 0xb5, 0x1c, 0x00,
+	0x08, 0xab, 0x88, 0x46, 0x15, 0x00, 0x1f, 0x78, 0x00, 0x20, 0x1e, 0xb1, 0x11, 0xb1, 0x0a, 0xb1,
+	0x00, 0x2f, 0x3e, 0xd1, 0x45, 0xf6, 0x14, 0x21, 0x43, 0xf2, 0xb9, 0x49, 0x3f, 0x22, 0xc0, 0xf2,
+	0x00, 0x01, 0xc0, 0xf2, 0x00, 0x09, 0xc8, 0x47, 0x62, 0x1c, 0xfb, 0x0f, 0xd0, 0x17, 0xba, 0x42,
+	0x58, 0x41, 0x45, 0xf6, 0x14, 0x21, 0x40, 0x22, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x01, 0xc8, 0x47,
+	0x00, 0x23, 0xff, 0x22, 0xea, 0x54, 0x01, 0x33, 0xdb, 0xb2, 0x9c, 0x42, 0xfa, 0xd2, 0x24, 0x23,
+	0x35, 0x62, 0xf4, 0x54, 0x01, 0x33, 0xf7, 0x54, 0x09, 0x9b, 0x41, 0x46, 0xb3, 0x62, 0x43, 0xf2,
+	0x21, 0x63, 0x30, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x70, 0xb9, 0x42, 0xf2, 0x81, 0x73,
+	0xc0, 0xf2, 0x00, 0x03, 0xb3, 0x60, 0x42, 0xf2, 0x69, 0x73, 0xc0, 0xf2, 0x00, 0x03, 0x33, 0x60,
+	0x42, 0xf2, 0x75, 0x73, 0xc0, 0xf2, 0x00, 0x03, 0x73, 0x60, 0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46,
+	0xf8, 0xbd, 0x09, 0x98, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0xbb, 0xe7, 0xf0, 0xb5, 0xd6, 0x46,
+	0x46, 0x46, 0x4f, 0x46, 0x04, 0x00, 0xc0, 0xb5, 0x0d, 0x00, 0x92, 0x46, 0x98, 0x46, 0x00, 0x28,
+	0x4a, 0xd0, 0x00, 0x2a, 0x48, 0xd0, 0x40, 0x46, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6,
+	0x14, 0x21, 0x43, 0xf2, 0xb9, 0x49, 0x24, 0x27, 0x66, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2,
+	0x00, 0x09, 0xc8, 0x47, 0x00, 0x20, 0xe3, 0x5d, 0x45, 0xf6, 0x14, 0x21, 0xab, 0x42, 0x40, 0x41,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xb2, 0x67, 0x22, 0xc8, 0x47, 0x21, 0x6a, 0x4b, 0x5d, 0xff, 0x2b,
+	0x2c, 0xd1, 0xe0, 0x5d, 0x00, 0x22, 0x00, 0x27, 0x8b, 0x5c, 0x01, 0x32, 0xff, 0x3b, 0x5e, 0x1e,
+	0xb3, 0x41, 0xd2, 0xb2, 0xff, 0x18, 0xff, 0xb2, 0x82, 0x42, 0xf5, 0xd9, 0x25, 0x23, 0xe3, 0x5c,
+	0xbb, 0x42, 0x1e, 0xd3, 0x7b, 0x00, 0xdb, 0x19, 0xdb, 0x00, 0x99, 0x46, 0xa3, 0x6a, 0x42, 0x46,
+	0x4b, 0x44, 0x18, 0x00, 0x43, 0xf2, 0x25, 0x53, 0x04, 0x30, 0x51, 0x46, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x58, 0xb9, 0x23, 0x6a, 0x5f, 0x55, 0xa3, 0x6a, 0x4b, 0x44, 0x98, 0x82, 0x1c, 0xbc,
+	0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x00, 0x20, 0xb8, 0xe7, 0x0d, 0x20, 0x40, 0x42,
+	0xf5, 0xe7, 0x1c, 0x20, 0x40, 0x42, 0xf2, 0xe7, 0xf8, 0xb5, 0x45, 0xf6, 0x14, 0x25, 0x06, 0x00,
+	0x43, 0xf2, 0xb9, 0x44, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xf2, 0x00, 0x05, 0x0f, 0x00, 0xc0, 0xf2,
+	0x00, 0x04, 0x29, 0x00, 0xc0, 0xb2, 0x83, 0x22, 0xa0, 0x47, 0x24, 0x23, 0x00, 0x20, 0xf3, 0x5c,
+	0x29, 0x00, 0xbb, 0x42, 0x40, 0x41, 0x84, 0x22, 0xc0, 0xb2, 0xa0, 0x47, 0x43, 0xf2, 0xa5, 0x73,
+	0x30, 0x00, 0x39, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0xf8, 0xbd, 0xc0, 0x46,
+	0xf8, 0xb5, 0x45, 0xf6, 0x14, 0x25, 0x06, 0x00, 0x43, 0xf2, 0xb9, 0x44, 0x43, 0x1e, 0x98, 0x41,
+	0xc0, 0xf2, 0x00, 0x05, 0x0f, 0x00, 0xc0, 0xf2, 0x00, 0x04, 0x29, 0x00, 0xc0, 0xb2, 0x8f, 0x22,
+	0xa0, 0x47, 0x24, 0x23, 0x00, 0x20, 0xf3, 0x5c, 0x29, 0x00, 0xbb, 0x42, 0x40, 0x41, 0x90, 0x22,
+	0xc0, 0xb2, 0xa0, 0x47, 0x43, 0xf2, 0xb9, 0x73, 0x30, 0x00, 0x39, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x00, 0x20, 0xf8, 0xbd, 0xc0, 0x46, 0xf0, 0xb5, 0xc6, 0x46, 0x1c, 0x00, 0x05, 0x00,
+	0x0f, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x45, 0xf6, 0x14, 0x21, 0x43, 0xf2, 0xb9, 0x48, 0x00, 0xb5,
+	0x16, 0x00, 0xc0, 0xb2, 0x9c, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x08, 0xc0, 0x47,
+	0x24, 0x23, 0x00, 0x20, 0xeb, 0x5c, 0x45, 0xf6, 0x14, 0x21, 0xbb, 0x42, 0x40, 0x41, 0x9d, 0x22,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0x47, 0x01, 0x2e, 0x1d, 0xd0, 0xa6, 0xb1, 0x02, 0x2e,
+	0x0d, 0xd1, 0xec, 0x61, 0x63, 0x1e, 0x9c, 0x41, 0xe3, 0xb2, 0x43, 0xf6, 0x79, 0x04, 0x28, 0x00,
+	0x32, 0x00, 0x39, 0x00, 0xc0, 0xf2, 0x00, 0x04, 0xa0, 0x47, 0x00, 0x20, 0x01, 0xe0, 0x0d, 0x20,
+	0x40, 0x42, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0x2b, 0x6a, 0xda, 0x5d, 0x53, 0x00, 0x9b, 0x18,
+	0xaa, 0x6a, 0xdb, 0x00, 0x9c, 0x50, 0xe5, 0xe7, 0xac, 0x61, 0xe3, 0xe7, 0xf0, 0xb5, 0x4f, 0x46,
+	0x46, 0x46, 0xd6, 0x46, 0xc0, 0xb5, 0x04, 0x00, 0x82, 0xb0, 0x88, 0x46, 0x15, 0x00, 0x1f, 0x00,
+	0x00, 0x28, 0x00, 0xd1, 0x6e, 0xe0, 0x00, 0x2a, 0x6c, 0xd0, 0x18, 0x00, 0x43, 0x1e, 0x98, 0x41,
+	0xc0, 0xb2, 0x45, 0xf6, 0x14, 0x21, 0x43, 0xf2, 0xb9, 0x46, 0xbc, 0x22, 0xc0, 0xf2, 0x00, 0x06,
+	0xc0, 0xf2, 0x00, 0x01, 0xb0, 0x47, 0x24, 0x23, 0x42, 0x46, 0x00, 0x20, 0xe3, 0x5c, 0x45, 0xf6,
+	0x14, 0x21, 0x93, 0x42, 0x40, 0x41, 0xc0, 0xf2, 0x00, 0x01, 0xbd, 0x22, 0xc0, 0xb2, 0xb0, 0x47,
+	0x43, 0xf2, 0xcd, 0x73, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x97, 0xfb, 0xf0, 0xf3,
+	0x58, 0x43, 0x3b, 0x1a, 0x58, 0x42, 0x58, 0x41, 0x45, 0xf6, 0x14, 0x21, 0xc0, 0xb2, 0xc0, 0xf2,
+	0x00, 0x01, 0xbf, 0x22, 0xb0, 0x47, 0x42, 0x46, 0x23, 0x6a, 0x01, 0xa8, 0x9a, 0x5c, 0x53, 0x00,
+	0x9b, 0x18, 0xa2, 0x6a, 0xdb, 0x00, 0x91, 0x46, 0x99, 0x44, 0x42, 0xf6, 0x65, 0x43, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x04, 0x23, 0x4b, 0x44, 0x18, 0x00, 0x98, 0x46, 0x43, 0xf2, 0xf9, 0x53,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x42, 0xf6, 0x75, 0x43, 0x06, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x01, 0xa8, 0x98, 0x47, 0x06, 0xb3, 0xff, 0xb1, 0x43, 0xf2, 0x69, 0x5a, 0x01, 0x3e, 0xae, 0x19,
+	0x00, 0x24, 0xc0, 0xf2, 0x00, 0x0a, 0x02, 0xe0, 0x01, 0x35, 0xa7, 0x42, 0x06, 0xd0, 0x01, 0x34,
+	0x29, 0x00, 0x40, 0x46, 0xa4, 0xb2, 0xd0, 0x47, 0xae, 0x42, 0xf5, 0xd1, 0x20, 0x00, 0x4b, 0x46,
+	0x9b, 0x8a, 0x1c, 0x1b, 0x4b, 0x46, 0x9c, 0x82, 0x02, 0xb0, 0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46,
+	0xa2, 0x46, 0xf0, 0xbd, 0x00, 0x20, 0x94, 0xe7, 0x00, 0x20, 0x00, 0x24, 0xef, 0xe7, 0xc0, 0x46,
+	0x10, 0xb5, 0x45, 0xf6, 0x14, 0x21, 0x04, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xf2, 0x00, 0x01, 0xd6, 0x22, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf2,
+	0xe1, 0x73, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x10, 0xbd, 0xc0, 0x46,
+	0x70, 0xb5, 0x0d, 0x00, 0x04, 0x00, 0x45, 0xf6, 0x14, 0x21, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2,
+	0xb9, 0x43, 0xe0, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x43, 0xf2, 0x91, 0x73, 0x29, 0x00, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20,
+	0x70, 0xbd, 0xc0, 0x46, 0x70, 0xb5, 0x0d, 0x00, 0x04, 0x00, 0x45, 0xf6, 0x14, 0x21, 0x43, 0x1e,
+	0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xea, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xb2, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x43, 0xf2, 0xf9, 0x73, 0x29, 0x00, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x00, 0x20, 0x70, 0xbd, 0xc0, 0x46, 0xf8, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x45, 0xf6,
+	0x14, 0x25, 0x80, 0xb5, 0x06, 0x00, 0x1f, 0x00, 0x43, 0xf2, 0xb9, 0x44, 0x43, 0x1e, 0x98, 0x41,
+	0xc0, 0xf2, 0x00, 0x05, 0x88, 0x46, 0x91, 0x46, 0x29, 0x00, 0xc0, 0xf2, 0x00, 0x04, 0xc0, 0xb2,
+	0xff, 0x22, 0xa0, 0x47, 0x24, 0x23, 0x00, 0x20, 0xf3, 0x5c, 0x29, 0x00, 0xbb, 0x42, 0x40, 0x41,
+	0x40, 0xf2, 0x00, 0x12, 0xc0, 0xb2, 0xa0, 0x47, 0x43, 0xf6, 0x3d, 0x04, 0x30, 0x00, 0x3b, 0x00,
+	0x4a, 0x46, 0x41, 0x46, 0xc0, 0xf2, 0x00, 0x04, 0xa0, 0x47, 0x00, 0x20, 0x0c, 0xbc, 0x90, 0x46,
+	0x99, 0x46, 0xf8, 0xbd, 0xef, 0xf3, 0x10, 0x83, 0x03, 0x60, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f,
+	0x70, 0x47, 0xc0, 0x46, 0xbf, 0xf3, 0x5f, 0x8f, 0x03, 0x68, 0x83, 0xf3, 0x10, 0x88, 0x70, 0x47,
+	0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0xc0, 0xb1, 0x08, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2,
+	0x45, 0xf6, 0x30, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03,
+	0x32, 0x22, 0x98, 0x47, 0x43, 0xf6, 0x9d, 0x13, 0x29, 0x00, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x08, 0xb9, 0x60, 0x60, 0xa0, 0x60, 0x70, 0xbd, 0x00, 0x20, 0xe8, 0xe7, 0xc0, 0x46,
+	0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0xa8, 0xb1, 0x48, 0x42, 0x48, 0x41, 0xc0, 0xb2, 0x45, 0xf6,
+	0x30, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x52, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x43, 0xf6, 0x1d, 0x23, 0x29, 0x00, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x00, 0x20, 0x70, 0xbd, 0x00, 0x20, 0xea, 0xe7, 0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0xa8, 0xb1,
+	0x48, 0x42, 0x48, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0x30, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x5e, 0x22,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0x31, 0x23, 0x29, 0x00,
+	0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x70, 0xbd, 0x00, 0x20, 0xea, 0xe7,
+	0xf0, 0xb5, 0xc6, 0x46, 0x06, 0x00, 0x00, 0xb5, 0x0f, 0x00, 0x14, 0x00, 0x98, 0x46, 0x00, 0x20,
+	0x06, 0xb1, 0x59, 0xb3, 0x45, 0xf6, 0x30, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x6a, 0x22, 0x98, 0x47, 0x43, 0xf6, 0x45, 0x23, 0x39, 0x00, 0x30, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x08, 0xb3, 0x43, 0x46, 0xfd, 0x00, 0x75, 0x19, 0x6c, 0x60,
+	0xab, 0x60, 0x7b, 0xb1, 0x43, 0xf6, 0x59, 0x28, 0xc0, 0xf2, 0x00, 0x08, 0x21, 0x88, 0x3a, 0x00,
+	0x30, 0x00, 0xc0, 0x47, 0x6b, 0x68, 0x9c, 0x1c, 0xab, 0x68, 0x6c, 0x60, 0x01, 0x3b, 0xab, 0x60,
+	0x00, 0x2b, 0xf3, 0xd1, 0x00, 0x20, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0x22, 0xb1, 0x18, 0x00,
+	0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0xcd, 0xe7, 0x10, 0x00, 0xcb, 0xe7, 0x1d, 0x20, 0x40, 0x42,
+	0xf1, 0xe7, 0xc0, 0x46, 0x03, 0x6a, 0x10, 0xb5, 0x03, 0xb1, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46,
+	0x43, 0xf2, 0xb5, 0x53, 0x10, 0xb5, 0x04, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x30, 0x30, 0x98, 0x47,
+	0xe3, 0x6a, 0x0b, 0xb1, 0x20, 0x00, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46, 0x70, 0xb5, 0x05, 0x00,
+	0x0e, 0x00, 0x14, 0x00, 0x00, 0xb3, 0xf9, 0xb1, 0x10, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2,
+	0x45, 0xf6, 0x4c, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x40, 0xf2, 0x51, 0x12, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x00, 0x44, 0x23, 0x18, 0x38, 0xe9, 0x8d, 0xc2, 0x5a,
+	0x91, 0x42, 0x0b, 0xd1, 0x06, 0x64, 0xc4, 0x52, 0x44, 0xf2, 0x15, 0x13, 0x31, 0x78, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x20, 0x00, 0x70, 0xbd, 0x00, 0x20, 0xe1, 0xe7, 0x04, 0x20, 0x40, 0x42,
+	0xf9, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0x47, 0x46, 0xce, 0x46, 0x80, 0xb5, 0x0d, 0x00, 0x83, 0xb0,
+	0x07, 0x00, 0x90, 0x46, 0x00, 0x28, 0x41, 0xd0, 0x00, 0x29, 0x3f, 0xd0, 0x10, 0x00, 0x43, 0x1e,
+	0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0x4c, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x40, 0xf2, 0x36, 0x12,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x42, 0xf6, 0x65, 0x43, 0x01, 0xa8,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf2, 0xf9, 0x53, 0x18, 0x37, 0xc0, 0xf2, 0x00, 0x03,
+	0x38, 0x00, 0x98, 0x47, 0x42, 0xf6, 0x75, 0x43, 0x06, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x01, 0xa8,
+	0x98, 0x47, 0xee, 0xb1, 0x43, 0x46, 0xdb, 0xb1, 0x43, 0xf2, 0x69, 0x59, 0x01, 0x3e, 0xae, 0x19,
+	0x00, 0x24, 0xc0, 0xf2, 0x00, 0x09, 0x02, 0xe0, 0x01, 0x35, 0xa0, 0x45, 0x0c, 0xd0, 0x01, 0x34,
+	0x29, 0x00, 0x38, 0x00, 0xa4, 0xb2, 0xc8, 0x47, 0xae, 0x42, 0xf5, 0xd1, 0x20, 0x00, 0x03, 0xb0,
+	0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd, 0x40, 0x46, 0xf8, 0xe7, 0x00, 0x20, 0xc1, 0xe7,
+	0x00, 0x20, 0xf4, 0xe7, 0x44, 0x23, 0xc2, 0x5a, 0x10, 0xb5, 0x1a, 0xb9, 0x43, 0x6a, 0x03, 0xb1,
+	0x98, 0x47, 0x10, 0xbd, 0x46, 0x21, 0x43, 0x5a, 0x01, 0x33, 0x9b, 0xb2, 0x43, 0x52, 0x9a, 0x42,
+	0x05, 0xd1, 0x00, 0x23, 0x43, 0x64, 0x83, 0x6a, 0x00, 0x2b, 0xf1, 0xd1, 0xf1, 0xe7, 0x02, 0x6c,
+	0xd1, 0x5c, 0x44, 0xf2, 0x15, 0x13, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xe9, 0xe7, 0xc0, 0x46,
+	0xf8, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x28, 0x3e, 0xd0, 0x00, 0x29,
+	0x3c, 0xd0, 0x00, 0x2a, 0x3a, 0xd0, 0x18, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6,
+	0x4c, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x3a, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x20, 0x00, 0x43, 0xf2, 0x25, 0x53, 0x3a, 0x00, 0x31, 0x00, 0x30, 0x30, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x20, 0xbb, 0x43, 0xf6, 0xd1, 0x63, 0x29, 0x00, 0x20, 0x00, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0xc8, 0xb9, 0x42, 0xf6, 0x35, 0x63, 0xc0, 0xf2, 0x00, 0x03, 0xe3, 0x61,
+	0x42, 0xf6, 0xdd, 0x53, 0xc0, 0xf2, 0x00, 0x03, 0xa3, 0x61, 0x42, 0xf6, 0xb5, 0x53, 0xc0, 0xf2,
+	0x00, 0x03, 0x63, 0x60, 0x42, 0xf6, 0xd5, 0x63, 0xc0, 0xf2, 0x00, 0x03, 0xa3, 0x60, 0x42, 0xf6,
+	0xc1, 0x53, 0xc0, 0xf2, 0x00, 0x03, 0xe3, 0x60, 0x60, 0x64, 0xf8, 0xbd, 0x00, 0x20, 0xc6, 0xe7,
+	0x0d, 0x20, 0x40, 0x42, 0xf9, 0xe7, 0xc0, 0x46, 0x70, 0xb5, 0x45, 0xf6, 0x4c, 0x21, 0x04, 0x00,
+	0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x63, 0x22, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x44, 0xf2, 0x85, 0x03, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x05, 0x00, 0x78, 0xb9, 0x44, 0xf2, 0x1d, 0x16, 0x01, 0x22, 0x01, 0x21, 0xc0, 0xf2,
+	0x00, 0x06, 0x20, 0x00, 0xb0, 0x47, 0x01, 0x22, 0x02, 0x21, 0x20, 0x00, 0xb0, 0x47, 0x01, 0x22,
+	0x00, 0x21, 0x20, 0x00, 0xb0, 0x47, 0x28, 0x00, 0x70, 0xbd, 0xc0, 0x46, 0x70, 0xb5, 0x04, 0x00,
+	0x0d, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x45, 0xf6, 0x4c, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2,
+	0xc0, 0xf2, 0x00, 0x03, 0x85, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47, 0x44, 0xf2, 0x9d, 0x03,
+	0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x38, 0xb1, 0x44, 0xf2, 0xa9, 0x03, 0x29, 0x00,
+	0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x70, 0xbd, 0x7f, 0x21, 0x44, 0xf2, 0xa9, 0x03,
+	0x29, 0x40, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xf5, 0xe7, 0x70, 0xb5, 0x0c, 0x00,
+	0x05, 0x00, 0x45, 0xf6, 0x4c, 0x21, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0x16, 0x00,
+	0xc0, 0xb2, 0x94, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x01, 0x2c,
+	0x10, 0xd0, 0x64, 0xb1, 0x02, 0x2c, 0x04, 0xd0, 0x03, 0x2c, 0x05, 0xd1, 0x00, 0x20, 0xee, 0x62,
+	0x70, 0xbd, 0xae, 0x62, 0x00, 0x20, 0xfb, 0xe7, 0x01, 0x20, 0x40, 0x42, 0xf8, 0xe7, 0x2e, 0x62,
+	0x00, 0x20, 0xf5, 0xe7, 0x6e, 0x62, 0x00, 0x20, 0xf2, 0xe7, 0xc0, 0x46, 0x70, 0xb5, 0x04, 0x00,
+	0x0d, 0x00, 0x88, 0xb1, 0x08, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0x4c, 0x21,
+	0x43, 0xf2, 0xb9, 0x43, 0xae, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x18, 0x34,
+	0x98, 0x47, 0x2c, 0x60, 0x00, 0x20, 0x70, 0xbd, 0x00, 0x20, 0xef, 0xe7, 0x10, 0xb5, 0x45, 0xf6,
+	0x4c, 0x21, 0x04, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xf2, 0x00, 0x01,
+	0xba, 0x22, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x20, 0x00, 0x43, 0xf2, 0xf9, 0x53,
+	0x30, 0x30, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46, 0x70, 0xb5, 0x04, 0x00,
+	0x0d, 0x00, 0x16, 0x00, 0x98, 0xb1, 0x08, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6,
+	0x6c, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x34, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x32, 0x00, 0x29, 0x00, 0x23, 0x68, 0x20, 0x00, 0x98, 0x47, 0x70, 0xbd, 0x00, 0x20,
+	0xed, 0xe7, 0xc0, 0x46, 0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x98, 0xb1, 0x08, 0x00,
+	0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0x6c, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x3d, 0x22,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x32, 0x00, 0x29, 0x00, 0x63, 0x68,
+	0x20, 0x00, 0x98, 0x47, 0x70, 0xbd, 0x00, 0x20, 0xed, 0xe7, 0xc0, 0x46, 0x43, 0xf6, 0xd1, 0x43,
+	0x10, 0xb5, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x30, 0xb9, 0x43, 0xf6, 0x45, 0x13, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x10, 0xbd, 0x0d, 0x20, 0x40, 0x42, 0xfb, 0xe7, 0xc0, 0x46,
+	0xf0, 0xb5, 0x4e, 0x46, 0x45, 0x46, 0xde, 0x46, 0x57, 0x46, 0xe0, 0xb5, 0x03, 0x69, 0x83, 0xb0,
+	0x5d, 0x1c, 0x99, 0x46, 0x03, 0x7e, 0x06, 0x00, 0x44, 0x69, 0x05, 0x61, 0xdb, 0x07, 0x4b, 0xd4,
+	0x03, 0x7e, 0x9b, 0x07, 0x48, 0xd4, 0x00, 0x2c, 0x4a, 0xd0, 0x63, 0x68, 0xa2, 0x68, 0xeb, 0x1a,
+	0x9a, 0x42, 0x45, 0xd8, 0x43, 0xf2, 0xd9, 0x43, 0x40, 0xf2, 0x14, 0x0a, 0x43, 0xf2, 0x19, 0x58,
+	0x43, 0xf2, 0x11, 0x5b, 0xc0, 0xf2, 0x00, 0x03, 0x82, 0x44, 0xc0, 0xf2, 0x00, 0x08, 0xc0, 0xf2,
+	0x00, 0x0b, 0x01, 0x93, 0x0a, 0xe0, 0x77, 0x69, 0xe3, 0x68, 0x20, 0x00, 0x98, 0x47, 0x7f, 0xb3,
+	0x7b, 0x68, 0xba, 0x68, 0x3c, 0x00, 0xeb, 0x1a, 0x93, 0x42, 0x29, 0xd3, 0x50, 0x46, 0xc0, 0x47,
+	0x23, 0x7c, 0x01, 0x2b, 0xef, 0xd1, 0x73, 0x69, 0x65, 0x60, 0x00, 0x93, 0x3b, 0xb3, 0x18, 0x00,
+	0xa2, 0x68, 0x00, 0x21, 0x07, 0xe0, 0x63, 0x44, 0x5b, 0x1b, 0x9a, 0x42, 0x0d, 0xd9, 0x03, 0x68,
+	0x01, 0x00, 0x73, 0xb1, 0x18, 0x00, 0x87, 0x68, 0x43, 0x68, 0xbc, 0x46, 0x9d, 0x42, 0xf2, 0xd2,
+	0x4f, 0x46, 0x63, 0x44, 0xdb, 0x1b, 0x9a, 0x42, 0xf1, 0xd8, 0x00, 0x9b, 0x83, 0x42, 0x0e, 0xd0,
+	0x08, 0x00, 0x21, 0x00, 0xd8, 0x47, 0xce, 0xe7, 0x02, 0x22, 0x33, 0x7e, 0x13, 0x43, 0x33, 0x76,
+	0x03, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x21, 0x00,
+	0x50, 0x46, 0x01, 0x9b, 0x98, 0x47, 0xbe, 0xe7, 0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0xe8, 0xb1,
+	0x08, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0x80, 0x21, 0x43, 0xf2, 0xb9, 0x43,
+	0x3b, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0x25, 0x53,
+	0x29, 0x00, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x23, 0x23, 0x61, 0x43, 0xf2,
+	0x91, 0x13, 0xc0, 0xf2, 0x00, 0x03, 0x00, 0x20, 0x23, 0x60, 0x70, 0xbd, 0x00, 0x20, 0xe3, 0xe7,
+	0x10, 0xb5, 0x45, 0xf6, 0x80, 0x21, 0x04, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xf2, 0x00, 0x01, 0x48, 0x22, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6,
+	0x95, 0x53, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x10, 0xbd, 0xc0, 0x46,
+	0x10, 0xb5, 0x45, 0xf6, 0x80, 0x21, 0x04, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x53, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47, 0x43, 0xf6,
+	0x8d, 0x63, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x38, 0xb9, 0x43, 0xf6, 0xe5, 0x53,
+	0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x10, 0xbd, 0x11, 0x20, 0x40, 0x42,
+	0xfb, 0xe7, 0xc0, 0x46, 0x10, 0xb5, 0x45, 0xf6, 0x80, 0x21, 0x04, 0x00, 0x43, 0x1e, 0x98, 0x41,
+	0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x61, 0x22, 0xc0, 0xf2, 0x00, 0x01,
+	0x98, 0x47, 0x43, 0xf6, 0x8d, 0x63, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x38, 0xb1,
+	0x43, 0xf6, 0x41, 0x63, 0x20, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x10, 0xbd,
+	0x11, 0x20, 0x40, 0x42, 0xfb, 0xe7, 0xc0, 0x46, 0x70, 0xb5, 0x0d, 0x00, 0x04, 0x00, 0x45, 0xf6,
+	0x80, 0x21, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0x6f, 0x22, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0x7d, 0x63, 0x29, 0x00, 0x20, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20, 0x70, 0xbd, 0xc0, 0x46, 0xf0, 0xb5, 0xd6, 0x46,
+	0x4f, 0x46, 0x46, 0x46, 0xc0, 0xb5, 0x04, 0x00, 0x82, 0xb0, 0x8a, 0x46, 0x00, 0x28, 0x6c, 0xd0,
+	0x08, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0x80, 0x21, 0x43, 0xf2, 0xb9, 0x47,
+	0x7a, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x07, 0xb8, 0x47, 0x01, 0x22, 0x23, 0x7e,
+	0x40, 0xf2, 0x14, 0x08, 0x13, 0x43, 0x23, 0x76, 0x43, 0xf2, 0xc1, 0x43, 0xa0, 0x44, 0x51, 0x46,
+	0x40, 0x46, 0xc0, 0xf2, 0x00, 0x03, 0x01, 0x26, 0x98, 0x47, 0x00, 0x28, 0x57, 0xd1, 0x53, 0x46,
+	0x22, 0x69, 0x5a, 0x60, 0x63, 0x69, 0x9c, 0x46, 0x00, 0x2b, 0x48, 0xd0, 0x53, 0x46, 0x60, 0x46,
+	0x99, 0x68, 0x00, 0x27, 0xb6, 0x1a, 0x09, 0xe0, 0x85, 0x68, 0xa9, 0x46, 0x4b, 0x44, 0x9b, 0x1a,
+	0x8b, 0x42, 0x0c, 0xd2, 0x03, 0x68, 0x07, 0x00, 0x63, 0xb1, 0x18, 0x00, 0x43, 0x68, 0x9a, 0x42,
+	0xf2, 0xd2, 0x85, 0x68, 0xf3, 0x18, 0xa9, 0x46, 0x4b, 0x44, 0x8b, 0x42, 0xf2, 0xd3, 0x84, 0x45,
+	0x2d, 0xd0, 0x38, 0x00, 0x43, 0xf2, 0x11, 0x53, 0x51, 0x46, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x01, 0x22, 0x02, 0x25, 0x23, 0x7e, 0x00, 0x26, 0x93, 0x43, 0x23, 0x76, 0x23, 0x7e, 0x1d, 0x42,
+	0x14, 0xd0, 0x42, 0xf6, 0x65, 0x43, 0x01, 0xa8, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x23, 0x7e,
+	0x20, 0x00, 0xab, 0x43, 0x23, 0x76, 0x43, 0xf6, 0xa1, 0x63, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x42, 0xf6, 0x75, 0x43, 0x01, 0xa8, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x30, 0x00, 0x02, 0xb0,
+	0x1c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x00, 0x20, 0x94, 0xe7, 0x43, 0xf2,
+	0xd9, 0x43, 0x51, 0x46, 0x40, 0x46, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xd0, 0xe7, 0x45, 0xf6,
+	0x80, 0x21, 0x23, 0x7e, 0x7f, 0x22, 0xb3, 0x43, 0x23, 0x76, 0xc0, 0xf2, 0x00, 0x01, 0x00, 0x20,
+	0xb8, 0x47, 0x13, 0x3e, 0xe2, 0xe7, 0xc0, 0x46, 0x00, 0xb9, 0x00, 0xbe, 0x70, 0x47, 0xc0, 0x46,
+	0x03, 0x68, 0x13, 0xb9, 0x05, 0xe0, 0x1b, 0x68, 0x1b, 0xb1, 0x99, 0x42, 0xfb, 0xd1, 0x01, 0x20,
+	0x00, 0xe0, 0x00, 0x20, 0x70, 0x47, 0xc0, 0x46, 0x03, 0x68, 0x70, 0xb5, 0x05, 0x00, 0x0c, 0x00,
+	0x13, 0xb9, 0x05, 0xe0, 0x1b, 0x68, 0x1b, 0xb1, 0x9c, 0x42, 0xfb, 0xd1, 0x00, 0x20, 0x00, 0xe0,
+	0x01, 0x20, 0x45, 0xf6, 0x98, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x39, 0x22, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x2b, 0x68, 0x23, 0x60, 0x2c, 0x60, 0x70, 0xbd, 0xc0, 0x46,
+	0x03, 0x68, 0x0b, 0x60, 0x01, 0x60, 0x70, 0x47, 0x03, 0x68, 0x0b, 0xb1, 0x1a, 0x68, 0x02, 0x60,
+	0x18, 0x00, 0x70, 0x47, 0x70, 0xb5, 0x05, 0x00, 0x0e, 0x00, 0x14, 0x00, 0xb8, 0xb1, 0xb1, 0xb1,
+	0x10, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0xb8, 0x21, 0x43, 0xf2, 0xb9, 0x43,
+	0x28, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47, 0x63, 0x1e, 0x1c, 0x40,
+	0x3c, 0xb9, 0x00, 0x20, 0x6b, 0x60, 0xac, 0x60, 0xec, 0x60, 0x2e, 0x60, 0x70, 0xbd, 0x00, 0x20,
+	0xea, 0xe7, 0x0d, 0x20, 0x40, 0x42, 0xf9, 0xe7, 0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0xd8, 0xb1,
+	0x08, 0x00, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6, 0xb8, 0x21, 0x43, 0xf2, 0xb9, 0x43,
+	0x40, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47, 0xa3, 0x68, 0xe2, 0x68,
+	0x9a, 0x42, 0x0b, 0xd0, 0x00, 0x20, 0x62, 0x68, 0x13, 0x40, 0x22, 0x68, 0xd3, 0x5c, 0x2b, 0x70,
+	0xa3, 0x68, 0x01, 0x33, 0xa3, 0x60, 0x70, 0xbd, 0x00, 0x20, 0xe5, 0xe7, 0x0a, 0x20, 0x40, 0x42,
+	0xf9, 0xe7, 0xc0, 0x46, 0x70, 0xb5, 0x04, 0x00, 0x0d, 0x00, 0x43, 0x1e, 0x98, 0x41, 0x45, 0xf6,
+	0xb8, 0x21, 0x43, 0xf2, 0xb9, 0x43, 0x51, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03,
+	0xc0, 0xb2, 0x98, 0x47, 0xe2, 0x68, 0x63, 0x68, 0x13, 0x40, 0x22, 0x68, 0xd5, 0x54, 0xe3, 0x68,
+	0xa2, 0x68, 0x61, 0x68, 0x9a, 0x1a, 0x8a, 0x42, 0x01, 0xd9, 0x59, 0x1a, 0xa1, 0x60, 0x01, 0x33,
+	0x00, 0x20, 0xe3, 0x60, 0x70, 0xbd, 0xc0, 0x46, 0x10, 0xb5, 0x45, 0xf6, 0xb8, 0x21, 0x04, 0x00,
+	0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xb2, 0x67, 0x22,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0xe0, 0x68, 0xa3, 0x68, 0xc0, 0x1a, 0x10, 0xbd, 0xc0, 0x46,
+	0xf8, 0xb5, 0x0c, 0x00, 0x05, 0x00, 0x45, 0xf6, 0xdc, 0x21, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2,
+	0xb9, 0x47, 0xc0, 0xb2, 0xee, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x07, 0xb8, 0x47,
+	0x46, 0xf2, 0x20, 0x03, 0x40, 0xf2, 0x00, 0x76, 0xc0, 0xf2, 0x80, 0x03, 0x1b, 0x68, 0x45, 0xf6,
+	0xdc, 0x21, 0x1a, 0x02, 0x9b, 0x06, 0x16, 0x40, 0x5b, 0x0f, 0x1e, 0x43, 0x4e, 0xf2, 0x00, 0x43,
+	0xcb, 0xf6, 0xff, 0x53, 0xe0, 0x18, 0x43, 0x42, 0x58, 0x41, 0xb2, 0x22, 0xc0, 0xb2, 0xc0, 0xf2,
+	0x00, 0x01, 0xb8, 0x47, 0x23, 0x8c, 0x03, 0x22, 0xdb, 0x07, 0x00, 0xd4, 0x68, 0xe0, 0x01, 0x22,
+	0x23, 0x8c, 0x13, 0x40, 0x00, 0x2b, 0xfb, 0xd1, 0x05, 0x22, 0xa6, 0x85, 0x63, 0x70, 0xa2, 0x70,
+	0xe3, 0x70, 0x41, 0xf6, 0x02, 0x03, 0x40, 0xf2, 0xff, 0x72, 0x23, 0x81, 0x23, 0x8c, 0x1a, 0x42,
+	0xfc, 0xd1, 0x10, 0x23, 0x40, 0xf2, 0xff, 0x72, 0x63, 0x81, 0x23, 0x8c, 0x1a, 0x42, 0xfc, 0xd1,
+	0x08, 0x23, 0x40, 0xf2, 0xff, 0x72, 0x23, 0x73, 0x23, 0x8c, 0x13, 0x40, 0x00, 0x2b, 0xfb, 0xd1,
+	0x40, 0xf2, 0xff, 0x72, 0x63, 0x73, 0x23, 0x8c, 0x13, 0x40, 0x00, 0x2b, 0xfb, 0xd1, 0x40, 0x22,
+	0xe3, 0x81, 0x23, 0x8c, 0x13, 0x40, 0x00, 0x2b, 0xfb, 0xd1, 0x80, 0x22, 0x23, 0x82, 0x23, 0x8c,
+	0x13, 0x40, 0x00, 0x2b, 0xfb, 0xd1, 0x40, 0xf2, 0x00, 0x12, 0x63, 0x82, 0x23, 0x8c, 0x13, 0x40,
+	0x00, 0x2b, 0xfb, 0xd1, 0x40, 0xf2, 0x00, 0x22, 0xa3, 0x82, 0x23, 0x8c, 0x13, 0x40, 0x00, 0x2b,
+	0xfb, 0xd1, 0x03, 0x22, 0x23, 0x77, 0xa3, 0x62, 0x23, 0x70, 0x23, 0x8c, 0x1a, 0x42, 0xfc, 0xd1,
+	0x41, 0xf6, 0x00, 0x43, 0xc4, 0xf2, 0x00, 0x23, 0x6c, 0x61, 0x9c, 0x42, 0x31, 0xd0, 0x4e, 0xf2,
+	0x00, 0x13, 0x84, 0x20, 0x20, 0x22, 0xce, 0xf2, 0x00, 0x03, 0x1a, 0x50, 0xbf, 0xf3, 0x4f, 0x8f,
+	0xbf, 0xf3, 0x6f, 0x8f, 0x40, 0xf2, 0x84, 0x11, 0x5a, 0x50, 0x5a, 0x60, 0x20, 0x32, 0x1a, 0x50,
+	0xbf, 0xf3, 0x4f, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0x00, 0x20, 0x5a, 0x50, 0x5a, 0x60, 0xf8, 0xbd,
+	0x23, 0x8c, 0x1a, 0x42, 0xfc, 0xd1, 0x02, 0x23, 0x22, 0x78, 0x13, 0x42, 0x0a, 0xd0, 0x22, 0x78,
+	0x9a, 0x43, 0x22, 0x70, 0x03, 0x22, 0x23, 0x8c, 0x1a, 0x42, 0xfc, 0xd1, 0x02, 0x22, 0x23, 0x8c,
+	0x1a, 0x42, 0xfc, 0xd1, 0x01, 0x23, 0x03, 0x22, 0x23, 0x70, 0x23, 0x8c, 0x1a, 0x42, 0xfc, 0xd1,
+	0x7d, 0xe7, 0x40, 0xf2, 0x40, 0x13, 0xc2, 0xf2, 0x00, 0x03, 0x1d, 0x60, 0xc7, 0xe7, 0xc0, 0x46,
+	0x42, 0x69, 0x11, 0x73, 0x40, 0xf2, 0xff, 0x71, 0x13, 0x8c, 0x19, 0x42, 0xfc, 0xd1, 0x00, 0x20,
+	0x70, 0x47, 0xc0, 0x46, 0x02, 0x21, 0x42, 0x69, 0x13, 0x78, 0x0b, 0x43, 0x13, 0x70, 0x01, 0x31,
+	0x13, 0x8c, 0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47, 0x02, 0x21, 0x42, 0x69, 0x13, 0x78, 0x8b, 0x43,
+	0x13, 0x70, 0x01, 0x31, 0x13, 0x8c, 0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47, 0x43, 0x69, 0x58, 0x89,
+	0x80, 0x06, 0x80, 0x0f, 0x03, 0x38, 0x43, 0x1e, 0x98, 0x41, 0x01, 0x30, 0x70, 0x47, 0xc0, 0x46,
+	0x02, 0x21, 0x42, 0x69, 0x13, 0x7e, 0x0b, 0x43, 0x40, 0xf2, 0xff, 0x71, 0x13, 0x76, 0x13, 0x8c,
+	0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47, 0xc0, 0x46, 0x43, 0x69, 0x03, 0x20, 0x10, 0xb5, 0x1a, 0x8c,
+	0x10, 0x42, 0xfc, 0xd1, 0x02, 0x20, 0x1c, 0x78, 0x1a, 0x78, 0xa4, 0x07, 0x82, 0x43, 0xe4, 0x0f,
+	0x1a, 0x70, 0x01, 0x30, 0x1a, 0x8c, 0x10, 0x42, 0xfc, 0xd1, 0x0f, 0x20, 0x9a, 0x78, 0x01, 0x40,
+	0x82, 0x43, 0x11, 0x43, 0x99, 0x70, 0x3c, 0xb1, 0x02, 0x21, 0x1a, 0x78, 0x0a, 0x43, 0x1a, 0x70,
+	0x01, 0x31, 0x1a, 0x8c, 0x11, 0x42, 0xfc, 0xd1, 0x10, 0xbd, 0xc0, 0x46, 0x10, 0xb5, 0x1f, 0x24,
+	0x43, 0x69, 0x21, 0x40, 0x18, 0x89, 0xa0, 0x43, 0x01, 0x43, 0x40, 0xf2, 0xff, 0x70, 0x19, 0x81,
+	0x19, 0x8c, 0x08, 0x42, 0xfc, 0xd1, 0x19, 0x89, 0x06, 0x48, 0x01, 0x40, 0x10, 0x02, 0x41, 0xf6,
+	0x00, 0x72, 0x02, 0x40, 0x0a, 0x43, 0x40, 0xf2, 0xff, 0x71, 0x1a, 0x81, 0x1a, 0x8c, 0x11, 0x42,
+	0xfc, 0xd1, 0x10, 0xbd, 0xff, 0xe0, 0xff, 0xff, 0x41, 0x69, 0x01, 0x2a, 0x06, 0xd0, 0x02, 0x2a,
+	0x08, 0xd0, 0x12, 0xb9, 0x63, 0xb1, 0x01, 0x23, 0x4b, 0x71, 0x70, 0x47, 0x2b, 0xb9, 0x04, 0x33,
+	0x0b, 0x71, 0xfa, 0xe7, 0x3b, 0xb9, 0x0a, 0x71, 0xf7, 0xe7, 0x04, 0x23, 0x4b, 0x71, 0xf4, 0xe7,
+	0x01, 0x33, 0x0b, 0x71, 0xf1, 0xe7, 0x4a, 0x71, 0xef, 0xe7, 0xc0, 0x46, 0x40, 0xf2, 0x40, 0x13,
+	0x10, 0xb5, 0xc2, 0xf2, 0x00, 0x03, 0x18, 0x68, 0x42, 0x69, 0x91, 0x79, 0x53, 0x79, 0x0b, 0x40,
+	0x01, 0x21, 0x19, 0x42, 0x0b, 0xd1, 0x02, 0x21, 0x19, 0x42, 0x0f, 0xd1, 0x04, 0x21, 0x19, 0x42,
+	0x00, 0xd1, 0x10, 0xbd, 0x91, 0x71, 0x03, 0x68, 0x00, 0x21, 0x98, 0x47, 0xf9, 0xe7, 0x91, 0x71,
+	0x92, 0x8c, 0x83, 0x68, 0x92, 0xb2, 0x00, 0x21, 0x98, 0x47, 0xf2, 0xe7, 0x91, 0x71, 0x43, 0x68,
+	0x00, 0x21, 0x98, 0x47, 0xed, 0xe7, 0xc0, 0x46, 0x40, 0xf2, 0x40, 0x13, 0x10, 0xb5, 0xc2, 0xf2,
+	0x00, 0x03, 0x18, 0x68, 0x42, 0x69, 0x91, 0x79, 0x53, 0x79, 0x0b, 0x40, 0x01, 0x21, 0x19, 0x42,
+	0x0b, 0xd1, 0x02, 0x21, 0x19, 0x42, 0x0f, 0xd1, 0x04, 0x21, 0x19, 0x42, 0x00, 0xd1, 0x10, 0xbd,
+	0x91, 0x71, 0x03, 0x68, 0x00, 0x21, 0x98, 0x47, 0xf9, 0xe7, 0x91, 0x71, 0x92, 0x8c, 0x83, 0x68,
+	0x92, 0xb2, 0x00, 0x21, 0x98, 0x47, 0xf2, 0xe7, 0x91, 0x71, 0x43, 0x68, 0x00, 0x21, 0x98, 0x47,
+	0xed, 0xe7, 0xc0, 0x46, 0xbf, 0xf3, 0x4f, 0x8f, 0x30, 0xbf, 0x70, 0x47, 0x44, 0xf2, 0x00, 0x03,
+	0x10, 0xb5, 0xc4, 0xf2, 0x00, 0x13, 0x5a, 0x68, 0x00, 0x20, 0x5a, 0x60, 0x43, 0xf6, 0xfd, 0x43,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0x95, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x43, 0xf6, 0xad, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0xc5, 0x23, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x43, 0xf6, 0xcd, 0x43, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x43, 0xf6,
+	0x69, 0x23, 0x1f, 0x20, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x10, 0xbd, 0x70, 0xb5, 0x0c, 0x00,
+	0x05, 0x00, 0x45, 0xf6, 0xf4, 0x21, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0x4c, 0x22,
+	0xc0, 0xf2, 0x00, 0x03, 0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47, 0x2c, 0x60, 0x23, 0x69,
+	0x03, 0x22, 0xdb, 0x07, 0x10, 0xd5, 0x01, 0x22, 0x23, 0x69, 0x13, 0x40, 0x00, 0x2b, 0xfb, 0xd1,
+	0x41, 0x22, 0xa3, 0x70, 0x62, 0x70, 0x23, 0x70, 0x3e, 0x3a, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1,
+	0x01, 0x23, 0x00, 0x20, 0x23, 0x75, 0x70, 0xbd, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x02, 0x23,
+	0x22, 0x78, 0x13, 0x42, 0x0a, 0xd0, 0x22, 0x78, 0x9a, 0x43, 0x22, 0x70, 0x03, 0x22, 0x23, 0x69,
+	0x1a, 0x42, 0xfc, 0xd1, 0x02, 0x22, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x01, 0x23, 0x03, 0x22,
+	0x23, 0x70, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0xd5, 0xe7, 0xc0, 0x46, 0x02, 0x21, 0x02, 0x68,
+	0x13, 0x78, 0x0b, 0x43, 0x13, 0x70, 0x01, 0x31, 0x13, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47,
+	0x02, 0x21, 0x02, 0x68, 0x13, 0x78, 0x8b, 0x43, 0x13, 0x70, 0x01, 0x31, 0x13, 0x69, 0x19, 0x42,
+	0xfc, 0xd1, 0x70, 0x47, 0x03, 0x21, 0x02, 0x68, 0x13, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x10, 0x78,
+	0x80, 0x07, 0xc0, 0x0f, 0x70, 0x47, 0xc0, 0x46, 0x02, 0x68, 0x11, 0x81, 0x04, 0x21, 0x13, 0x69,
+	0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47, 0xc0, 0x46, 0xc3, 0x07, 0x0c, 0xd5, 0x41, 0xf6, 0x00, 0x42,
+	0x40, 0xf2, 0x05, 0x13, 0x7d, 0x21, 0xc4, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x01, 0x03, 0x13, 0x62,
+	0x53, 0x68, 0x19, 0x42, 0xfc, 0xd1, 0x43, 0x07, 0x0c, 0xd5, 0x41, 0xf6, 0x00, 0x42, 0x42, 0xf2,
+	0x05, 0x13, 0x7d, 0x21, 0xc4, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x01, 0x03, 0x93, 0x62, 0x53, 0x68,
+	0x19, 0x42, 0xfc, 0xd1, 0x03, 0x07, 0x0c, 0xd5, 0x41, 0xf6, 0x00, 0x42, 0x40, 0xf2, 0x03, 0x13,
+	0x7d, 0x21, 0xc4, 0xf2, 0x00, 0x02, 0xc0, 0xf2, 0x01, 0x03, 0xd3, 0x62, 0x53, 0x68, 0x19, 0x42,
+	0xfc, 0xd1, 0x70, 0x47, 0x40, 0xf6, 0x00, 0x03, 0x01, 0x22, 0xc4, 0xf2, 0x00, 0x03, 0x1a, 0x71,
+	0x70, 0x47, 0xc0, 0x46, 0x00, 0x20, 0x70, 0x47, 0x44, 0xf2, 0x00, 0x02, 0x04, 0x21, 0xc4, 0xf2,
+	0x00, 0x12, 0x13, 0x8b, 0x19, 0x42, 0xfc, 0xd0, 0x3f, 0x23, 0x13, 0x75, 0x0a, 0x4b, 0xd0, 0x61,
+	0x13, 0x80, 0x44, 0xf2, 0x00, 0x03, 0x01, 0x21, 0xc4, 0xf2, 0x00, 0x13, 0x1e, 0x20, 0x02, 0xe0,
+	0x1a, 0x7d, 0x10, 0x42, 0x04, 0xd1, 0x1a, 0x7d, 0x11, 0x42, 0xf9, 0xd0, 0x00, 0x20, 0x70, 0x47,
+	0x1e, 0x20, 0x40, 0x42, 0xfb, 0xe7, 0xc0, 0x46, 0x02, 0xa5, 0xff, 0xff, 0xf0, 0xb5, 0x83, 0x06,
+	0x01, 0xd1, 0x40, 0x2a, 0x02, 0xd9, 0x0d, 0x20, 0x40, 0x42, 0xf0, 0xbd, 0x44, 0xf2, 0x00, 0x04,
+	0x04, 0x25, 0xc4, 0xf2, 0x00, 0x14, 0x23, 0x8b, 0x1d, 0x42, 0xfc, 0xd0, 0x3f, 0x23, 0x23, 0x75,
+	0x28, 0x4b, 0x01, 0x25, 0x23, 0x80, 0x44, 0xf2, 0x00, 0x03, 0x1e, 0x26, 0xc4, 0xf2, 0x00, 0x13,
+	0x02, 0xe0, 0x1c, 0x7d, 0x26, 0x42, 0x02, 0xd1, 0x1c, 0x7d, 0x25, 0x42, 0xf9, 0xd0, 0x46, 0x08,
+	0xc2, 0xb1, 0x57, 0x1e, 0x76, 0x00, 0x00, 0x23, 0x07, 0xe0, 0xac, 0xb2, 0xf5, 0x18, 0x02, 0x33,
+	0x2c, 0x80, 0x9c, 0xb2, 0x02, 0x31, 0xa2, 0x42, 0x0c, 0xd9, 0x0d, 0x78, 0x9f, 0x42, 0xf4, 0xdd,
+	0x4c, 0x78, 0x02, 0x31, 0x24, 0x02, 0x2c, 0x43, 0xf5, 0x18, 0x02, 0x33, 0x2c, 0x80, 0x9c, 0xb2,
+	0xa2, 0x42, 0xf2, 0xd8, 0x44, 0xf2, 0x00, 0x03, 0xc4, 0xf2, 0x00, 0x13, 0x1b, 0x7a, 0xdb, 0x07,
+	0x01, 0xd4, 0x40, 0x2a, 0x19, 0xd0, 0x44, 0xf2, 0x00, 0x02, 0x04, 0x21, 0xc4, 0xf2, 0x00, 0x12,
+	0x13, 0x8b, 0x19, 0x42, 0xfc, 0xd0, 0x3f, 0x23, 0x13, 0x75, 0x0b, 0x4b, 0xd0, 0x61, 0x13, 0x80,
+	0x44, 0xf2, 0x00, 0x03, 0x01, 0x21, 0xc4, 0xf2, 0x00, 0x13, 0x1e, 0x20, 0x02, 0xe0, 0x1a, 0x7d,
+	0x10, 0x42, 0x04, 0xd1, 0x1a, 0x7d, 0x11, 0x42, 0xf9, 0xd0, 0x00, 0x20, 0xa5, 0xe7, 0x1e, 0x20,
+	0x40, 0x42, 0xa2, 0xe7, 0x44, 0xa5, 0xff, 0xff, 0x04, 0xa5, 0xff, 0xff, 0x70, 0xb5, 0x44, 0xf2,
+	0x00, 0x04, 0x04, 0x26, 0x45, 0x08, 0xc4, 0xf2, 0x00, 0x14, 0x23, 0x8b, 0x1e, 0x42, 0xfc, 0xd0,
+	0x01, 0x23, 0x00, 0x24, 0x03, 0x42, 0x05, 0xd0, 0x98, 0x43, 0x03, 0x88, 0x01, 0x35, 0x1b, 0x0a,
+	0x0b, 0x70, 0x01, 0x34, 0xa2, 0x42, 0x0f, 0xd9, 0x6d, 0x00, 0x56, 0x1e, 0x09, 0x19, 0x2d, 0x1b,
+	0x63, 0x19, 0x1b, 0x88, 0x9b, 0xb2, 0x0b, 0x70, 0xa6, 0x42, 0x01, 0xd9, 0x1b, 0x0a, 0x4b, 0x70,
+	0x02, 0x34, 0x02, 0x31, 0xa2, 0x42, 0xf3, 0xd8, 0x00, 0x20, 0x70, 0xbd, 0x43, 0xf2, 0x00, 0x03,
+	0x00, 0x22, 0xc4, 0xf2, 0x00, 0x23, 0x1a, 0x70, 0x01, 0x32, 0x1a, 0x70, 0x40, 0xf2, 0x04, 0x02,
+	0xc2, 0xf2, 0x00, 0x02, 0x11, 0x68, 0x00, 0x20, 0x59, 0x60, 0x51, 0x68, 0x99, 0x60, 0x91, 0x68,
+	0xd9, 0x60, 0x11, 0x7b, 0x19, 0x70, 0x52, 0x7b, 0x1a, 0x74, 0x70, 0x47, 0x43, 0xf2, 0x00, 0x03,
+	0x02, 0x21, 0xc4, 0xf2, 0x00, 0x23, 0x1a, 0x78, 0x00, 0x20, 0x0a, 0x43, 0x1a, 0x70, 0x70, 0x47,
+	0x43, 0xf2, 0x00, 0x03, 0x02, 0x21, 0xc4, 0xf2, 0x00, 0x23, 0x1a, 0x78, 0x8a, 0x43, 0x1a, 0x70,
+	0x70, 0x47, 0xc0, 0x46, 0x41, 0xf2, 0x00, 0x43, 0x41, 0xf6, 0x00, 0x71, 0xc4, 0xf2, 0x00, 0x03,
+	0xda, 0x69, 0x0a, 0x40, 0xda, 0x61, 0x01, 0x22, 0x1a, 0x74, 0x70, 0x47, 0x41, 0xf2, 0x00, 0x02,
+	0x0e, 0x23, 0x10, 0x21, 0xc4, 0xf2, 0x00, 0x02, 0x13, 0x76, 0x13, 0x69, 0x19, 0x42, 0xfc, 0xd0,
+	0x80, 0x21, 0x13, 0x7e, 0x0b, 0x43, 0x13, 0x76, 0x70, 0x47, 0xc0, 0x46, 0x70, 0x47, 0xc0, 0x46,
+	0x06, 0x28, 0x0f, 0xd8, 0x01, 0x23, 0x54, 0x22, 0x83, 0x40, 0x1a, 0x42, 0x0a, 0xd0, 0x40, 0xf2,
+	0x00, 0x43, 0x07, 0x21, 0xc4, 0xf2, 0x00, 0x03, 0x5a, 0x78, 0x8a, 0x43, 0x10, 0x43, 0x58, 0x70,
+	0x00, 0x20, 0x70, 0x47, 0x0d, 0x20, 0x40, 0x42, 0xfb, 0xe7, 0xc0, 0x46, 0x40, 0xf2, 0x00, 0x42,
+	0x03, 0x23, 0xc4, 0xf2, 0x00, 0x02, 0x91, 0x78, 0x19, 0x40, 0x88, 0x42, 0x09, 0xd0, 0xff, 0x21,
+	0x91, 0x71, 0x91, 0x78, 0x99, 0x43, 0x03, 0x40, 0x0b, 0x43, 0x93, 0x70, 0x93, 0x79, 0x00, 0x2b,
+	0xfc, 0xd0, 0x70, 0x47, 0x70, 0xb5, 0x0c, 0x00, 0x05, 0x00, 0x45, 0xf6, 0x0c, 0x31, 0x43, 0x1e,
+	0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0x30, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0xc0, 0xb2, 0xc0, 0xf2,
+	0x00, 0x01, 0x98, 0x47, 0x01, 0x23, 0x48, 0xf2, 0x03, 0x02, 0xec, 0x60, 0x23, 0x80, 0x23, 0x69,
+	0x1a, 0x42, 0xfc, 0xd1, 0x01, 0x22, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x40, 0xf2, 0x00, 0x13,
+	0x48, 0xf2, 0x03, 0x02, 0x63, 0x60, 0x0a, 0x4b, 0x23, 0x80, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1,
+	0xa3, 0x23, 0x20, 0x22, 0x23, 0x62, 0x23, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x40, 0xf2, 0x00, 0x13,
+	0x63, 0x81, 0x40, 0xf2, 0x44, 0x13, 0xc2, 0xf2, 0x00, 0x03, 0x1d, 0x60, 0x00, 0x20, 0x70, 0xbd,
+	0x80, 0x80, 0xff, 0xff, 0x10, 0xb5, 0x04, 0x00, 0x08, 0xb3, 0xc0, 0x68, 0x43, 0x1e, 0x98, 0x41,
+	0xc0, 0xb2, 0x45, 0xf6, 0x0c, 0x31, 0x43, 0xf2, 0xb9, 0x43, 0x52, 0x22, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x4e, 0xf2, 0x00, 0x13, 0x04, 0x21, 0x80, 0x22, 0xce, 0xf2,
+	0x00, 0x03, 0x99, 0x50, 0xbf, 0xf3, 0x4f, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0x01, 0x23, 0x48, 0xf2,
+	0x03, 0x01, 0xe2, 0x68, 0x13, 0x80, 0x13, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x10, 0xbd, 0x00, 0x20,
+	0xdf, 0xe7, 0xc0, 0x46, 0x10, 0xb5, 0x04, 0x00, 0x40, 0xb3, 0xc0, 0x68, 0x43, 0x1e, 0x98, 0x41,
+	0xc0, 0xb2, 0x45, 0xf6, 0x0c, 0x31, 0x43, 0xf2, 0xb9, 0x43, 0x5e, 0x22, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x4e, 0xf2, 0x00, 0x13, 0x04, 0x22, 0xce, 0xf2, 0x00, 0x03,
+	0x1a, 0x60, 0x00, 0x22, 0x08, 0x21, 0xe3, 0x68, 0x9a, 0x61, 0x1a, 0x69, 0x11, 0x42, 0xfc, 0xd1,
+	0x08, 0x21, 0x1a, 0x69, 0x11, 0x42, 0xfc, 0xd1, 0x02, 0x21, 0x1a, 0x88, 0x0a, 0x43, 0x48, 0xf2,
+	0x03, 0x01, 0x1a, 0x80, 0x1a, 0x69, 0x11, 0x42, 0xfc, 0xd1, 0x10, 0xbd, 0x00, 0x20, 0xd8, 0xe7,
+	0x10, 0xb5, 0x04, 0x00, 0xc0, 0xb1, 0xc0, 0x68, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xb2, 0x45, 0xf6,
+	0x0c, 0x31, 0x43, 0xf2, 0xb9, 0x43, 0x6b, 0x22, 0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03,
+	0x98, 0x47, 0x02, 0x21, 0xe2, 0x68, 0x13, 0x88, 0x8b, 0x43, 0x48, 0xf2, 0x03, 0x01, 0x13, 0x80,
+	0x13, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x10, 0xbd, 0x00, 0x20, 0xe8, 0xe7, 0xc2, 0x68, 0x11, 0x62,
+	0x20, 0x21, 0x13, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x70, 0x47, 0xc0, 0x46, 0x48, 0xf2, 0x03, 0x01,
+	0xc2, 0x68, 0x13, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x10, 0x88, 0x80, 0x07, 0xc0, 0x0f, 0x70, 0x47,
+	0x70, 0x47, 0xc0, 0x46, 0x00, 0x20, 0x70, 0x47, 0x40, 0xf2, 0x44, 0x13, 0x10, 0xb5, 0xc2, 0xf2,
+	0x00, 0x03, 0x1c, 0x68, 0xe3, 0x68, 0x9a, 0x89, 0xd2, 0x05, 0x07, 0xd5, 0x22, 0x68, 0x12, 0xb1,
+	0x20, 0x00, 0x90, 0x47, 0xe3, 0x68, 0x40, 0xf2, 0x00, 0x12, 0x9a, 0x81, 0x10, 0xbd, 0xc0, 0x46,
+	0xf0, 0xb5, 0xc6, 0x46, 0x0c, 0x00, 0x80, 0x46, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e, 0x98, 0x41,
+	0x43, 0xf2, 0xb9, 0x46, 0x00, 0xb5, 0xc0, 0xb2, 0x84, 0xb0, 0x40, 0xf2, 0xbe, 0x62, 0xc0, 0xf2,
+	0x00, 0x01, 0xc0, 0xf2, 0x00, 0x06, 0xb0, 0x47, 0x45, 0xf6, 0x24, 0x32, 0xc0, 0xf2, 0x00, 0x02,
+	0x11, 0x00, 0x01, 0xab, 0x9c, 0x46, 0xa1, 0xc9, 0xa1, 0xc3, 0x01, 0x9b, 0xa3, 0x42, 0x07, 0xd0,
+	0x53, 0x68, 0xa3, 0x42, 0x00, 0xd1, 0x9a, 0xe0, 0x93, 0x68, 0xa3, 0x42, 0x00, 0xd1, 0x96, 0xe0,
+	0xe3, 0x69, 0x03, 0x21, 0xdb, 0x07, 0x00, 0xd4, 0x78, 0xe0, 0x01, 0x21, 0xe3, 0x69, 0x19, 0x42,
+	0xfc, 0xd1, 0x90, 0x23, 0x03, 0x21, 0xc0, 0xf2, 0x20, 0x03, 0x23, 0x60, 0xe3, 0x69, 0x19, 0x42,
+	0xfc, 0xd1, 0x40, 0xf2, 0x00, 0x53, 0x63, 0x60, 0x24, 0x23, 0x63, 0x62, 0x43, 0x46, 0x1c, 0x60,
+	0x40, 0xf2, 0x00, 0x43, 0xc4, 0xf2, 0x00, 0x23, 0x9c, 0x42, 0x00, 0xd1, 0x82, 0xe0, 0x60, 0x46,
+	0x13, 0x00, 0x62, 0xcb, 0x62, 0xc0, 0x01, 0x9b, 0xa3, 0x42, 0x00, 0xd1, 0x81, 0xe0, 0x53, 0x68,
+	0xa3, 0x42, 0x00, 0xd1, 0x81, 0xe0, 0x92, 0x68, 0x16, 0x23, 0xa2, 0x42, 0x00, 0xd1, 0x7e, 0xe0,
+	0x01, 0x21, 0x0e, 0x00, 0x4e, 0xf2, 0x00, 0x12, 0x9e, 0x40, 0x80, 0x25, 0xce, 0xf2, 0x00, 0x02,
+	0x56, 0x51, 0xbf, 0xf3, 0x4f, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0x40, 0xf2, 0x80, 0x10, 0x0f, 0x00,
+	0x16, 0x50, 0x16, 0x60, 0x5e, 0x1c, 0xf6, 0xb2, 0xb7, 0x40, 0x57, 0x51, 0xbf, 0xf3, 0x4f, 0x8f,
+	0xbf, 0xf3, 0x6f, 0x8f, 0x40, 0xf2, 0x1f, 0x08, 0x17, 0x50, 0x17, 0x60, 0x47, 0x46, 0x0e, 0x00,
+	0x9a, 0x1c, 0xd2, 0xb2, 0x17, 0x40, 0xbe, 0x40, 0x37, 0x00, 0x4e, 0xf2, 0x00, 0x16, 0xce, 0xf2,
+	0x00, 0x06, 0xb4, 0x46, 0x52, 0xb2, 0x52, 0x09, 0x92, 0x00, 0x62, 0x44, 0x57, 0x51, 0xbf, 0xf3,
+	0x4f, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0x46, 0x46, 0x17, 0x50, 0x17, 0x60, 0x0a, 0x00, 0x03, 0x33,
+	0xdb, 0xb2, 0x1e, 0x40, 0xb2, 0x40, 0x5b, 0xb2, 0x5b, 0x09, 0x9b, 0x00, 0x63, 0x44, 0x5a, 0x51,
+	0xbf, 0xf3, 0x4f, 0x8f, 0xbf, 0xf3, 0x6f, 0x8f, 0x1a, 0x50, 0x1a, 0x60, 0x02, 0x23, 0x00, 0x20,
+	0xa3, 0x75, 0xa1, 0x75, 0x04, 0xb0, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0xe3, 0x69, 0x19, 0x42,
+	0xfc, 0xd1, 0x02, 0x23, 0x21, 0x68, 0x0b, 0x42, 0x0a, 0xd0, 0x21, 0x68, 0x99, 0x43, 0x21, 0x60,
+	0x03, 0x21, 0xe3, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x02, 0x21, 0xe3, 0x69, 0x19, 0x42, 0xfc, 0xd1,
+	0x11, 0x23, 0x03, 0x21, 0x23, 0x60, 0xe3, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x6d, 0xe7, 0x45, 0xf6,
+	0x44, 0x31, 0x00, 0x20, 0x40, 0xf2, 0xe6, 0x72, 0xc0, 0xf2, 0x00, 0x01, 0xb0, 0x47, 0x0d, 0x20,
+	0x40, 0x42, 0xd7, 0xe7, 0x40, 0xf2, 0x48, 0x13, 0x41, 0x46, 0xc2, 0xf2, 0x00, 0x03, 0x19, 0x60,
+	0x75, 0xe7, 0x00, 0x23, 0x9b, 0x00, 0x16, 0x33, 0x82, 0xe7, 0x01, 0x23, 0xfa, 0xe7, 0x14, 0x3b,
+	0xf8, 0xe7, 0xc0, 0x46, 0x02, 0x21, 0x02, 0x68, 0x13, 0x68, 0x0b, 0x43, 0x13, 0x60, 0x01, 0x31,
+	0xd3, 0x69, 0x19, 0x42, 0xfc, 0xd1, 0x00, 0x20, 0x70, 0x47, 0xc0, 0x46, 0x03, 0x68, 0x58, 0x6a,
+	0x00, 0x04, 0xc0, 0x0f, 0x70, 0x47, 0xc0, 0x46, 0x70, 0xb5, 0x03, 0x22, 0x0e, 0x00, 0x04, 0x68,
+	0x82, 0xb0, 0xe3, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x42, 0xf6, 0x65, 0x43, 0x01, 0xa8, 0xc0, 0xf2,
+	0x00, 0x03, 0x25, 0x68, 0x98, 0x47, 0x02, 0x22, 0x23, 0x68, 0xad, 0x07, 0x93, 0x43, 0xed, 0x0f,
+	0x23, 0x60, 0x01, 0x32, 0xe3, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x61, 0x6a, 0x0c, 0x4b, 0x76, 0x00,
+	0x0b, 0x40, 0x40, 0xf2, 0xfe, 0x71, 0x31, 0x40, 0x19, 0x43, 0x42, 0xf6, 0x75, 0x43, 0x61, 0x62,
+	0x01, 0xa8, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x3d, 0xb1, 0x02, 0x22, 0x23, 0x68, 0x13, 0x43,
+	0x23, 0x60, 0x01, 0x32, 0xe3, 0x69, 0x1a, 0x42, 0xfc, 0xd1, 0x00, 0x20, 0x02, 0xb0, 0x70, 0xbd,
+	0x01, 0xf8, 0xff, 0xff, 0x28, 0x23, 0x02, 0x68, 0xd1, 0x54, 0x70, 0x47, 0x70, 0xb5, 0x0c, 0x00,
+	0x05, 0x00, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0x16, 0x00,
+	0xc0, 0xf2, 0x00, 0x03, 0xc0, 0xb2, 0x40, 0xf2, 0x84, 0x72, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47,
+	0x63, 0x1e, 0x01, 0x2b, 0x06, 0xd9, 0x1c, 0xb9, 0x2b, 0x68, 0x80, 0x22, 0x36, 0xb1, 0x9a, 0x75,
+	0x00, 0x20, 0x70, 0xbd, 0x2b, 0x68, 0x04, 0x22, 0x00, 0x2e, 0xf8, 0xd1, 0x1a, 0x75, 0xf7, 0xe7,
+	0x40, 0xf2, 0x48, 0x13, 0x70, 0xb5, 0xc2, 0xf2, 0x00, 0x03, 0x1e, 0x68, 0x35, 0x68, 0x2c, 0x7e,
+	0xe4, 0xb2, 0x63, 0xb2, 0x00, 0x2b, 0x37, 0xdb, 0x02, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76,
+	0x01, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76, 0x63, 0x07, 0x16, 0xd5, 0x6b, 0x8b, 0x1b, 0x07,
+	0x14, 0xd5, 0xb0, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x40, 0xf2, 0xa8, 0x72, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47,
+	0xb3, 0x68, 0x30, 0x00, 0x98, 0x47, 0x04, 0x23, 0x2b, 0x76, 0x70, 0xbd, 0xf0, 0x68, 0x45, 0xf6,
+	0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0xa5, 0x72,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x23, 0xe9, 0x5c, 0x30, 0x00,
+	0xc9, 0xb2, 0xf3, 0x68, 0x98, 0x47, 0xe6, 0xe7, 0x70, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e,
+	0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0x9a, 0x72, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x30, 0x00, 0x73, 0x68, 0x98, 0x47, 0xb4, 0xe7, 0xc0, 0x46,
+	0x40, 0xf2, 0x48, 0x13, 0x70, 0xb5, 0xc2, 0xf2, 0x00, 0x03, 0x1e, 0x68, 0x35, 0x68, 0x2c, 0x7e,
+	0xe4, 0xb2, 0x63, 0xb2, 0x00, 0x2b, 0x37, 0xdb, 0x02, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76,
+	0x01, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76, 0x63, 0x07, 0x16, 0xd5, 0x6b, 0x8b, 0x1b, 0x07,
+	0x14, 0xd5, 0xb0, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x40, 0xf2, 0xa8, 0x72, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47,
+	0xb3, 0x68, 0x30, 0x00, 0x98, 0x47, 0x04, 0x23, 0x2b, 0x76, 0x70, 0xbd, 0xf0, 0x68, 0x45, 0xf6,
+	0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0xa5, 0x72,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x23, 0xe9, 0x5c, 0x30, 0x00,
+	0xc9, 0xb2, 0xf3, 0x68, 0x98, 0x47, 0xe6, 0xe7, 0x70, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e,
+	0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0x9a, 0x72, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x30, 0x00, 0x73, 0x68, 0x98, 0x47, 0xb4, 0xe7, 0xc0, 0x46,
+	0x40, 0xf2, 0x48, 0x13, 0x70, 0xb5, 0xc2, 0xf2, 0x00, 0x03, 0x1e, 0x68, 0x35, 0x68, 0x2c, 0x7e,
+	0xe4, 0xb2, 0x63, 0xb2, 0x00, 0x2b, 0x37, 0xdb, 0x02, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76,
+	0x01, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76, 0x63, 0x07, 0x16, 0xd5, 0x6b, 0x8b, 0x1b, 0x07,
+	0x14, 0xd5, 0xb0, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x40, 0xf2, 0xa8, 0x72, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47,
+	0xb3, 0x68, 0x30, 0x00, 0x98, 0x47, 0x04, 0x23, 0x2b, 0x76, 0x70, 0xbd, 0xf0, 0x68, 0x45, 0xf6,
+	0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0xa5, 0x72,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x23, 0xe9, 0x5c, 0x30, 0x00,
+	0xc9, 0xb2, 0xf3, 0x68, 0x98, 0x47, 0xe6, 0xe7, 0x70, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e,
+	0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0x9a, 0x72, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x30, 0x00, 0x73, 0x68, 0x98, 0x47, 0xb4, 0xe7, 0xc0, 0x46,
+	0x40, 0xf2, 0x48, 0x13, 0x70, 0xb5, 0xc2, 0xf2, 0x00, 0x03, 0x1e, 0x68, 0x35, 0x68, 0x2c, 0x7e,
+	0xe4, 0xb2, 0x63, 0xb2, 0x00, 0x2b, 0x37, 0xdb, 0x02, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76,
+	0x01, 0x23, 0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76, 0x63, 0x07, 0x16, 0xd5, 0x6b, 0x8b, 0x1b, 0x07,
+	0x14, 0xd5, 0xb0, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43,
+	0xc0, 0xb2, 0xc0, 0xf2, 0x00, 0x03, 0x40, 0xf2, 0xa8, 0x72, 0xc0, 0xf2, 0x00, 0x01, 0x98, 0x47,
+	0xb3, 0x68, 0x30, 0x00, 0x98, 0x47, 0x04, 0x23, 0x2b, 0x76, 0x70, 0xbd, 0xf0, 0x68, 0x45, 0xf6,
+	0x44, 0x31, 0x43, 0x1e, 0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0xa5, 0x72,
+	0xc0, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x23, 0xe9, 0x5c, 0x30, 0x00,
+	0xc9, 0xb2, 0xf3, 0x68, 0x98, 0x47, 0xe6, 0xe7, 0x70, 0x68, 0x45, 0xf6, 0x44, 0x31, 0x43, 0x1e,
+	0x98, 0x41, 0x43, 0xf2, 0xb9, 0x43, 0xc0, 0xb2, 0x40, 0xf2, 0x9a, 0x72, 0xc0, 0xf2, 0x00, 0x01,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x30, 0x00, 0x73, 0x68, 0x98, 0x47, 0xb4, 0xe7, 0xc0, 0x46,
+	0x41, 0xf2, 0x61, 0x13, 0x10, 0xb5, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x41, 0xf6, 0x0d, 0x53,
+	0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x42, 0xf2, 0x59, 0x33, 0x43, 0xf2, 0x6d, 0x14, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0xc0, 0xf2, 0x00, 0x04, 0x06, 0x20, 0xa0, 0x47, 0xfc, 0xe7, 0xc0, 0x46,
+	0xf0, 0xb5, 0x45, 0x46, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46, 0x41, 0xf6, 0x00, 0x03, 0xe0, 0xb5,
+	0xc4, 0xf2, 0x00, 0x03, 0xda, 0x69, 0x43, 0x49, 0x05, 0x00, 0x0a, 0x40, 0x80, 0x21, 0xda, 0x61,
+	0xda, 0x69, 0x83, 0xb0, 0x0a, 0x43, 0xda, 0x61, 0xda, 0x69, 0x40, 0x39, 0x8a, 0x43, 0xda, 0x61,
+	0x44, 0xf2, 0x00, 0x02, 0x3c, 0x39, 0xc4, 0xf2, 0x00, 0x12, 0x13, 0x8b, 0x19, 0x42, 0xfc, 0xd0,
+	0x46, 0xf2, 0x38, 0x03, 0x6a, 0x46, 0xc0, 0xf2, 0x80, 0x03, 0x1b, 0x88, 0x40, 0xf2, 0x0f, 0x0b,
+	0x13, 0x80, 0x46, 0xf2, 0x3a, 0x03, 0xc0, 0xf2, 0x80, 0x03, 0x1b, 0x88, 0x45, 0xf2, 0xad, 0x64,
+	0x53, 0x80, 0x46, 0xf2, 0x3c, 0x03, 0xc0, 0xf2, 0x80, 0x03, 0x1b, 0x88, 0x00, 0x9e, 0x93, 0x80,
+	0x46, 0xf2, 0x3e, 0x03, 0xc0, 0xf2, 0x80, 0x03, 0x1b, 0x88, 0x30, 0x0a, 0xd3, 0x80, 0x5b, 0x46,
+	0xc0, 0xf2, 0x00, 0x04, 0x18, 0x40, 0xa0, 0x47, 0x44, 0xf6, 0x89, 0x47, 0x00, 0x21, 0xc0, 0xf2,
+	0x00, 0x07, 0xc4, 0xf2, 0x20, 0x11, 0xb8, 0x47, 0x40, 0xf2, 0xff, 0x0a, 0x81, 0x46, 0x50, 0x46,
+	0x30, 0x40, 0xa0, 0x47, 0x44, 0xf6, 0x71, 0x18, 0x01, 0x1c, 0xc0, 0xf2, 0x00, 0x08, 0x48, 0x46,
+	0xc0, 0x47, 0x5b, 0x46, 0x81, 0x46, 0x28, 0x60, 0x30, 0x0d, 0x18, 0x40, 0xa0, 0x47, 0x00, 0x21,
+	0xc4, 0xf2, 0x20, 0x11, 0xb8, 0x47, 0x53, 0x46, 0x83, 0x46, 0x30, 0x0b, 0x03, 0x40, 0x18, 0x00,
+	0xa0, 0x47, 0x36, 0x0e, 0x01, 0x1c, 0x58, 0x46, 0xc0, 0x47, 0x2e, 0x73, 0x45, 0xf2, 0xb1, 0x26,
+	0x01, 0x9b, 0x49, 0x46, 0x1a, 0x03, 0x12, 0x0d, 0x6b, 0x73, 0x1b, 0x0d, 0x2a, 0x81, 0x6b, 0x81,
+	0xc0, 0xf2, 0x00, 0x06, 0x68, 0x60, 0x98, 0x46, 0x92, 0x46, 0xb0, 0x47, 0x81, 0x46, 0x40, 0x46,
+	0xa0, 0x47, 0x80, 0x46, 0x50, 0x46, 0xa0, 0x47, 0x01, 0x1c, 0x40, 0x46, 0xb0, 0x47, 0x01, 0x1c,
+	0x48, 0x46, 0xb8, 0x47, 0x28, 0x61, 0x03, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46,
+	0xab, 0x46, 0xf0, 0xbd, 0xff, 0xff, 0xf0, 0xff, 0xf8, 0xb5, 0x40, 0xf2, 0x14, 0x05, 0x44, 0xf6,
+	0x21, 0x13, 0x00, 0x21, 0xc2, 0xf2, 0x00, 0x05, 0x2e, 0x68, 0x04, 0x1c, 0xc0, 0xf2, 0x00, 0x03,
+	0xcc, 0xf2, 0xc8, 0x31, 0x30, 0x1c, 0x98, 0x47, 0x03, 0x00, 0x20, 0x1c, 0xab, 0xb9, 0x45, 0xf2,
+	0x59, 0x04, 0x4c, 0xf6, 0xcd, 0x41, 0xc0, 0xf2, 0x00, 0x04, 0xc3, 0xf6, 0x4c, 0x51, 0xa0, 0x47,
+	0x43, 0xf2, 0x33, 0x31, 0x07, 0x1c, 0xc3, 0xf6, 0x73, 0x71, 0x30, 0x1c, 0xa0, 0x47, 0x44, 0xf6,
+	0x71, 0x13, 0x39, 0x1c, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x28, 0x60, 0xf8, 0xbd, 0xc0, 0x46,
+	0xc0, 0x23, 0x48, 0xf2, 0x00, 0x02, 0xdb, 0x05, 0x9a, 0x61, 0x70, 0x47, 0x40, 0xf2, 0x4c, 0x11,
+	0x43, 0xf2, 0xfd, 0x03, 0x10, 0xb5, 0xc2, 0xf2, 0x00, 0x01, 0x08, 0x6c, 0x03, 0x22, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x10, 0xbd, 0xc0, 0x46, 0x40, 0xf2, 0xb4, 0x20, 0x43, 0xf2, 0xcd, 0x03,
+	0x70, 0xb5, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x02, 0x28, 0x00, 0xdc,
+	0x70, 0xbd, 0x40, 0xf2, 0x4c, 0x14, 0xc2, 0xf2, 0x00, 0x04, 0x25, 0x00, 0x43, 0xf2, 0x35, 0x13,
+	0x44, 0x35, 0x03, 0x22, 0xc0, 0xf2, 0x00, 0x03, 0x29, 0x00, 0x20, 0x6c, 0x98, 0x47, 0x40, 0xf2,
+	0xcc, 0x13, 0xc2, 0xf2, 0x00, 0x03, 0x5a, 0x6a, 0x08, 0x2a, 0xe9, 0xd0, 0xd8, 0x69, 0x1a, 0x1d,
+	0x41, 0x00, 0x09, 0x18, 0x52, 0x18, 0x44, 0x21, 0x61, 0x5c, 0x11, 0x70, 0x69, 0x78, 0x51, 0x70,
+	0xa9, 0x78, 0x91, 0x70, 0xda, 0x69, 0x51, 0x1c, 0x07, 0x22, 0x0a, 0x40, 0xda, 0x61, 0x5a, 0x6a,
+	0x01, 0x32, 0x5a, 0x62, 0xd4, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x40, 0xf2,
+	0xcc, 0x14, 0x42, 0xf6, 0x65, 0x46, 0x42, 0xf6, 0x75, 0x45, 0x80, 0xb5, 0xc2, 0xf2, 0x00, 0x04,
+	0x23, 0x1d, 0x83, 0xb0, 0xc0, 0xf2, 0x00, 0x06, 0xc0, 0xf2, 0x00, 0x05, 0x98, 0x46, 0x40, 0xf2,
+	0x07, 0x09, 0x15, 0xe0, 0x6f, 0x46, 0x23, 0x6a, 0x01, 0x39, 0x5a, 0x00, 0xd2, 0x18, 0x42, 0x44,
+	0x10, 0x78, 0x01, 0x33, 0x38, 0x70, 0x50, 0x78, 0x92, 0x78, 0x78, 0x70, 0xba, 0x70, 0x4a, 0x46,
+	0x01, 0xa8, 0x13, 0x40, 0x23, 0x62, 0x61, 0x62, 0xa8, 0x47, 0x68, 0x46, 0xa3, 0x6a, 0x98, 0x47,
+	0x01, 0xa8, 0xb0, 0x47, 0x61, 0x6a, 0x00, 0x29, 0xe4, 0xd1, 0x01, 0xa8, 0xa8, 0x47, 0x03, 0xb0,
+	0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd, 0x10, 0xb5, 0x45, 0xf2, 0xc5, 0x73, 0x14, 0x00,
+	0x0a, 0x00, 0x01, 0x00, 0x40, 0xf2, 0x4c, 0x10, 0x82, 0xb0, 0xc0, 0xf2, 0x00, 0x03, 0xc2, 0xf2,
+	0x00, 0x00, 0x98, 0x47, 0x42, 0xf6, 0x65, 0x43, 0x01, 0xa8, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47,
+	0x40, 0xf2, 0xb4, 0x23, 0x44, 0x22, 0xc2, 0xf2, 0x00, 0x03, 0x9a, 0x5a, 0x0a, 0xb1, 0x00, 0x22,
+	0x5a, 0x64, 0x42, 0xf6, 0x75, 0x43, 0x01, 0xa8, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x24, 0xb1,
+	0xc0, 0x23, 0x48, 0xf2, 0x00, 0x02, 0xdb, 0x05, 0x9a, 0x61, 0xc0, 0x23, 0x48, 0xf2, 0x00, 0x02,
+	0xdb, 0x05, 0x5a, 0x61, 0x02, 0xb0, 0x10, 0xbd, 0x40, 0xf2, 0xcc, 0x12, 0xc0, 0x23, 0x48, 0xf2,
+	0x00, 0x01, 0xdb, 0x05, 0xc2, 0xf2, 0x00, 0x02, 0xf0, 0xb5, 0x90, 0x62, 0x43, 0xf2, 0x00, 0x04,
+	0x99, 0x61, 0x99, 0x60, 0x48, 0xf2, 0x00, 0x03, 0xc4, 0xf2, 0x00, 0x04, 0xc4, 0xf2, 0x00, 0x03,
+	0xa3, 0x62, 0xc0, 0x23, 0x4f, 0x21, 0x01, 0x25, 0x1b, 0x06, 0xa3, 0x62, 0x63, 0x5c, 0x42, 0x20,
+	0xab, 0x43, 0x63, 0x54, 0x41, 0xf6, 0x00, 0x43, 0x5d, 0x31, 0xc4, 0xf2, 0x00, 0x03, 0x58, 0x50,
+	0x01, 0x30, 0x04, 0x39, 0x58, 0x50, 0x40, 0xf6, 0x00, 0x03, 0xc4, 0xf2, 0x00, 0x03, 0xd9, 0x69,
+	0x41, 0x38, 0x01, 0x43, 0xd9, 0x61, 0x40, 0xf2, 0xb4, 0x20, 0x40, 0xf2, 0x00, 0x41, 0x42, 0xf6,
+	0x11, 0x76, 0x83, 0xb0, 0x2c, 0x32, 0x40, 0x23, 0xc4, 0xf2, 0x00, 0x21, 0xc0, 0xf2, 0x00, 0x06,
+	0xc2, 0xf2, 0x00, 0x00, 0xb0, 0x47, 0x50, 0x21, 0x04, 0x23, 0x01, 0x26, 0x62, 0x5c, 0x38, 0x20,
+	0x9a, 0x43, 0x62, 0x54, 0x62, 0x5c, 0x03, 0x27, 0xaa, 0x43, 0x32, 0x43, 0xd2, 0xb2, 0x62, 0x54,
+	0x0f, 0x22, 0x21, 0x5c, 0x91, 0x43, 0x39, 0x43, 0x21, 0x54, 0x51, 0x21, 0x67, 0x5c, 0x9f, 0x43,
+	0x67, 0x54, 0x63, 0x5c, 0xab, 0x43, 0x33, 0x43, 0xdb, 0xb2, 0x63, 0x54, 0x23, 0x5c, 0x40, 0xf2,
+	0x4c, 0x11, 0x1a, 0x40, 0x30, 0x23, 0x1a, 0x43, 0x22, 0x54, 0x43, 0xf2, 0x9d, 0x03, 0x40, 0xf2,
+	0xb4, 0x20, 0xc2, 0xf2, 0x00, 0x01, 0xc0, 0xf2, 0x00, 0x03, 0x40, 0x31, 0xc2, 0xf2, 0x00, 0x00,
+	0x98, 0x47, 0x43, 0xf2, 0x4d, 0x04, 0x44, 0xf2, 0xf9, 0x52, 0x40, 0xf2, 0xb4, 0x20, 0xc0, 0xf2,
+	0x00, 0x04, 0xc0, 0xf2, 0x00, 0x02, 0x03, 0x21, 0xc2, 0xf2, 0x00, 0x00, 0xa0, 0x47, 0x44, 0xf2,
+	0xd1, 0x52, 0x40, 0xf2, 0xb4, 0x20, 0xc0, 0xf2, 0x00, 0x02, 0x02, 0x21, 0xc2, 0xf2, 0x00, 0x00,
+	0xa0, 0x47, 0x44, 0xf2, 0xdd, 0x52, 0x40, 0xf2, 0xb4, 0x20, 0xc0, 0xf2, 0x00, 0x02, 0x01, 0x21,
+	0xc2, 0xf2, 0x00, 0x00, 0xa0, 0x47, 0x6b, 0x46, 0xd8, 0x1d, 0x42, 0xf2, 0xed, 0x63, 0xc0, 0xf2,
+	0x00, 0x03, 0x98, 0x47, 0x50, 0xb9, 0x6b, 0x46, 0x40, 0xf2, 0xb4, 0x20, 0xd9, 0x79, 0x42, 0xf6,
+	0xfd, 0x73, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x40, 0xf2, 0xb4, 0x20,
+	0x42, 0xf6, 0xa9, 0x73, 0xc2, 0xf2, 0x00, 0x00, 0xc0, 0xf2, 0x00, 0x03, 0x98, 0x47, 0x00, 0x20,
+	0x03, 0xb0, 0xf0, 0xbd, 0xff, 0x22, 0x43, 0x00, 0x5b, 0x08, 0x01, 0x20, 0xd2, 0x05, 0x93, 0x42,
+	0x00, 0xdc, 0x00, 0x20, 0x70, 0x47, 0xc0, 0x46, 0x42, 0x00, 0x12, 0x0e, 0x11, 0x00, 0x10, 0xb5,
+	0x01, 0x24, 0xc3, 0x17, 0x7f, 0x39, 0x23, 0x43, 0x1e, 0x29, 0x0e, 0xdc, 0x00, 0x29, 0x18, 0xdb,
+	0x80, 0x24, 0x40, 0x02, 0x40, 0x0a, 0x24, 0x04, 0x04, 0x43, 0x16, 0x29, 0x09, 0xdd, 0x20, 0x00,
+	0x96, 0x3a, 0x90, 0x40, 0x43, 0x43, 0x18, 0x00, 0x10, 0xbd, 0x00, 0xf0, 0x79, 0xfe, 0x03, 0x00,
+	0xf9, 0xe7, 0x80, 0x20, 0xc0, 0x03, 0x08, 0x41, 0x17, 0x22, 0x00, 0x19, 0x51, 0x1a, 0xc8, 0x40,
+	0xf0, 0xe7, 0x4a, 0x1c, 0xef, 0xd0, 0x00, 0x23, 0xed, 0xe7, 0xc0, 0x46, 0x84, 0x46, 0x08, 0x1c,
+	0x61, 0x46, 0xff, 0xe7, 0x1f, 0xb5, 0x00, 0xf0, 0x69, 0xfb, 0x00, 0x28, 0x01, 0xd4, 0x00, 0x21,
+	0xc8, 0x42, 0x1f, 0xbd, 0x10, 0xb5, 0x00, 0xf0, 0x01, 0xfb, 0x40, 0x42, 0x01, 0x30, 0x10, 0xbd,
+	0x10, 0xb5, 0x00, 0xf0, 0x5b, 0xfb, 0x00, 0x28, 0x01, 0xdb, 0x00, 0x20, 0x10, 0xbd, 0x01, 0x20,
+	0x10, 0xbd, 0xc0, 0x46, 0x10, 0xb5, 0x00, 0xf0, 0x51, 0xfb, 0x00, 0x28, 0x01, 0xdd, 0x00, 0x20,
+	0x10, 0xbd, 0x01, 0x20, 0x10, 0xbd, 0xc0, 0x46, 0x10, 0xb5, 0x00, 0xf0, 0x0d, 0xfb, 0x00, 0x28,
+	0x01, 0xdc, 0x00, 0x20, 0x10, 0xbd, 0x01, 0x20, 0x10, 0xbd, 0xc0, 0x46, 0x10, 0xb5, 0x00, 0xf0,
+	0x03, 0xfb, 0x00, 0x28, 0x01, 0xda, 0x00, 0x20, 0x10, 0xbd, 0x01, 0x20, 0x10, 0xbd, 0xc0, 0x46,
+	0xf0, 0xb5, 0xc6, 0x46, 0x4e, 0x02, 0x47, 0x02, 0x76, 0x0a, 0x7b, 0x0a, 0x44, 0x00, 0xc5, 0x0f,
+	0xf7, 0x00, 0x48, 0x00, 0x98, 0x46, 0x00, 0xb5, 0x24, 0x0e, 0x2a, 0x00, 0xdb, 0x00, 0x00, 0x0e,
+	0xc9, 0x0f, 0xbc, 0x46, 0x8d, 0x42, 0x67, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xdc, 0xa5, 0xe0,
+	0x00, 0x28, 0x3a, 0xd1, 0x00, 0x2f, 0x00, 0xd1, 0x93, 0xe0, 0x51, 0x1e, 0x00, 0x29, 0x00, 0xd0,
+	0xbb, 0xe0, 0x01, 0x24, 0xdb, 0x1b, 0x5a, 0x01, 0x46, 0xd5, 0x9b, 0x01, 0x9e, 0x09, 0x30, 0x00,
+	0x00, 0xf0, 0xba, 0xfe, 0x05, 0x38, 0x86, 0x40, 0x84, 0x42, 0x00, 0xdd, 0x9c, 0xe0, 0x04, 0x1b,
+	0x32, 0x00, 0x20, 0x20, 0x01, 0x34, 0xe2, 0x40, 0x04, 0x1b, 0xa6, 0x40, 0x33, 0x00, 0x5e, 0x1e,
+	0xb3, 0x41, 0x00, 0x24, 0x13, 0x43, 0x5a, 0x07, 0x04, 0xd0, 0x0f, 0x22, 0x1a, 0x40, 0x04, 0x2a,
+	0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0x29, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x80, 0xe0,
+	0x2a, 0x00, 0x9b, 0x01, 0x5b, 0x0a, 0xe4, 0xb2, 0x5b, 0x02, 0xe4, 0x05, 0x58, 0x0a, 0xd2, 0x07,
+	0x20, 0x43, 0x10, 0x43, 0x04, 0xbc, 0x90, 0x46, 0xf0, 0xbd, 0xff, 0x2c, 0xe3, 0xd0, 0x80, 0x21,
+	0x38, 0x00, 0xc9, 0x04, 0x08, 0x43, 0x84, 0x46, 0x1b, 0x2a, 0x00, 0xdd, 0x81, 0xe0, 0x20, 0x20,
+	0x61, 0x46, 0xd1, 0x40, 0x82, 0x1a, 0x60, 0x46, 0x90, 0x40, 0x02, 0x00, 0x50, 0x1e, 0x82, 0x41,
+	0x0a, 0x43, 0x9b, 0x1a, 0x5a, 0x01, 0xb8, 0xd4, 0x5a, 0x07, 0xce, 0xd1, 0xde, 0x08, 0x2a, 0x00,
+	0xff, 0x2c, 0x3a, 0xd1, 0x00, 0x2e, 0x00, 0xd1, 0xac, 0xe0, 0x80, 0x23, 0xdb, 0x03, 0x33, 0x43,
+	0x5b, 0x02, 0x5b, 0x0a, 0xff, 0x24, 0xcf, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x51, 0xdd, 0x90, 0xb3,
+	0xff, 0x2c, 0xb8, 0xd0, 0x80, 0x20, 0x3e, 0x00, 0xc0, 0x04, 0x06, 0x43, 0xb4, 0x46, 0x1b, 0x29,
+	0x00, 0xdd, 0xa9, 0xe0, 0x20, 0x26, 0x60, 0x46, 0xc8, 0x40, 0x71, 0x1a, 0x66, 0x46, 0x8e, 0x40,
+	0x31, 0x00, 0x4e, 0x1e, 0xb1, 0x41, 0x01, 0x43, 0x5b, 0x18, 0x59, 0x01, 0xd4, 0xd5, 0x01, 0x34,
+	0xff, 0x2c, 0x00, 0xd1, 0x86, 0xe0, 0x01, 0x22, 0x75, 0x49, 0x1a, 0x40, 0x5b, 0x08, 0x0b, 0x40,
+	0x13, 0x43, 0x98, 0xe7, 0x00, 0x2c, 0x00, 0xd0, 0xa3, 0xe0, 0x00, 0x2b, 0x00, 0xd0, 0xb1, 0xe0,
+	0x3b, 0x00, 0x00, 0x2f, 0x60, 0xd1, 0x00, 0x26, 0x00, 0x22, 0x73, 0x02, 0x5b, 0x0a, 0xe4, 0xb2,
+	0x9a, 0xe7, 0x14, 0x00, 0x87, 0xe7, 0x00, 0x2f, 0x4b, 0xd0, 0x48, 0x1e, 0x00, 0x28, 0x55, 0xd1,
+	0x63, 0x44, 0x01, 0x24, 0x5a, 0x01, 0xaf, 0xd5, 0x02, 0x24, 0xdc, 0xe7, 0x22, 0xbb, 0x62, 0x1c,
+	0xd2, 0xb2, 0x01, 0x2a, 0xde, 0xdd, 0xde, 0x1b, 0x72, 0x01, 0x34, 0xd5, 0xfe, 0x1a, 0x0d, 0x00,
+	0x5d, 0xe7, 0x2a, 0x00, 0x00, 0x23, 0x7f, 0xe7, 0x33, 0x00, 0x5e, 0x4a, 0x24, 0x1a, 0x13, 0x40,
+	0x69, 0xe7, 0x00, 0x29, 0x62, 0xd1, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4d, 0xdd, 0xff, 0x29,
+	0x48, 0xd0, 0x63, 0x44, 0x5b, 0x08, 0x0c, 0x00, 0x5d, 0xe7, 0xff, 0x2a, 0x40, 0xd0, 0x0a, 0x00,
+	0x7a, 0xe7, 0x01, 0x22, 0x9b, 0x1a, 0x85, 0xe7, 0xec, 0xb1, 0xff, 0x28, 0x22, 0xd0, 0x80, 0x24,
+	0xe4, 0x04, 0x52, 0x42, 0x23, 0x43, 0x1b, 0x2a, 0x00, 0xdd, 0x86, 0xe0, 0x1c, 0x00, 0x20, 0x25,
+	0xd4, 0x40, 0xaa, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0x93, 0x41, 0x23, 0x43, 0x62, 0x46, 0x04, 0x00,
+	0xd3, 0x1a, 0x0d, 0x00, 0x27, 0xe7, 0x00, 0x2e, 0x00, 0xd0, 0x28, 0xe7, 0x00, 0x22, 0x00, 0x24,
+	0xab, 0xe7, 0x0c, 0x00, 0x37, 0xe7, 0x00, 0x2b, 0x49, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xed, 0xd0,
+	0xff, 0x28, 0xe0, 0xd1, 0x63, 0x46, 0xff, 0x24, 0x0d, 0x00, 0x2c, 0xe7, 0xff, 0x29, 0x0f, 0xd0,
+	0x01, 0x00, 0x74, 0xe7, 0x00, 0x2b, 0x5d, 0xd0, 0xff, 0x24, 0x00, 0x2f, 0x00, 0xd1, 0x22, 0xe7,
+	0x80, 0x22, 0x41, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x02, 0xd0, 0x16, 0x42, 0x00, 0xd1, 0x3b, 0x00,
+	0xff, 0x24, 0x18, 0xe7, 0xff, 0x24, 0x00, 0x23, 0x26, 0xe7, 0x00, 0x2c, 0xea, 0xd1, 0x00, 0x2b,
+	0x54, 0xd0, 0x00, 0x2f, 0x00, 0xd1, 0x0e, 0xe7, 0x63, 0x44, 0x5a, 0x01, 0x00, 0xd4, 0x3b, 0xe7,
+	0x2c, 0x4a, 0x0c, 0x00, 0x13, 0x40, 0x06, 0xe7, 0x01, 0x21, 0x5d, 0xe7, 0xdc, 0xb9, 0xf3, 0xb3,
+	0xc9, 0x43, 0x59, 0xb1, 0xff, 0x28, 0x35, 0xd0, 0x1b, 0x29, 0x47, 0xdc, 0x1c, 0x00, 0x20, 0x26,
+	0xcc, 0x40, 0x71, 0x1a, 0x8b, 0x40, 0x59, 0x1e, 0x8b, 0x41, 0x23, 0x43, 0x63, 0x44, 0x04, 0x00,
+	0x4b, 0xe7, 0xc3, 0xb9, 0x3b, 0x00, 0x6f, 0xb3, 0x0d, 0x00, 0xff, 0x24, 0xeb, 0xe6, 0x3b, 0x00,
+	0x04, 0x00, 0x0d, 0x00, 0xe7, 0xe6, 0xff, 0x28, 0x1c, 0xd0, 0x80, 0x24, 0xe4, 0x04, 0x49, 0x42,
+	0x23, 0x43, 0xe1, 0xe7, 0x00, 0x2f, 0x00, 0xd1, 0xdd, 0xe6, 0xde, 0x1b, 0x72, 0x01, 0x1f, 0xd5,
+	0xfb, 0x1a, 0x0d, 0x00, 0xd7, 0xe6, 0xff, 0x24, 0x00, 0x2f, 0x00, 0xd1, 0xd3, 0xe6, 0x80, 0x22,
+	0x40, 0x46, 0xd2, 0x03, 0x10, 0x42, 0xb3, 0xd0, 0x16, 0x42, 0xb1, 0xd1, 0x3b, 0x00, 0x0d, 0x00,
+	0xff, 0x24, 0xc8, 0xe6, 0x63, 0x46, 0xff, 0x24, 0xc5, 0xe6, 0x01, 0x23, 0x7e, 0xe7, 0x3b, 0x00,
+	0x04, 0x00, 0xc0, 0xe6, 0x80, 0x26, 0x00, 0x22, 0xf6, 0x03, 0xf6, 0xe6, 0x3b, 0x00, 0xba, 0xe6,
+	0x33, 0x00, 0x00, 0x2e, 0x00, 0xd0, 0xe7, 0xe6, 0x00, 0x22, 0x26, 0xe7, 0x01, 0x23, 0xbd, 0xe7,
+	0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0xde, 0x46,
+	0x45, 0x46, 0xe0, 0xb5, 0x43, 0x00, 0x44, 0x02, 0xc6, 0x0f, 0x1b, 0x0e, 0x83, 0xb0, 0x0f, 0x1c,
+	0x64, 0x0a, 0xb2, 0x46, 0x00, 0x2b, 0x54, 0xd0, 0xff, 0x2b, 0x28, 0xd0, 0x80, 0x22, 0xe4, 0x00,
+	0xd2, 0x04, 0x14, 0x43, 0x7f, 0x22, 0x52, 0x42, 0x90, 0x46, 0x40, 0xf2, 0x00, 0x09, 0x40, 0xf2,
+	0x00, 0x0b, 0x98, 0x44, 0x78, 0x00, 0x7d, 0x02, 0xfb, 0x0f, 0x00, 0x0e, 0x6d, 0x0a, 0x00, 0x93,
+	0x28, 0xb3, 0xff, 0x28, 0x45, 0xd0, 0x80, 0x23, 0x00, 0x21, 0xed, 0x00, 0xdb, 0x04, 0x1d, 0x43,
+	0x7f, 0x38, 0x47, 0x46, 0x38, 0x1a, 0x4f, 0x46, 0x0f, 0x43, 0xbf, 0x00, 0xb9, 0x46, 0x33, 0x00,
+	0x00, 0x9a, 0x87, 0x4f, 0x53, 0x40, 0x4a, 0x46, 0xba, 0x58, 0x01, 0x93, 0x97, 0x46, 0x00, 0x2c,
+	0x4d, 0xd1, 0x78, 0x00, 0x7d, 0x02, 0xfb, 0x0f, 0x00, 0x0e, 0x40, 0xf2, 0x08, 0x09, 0x40, 0xf2,
+	0xff, 0x08, 0x40, 0xf2, 0x02, 0x0b, 0x6d, 0x0a, 0x00, 0x93, 0x00, 0x28, 0xd9, 0xd1, 0x25, 0xbb,
+	0x00, 0x20, 0x01, 0x21, 0x33, 0x00, 0x00, 0x9a, 0x7a, 0x4f, 0x53, 0x40, 0x42, 0x46, 0x10, 0x1a,
+	0x4a, 0x46, 0x0a, 0x43, 0x92, 0x00, 0xba, 0x58, 0x1d, 0x00, 0x97, 0x46, 0x00, 0x9b, 0x2c, 0x00,
+	0x9a, 0x46, 0x8b, 0x46, 0x5b, 0x46, 0x02, 0x2b, 0x30, 0xd1, 0x53, 0x46, 0xff, 0x21, 0x00, 0x24,
+	0x37, 0xe0, 0xb4, 0xb9, 0x40, 0xf2, 0x04, 0x09, 0x40, 0xf2, 0x00, 0x08, 0x40, 0xf2, 0x01, 0x0b,
+	0xb0, 0xe7, 0xff, 0x20, 0x5d, 0xb9, 0x02, 0x21, 0xdc, 0xe7, 0x28, 0x00, 0x00, 0xf0, 0xe4, 0xfc,
+	0x43, 0x1f, 0x9d, 0x40, 0x76, 0x23, 0x5b, 0x42, 0x18, 0x1a, 0x00, 0x21, 0xb1, 0xe7, 0x03, 0x21,
+	0xaf, 0xe7, 0x20, 0x00, 0x00, 0xf0, 0xd8, 0xfc, 0x43, 0x1f, 0x9c, 0x40, 0x76, 0x23, 0x5b, 0x42,
+	0x1b, 0x1a, 0x98, 0x46, 0x40, 0xf2, 0x00, 0x09, 0x40, 0xf2, 0x00, 0x0b, 0x92, 0xe7, 0x40, 0xf2,
+	0x0c, 0x09, 0x40, 0xf2, 0xff, 0x08, 0x40, 0xf2, 0x03, 0x0b, 0x8b, 0xe7, 0x03, 0x2b, 0x00, 0xd1,
+	0xa5, 0xe0, 0x55, 0x46, 0x01, 0x2b, 0x00, 0xd0, 0x81, 0xe0, 0x01, 0x23, 0x00, 0x21, 0x00, 0x24,
+	0x2b, 0x40, 0x64, 0x02, 0xc9, 0x05, 0x60, 0x0a, 0xdb, 0x07, 0x08, 0x43, 0x18, 0x43, 0x03, 0xb0,
+	0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbd, 0x80, 0x24, 0x00, 0x23,
+	0xe4, 0x03, 0xff, 0x21, 0xed, 0xe7, 0xff, 0x21, 0x00, 0x24, 0xea, 0xe7, 0x01, 0x23, 0x59, 0x1a,
+	0x1b, 0x29, 0x66, 0xdd, 0x01, 0x9a, 0x13, 0x40, 0x00, 0x21, 0x00, 0x24, 0xe1, 0xe7, 0x80, 0x23,
+	0xdb, 0x03, 0x1c, 0x42, 0x38, 0xd0, 0x1d, 0x42, 0x51, 0xd0, 0x1c, 0x43, 0x64, 0x02, 0x64, 0x0a,
+	0x33, 0x00, 0xff, 0x21, 0xd5, 0xe7, 0x63, 0x01, 0x6c, 0x01, 0xa3, 0x42, 0x3b, 0xd2, 0x1b, 0x26,
+	0x00, 0x21, 0x01, 0x38, 0x01, 0x25, 0x1f, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x00, 0x2f, 0x01, 0xdb,
+	0x9c, 0x42, 0x01, 0xd8, 0x1b, 0x1b, 0x29, 0x43, 0x01, 0x3e, 0x00, 0x2e, 0xf3, 0xd1, 0x1c, 0x00,
+	0x63, 0x1e, 0x9c, 0x41, 0x0c, 0x43, 0x01, 0x00, 0x7f, 0x31, 0x00, 0x29, 0xce, 0xdd, 0x63, 0x07,
+	0x04, 0xd0, 0x0f, 0x23, 0x23, 0x40, 0x04, 0x2b, 0x00, 0xd0, 0x04, 0x34, 0x23, 0x01, 0x03, 0xd5,
+	0x01, 0x00, 0x2d, 0x4b, 0x80, 0x31, 0x1c, 0x40, 0xfe, 0x29, 0x0d, 0xdd, 0x01, 0x23, 0x01, 0x9a,
+	0xff, 0x21, 0x13, 0x40, 0x00, 0x24, 0xa4, 0xe7, 0x80, 0x23, 0xdb, 0x03, 0x1c, 0x43, 0x64, 0x02,
+	0x64, 0x0a, 0x33, 0x00, 0xff, 0x21, 0x9c, 0xe7, 0x01, 0x23, 0x01, 0x9a, 0xa4, 0x01, 0x64, 0x0a,
+	0xc9, 0xb2, 0x13, 0x40, 0x95, 0xe7, 0x1b, 0x1b, 0x1a, 0x26, 0x01, 0x21, 0xc2, 0xe7, 0x00, 0x9b,
+	0x8b, 0x46, 0x9a, 0x46, 0x00, 0x24, 0x4d, 0xe7, 0x63, 0x02, 0xe5, 0xd5, 0x00, 0x25, 0x80, 0x24,
+	0xe4, 0x03, 0x2c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x00, 0x9b, 0xff, 0x21, 0x81, 0xe7, 0x01, 0x95,
+	0xc1, 0xe7, 0x23, 0x00, 0x20, 0x20, 0xcb, 0x40, 0x41, 0x1a, 0x8c, 0x40, 0x61, 0x1e, 0x8c, 0x41,
+	0x1c, 0x43, 0x63, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0x23, 0x40, 0x04, 0x2b, 0x00, 0xd0, 0x04, 0x34,
+	0x63, 0x01, 0x05, 0xd5, 0x01, 0x23, 0x01, 0x9a, 0x01, 0x21, 0x13, 0x40, 0x00, 0x24, 0x68, 0xe7,
+	0x01, 0x23, 0x01, 0x9a, 0xa4, 0x01, 0x64, 0x0a, 0x13, 0x40, 0x00, 0x21, 0x61, 0xe7, 0x80, 0x23,
+	0xdb, 0x03, 0x1c, 0x43, 0x64, 0x02, 0x64, 0x0a, 0x53, 0x46, 0xff, 0x21, 0x59, 0xe7, 0xc0, 0x46,
+	0x60, 0x5b, 0x00, 0x00, 0xa0, 0x5b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 0x70, 0xb5, 0x42, 0x00,
+	0x45, 0x02, 0x4e, 0x02, 0x4c, 0x00, 0xc3, 0x0f, 0x6d, 0x0a, 0x12, 0x0e, 0x76, 0x0a, 0x24, 0x0e,
+	0xc9, 0x0f, 0x01, 0x20, 0xff, 0x2a, 0x06, 0xd0, 0xff, 0x2c, 0x03, 0xd0, 0xa2, 0x42, 0x01, 0xd1,
+	0xb5, 0x42, 0x06, 0xd0, 0x70, 0xbd, 0x00, 0x2d, 0xfc, 0xd1, 0xff, 0x2c, 0xfa, 0xd1, 0x00, 0x2e,
+	0xf8, 0xd1, 0x8b, 0x42, 0x06, 0xd0, 0x01, 0x20, 0x00, 0x2a, 0xf3, 0xd1, 0x28, 0x00, 0x45, 0x1e,
+	0xa8, 0x41, 0xef, 0xe7, 0x00, 0x20, 0xed, 0xe7, 0xf0, 0xb5, 0x42, 0x00, 0x45, 0x02, 0x4c, 0x02,
+	0xc3, 0x0f, 0x48, 0x00, 0x6d, 0x0a, 0x12, 0x0e, 0x64, 0x0a, 0x00, 0x0e, 0xc9, 0x0f, 0xff, 0x2a,
+	0x1d, 0xd0, 0xff, 0x28, 0x10, 0xd0, 0x3a, 0xb9, 0x6e, 0x42, 0x6e, 0x41, 0xf6, 0xb2, 0x80, 0xb9,
+	0x7c, 0xb9, 0x00, 0x20, 0x3d, 0xb1, 0x03, 0xe0, 0x00, 0xb9, 0x0c, 0xb1, 0x8b, 0x42, 0x11, 0xd0,
+	0x01, 0x21, 0x58, 0x42, 0x08, 0x43, 0xf0, 0xbd, 0x00, 0x2c, 0xec, 0xd0, 0x02, 0x20, 0x40, 0x42,
+	0xf9, 0xe7, 0x00, 0x2e, 0xf2, 0xd0, 0x01, 0x20, 0x01, 0x39, 0x08, 0x43, 0xf3, 0xe7, 0x00, 0x2d,
+	0xdf, 0xd0, 0xf3, 0xe7, 0x82, 0x42, 0xeb, 0xdc, 0x04, 0xdb, 0xa5, 0x42, 0xe8, 0xd8, 0x00, 0x20,
+	0xa5, 0x42, 0xe8, 0xd2, 0x01, 0x21, 0x58, 0x1e, 0x08, 0x43, 0xe4, 0xe7, 0xf0, 0xb5, 0x42, 0x00,
+	0x4d, 0x02, 0x4c, 0x00, 0x46, 0x02, 0x76, 0x0a, 0x12, 0x0e, 0xc3, 0x0f, 0x6d, 0x0a, 0x24, 0x0e,
+	0xc9, 0x0f, 0xff, 0x2a, 0x16, 0xd0, 0xff, 0x2c, 0x10, 0xd0, 0x42, 0xb9, 0x70, 0x42, 0x70, 0x41,
+	0xc0, 0xb2, 0x9c, 0xb1, 0x20, 0xb1, 0x01, 0x20, 0x01, 0x39, 0x08, 0x43, 0xf0, 0xbd, 0x9c, 0xb1,
+	0x99, 0x42, 0x14, 0xd0, 0x01, 0x20, 0x5b, 0x42, 0x18, 0x43, 0xf7, 0xe7, 0x02, 0x20, 0x00, 0x2d,
+	0xf4, 0xd1, 0xea, 0xe7, 0x02, 0x20, 0x00, 0x2e, 0xf0, 0xd1, 0xe4, 0xe7, 0x00, 0x2d, 0xe9, 0xd1,
+	0x00, 0x20, 0x00, 0x2e, 0xea, 0xd0, 0xed, 0xe7, 0x00, 0x2d, 0xe9, 0xd1, 0xea, 0xe7, 0xa2, 0x42,
+	0x06, 0xdc, 0xe0, 0xdb, 0xae, 0x42, 0x03, 0xd8, 0x00, 0x20, 0xae, 0x42, 0xdb, 0xd3, 0xdd, 0xe7,
+	0x01, 0x20, 0x49, 0x42, 0x08, 0x43, 0xd9, 0xe7, 0xf0, 0xb5, 0x46, 0x46, 0x4f, 0x46, 0xd6, 0x46,
+	0x43, 0x02, 0xc0, 0xb5, 0x46, 0x00, 0x5b, 0x0a, 0x36, 0x0e, 0x88, 0x46, 0x99, 0x46, 0xc4, 0x0f,
+	0x00, 0x2e, 0x51, 0xd0, 0xff, 0x2e, 0x23, 0xd0, 0x80, 0x20, 0xdb, 0x00, 0xc0, 0x04, 0x18, 0x43,
+	0x81, 0x46, 0x00, 0x27, 0x40, 0xf2, 0x00, 0x0a, 0x7f, 0x3e, 0x43, 0x46, 0x58, 0x00, 0x5d, 0x02,
+	0x00, 0x0e, 0xdb, 0x0f, 0x6d, 0x0a, 0x98, 0x46, 0x08, 0xb3, 0xff, 0x28, 0x42, 0xd0, 0xeb, 0x00,
+	0x80, 0x25, 0xed, 0x04, 0x1d, 0x43, 0x00, 0x23, 0x7f, 0x38, 0x41, 0x46, 0x36, 0x18, 0x61, 0x40,
+	0x70, 0x1c, 0x1f, 0x43, 0x0f, 0x2f, 0x69, 0xd8, 0x7b, 0x4a, 0xbf, 0x00, 0xd2, 0x59, 0x97, 0x46,
+	0x00, 0x2b, 0x48, 0xd1, 0x43, 0x46, 0x58, 0x00, 0x5d, 0x02, 0x00, 0x0e, 0xdb, 0x0f, 0x08, 0x27,
+	0xff, 0x26, 0x40, 0xf2, 0x02, 0x0a, 0x6d, 0x0a, 0x98, 0x46, 0x00, 0x28, 0xdd, 0xd1, 0x00, 0x2d,
+	0x3e, 0xd1, 0x00, 0x20, 0x01, 0x23, 0xe0, 0xe7, 0x41, 0x46, 0x02, 0x2b, 0x20, 0xd0, 0x03, 0x2b,
+	0x00, 0xd1, 0xcf, 0xe0, 0x01, 0x2b, 0x00, 0xd0, 0xad, 0xe0, 0x00, 0x22, 0x00, 0x20, 0x19, 0x40,
+	0xcc, 0xb2, 0x40, 0x02, 0xd2, 0x05, 0x40, 0x0a, 0xe4, 0x07, 0x10, 0x43, 0x20, 0x43, 0x1c, 0xbc,
+	0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0x7b, 0xb9, 0x04, 0x27, 0x00, 0x26, 0x40, 0xf2,
+	0x01, 0x0a, 0xb2, 0xe7, 0xff, 0x20, 0x02, 0x23, 0x00, 0x2d, 0xbe, 0xd0, 0x03, 0x23, 0xbc, 0xe7,
+	0x01, 0x24, 0xff, 0x22, 0x0c, 0x40, 0x00, 0x20, 0xe3, 0xe7, 0x18, 0x00, 0x00, 0xf0, 0xfc, 0xfa,
+	0x4a, 0x46, 0x43, 0x1f, 0x76, 0x26, 0x9a, 0x40, 0x76, 0x42, 0x91, 0x46, 0x36, 0x1a, 0x00, 0x27,
+	0x40, 0xf2, 0x00, 0x0a, 0x99, 0xe7, 0x0c, 0x27, 0xff, 0x26, 0x40, 0xf2, 0x03, 0x0a, 0x94, 0xe7,
+	0x28, 0x00, 0x00, 0xf0, 0xe9, 0xfa, 0x43, 0x1f, 0x9d, 0x40, 0x76, 0x23, 0x5b, 0x42, 0x18, 0x1a,
+	0x00, 0x23, 0x9a, 0xe7, 0x80, 0x20, 0x00, 0x24, 0xc0, 0x03, 0xff, 0x22, 0xc1, 0xe7, 0x4d, 0x46,
+	0x53, 0x46, 0xb2, 0xe7, 0x4d, 0x46, 0x21, 0x00, 0x53, 0x46, 0xae, 0xe7, 0x4b, 0x46, 0x1b, 0x0c,
+	0x98, 0x46, 0x4a, 0x46, 0x4f, 0xf6, 0xff, 0x73, 0x1a, 0x40, 0x2b, 0x40, 0x1c, 0x00, 0x54, 0x43,
+	0x2f, 0x0c, 0xa4, 0x46, 0x45, 0x46, 0x44, 0x46, 0x7d, 0x43, 0x57, 0x43, 0x62, 0x46, 0x63, 0x43,
+	0x12, 0x0c, 0xff, 0x18, 0xd2, 0x19, 0x93, 0x42, 0x03, 0xd9, 0x80, 0x23, 0x5b, 0x02, 0x98, 0x46,
+	0x45, 0x44, 0x67, 0x46, 0x4f, 0xf6, 0xff, 0x73, 0x14, 0x04, 0x3b, 0x40, 0xe4, 0x18, 0xa3, 0x01,
+	0x5f, 0x1e, 0xbb, 0x41, 0x12, 0x0c, 0xa4, 0x0e, 0x55, 0x19, 0x1c, 0x43, 0xad, 0x01, 0x25, 0x43,
+	0x2b, 0x01, 0x04, 0xd5, 0x01, 0x23, 0x06, 0x00, 0x6a, 0x08, 0x1d, 0x40, 0x15, 0x43, 0x32, 0x00,
+	0x7f, 0x32, 0x00, 0x2a, 0x27, 0xdd, 0x6b, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0x2b, 0x40, 0x04, 0x2b,
+	0x00, 0xd0, 0x04, 0x35, 0x2b, 0x01, 0x03, 0xd5, 0x32, 0x00, 0x28, 0x4b, 0x80, 0x32, 0x1d, 0x40,
+	0xfe, 0x2a, 0x8d, 0xdc, 0x01, 0x24, 0xa8, 0x01, 0x40, 0x0a, 0xd2, 0xb2, 0x0c, 0x40, 0x70, 0xe7,
+	0x80, 0x20, 0x4b, 0x46, 0xc0, 0x03, 0x03, 0x42, 0x08, 0xd0, 0x05, 0x42, 0x05, 0xd1, 0x28, 0x43,
+	0x40, 0x02, 0x40, 0x0a, 0x44, 0x46, 0xff, 0x22, 0x63, 0xe7, 0x4b, 0x46, 0x18, 0x43, 0x40, 0x02,
+	0x40, 0x0a, 0xff, 0x22, 0x5d, 0xe7, 0x01, 0x24, 0xa3, 0x1a, 0x1b, 0x2b, 0x05, 0xdd, 0x0c, 0x40,
+	0x00, 0x22, 0x00, 0x20, 0x55, 0xe7, 0x06, 0x00, 0xc9, 0xe7, 0x2a, 0x00, 0x20, 0x20, 0xda, 0x40,
+	0xc3, 0x1a, 0x9d, 0x40, 0x2b, 0x00, 0x5d, 0x1e, 0xab, 0x41, 0x13, 0x43, 0x5a, 0x07, 0x04, 0xd0,
+	0x0f, 0x22, 0x1a, 0x40, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0x04, 0xd5, 0x01, 0x24,
+	0x01, 0x22, 0x0c, 0x40, 0x00, 0x20, 0x3c, 0xe7, 0x01, 0x24, 0x9b, 0x01, 0x58, 0x0a, 0x0c, 0x40,
+	0x00, 0x22, 0x36, 0xe7, 0x80, 0x20, 0x01, 0x24, 0xc0, 0x03, 0x28, 0x43, 0x40, 0x02, 0x40, 0x0a,
+	0x0c, 0x40, 0xff, 0x22, 0x2d, 0xe7, 0xc0, 0x46, 0xe0, 0x5b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7,
+	0xf8, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x44, 0x00, 0xc2, 0x0f, 0x80, 0xb5, 0x47, 0x02, 0x48, 0x02,
+	0x40, 0x0a, 0x84, 0x46, 0x66, 0x46, 0x7b, 0x0a, 0x48, 0x00, 0x99, 0x46, 0x24, 0x0e, 0x15, 0x00,
+	0xdb, 0x00, 0x00, 0x0e, 0xc9, 0x0f, 0xf6, 0x00, 0xff, 0x28, 0x00, 0xd1, 0x8d, 0xe0, 0x40, 0xf2,
+	0x01, 0x08, 0x47, 0x46, 0x79, 0x40, 0x91, 0x42, 0x65, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xdc,
+	0x9c, 0xe0, 0x00, 0x28, 0x3c, 0xd1, 0x00, 0x2e, 0x00, 0xd1, 0x8a, 0xe0, 0x51, 0x1e, 0x00, 0x29,
+	0x00, 0xd0, 0xb3, 0xe0, 0x01, 0x24, 0x9b, 0x1b, 0x5a, 0x01, 0x43, 0xd5, 0x9b, 0x01, 0x9f, 0x09,
+	0x38, 0x00, 0x00, 0xf0, 0x11, 0xfa, 0x05, 0x38, 0x87, 0x40, 0x84, 0x42, 0x00, 0xdd, 0x94, 0xe0,
+	0x04, 0x1b, 0x3a, 0x00, 0x20, 0x20, 0x01, 0x34, 0xe2, 0x40, 0x04, 0x1b, 0xa7, 0x40, 0x3b, 0x00,
+	0x5f, 0x1e, 0xbb, 0x41, 0x00, 0x24, 0x13, 0x43, 0x5a, 0x07, 0x04, 0xd0, 0x0f, 0x22, 0x1a, 0x40,
+	0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0x26, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1,
+	0x77, 0xe0, 0x01, 0x22, 0x9b, 0x01, 0x5b, 0x0a, 0xe4, 0xb2, 0x2a, 0x40, 0x5b, 0x02, 0xe4, 0x05,
+	0x58, 0x0a, 0xd2, 0x07, 0x20, 0x43, 0x10, 0x43, 0x0c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xf8, 0xbd,
+	0xff, 0x2c, 0xe1, 0xd0, 0x80, 0x21, 0xc9, 0x04, 0x0e, 0x43, 0x1b, 0x2a, 0x7a, 0xdc, 0x31, 0x00,
+	0x20, 0x20, 0xd1, 0x40, 0x82, 0x1a, 0x96, 0x40, 0x72, 0x1e, 0x96, 0x41, 0x0e, 0x43, 0x9b, 0x1b,
+	0x5a, 0x01, 0xbb, 0xd4, 0x5a, 0x07, 0xd1, 0xd1, 0x01, 0x22, 0xdf, 0x08, 0x2a, 0x40, 0xff, 0x2c,
+	0x33, 0xd1, 0x00, 0x2f, 0x00, 0xd1, 0xa6, 0xe0, 0x80, 0x23, 0xdb, 0x03, 0x3b, 0x43, 0x5b, 0x02,
+	0x5b, 0x0a, 0xff, 0x24, 0xd2, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x4b, 0xdd, 0x58, 0xb3, 0xff, 0x2c,
+	0xba, 0xd0, 0x80, 0x20, 0xc0, 0x04, 0x06, 0x43, 0x1b, 0x29, 0x00, 0xdd, 0xac, 0xe0, 0x30, 0x00,
+	0x20, 0x27, 0xc8, 0x40, 0x79, 0x1a, 0x8e, 0x40, 0x71, 0x1e, 0x8e, 0x41, 0x06, 0x43, 0x9b, 0x19,
+	0x59, 0x01, 0xd7, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0x84, 0xe0, 0x01, 0x22, 0x76, 0x49,
+	0x1a, 0x40, 0x5b, 0x08, 0x0b, 0x40, 0x13, 0x43, 0x9e, 0xe7, 0x00, 0x2e, 0x00, 0xd0, 0x72, 0xe7,
+	0x6d, 0xe7, 0x3b, 0x00, 0x00, 0x2f, 0xc5, 0xd1, 0x00, 0x22, 0x7b, 0x02, 0x5b, 0x0a, 0xe4, 0xb2,
+	0xa4, 0xe7, 0x14, 0x00, 0x90, 0xe7, 0x00, 0x2e, 0x4b, 0xd0, 0x48, 0x1e, 0x00, 0x28, 0x55, 0xd1,
+	0x9b, 0x19, 0x01, 0x24, 0x5a, 0x01, 0xb5, 0xd5, 0x02, 0x24, 0xdf, 0xe7, 0x2a, 0xbb, 0x62, 0x1c,
+	0xd2, 0xb2, 0x01, 0x2a, 0x71, 0xdd, 0x9f, 0x1b, 0x7a, 0x01, 0x34, 0xd5, 0xf7, 0x1a, 0x0d, 0x00,
+	0x66, 0xe7, 0x01, 0x22, 0x00, 0x23, 0x2a, 0x40, 0x88, 0xe7, 0x3b, 0x00, 0x5f, 0x4a, 0x24, 0x1a,
+	0x13, 0x40, 0x71, 0xe7, 0x00, 0x29, 0x69, 0xd1, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4d, 0xdd,
+	0xff, 0x29, 0x48, 0xd0, 0x9b, 0x19, 0x5b, 0x08, 0x0c, 0x00, 0x65, 0xe7, 0xff, 0x2a, 0x40, 0xd0,
+	0x0a, 0x00, 0x82, 0xe7, 0x01, 0x26, 0x9b, 0x1b, 0x8a, 0xe7, 0xe4, 0xb1, 0xff, 0x28, 0x21, 0xd0,
+	0x80, 0x24, 0xe4, 0x04, 0x52, 0x42, 0x23, 0x43, 0x1b, 0x2a, 0x00, 0xdd, 0x90, 0xe0, 0x1c, 0x00,
+	0x20, 0x25, 0xd4, 0x40, 0xaa, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0x93, 0x41, 0x23, 0x43, 0xf3, 0x1a,
+	0x04, 0x00, 0x0d, 0x00, 0x30, 0xe7, 0x00, 0x2f, 0x00, 0xd0, 0x31, 0xe7, 0x00, 0x22, 0x00, 0x24,
+	0xab, 0xe7, 0x0c, 0x00, 0x40, 0xe7, 0x00, 0x2b, 0x52, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xee, 0xd0,
+	0xff, 0x28, 0xe1, 0xd1, 0x33, 0x00, 0xff, 0x24, 0x0d, 0x00, 0x35, 0xe7, 0xff, 0x29, 0x10, 0xd0,
+	0x01, 0x00, 0x79, 0xe7, 0x00, 0x2b, 0x68, 0xd0, 0xff, 0x24, 0x00, 0x2e, 0x00, 0xd1, 0x2b, 0xe7,
+	0x80, 0x22, 0x49, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x03, 0xd0, 0x61, 0x46, 0x11, 0x42, 0x00, 0xd1,
+	0x33, 0x00, 0xff, 0x24, 0x20, 0xe7, 0xff, 0x24, 0x00, 0x23, 0x2f, 0xe7, 0x00, 0x2c, 0xe9, 0xd1,
+	0x00, 0x2b, 0x5d, 0xd0, 0x00, 0x2e, 0x00, 0xd1, 0x16, 0xe7, 0x9b, 0x19, 0x5a, 0x01, 0x00, 0xd4,
+	0x40, 0xe7, 0x2e, 0x4a, 0x0c, 0x00, 0x13, 0x40, 0x0e, 0xe7, 0xdc, 0xb9, 0x5b, 0xbb, 0x00, 0x2e,
+	0x4b, 0xd0, 0x33, 0x00, 0x0d, 0x00, 0x07, 0xe7, 0x01, 0x26, 0x58, 0xe7, 0xe4, 0xb9, 0x00, 0x2b,
+	0x40, 0xd0, 0xc9, 0x43, 0x59, 0xb1, 0xff, 0x28, 0x37, 0xd0, 0x1b, 0x29, 0x42, 0xdc, 0x1c, 0x00,
+	0x20, 0x27, 0xcc, 0x40, 0x79, 0x1a, 0x8b, 0x40, 0x59, 0x1e, 0x8b, 0x41, 0x23, 0x43, 0x9b, 0x19,
+	0x04, 0x00, 0x45, 0xe7, 0xcb, 0xb9, 0x26, 0xbb, 0x80, 0x27, 0x00, 0x22, 0xff, 0x03, 0x23, 0xe7,
+	0x33, 0x00, 0x04, 0x00, 0x0d, 0x00, 0xe7, 0xe6, 0xff, 0x28, 0x1e, 0xd0, 0x80, 0x24, 0xe4, 0x04,
+	0x49, 0x42, 0x23, 0x43, 0xe1, 0xe7, 0x00, 0x2e, 0x00, 0xd1, 0xdd, 0xe6, 0x9f, 0x1b, 0x7a, 0x01,
+	0x00, 0xd4, 0x3e, 0xe7, 0xf3, 0x1a, 0x0d, 0x00, 0xd6, 0xe6, 0xff, 0x24, 0x00, 0x2e, 0x00, 0xd1,
+	0xd2, 0xe6, 0x80, 0x22, 0x48, 0x46, 0xd2, 0x03, 0x10, 0x42, 0xaa, 0xd0, 0x60, 0x46, 0x10, 0x42,
+	0xa7, 0xd1, 0x33, 0x00, 0x0d, 0x00, 0xff, 0x24, 0xc6, 0xe6, 0x33, 0x00, 0xff, 0x24, 0xc3, 0xe6,
+	0x01, 0x23, 0x74, 0xe7, 0x33, 0x00, 0x04, 0x00, 0xbe, 0xe6, 0x00, 0x27, 0x00, 0x22, 0x24, 0xe7,
+	0x33, 0x00, 0xb9, 0xe6, 0x01, 0x23, 0xc2, 0xe7, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xfb,
+	0x41, 0x02, 0x43, 0x00, 0xc2, 0x0f, 0x49, 0x0a, 0x1b, 0x0e, 0x00, 0x20, 0x7e, 0x2b, 0x0c, 0xdd,
+	0x9d, 0x2b, 0x0b, 0xdc, 0x80, 0x20, 0x00, 0x04, 0x01, 0x43, 0x95, 0x2b, 0x09, 0xdc, 0x96, 0x20,
+	0xc3, 0x1a, 0xd9, 0x40, 0x48, 0x42, 0x02, 0xb9, 0x08, 0x00, 0x70, 0x47, 0x02, 0x4b, 0xd0, 0x18,
+	0xfb, 0xe7, 0x96, 0x3b, 0x99, 0x40, 0xf5, 0xe7, 0xff, 0xff, 0xff, 0x7f, 0x70, 0xb5, 0x00, 0x28,
+	0x30, 0xd0, 0xc3, 0x17, 0xc4, 0x18, 0x5c, 0x40, 0xc5, 0x0f, 0x20, 0x00, 0x00, 0xf0, 0x8c, 0xf8,
+	0x9e, 0x23, 0x1b, 0x1a, 0x96, 0x2b, 0x0d, 0xdc, 0x96, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0x2a, 0x00,
+	0x64, 0x02, 0x64, 0x0a, 0xdb, 0xb2, 0x64, 0x02, 0xdb, 0x05, 0x60, 0x0a, 0xd2, 0x07, 0x18, 0x43,
+	0x10, 0x43, 0x70, 0xbd, 0x99, 0x2b, 0x19, 0xdc, 0x99, 0x22, 0xd2, 0x1a, 0x00, 0x2a, 0x29, 0xdd,
+	0x94, 0x40, 0x22, 0x00, 0x14, 0x4c, 0x14, 0x40, 0x51, 0x07, 0x04, 0xd0, 0x0f, 0x21, 0x0a, 0x40,
+	0x04, 0x2a, 0x00, 0xd0, 0x04, 0x34, 0x62, 0x01, 0x13, 0xd4, 0xa4, 0x01, 0x64, 0x0a, 0xdb, 0xb2,
+	0x2a, 0x00, 0xe0, 0xe7, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0xdc, 0xe7, 0x05, 0x22, 0x21, 0x00,
+	0x12, 0x1a, 0xd1, 0x40, 0xb9, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0x62, 0x1e, 0x94, 0x41, 0x0c, 0x43,
+	0xda, 0xe7, 0x05, 0x4b, 0x2a, 0x00, 0x1c, 0x40, 0x9f, 0x23, 0xa4, 0x01, 0x1b, 0x1a, 0x64, 0x0a,
+	0xdb, 0xb2, 0xc8, 0xe7, 0x22, 0x00, 0xd5, 0xe7, 0xff, 0xff, 0xff, 0xfb, 0x10, 0xb5, 0x04, 0x00,
+	0x38, 0xb3, 0x00, 0xf0, 0x41, 0xf8, 0x9e, 0x23, 0x1b, 0x1a, 0x96, 0x2b, 0x0a, 0xdc, 0x96, 0x22,
+	0xd2, 0x1a, 0x94, 0x40, 0x64, 0x02, 0x64, 0x0a, 0xdb, 0xb2, 0x64, 0x02, 0xdb, 0x05, 0x60, 0x0a,
+	0x18, 0x43, 0x10, 0xbd, 0x99, 0x2b, 0x17, 0xdc, 0x99, 0x22, 0xd2, 0x1a, 0x00, 0x2a, 0x27, 0xdd,
+	0x94, 0x40, 0x22, 0x00, 0x13, 0x4c, 0x14, 0x40, 0x51, 0x07, 0x04, 0xd0, 0x0f, 0x21, 0x0a, 0x40,
+	0x04, 0x2a, 0x00, 0xd0, 0x04, 0x34, 0x62, 0x01, 0x12, 0xd4, 0xa4, 0x01, 0x64, 0x0a, 0xdb, 0xb2,
+	0xe3, 0xe7, 0x00, 0x23, 0x00, 0x24, 0xe0, 0xe7, 0xb9, 0x22, 0x21, 0x00, 0xd2, 0x1a, 0x91, 0x40,
+	0x0a, 0x00, 0x51, 0x1e, 0x8a, 0x41, 0x05, 0x21, 0x09, 0x1a, 0xcc, 0x40, 0x14, 0x43, 0xdb, 0xe7,
+	0x04, 0x4b, 0x1c, 0x40, 0x9f, 0x23, 0xa4, 0x01, 0x1b, 0x1a, 0x64, 0x0a, 0xdb, 0xb2, 0xcc, 0xe7,
+	0x22, 0x00, 0xd7, 0xe7, 0xff, 0xff, 0xff, 0xfb, 0x1c, 0x21, 0x01, 0x23, 0x1b, 0x04, 0x98, 0x42,
+	0x01, 0xd3, 0x00, 0x0c, 0x10, 0x39, 0x1b, 0x0a, 0x98, 0x42, 0x01, 0xd3, 0x00, 0x0a, 0x08, 0x39,
+	0x1b, 0x09, 0x98, 0x42, 0x01, 0xd3, 0x00, 0x09, 0x04, 0x39, 0x02, 0xa2, 0x10, 0x5c, 0x40, 0x18,
+	0x70, 0x47, 0xc0, 0x46, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0xb5, 0x00, 0x25, 0x0e, 0x4b, 0x0f, 0x4c, 0xe4, 0x1a, 0xa4, 0x10,
+	0xa5, 0x42, 0x09, 0xd1, 0x00, 0x25, 0x00, 0xf0, 0x4b, 0xfa, 0x0c, 0x4c, 0x0c, 0x4b, 0xe4, 0x1a,
+	0xa4, 0x10, 0xa5, 0x42, 0x07, 0xd1, 0x70, 0xbd, 0x06, 0x4a, 0xab, 0x00, 0x9b, 0x18, 0x1b, 0x68,
+	0x98, 0x47, 0x01, 0x35, 0xec, 0xe7, 0x06, 0x4a, 0xab, 0x00, 0x9b, 0x18, 0x1b, 0x68, 0x98, 0x47,
+	0x01, 0x35, 0xee, 0xe7, 0x2c, 0x5c, 0x00, 0x00, 0x2c, 0x5c, 0x00, 0x00, 0x30, 0x5c, 0x00, 0x00,
+	0x2c, 0x5c, 0x00, 0x00, 0x00, 0x23, 0x10, 0xb5, 0x9a, 0x42, 0x00, 0xd1, 0x10, 0xbd, 0xcc, 0x5c,
+	0xc4, 0x54, 0x01, 0x33, 0xf8, 0xe7, 0x03, 0x00, 0x82, 0x18, 0x93, 0x42, 0x00, 0xd1, 0x70, 0x47,
+	0x19, 0x70, 0x01, 0x33, 0xf9, 0xe7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x08, 0x58, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+	0xe6, 0x00, 0x63, 0x02, 0x23, 0x04, 0x00, 0x00, 0x9a, 0x00, 0x80, 0x20, 0x01, 0x20, 0xa0, 0x00,
+	0x00, 0x22, 0xc0, 0x03, 0xa8, 0x00, 0xc0, 0x03, 0x02, 0x46, 0xb2, 0x00, 0x40, 0x22, 0x00, 0x22,
+	0xba, 0x00, 0x56, 0x22, 0x4f, 0x22, 0x00, 0x00, 0x78, 0x14, 0x00, 0x00, 0xda, 0x14, 0x00, 0x00,
+	0x82, 0x13, 0x00, 0x00, 0x78, 0x13, 0x00, 0x00, 0x8c, 0x13, 0x00, 0x00, 0x9e, 0x13, 0x00, 0x00,
+	0xbc, 0x13, 0x00, 0x00, 0x06, 0x13, 0x00, 0x00, 0xfa, 0x13, 0x00, 0x00, 0x18, 0x14, 0x00, 0x00,
+	0x26, 0x14, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00,
+	0x6e, 0x13, 0x00, 0x00, 0x6e, 0x13, 0x00, 0x00, 0x40, 0x14, 0x00, 0x00, 0x56, 0x45, 0x52, 0x5f,
+	0x4e, 0x4f, 0x54, 0x45, 0x53, 0x3a, 0x20, 0x28, 0x44, 0x45, 0x42, 0x55, 0x47, 0x29, 0x20, 0x42,
+	0x6f, 0x6f, 0x74, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x72, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2c,
+	0x20, 0x46, 0x69, 0x78, 0x65, 0x64, 0x20, 0x49, 0x32, 0x43, 0x20, 0x68, 0x61, 0x6e, 0x67, 0x20,
+	0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x52, 0x45, 0x56, 0x3a,
+	0x20, 0x30, 0x2e, 0x31, 0x32, 0x2e, 0x30, 0x00, 0x56, 0x45, 0x52, 0x3a, 0x20, 0x34, 0x37, 0x2e,
+	0x30, 0x2e, 0x30, 0x00, 0x2e, 0x2e, 0x2f, 0x68, 0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x68,
+	0x61, 0x6c, 0x5f, 0x61, 0x64, 0x63, 0x5f, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x2e, 0x63, 0x00, 0x00,
+	0x2e, 0x2e, 0x2f, 0x68, 0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x68, 0x61, 0x6c, 0x5f, 0x64,
+	0x61, 0x63, 0x5f, 0x73, 0x79, 0x6e, 0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68,
+	0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x68, 0x61, 0x6c, 0x5f, 0x69, 0x32, 0x63, 0x5f, 0x73,
+	0x5f, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68,
+	0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x68, 0x61, 0x6c, 0x5f, 0x69, 0x6f, 0x2e, 0x63, 0x00,
+	0x2e, 0x2e, 0x2f, 0x68, 0x61, 0x6c, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x68, 0x61, 0x6c, 0x5f, 0x74,
+	0x69, 0x6d, 0x65, 0x72, 0x2e, 0x63, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68, 0x61, 0x6c, 0x2f, 0x75,
+	0x74, 0x69, 0x6c, 0x73, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x5f, 0x6c,
+	0x69, 0x73, 0x74, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68, 0x61, 0x6c, 0x2f, 0x75,
+	0x74, 0x69, 0x6c, 0x73, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x5f, 0x72,
+	0x69, 0x6e, 0x67, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x63, 0x00, 0x2e, 0x2e, 0x2f, 0x68,
+	0x70, 0x6c, 0x2f, 0x61, 0x64, 0x63, 0x2f, 0x68, 0x70, 0x6c, 0x5f, 0x61, 0x64, 0x63, 0x2e, 0x63,
+	0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68, 0x70, 0x6c, 0x2f, 0x64, 0x61, 0x63, 0x2f, 0x68,
+	0x70, 0x6c, 0x5f, 0x64, 0x61, 0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68,
+	0x70, 0x6c, 0x2f, 0x72, 0x74, 0x63, 0x2f, 0x68, 0x70, 0x6c, 0x5f, 0x72, 0x74, 0x63, 0x2e, 0x63,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x42, 0x00, 0x08, 0x00, 0x42, 0x00, 0x0c, 0x00, 0x42,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2f, 0x68, 0x70, 0x6c, 0x2f, 0x73, 0x65, 0x72, 0x63, 0x6f,
+	0x6d, 0x2f, 0x68, 0x70, 0x6c, 0x5f, 0x73, 0x65, 0x72, 0x63, 0x6f, 0x6d, 0x2e, 0x63, 0x00, 0x00,
+	0x16, 0x4e, 0x00, 0x00, 0xe6, 0x4d, 0x00, 0x00, 0xf8, 0x4d, 0x00, 0x00, 0x3c, 0x4d, 0x00, 0x00,
+	0xf8, 0x4d, 0x00, 0x00, 0xdc, 0x4d, 0x00, 0x00, 0xf8, 0x4d, 0x00, 0x00, 0x3c, 0x4d, 0x00, 0x00,
+	0xe6, 0x4d, 0x00, 0x00, 0xe6, 0x4d, 0x00, 0x00, 0xdc, 0x4d, 0x00, 0x00, 0x3c, 0x4d, 0x00, 0x00,
+	0x44, 0x4d, 0x00, 0x00, 0x44, 0x4d, 0x00, 0x00, 0x44, 0x4d, 0x00, 0x00, 0xfe, 0x4d, 0x00, 0x00,
+	0xe6, 0x4d, 0x00, 0x00, 0xe6, 0x4d, 0x00, 0x00, 0xba, 0x4d, 0x00, 0x00, 0x9e, 0x4e, 0x00, 0x00,
+	0xba, 0x4d, 0x00, 0x00, 0xdc, 0x4d, 0x00, 0x00, 0xba, 0x4d, 0x00, 0x00, 0x9e, 0x4e, 0x00, 0x00,
+	0xe6, 0x4d, 0x00, 0x00, 0xe6, 0x4d, 0x00, 0x00, 0xdc, 0x4d, 0x00, 0x00, 0x9e, 0x4e, 0x00, 0x00,
+	0x44, 0x4d, 0x00, 0x00, 0x44, 0x4d, 0x00, 0x00, 0x44, 0x4d, 0x00, 0x00, 0xa8, 0x4e, 0x00, 0x00,
+	0x8c, 0x51, 0x00, 0x00, 0xea, 0x50, 0x00, 0x00, 0xea, 0x50, 0x00, 0x00, 0xe8, 0x50, 0x00, 0x00,
+	0x7e, 0x51, 0x00, 0x00, 0x7e, 0x51, 0x00, 0x00, 0x74, 0x51, 0x00, 0x00, 0xe8, 0x50, 0x00, 0x00,
+	0x7e, 0x51, 0x00, 0x00, 0x74, 0x51, 0x00, 0x00, 0x7e, 0x51, 0x00, 0x00, 0xe8, 0x50, 0x00, 0x00,
+	0x84, 0x51, 0x00, 0x00, 0x84, 0x51, 0x00, 0x00, 0x84, 0x51, 0x00, 0x00, 0x20, 0x52, 0x00, 0x00,
+	0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0x21, 0x11, 0x00, 0x00,
+	0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0xf5, 0x10, 0x00, 0x00,
+	0xa3, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x30, 0x00, 0x02, 0x0c, 0x30, 0x00, 0x02, 0xcb, 0x17, 0x00,
+	0x80, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xc3
+};
+
+const ads_fw_image_t ads_fw_v2_image = {
+	47,									// rev
+	19544,								// len
+	0x6b32bc12,							// crc
+	ADS_FW_RAW,							// format
+	ads_fw_v2_data,
+	sizeof(ads_fw_v2_data)
+};
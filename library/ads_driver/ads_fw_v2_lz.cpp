@@ -0,0 +1,903 @@
+/* Generated by ads_fw_pack from ads_fw_v2.bin, see ads_fw.h */
+#include "ads_fw.h"
+
+static const uint8_t ads_fw_v2_lz_data[] = {
+	0x41, 0x44, 0x5a, 0x0a, 0x58, 0x4c, 0x00, 0x00, 0xff, 0x00, 0x09, 0x00, 0x20, 0xfd, 0x23, 0x00,
+	0x00, 0xb1, 0xf9, 0xc4, 0x00, 0x19, 0x00, 0xc9, 0x07, 0xf9, 0x23, 0xcb, 0x00, 0xa9, 0xf9, 0x3e,
+	0xcf, 0x04, 0xf9, 0x00, 0x61, 0x41, 0x00, 0x00, 0x11, 0x6f, 0x42, 0x00, 0x00, 0xc1, 0xc0, 0x00,
+	0x71, 0x43, 0xeb, 0x0e, 0xeb, 0xad, 0x38, 0xc0, 0x01, 0x38, 0xd7, 0x07, 0x10, 0xb5, 0x40, 0xff,
+	0xf2, 0x18, 0x04, 0xc2, 0xf2, 0x00, 0x04, 0x23, 0xff, 0x78, 0x63, 0xb9, 0x40, 0xf2, 0x00, 0x03,
+	0xc0, 0x7e, 0xc0, 0x00, 0x2b, 0xb1, 0x45, 0xf6, 0x40, 0x40, 0x40, 0x02, 0xff, 0x00, 0x00, 0xe0,
+	0x00, 0xbf, 0x01, 0x23, 0x23, 0xdf, 0x70, 0x10, 0xbd, 0xc0, 0x46, 0x45, 0x07, 0x10, 0xb5, 0x3f,
+	0x4b, 0xb1, 0x40, 0xf2, 0x1c, 0x01, 0xc1, 0x08, 0x40, 0x0e, 0xf9, 0x01, 0xc5, 0x09, 0xc5, 0x0c,
+	0x03, 0x68, 0x03, 0xb9, 0x10, 0xfd, 0xbd, 0x45, 0x0b, 0x00, 0x2b, 0xf8, 0xd0, 0x98, 0x47, 0xff,
+	0xf6, 0xe7, 0xc0, 0x46, 0x42, 0xf2, 0x89, 0x43, 0xdb, 0x10, 0xb5, 0xc1, 0x04, 0x98, 0x47, 0xc1,
+	0x13, 0xf0, 0xb5, 0xff, 0x4e, 0x46, 0x45, 0x46, 0x57, 0x46, 0xde, 0x46, 0xff, 0xe0, 0xb5, 0x45,
+	0xf2, 0xe8, 0x76, 0x43, 0xf6, 0xfb, 0xed, 0x39, 0x40, 0x07, 0x06, 0x35, 0x00, 0x00, 0x24, 0xfa,
+	0x40, 0x0f, 0x08, 0xc0, 0x00, 0x0a, 0xc3, 0xb0, 0x01, 0x90, 0xfa, 0xc0, 0x04, 0x09, 0xc0, 0x02,
+	0x12, 0x02, 0xa9, 0x28, 0x68, 0xff, 0xc8, 0x47, 0x00, 0x28, 0x00, 0xd0, 0x7a, 0xe0, 0xff, 0x2b,
+	0x79, 0x9c, 0x46, 0xfb, 0xb1, 0x62, 0x46, 0xff, 0x50, 0x00, 0xab, 0x68, 0x60, 0x44, 0x40, 0x00,
+	0xff, 0x18, 0x18, 0x06, 0xe0, 0x59, 0x88, 0x91, 0x42, 0xff, 0x00, 0xd0, 0x6c, 0xe0, 0x06, 0x33,
+	0x98, 0x42, 0xff, 0x11, 0xd0, 0x1f, 0x88, 0x02, 0xa9, 0x8b, 0x46, 0xff, 0x3a, 0x00, 0x5a, 0x44,
+	0x51, 0x78, 0x5a, 0x46, 0x7f, 0xd2, 0x5d, 0x09, 0x02, 0x0a, 0x43, 0x99, 0x40, 0x08, 0xff, 0xeb,
+	0xd1, 0x01, 0x34, 0x06, 0x33, 0xe4, 0xb2, 0xdf, 0x98, 0x42, 0xed, 0xd1, 0x63, 0xc0, 0x34, 0x01,
+	0x0c, 0xff, 0x43, 0x44, 0xdb, 0xb2, 0xe2, 0x44, 0x98, 0x46, 0xff, 0x53, 0x46, 0x0c, 0x35, 0x02,
+	0x2b, 0xc9, 0xd1, 0xff, 0xa0, 0x45, 0x44, 0xd0, 0x43, 0xf6, 0xd9, 0x2b, 0x4f, 0x43, 0xf6, 0x1d,
+	0x37, 0xc1, 0x20, 0xc0, 0x1f, 0x0b, 0xc0, 0x00, 0xf7, 0x07, 0x34, 0x68, 0x43, 0x21, 0x20, 0x00,
+	0xc8, 0x47, 0xff, 0x32, 0x79, 0x8a, 0xb1, 0x50, 0x00, 0xb3, 0x68, 0xfb, 0x80, 0x18, 0xc1, 0x1e,
+	0x02, 0xad, 0xac, 0x46, 0x1a, 0xdf, 0x88, 0x99, 0x88, 0xa9, 0x54, 0x41, 0x01, 0x62, 0x44, 0xff,
+	0x09, 0x0a, 0x06, 0x33, 0x51, 0x70, 0x98, 0x42, 0xff, 0xf2, 0xd1, 0x20, 0x00, 0xd8, 0x47, 0x63,
+	0x1c, 0xff, 0xff, 0x33, 0x98, 0x46, 0x02, 0xad, 0x29, 0x00, 0xff, 0x20, 0x00, 0x40, 0x22, 0x40,
+	0x34, 0xb8, 0x47, 0xbf, 0x40, 0x35, 0x44, 0x45, 0xf7, 0xd1, 0xc1, 0x1e, 0xe2, 0xbd, 0x44, 0x40,
+	0x1d, 0x36, 0x02, 0x2b, 0xd0, 0x40, 0x03, 0xdf, 0xff, 0x23, 0x01, 0x20, 0x01, 0x9a, 0x13, 0x80,
+	0x43, 0xff, 0xb0, 0x3c, 0xbc, 0x90, 0x46, 0x99, 0x46, 0xa2, 0xdf, 0x46, 0xab, 0x46, 0xf0, 0xbd,
+	0xc2, 0x05, 0x9a, 0x00, 0xff, 0x20, 0x13, 0x80, 0xf2, 0xe7, 0x40, 0xf2, 0xde, 0xfa, 0xc4, 0x02,
+	0xec, 0xc0, 0x53, 0xbf, 0xf3, 0x4f, 0x8f, 0x4e, 0xbf, 0xf6, 0x00, 0x53, 0x04, 0x22, 0xce, 0xc2,
+	0x5a, 0xfa, 0x77, 0x52, 0xda, 0x60, 0xc1, 0x04, 0xc0, 0x46, 0xfd, 0x40, 0x0a, 0xef, 0x34, 0x03,
+	0x01, 0x22, 0x40, 0x67, 0x03, 0x1a, 0x70, 0xd3, 0x70, 0x47, 0xc1, 0x6e, 0xc5, 0x03, 0x5a, 0xc2,
+	0x03, 0xf0, 0xb5, 0xff, 0xce, 0x46, 0x47, 0x46, 0x80, 0xb5, 0x03, 0x78, 0xff, 0x83, 0xb0, 0x04,
+	0x00, 0x64, 0x2b, 0x37, 0xd8, 0xff, 0xdc, 0x4a, 0x9b, 0x00, 0xd3, 0x58, 0x9f, 0x46, 0xff, 0x63,
+	0x78, 0x80, 0x78, 0x03, 0x2b, 0x00, 0xd1, 0x7f, 0xf9, 0xe1, 0x00, 0xd9, 0x30, 0xe1, 0x01, 0x40,
+	0x02, 0xbf, 0x1a, 0xe2, 0x00, 0xd9, 0x03, 0xe2, 0x40, 0x10, 0x04, 0x6f, 0x45, 0xf2, 0xad, 0x63,
+	0xc1, 0x8a, 0x25, 0x6a, 0x41, 0x71, 0xff, 0x20, 0x77, 0xa5, 0x62, 0x98, 0x47, 0x45, 0xf2, 0x6f,
+	0x0d, 0x63, 0x06, 0x1c, 0xc1, 0x03, 0x28, 0x00, 0x41, 0x03, 0xef, 0x59, 0x03, 0x21, 0x6b, 0xc3,
+	0x78, 0x45, 0xf2, 0xb1, 0xfb, 0x23, 0x01, 0x42, 0x06, 0x30, 0x1c, 0x98, 0x47, 0xa0, 0xff, 0x63,
+	0x20, 0x00, 0x42, 0xf2, 0x05, 0x53, 0x30, 0xdd, 0x30, 0x43, 0x07, 0x03, 0xb0, 0x0c, 0x42, 0x39,
+	0xf0, 0xbd, 0x2f, 0x42, 0xf2, 0x51, 0x63, 0xc3, 0x04, 0x41, 0x40, 0x0c, 0x43, 0x02, 0xbf, 0x42,
+	0xf2, 0x95, 0x63, 0x40, 0x78, 0xc3, 0x02, 0x00, 0xcf, 0x28, 0xe8, 0xd1, 0xf1, 0x41, 0x34, 0xc2,
+	0xa9, 0x43, 0x78, 0xff, 0x22, 0x7e, 0x93, 0x42, 0xdf, 0xd0, 0x23, 0x76, 0xbf, 0x00, 0x2b, 0x00,
+	0xd0, 0x23, 0xe1, 0x41, 0xa7, 0x74, 0x7f, 0xe0, 0x45, 0xf2, 0xd7, 0x73, 0x01, 0xac, 0xc1, 0x0b,
+	0x9f, 0x03, 0x22, 0xff, 0x21, 0x20, 0x40, 0x22, 0xc1, 0x05, 0x2e, 0x7f, 0x33, 0x63, 0x70, 0x00,
+	0x23, 0xa3, 0x70, 0x41, 0x3f, 0xfe, 0xc1, 0x3e, 0x9a, 0x78, 0x03, 0x21, 0x53, 0x1e, 0x9a, 0xff,
+	0x41, 0x44, 0xf2, 0xd9, 0x63, 0xd2, 0xb2, 0x20, 0xb5, 0x00, 0xc3, 0x17, 0xb9, 0x42, 0x4b, 0x64,
+	0x21, 0x41, 0x08, 0x42, 0xff, 0x78, 0x58, 0x5c, 0x90, 0x42, 0xb0, 0xd0, 0x5a, 0xff, 0x54, 0x00,
+	0x2a, 0xad, 0xd1, 0x01, 0x32, 0x1a, 0xff, 0x70, 0xaa, 0xe7, 0x43, 0xf2, 0x6d, 0x13, 0x06, 0xad,
+	0x20, 0xc3, 0x0a, 0xa3, 0xe7, 0x4f, 0x1a, 0x02, 0x40, 0x1a, 0x0a, 0xff, 0x33, 0xc9, 0xe7, 0x42,
+	0x78, 0x53, 0x1e, 0x09, 0xf7, 0x2b, 0x92, 0xd8, 0x45, 0x1b, 0x18, 0x00, 0x5c, 0x33, 0xfb, 0x1a,
+	0x70, 0xc9, 0x3c, 0x40, 0xf2, 0x38, 0x20, 0x42, 0x8f, 0xf6, 0xa1, 0x33, 0x61, 0x42, 0x36, 0xc0,
+	0x08, 0x40, 0x0f, 0x7a, 0xfe, 0x48, 0x36, 0xa2, 0x78, 0x93, 0x42, 0x00, 0xd1, 0x71, 0xdf, 0xe7,
+	0xa3, 0x70, 0xa3, 0x78, 0x41, 0x37, 0xef, 0xe0, 0xff, 0x40, 0xf2, 0x88, 0x20, 0x43, 0xf2, 0x25,
+	0x33, 0xbc, 0xc1, 0x0a, 0xc3, 0x10, 0x43, 0xf6, 0x81, 0x43, 0x45, 0x13, 0x64, 0x9e, 0x40, 0x13,
+	0xf9, 0x43, 0x00, 0x21, 0x47, 0x13, 0x44, 0x18, 0x13, 0xfe, 0xc9, 0x04, 0x49, 0xe7, 0x82, 0x78,
+	0x43, 0x78, 0x12, 0xb7, 0x02, 0x13, 0x43, 0xc0, 0x14, 0xd1, 0x42, 0xc0, 0x1b, 0x00, 0xb2, 0x43,
+	0xfc, 0x80, 0x4f, 0x17, 0x43, 0x04, 0xb1, 0x23, 0xc9, 0x1b, 0xa5, 0xfe, 0x44, 0x67, 0x42, 0xf2,
+	0x00, 0x41, 0x02, 0x00, 0x43, 0x17, 0xf2, 0x69, 0x23, 0x41, 0x09, 0xc4, 0x43, 0xfe, 0xc6, 0x1d,
+	0xc1, 0x0d, 0x6f, 0x69, 0x33, 0x21, 0x88, 0xc1, 0x04, 0x89, 0xb2, 0x45, 0x05, 0xba, 0x43, 0x42,
+	0x9b, 0x41, 0x33, 0xd1, 0x05, 0xe7, 0x43, 0x09, 0xe1, 0xee, 0x48, 0x17, 0xfb, 0xe6, 0x55, 0x40,
+	0x06, 0x23, 0xe1, 0x56, 0x6e, 0x40, 0x01, 0x14, 0xe1, 0x04, 0xc0, 0x3c, 0xf2, 0xe6, 0xc1, 0x43,
+	0xdd, 0x64, 0xc1, 0x08, 0x04, 0xe3, 0x5c, 0xc1, 0x0d, 0xe9, 0xe6, 0xdc, 0xc1, 0x9d, 0xc5, 0x94,
+	0x0d, 0x66, 0x07, 0xc1, 0x94, 0x06, 0x60, 0x7b, 0x6a, 0xb0, 0x42, 0x98, 0x44, 0xf6, 0x89, 0x45,
+	0xc1, 0x06, 0xef, 0xe1, 0x6b, 0x98, 0x47, 0xc0, 0x01, 0x05, 0x39, 0x1c, 0x9f, 0xa8, 0x47, 0x60,
+	0x63, 0x20, 0x42, 0x07, 0xc7, 0xa2, 0x44, 0xcf, 0xf6, 0x71, 0x13, 0xa1, 0xc4, 0x02, 0x41, 0x08,
+	0x65, 0x23, 0xef, 0xe3, 0x5c, 0x20, 0x64, 0x41, 0x17, 0xb3, 0xe6, 0xa3, 0xff, 0x6e, 0xa3, 0x65,
+	0xb0, 0xe6, 0xc0, 0x23, 0x48, 0x7f, 0xf2, 0x00, 0x02, 0xdb, 0x05, 0x9a, 0x61, 0x41, 0x8e, 0xfd,
+	0x00, 0xc0, 0x38, 0x64, 0x20, 0xa3, 0x70, 0x42, 0xf6, 0xed, 0xc1, 0xcc, 0x57, 0xfe, 0x13, 0xc3,
+	0x5d, 0x31, 0x55, 0x01, 0xff, 0xaa, 0x13, 0x80, 0xfe, 0x3b, 0x00, 0x21, 0xff, 0x69, 0x3b, 0xc1,
+	0x1d, 0xc1, 0x07, 0xa8, 0x40, 0x4b, 0x6d, 0x43, 0xc9, 0x7a, 0xfd, 0x59, 0x4a, 0x62, 0x44, 0xf2,
+	0x51, 0x43, 0x20, 0x1d, 0x7e, 0xc3, 0x07, 0x7e, 0xe6, 0x28, 0x58, 0x00, 0x00, 0xc3, 0x12, 0xb8,
+	0xff, 0x18, 0x49, 0x0f, 0x42, 0x02, 0x03, 0x19, 0x88, 0xc5, 0x64, 0x89, 0x51, 0xb2, 0xcd, 0x69,
+	0x49, 0x60, 0xc9, 0x24, 0x34, 0xce, 0x5e, 0x2b, 0xc0, 0x5e, 0xf7, 0x0d, 0x63, 0x60, 0xc2, 0xfb,
+	0x98, 0x47, 0xe0, 0x63, 0xf5, 0x1c, 0x41, 0x08, 0x00, 0x41, 0x0f, 0xc3, 0x6c, 0x30, 0x30, 0xff,
+	0x83, 0x60, 0x03, 0x6a, 0xc3, 0x60, 0x43, 0x69, 0xff, 0x03, 0x60, 0x83, 0x69, 0x43, 0x60, 0x43,
+	0x6a, 0x93, 0x03, 0x61, 0x41, 0xbb, 0xc3, 0x0a, 0x0e, 0xc2, 0x12, 0x40, 0x0f, 0x65, 0xf6, 0xc2,
+	0x9a, 0x7f, 0x26, 0xc1, 0x10, 0x05, 0x60, 0x77, 0xe6, 0xff, 0x62, 0xc0, 0x1a, 0x98, 0x46, 0xa8,
+	0x47, 0xa7, 0xbf, 0x6a, 0x81, 0x46, 0xf0, 0x1b, 0xa8, 0x40, 0x66, 0x89, 0xfb, 0x43, 0x01, 0x41,
+	0x74, 0x03, 0x48, 0x46, 0x98, 0x47, 0xdf, 0x06, 0x1c, 0x20, 0x63, 0x40, 0x40, 0x07, 0x80, 0x46,
+	0xd9, 0x38, 0x40, 0x3a, 0x41, 0x70, 0x31, 0x1c, 0x45, 0x7e, 0xb1, 0x23, 0x9e, 0xc3, 0x09, 0x40,
+	0x46, 0xd7, 0xe5, 0x41, 0x96, 0x40, 0x3a, 0x21, 0xfb, 0x5e, 0x22, 0xc1, 0x3a, 0x99, 0x52, 0x01,
+	0x21, 0x0e, 0xdf, 0x32, 0x99, 0x54, 0xd4, 0xe5, 0x45, 0x27, 0x83, 0x6b, 0xff, 0x30, 0x30, 0xc3,
+	0x61, 0xc3, 0x68, 0x03, 0x62, 0xff, 0x03, 0x68, 0x43, 0x61, 0x43, 0x68, 0x83, 0x61, 0xef, 0x03,
+	0x69, 0x43, 0x62, 0x47, 0x27, 0xbf, 0xe5, 0xc0, 0xf7, 0x46, 0xf0, 0xb5, 0xc3, 0x4f, 0x09, 0x46,
+	0x83, 0xb0, 0xbf, 0x00, 0x23, 0x18, 0x22, 0x05, 0x21, 0x44, 0x45, 0x06, 0xbf, 0xb0, 0x47, 0xc0,
+	0x23, 0x08, 0x22, 0x43, 0x07, 0x71, 0x3d, 0x35, 0xc1, 0x31, 0x43, 0xf2, 0x6d, 0x17, 0xc1, 0x86,
+	0x44, 0x08, 0xde, 0x41, 0x62, 0x04, 0xa8, 0x47, 0x63, 0xc1, 0xf1, 0x07, 0x02, 0xef, 0x20, 0x23,
+	0xb9, 0xb8, 0xc0, 0x02, 0x02, 0x20, 0x00, 0xff, 0x2b, 0xfa, 0xd0, 0x23, 0x78, 0x13, 0xb9, 0x02,
+	0x6f, 0x30, 0xb8, 0x47, 0xf6, 0x40, 0xbb, 0x38, 0x20, 0xc1, 0x15, 0xbd, 0x1e, 0xc2, 0x15, 0x63,
+	0x70, 0x23, 0x70, 0xc7, 0x15, 0xdb, 0xb3, 0x05, 0x5a, 0xc2, 0x12, 0xc1, 0x10, 0x43, 0xb9, 0x40,
+	0x17, 0x15, 0x86, 0x41, 0x15, 0x02, 0x20, 0xc1, 0x03, 0x41, 0x11, 0xc1, 0x9f, 0x41, 0x1f, 0x6d,
+	0xff, 0x25, 0x63, 0x70, 0x01, 0xaa, 0x04, 0x33, 0x00, 0xfe, 0xc5, 0x26, 0x05, 0xa8, 0x47, 0xa3,
+	0x78, 0x9b, 0xb9, 0xf7, 0x23, 0x78, 0x6b, 0x42, 0x0d, 0x44, 0xf2, 0x69, 0x66, 0x54, 0x41, 0x05,
+	0x43, 0x2d, 0x04, 0xc0, 0x0f, 0x23, 0xc0, 0x0f, 0xf9, 0xc0, 0x0f, 0xff, 0x23, 0x70, 0x03, 0xb0,
+	0xf0, 0xbd, 0x6b, 0x46, 0xff, 0x98, 0x88, 0xdb, 0x88, 0x6a, 0x46, 0xc0, 0x1a, 0x4f, 0x03, 0x23,
+	0x13, 0x70, 0xc1, 0x72, 0xc0, 0x51, 0x25, 0xc1, 0x40, 0x5b, 0x60, 0x62, 0xc3, 0xcb, 0xe1, 0x6b,
+	0xc3, 0x60, 0x61, 0x44, 0xc7, 0xfe, 0x41, 0xc6, 0x06, 0x1c, 0x63, 0xb3, 0xa1, 0x6d, 0xa0, 0x7d,
+	0x6e, 0x42, 0x60, 0x05, 0x4c, 0xf6, 0xcd, 0x41, 0x41, 0x0a, 0x6f, 0xc3, 0xf6, 0xcc, 0x51, 0xc1,
+	0x0a, 0x71, 0x13, 0xc3, 0x61, 0xfb, 0x30, 0x1c, 0xc1, 0x6b, 0x85, 0x21, 0x30, 0x1c, 0xc9, 0xde,
+	0x40, 0x25, 0x44, 0xf6, 0xa9, 0x03, 0x43, 0x10, 0x6b, 0x46, 0xff, 0xa2, 0x78, 0x58, 0x70, 0x00,
+	0x0a, 0x98, 0x70, 0xff, 0x53, 0x1e, 0x9a, 0x41, 0x44, 0xf2, 0xd9, 0x63, 0xbf, 0xd2, 0xb2, 0x03,
+	0x21, 0x68, 0x46, 0x43, 0x07, 0xa1, 0xe9, 0xe7, 0xc1, 0x14, 0x42, 0x1e, 0xe7, 0xc1, 0x60, 0xd6,
+	0x46, 0x4f, 0xb7, 0x46, 0x46, 0x46, 0x41, 0x3b, 0xc0, 0xb5, 0xc1, 0x62, 0x82, 0x52, 0xd9, 0x62,
+	0x37, 0xc1, 0x62, 0xc8, 0x61, 0x07, 0xc1, 0x61, 0xb8, 0xd4, 0x50, 0x8a, 0xcd, 0x5f, 0xb0, 0x40,
+	0xce, 0x81, 0x44, 0xce, 0xc7, 0xd0, 0x4d, 0x64, 0xb8, 0x7e, 0x5e, 0x64, 0x6a, 0x46, 0x00, 0x21,
+	0x63, 0x70, 0x41, 0x07, 0xfb, 0x04, 0x33, 0xc3, 0x70, 0x6b, 0x46, 0x18, 0x88, 0x5b, 0x57, 0x88,
+	0x01, 0xad, 0x41, 0x59, 0x2b, 0x45, 0x59, 0x26, 0x48, 0x59, 0xef, 0x06, 0xe1, 0x6b, 0xb0, 0x4e,
+	0x59, 0x07, 0x1c, 0x00, 0x57, 0x2b, 0x5a, 0xd0, 0xc1, 0x59, 0xb0, 0xc1, 0x59, 0x06, 0xc4, 0x59,
+	0x55, 0x06, 0xc1, 0x59, 0xb0, 0xc8, 0x59, 0x38, 0xc0, 0x59, 0x07, 0xc0, 0x59, 0xf5, 0x38, 0xc0,
+	0x59, 0xb0, 0xc8, 0x59, 0xa2, 0x78, 0x42, 0xf6, 0xfb, 0x65, 0x48, 0xc5, 0x58, 0x42, 0xf6, 0x75,
+	0x47, 0xc0, 0xbf, 0x26, 0x43, 0xf2, 0x00, 0x09, 0x68, 0xc0, 0x5e, 0xa8, 0xa5, 0x70, 0xc1, 0x5c,
+	0x28, 0xc4, 0xf8, 0x40, 0x01, 0x08, 0x41, 0x4b, 0xf6, 0xfb, 0x05, 0xc4, 0xc0, 0x07, 0x48, 0xf2,
+	0x00, 0x0a, 0x0a, 0xf5, 0xe0, 0x40, 0x8e, 0x63, 0xc4, 0x42, 0xf2, 0x6d, 0x13, 0x04, 0xf9, 0x20,
+	0xc3, 0x02, 0x40, 0x0c, 0x47, 0x4b, 0x46, 0x34, 0x68, 0xff, 0x1a, 0x6a, 0x33, 0x69, 0x28, 0x00,
+	0x53, 0x40, 0xff, 0x1c, 0x40, 0x54, 0x40, 0xb8, 0x47, 0x53, 0x46, 0xff, 0x23, 0x42, 0xe6, 0xd0,
+	0x02, 0xb0, 0x1c, 0xbc, 0xff, 0x90, 0x46, 0x99, 0x46, 0xa2, 0x46, 0xf0, 0xbd, 0xd4, 0xc1, 0x2b,
+	0xc1, 0x2a, 0xb3, 0xc2, 0x70, 0xc6, 0xc2, 0x6f, 0x42, 0xf6, 0xff, 0xa1, 0x36, 0x00, 0xb5, 0x00,
+	0x21, 0x82, 0xb0, 0x9e, 0xc7, 0x6e, 0x42, 0xf6, 0xd5, 0x37, 0xc2, 0x61, 0xc5, 0x73, 0x07, 0x6d,
+	0xb8, 0xc0, 0x04, 0x09, 0x44, 0xc5, 0x66, 0x18, 0x21, 0xc0, 0x04, 0x2d, 0x04, 0xc1, 0x06, 0xa0,
+	0x47, 0xc4, 0x78, 0x33, 0xc1, 0x78, 0x41, 0x23, 0xf4, 0x41, 0x05, 0xc1, 0x77, 0x98, 0x56, 0x64,
+	0x63, 0x70, 0x06, 0x33, 0x77, 0x6b, 0x44, 0x98, 0x44, 0x1f, 0x6d, 0x25, 0x42, 0x40, 0x66, 0xf3,
+	0x02, 0x23, 0xc4, 0xe7, 0xc0, 0x65, 0x43, 0x46, 0x45, 0xf2, 0xef, 0xad, 0x65, 0x18, 0x88, 0xc3,
+	0xcd, 0x80, 0x46, 0xa0, 0xed, 0x89, 0x41, 0xb4, 0xb1, 0x23, 0xc3, 0x55, 0x40, 0x46, 0x98, 0xce,
+	0xc1, 0x5d, 0x03, 0x61, 0x69, 0xc3, 0x3e, 0x41, 0x5c, 0x61, 0x68, 0x6e, 0xc4, 0x02, 0xf2, 0x79,
+	0x53, 0x43, 0x02, 0x05, 0x1c, 0x41, 0x17, 0x2f, 0x5c, 0x34, 0x21, 0x78, 0xc1, 0x14, 0xb0, 0x42,
+	0x29, 0x43, 0xa7, 0x7f, 0xb8, 0x47, 0x28, 0x1c, 0x02, 0xb0, 0x04, 0xc0, 0x44, 0xfb, 0xf0, 0xbd,
+	0xc3, 0x40, 0x80, 0x08, 0x40, 0xf6, 0x00, 0xdf, 0x03, 0x41, 0x46, 0x00, 0xb5, 0xc0, 0x59, 0x03,
+	0xda, 0xfd, 0x69, 0x41, 0x32, 0x0a, 0x43, 0xda, 0x61, 0x41, 0xf6, 0xef, 0x00, 0x43, 0xc0, 0x22,
+	0xc1, 0x04, 0x3e, 0x39, 0x99, 0xef, 0x50, 0x00, 0x23, 0x84, 0x41, 0x48, 0x04, 0x02, 0x93, 0xfe,
+	0xc0, 0x12, 0x25, 0x40, 0xf2, 0x70, 0x23, 0x01, 0x27, 0xfb, 0x22, 0x00, 0xc0, 0x08, 0x41, 0x42,
+	0xf2, 0xf5, 0x76, 0x7d, 0xc2, 0x43, 0x2f, 0x03, 0x01, 0x93, 0x74, 0x32, 0x40, 0x0c, 0xbf, 0x21,
+	0x00, 0x97, 0x00, 0x23, 0x28, 0x44, 0x53, 0x22, 0xff, 0x00, 0x42, 0xf6, 0x9d, 0x04, 0x78, 0x32,
+	0x80, 0xdb, 0x23, 0x00, 0xc3, 0x76, 0x04, 0xa0, 0xc0, 0xaf, 0x42, 0x46, 0xaa, 0xc0, 0xae, 0x60,
+	0x40, 0x7e, 0x03, 0xc0, 0x0b, 0x02, 0x41, 0x19, 0x9a, 0xff, 0x62, 0xc0, 0x22, 0x47, 0x21, 0x01,
+	0x20, 0x12, 0xff, 0x06, 0x9a, 0x62, 0x5a, 0x5c, 0x42, 0xf6, 0xe9, 0xff, 0x14, 0xba, 0x43, 0x02,
+	0x43, 0x5a, 0x54, 0x0f, 0xdf, 0x22, 0x14, 0x39, 0x58, 0x5c, 0xc1, 0x0d, 0x02, 0x40, 0xfb, 0x10,
+	0x20, 0x41, 0x04, 0x41, 0xf2, 0xdd, 0x23, 0x00, 0xb9, 0x22, 0x41, 0x3a, 0x41, 0x14, 0xa0, 0x47,
+	0x04, 0xc4, 0x33, 0xf8, 0xff, 0xb5, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46, 0x45, 0x7f, 0x46, 0xe0,
+	0xb5, 0xc0, 0x27, 0x08, 0x23, 0x40, 0x17, 0xfb, 0x04, 0xff, 0x41, 0x8f, 0x04, 0x7b, 0x61, 0xbb,
+	0x60, 0xfe, 0xc1, 0x18, 0xa3, 0x62, 0xc0, 0x23, 0x43, 0x22, 0x01, 0xff, 0x26, 0x1b, 0x06, 0xa3,
+	0x62, 0x99, 0x46, 0xa3, 0xff, 0x5c, 0x41, 0xf2, 0xed, 0x20, 0xb3, 0x43, 0xa3, 0xff, 0x54, 0x44,
+	0xf2, 0x39, 0x73, 0x40, 0xf2, 0x00, 0xf1, 0x28, 0x40, 0x42, 0x41, 0xf9, 0xc1, 0xaa, 0x00, 0x98,
+	0x47, 0x42, 0xed, 0x46, 0xc0, 0x0c, 0x05, 0x6b, 0x40, 0x44, 0x40, 0x0b, 0x13, 0xbf, 0x43, 0x6b,
+	0x61, 0x43, 0xf6, 0xa5, 0x44, 0x9f, 0x42, 0xff, 0xf2, 0x00, 0x41, 0x02, 0x00, 0x43, 0xf2, 0x69,
+	0x56, 0xc0, 0xd7, 0x88, 0x20, 0x40, 0x09, 0x01, 0xc5, 0x7e, 0x98, 0xc0, 0x5a, 0xce, 0x42, 0x02,
+	0x03, 0x19, 0x88, 0xc1, 0x06, 0xc0, 0x08, 0x33, 0x89, 0xbd, 0xb2, 0x49, 0x07, 0xb4, 0x01, 0x80,
+	0x23, 0xc0, 0x02, 0x01, 0x7f, 0xce, 0x50, 0x41, 0xf2, 0xcd, 0x23, 0x84, 0xc2, 0x31, 0xf7, 0x8b,
+	0x50, 0x01, 0x42, 0x12, 0x9a, 0x46, 0x43, 0xf2, 0x6f, 0x9d, 0x33, 0x78, 0x31, 0xc5, 0x0b, 0x0e,
+	0x74, 0x41, 0x0c, 0xd6, 0x41, 0x11, 0xe1, 0x23, 0xc4, 0xa2, 0x03, 0x45, 0x04, 0x25, 0x33, 0xfe,
+	0x49, 0x04, 0x00, 0x12, 0xeb, 0x69, 0x59, 0x46, 0x13, 0xdb, 0x43, 0xeb, 0xc2, 0x6d, 0x38, 0x3a,
+	0x41, 0x3b, 0x99, 0x50, 0xef, 0x40, 0xf2, 0x64, 0x20, 0xc0, 0x2a, 0x01, 0x42, 0xf6, 0xd3, 0x81,
+	0x43, 0xc1, 0x65, 0xc7, 0x21, 0x41, 0x40, 0x5d, 0xeb, 0x69, 0xde, 0xc1, 0x0b, 0x43, 0xf6, 0x3d,
+	0x43, 0x43, 0x11, 0x5b, 0x46, 0xfd, 0x7b, 0x44, 0x49, 0x4b, 0x46, 0x46, 0x22, 0x51, 0x46, 0xff,
+	0xa3, 0x62, 0xa3, 0x5c, 0x50, 0x46, 0xb3, 0x43, 0xff, 0x0b, 0x43, 0x33, 0x21, 0xdb, 0xb2, 0xa3,
+	0x54, 0xff, 0x63, 0x5c, 0x37, 0x3a, 0x93, 0x43, 0x03, 0x43, 0xbf, 0xdb, 0xb2, 0x63, 0x54, 0x02,
+	0x23, 0xc7, 0x0a, 0x0e, 0xbf, 0x31, 0xa3, 0x62, 0x63, 0x5c, 0xb3, 0x44, 0x06, 0x30, 0xff, 0x23,
+	0xe1, 0x5c, 0x04, 0x20, 0x0a, 0x40, 0x10, 0xdf, 0x21, 0x0a, 0x43, 0xe2, 0x54, 0x44, 0x78, 0x23,
+	0x99, 0xfd, 0x68, 0xc1, 0x95, 0x01, 0x43, 0x99, 0x60, 0xda, 0x68, 0xde, 0xc2, 0x91, 0x43, 0xda,
+	0x60, 0x41, 0x46, 0x1e, 0x42, 0xf2, 0xfd, 0xdd, 0x44, 0x02, 0x20, 0x00, 0x42, 0xf2, 0x81, 0x53,
+	0xfb, 0x30, 0x30, 0xc4, 0xb1, 0x00, 0xb0, 0xb9, 0x23, 0x00, 0xcf, 0x5c, 0x33, 0x19, 0x78, 0xc4,
+	0xea, 0xc8, 0x3c, 0x45, 0xf2, 0xef, 0xd7, 0x73, 0x6c, 0x34, 0xc1, 0x02, 0x08, 0x22, 0x00, 0xfb,
+	0x21, 0x20, 0xc0, 0x34, 0x43, 0x46, 0xe3, 0x80, 0x28, 0xfb, 0x00, 0x3c, 0xc4, 0xfb, 0xab, 0x46,
+	0xf8, 0xbd, 0xc0, 0xff, 0x46, 0x03, 0x78, 0x02, 0x2b, 0x34, 0xd0, 0x29, 0xff, 0xd9, 0x03, 0x2b,
+	0x10, 0xd0, 0x04, 0x2b, 0x0c, 0xff, 0xd1, 0x47, 0xf6, 0xfe, 0x72, 0x43, 0x88, 0x93, 0xff, 0x42,
+	0x42, 0xd8, 0x40, 0xf2, 0xff, 0x31, 0xc2, 0xff, 0x88, 0x8a, 0x42, 0x4b, 0xd0, 0x01, 0x32, 0xc2,
+	0x7f, 0x80, 0x83, 0x80, 0x00, 0x20, 0x70, 0x47, 0x45, 0x07, 0xff, 0x2d, 0xd8, 0x22, 0x49, 0x47,
+	0xf6, 0xff, 0x72, 0xff, 0x8c, 0x46, 0xd2, 0x1a, 0x83, 0x88, 0x63, 0x44, 0xff, 0xd9, 0x17, 0x5b,
+	0x18, 0x4b, 0x40, 0x9a, 0x42, 0xff, 0x02, 0xdd, 0xc3, 0x88, 0x01, 0x33, 0xc3, 0x80, 0xff, 0x00,
+	0x23, 0x03, 0x70, 0xe6, 0xe7, 0x01, 0x2b, 0xeb, 0xe4, 0xd1, 0x40, 0x5e, 0x23, 0xc1, 0x03, 0x83,
+	0x80, 0x02, 0xdf, 0x33, 0x03, 0x70, 0xdc, 0xe7, 0x40, 0x10, 0x73, 0x42, 0x7f, 0x88, 0x9a, 0x42,
+	0x07, 0xd8, 0x04, 0x21, 0xc1, 0x0a, 0xff, 0x9b, 0xb2, 0x01, 0x70, 0xc3, 0x80, 0x82, 0x80, 0xff,
+	0xcf, 0xe7, 0xc3, 0x88, 0x03, 0x21, 0x01, 0x3b, 0xff, 0x9b, 0xb2, 0xf6, 0xe7, 0xc2, 0x88, 0x92,
+	0xb1, 0xfb, 0x01, 0x3a, 0xc1, 0x1c, 0xc4, 0xe7, 0x08, 0x4a, 0x94, 0xfb, 0x46, 0x82, 0x40, 0x18,
+	0x62, 0x44, 0xd1, 0x17, 0x52, 0xbf, 0x18, 0x4a, 0x40, 0x93, 0x42, 0xd0, 0xc1, 0x18, 0x3b, 0xff,
+	0xc3, 0x80, 0xcc, 0xe7, 0x00, 0x22, 0x02, 0x70, 0xff, 0x83, 0x80, 0xb2, 0xe7, 0x01, 0x80, 0xff,
+	0xff, 0xfc, 0xc3, 0xea, 0xc1, 0x40, 0x09, 0x44, 0x00, 0xb5, 0x00, 0x23, 0x5f, 0x82, 0xb0, 0x18,
+	0x22, 0x1f, 0xc1, 0x73, 0x04, 0x41, 0x44, 0x75, 0xa0, 0x40, 0x80, 0x34, 0x41, 0x02, 0x04, 0x22,
+	0x00, 0xc2, 0x7c, 0x3f, 0xf6, 0x31, 0x55, 0x5e, 0x32, 0x01, 0x40, 0xdc, 0xc4, 0x4b, 0xfb, 0x05,
+	0xa8, 0xc0, 0xdc, 0x08, 0x22, 0xdb, 0x05, 0x9a, 0xf5, 0x61, 0x43, 0x11, 0x71, 0x48, 0x52, 0x63,
+	0x78, 0x43, 0xb9, 0xef, 0x43, 0xf2, 0x6d, 0x15, 0xc1, 0x09, 0x02, 0x20, 0xa8, 0xbe, 0xc0, 0x03,
+	0x00, 0x2b, 0xfa, 0xd0, 0x6a, 0xc4, 0x1b, 0x6d, 0x7f, 0x25, 0x00, 0x26, 0x02, 0x23, 0x02, 0x32,
+	0xc7, 0x12, 0xdf, 0x66, 0x70, 0xa8, 0x47, 0xa3, 0xc0, 0x08, 0x47, 0xd1, 0xff, 0x6c, 0x25, 0x63,
+	0x5d, 0x5b, 0xbb, 0x23, 0x78, 0x3d, 0x6b, 0xc2, 0x0f, 0x44, 0xf2, 0x69, 0x66, 0xc1, 0x07, 0xc3,
+	0xfd, 0xf5, 0x04, 0x40, 0x12, 0x23, 0x40, 0x09, 0xf9, 0xd0, 0x00, 0x23, 0x5b, 0x23, 0x70, 0x43,
+	0x1f, 0x5a, 0x61, 0xe1, 0x0a, 0x02, 0xc4, 0xf3, 0xff, 0x6b, 0x46, 0x26, 0x00, 0x5b, 0x88, 0x6c,
+	0x36, 0x7f, 0x73, 0x80, 0x41, 0xf6, 0x21, 0x73, 0x30, 0x44, 0x2b, 0xff, 0x5e, 0x23, 0xf2, 0x88,
+	0xe2, 0x52, 0x63, 0x5d, 0xaf, 0x00, 0x2b, 0xc2, 0xd1, 0x41, 0x8b, 0x05, 0x46, 0x8b, 0xba, 0xff,
+	0xe7, 0x6b, 0x46, 0x01, 0xad, 0x45, 0xf2, 0x0d, 0xff, 0x67, 0x2e, 0x70, 0x45, 0xf2, 0x59, 0x06,
+	0x58, 0x7d, 0x88, 0xc0, 0x05, 0x07, 0x20, 0x62, 0xb8, 0x47, 0x41, 0x19, 0xff, 0x21, 0x6b, 0xb0,
+	0x47, 0x44, 0xf6, 0x71, 0x13, 0xfb, 0xa1, 0x6b, 0x43, 0x0b, 0x64, 0x23, 0xe3, 0x5c, 0x80, 0xbf,
+	0x46, 0x9b, 0xb1, 0x60, 0x6a, 0xb8, 0xc0, 0x92, 0xb1, 0xdb, 0x27, 0xe1, 0xc1, 0x05, 0x07, 0xb8,
+	0xc0, 0x08, 0x89, 0x43, 0xfd, 0x61, 0xc4, 0x08, 0x21, 0x6c, 0xb0, 0x47, 0x01, 0x1c, 0xff, 0x40,
+	0x46, 0xb8, 0x47, 0x80, 0x46, 0x85, 0x21, 0x6f, 0x40, 0x46, 0xc9, 0x05, 0xc1, 0x10, 0xa9, 0x03,
+	0x43, 0x07, 0xff, 0xa2, 0x78, 0x68, 0x70, 0x53, 0x1e, 0x9a, 0x41, 0xff, 0x44, 0xf2, 0xd9, 0x63,
+	0x00, 0x0a, 0xa8, 0x70, 0xdf, 0xd2, 0xb2, 0x03, 0x21, 0x28, 0x44, 0x29, 0x71, 0xe7, 0xff, 0xc0,
+	0x46, 0xf0, 0xb5, 0xd6, 0x46, 0x4f, 0x46, 0xc5, 0x46, 0xc6, 0x6d, 0xc0, 0xff, 0x6d, 0xed, 0x6d,
+	0x40, 0x6d, 0x02, 0x23, 0x60, 0xc1, 0x07, 0x41, 0x0d, 0xc1, 0x6d, 0x7f, 0x48, 0x6b, 0x48, 0x6c,
+	0x26, 0x45, 0x48, 0xe3, 0x68, 0x70, 0xc1, 0x48, 0xc1, 0x05, 0xc3, 0x49, 0x98, 0x47, 0xa3, 0xfe,
+	0xc0, 0x70, 0x31, 0xd1, 0xc0, 0x26, 0x08, 0x23, 0x42, 0xff, 0xf6, 0x65, 0x48, 0x42, 0xf6, 0x75,
+	0x47, 0x43, 0x7f, 0xf2, 0x00, 0x09, 0xf6, 0x05, 0x73, 0x61, 0x40, 0x09, 0xf5, 0x08, 0xc1, 0x1a,
+	0xc4, 0xc0, 0x03, 0x48, 0xf2, 0x00, 0x0a, 0xcb, 0x0a, 0xe0, 0xc0, 0x8b, 0x63, 0xc3, 0x14, 0x40,
+	0x3c, 0x13, 0x04, 0xf9, 0x20, 0xc3, 0x02, 0x40, 0x5b, 0x47, 0x4b, 0x46, 0x34, 0x68, 0xff, 0x1a,
+	0x6a, 0x33, 0x69, 0x28, 0x00, 0x53, 0x40, 0xff, 0x1c, 0x40, 0x54, 0x40, 0xb8, 0x47, 0x53, 0x46,
+	0x7f, 0x23, 0x42, 0xe6, 0xd0, 0x02, 0xb0, 0x1c, 0x40, 0x91, 0xd7, 0x99, 0x46, 0xa2, 0x42, 0x92,
+	0x27, 0x41, 0x92, 0x37, 0x7b, 0x4a, 0x42, 0x92, 0x38, 0x46, 0x92, 0xfa, 0x40, 0x92, 0x41, 0x21,
+	0xbc, 0x4c, 0x92, 0xff, 0xb4, 0xe7, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0xff, 0x45, 0x46, 0xde,
+	0x46, 0x41, 0xf2, 0xf1, 0x73, 0xfb, 0xe0, 0xb5, 0xc1, 0x05, 0x83, 0xb0, 0x01, 0x93, 0x41, 0xf7,
+	0xf6, 0x75, 0x13, 0xc1, 0x6c, 0x41, 0xf6, 0x39, 0x39, 0xff, 0x41, 0xf6, 0xe9, 0x77, 0x42, 0xf2,
+	0x9d, 0x18, 0xfa, 0xc0, 0x26, 0x6b, 0x40, 0x25, 0x1a, 0x65, 0x26, 0x64, 0x25, 0xc8, 0xc1, 0x09,
+	0xc1, 0x73, 0xc0, 0x01, 0x09, 0x41, 0x30, 0x41, 0x32, 0x00, 0x93, 0xfa, 0x40, 0x01, 0x0b, 0xc0,
+	0x00, 0x0a, 0xa3, 0x78, 0x6b, 0xb1, 0xbf, 0xa3, 0x5d, 0xd3, 0xb9, 0xb8, 0x47, 0xc1, 0xaf, 0xf7,
+	0x7d, 0xd0, 0x41, 0xd1, 0xf4, 0xd0, 0x01, 0x9b, 0x98, 0xc2, 0xd3, 0xdf, 0xf1, 0xd1, 0x23, 0x7e,
+	0x43, 0xc0, 0x07, 0x6b, 0xb9, 0xdd, 0xc0, 0xc2, 0x07, 0xe7, 0xd0, 0x00, 0x40, 0x06, 0xe4, 0xe7,
+	0xfd, 0xd8, 0xc0, 0xc7, 0xd0, 0x47, 0xe0, 0xe7, 0xc8, 0x47, 0x77, 0xa0, 0x66, 0xe1, 0x42, 0x01,
+	0xee, 0xe7, 0xfe, 0xc0, 0x97, 0x5f, 0x45, 0xf6, 0x40, 0x41, 0x40, 0x43, 0x83, 0x01, 0xc1, 0x77,
+	0xff, 0x10, 0xb5, 0x81, 0x42, 0x0f, 0xd0, 0x40, 0xf2, 0xfd, 0x18, 0x41, 0x20, 0x03, 0x98, 0x42,
+	0x09, 0xd2, 0xc2, 0xff, 0x43, 0xd2, 0x18, 0x45, 0xf2, 0xc5, 0x73, 0x92, 0x8f, 0x08, 0x01, 0x32,
+	0x92, 0x44, 0x3d, 0xc0, 0x07, 0xc0, 0x9a, 0xfc, 0xa9, 0x23, 0x41, 0x0c, 0xc3, 0x09, 0x0a, 0xc4,
+	0x09, 0xd7, 0xc4, 0x09, 0x00, 0xb5, 0x21, 0x43, 0x0a, 0x41, 0x40, 0x01, 0x7f, 0x22, 0xc1, 0x02,
+	0x93, 0xff, 0x43, 0x4e, 0xf6, 0x00, 0x52, 0xce, 0xf2, 0x00, 0x7f, 0x02, 0x93, 0x60, 0x45, 0xf2,
+	0x75, 0x73, 0xc3, 0x07, 0xef, 0x44, 0xf2, 0x21, 0x43, 0x43, 0x02, 0xfe, 0xe7, 0x43, 0xef, 0xf6,
+	0x4d, 0x13, 0x70, 0x42, 0x49, 0x98, 0x47, 0xc0, 0xff, 0x22, 0x08, 0x23, 0xd2, 0x05, 0x53, 0x61,
+	0x08, 0xdf, 0x21, 0x93, 0x60, 0xc0, 0x24, 0xc0, 0x74, 0x03, 0x43, 0x77, 0x25, 0x01, 0x20, 0xc0,
+	0x72, 0x03, 0x24, 0x06, 0x40, 0x01, 0xff, 0x01, 0x99, 0x62, 0x9c, 0x62, 0x59, 0x5d, 0x81, 0xf7,
+	0x43, 0x59, 0x55, 0xc0, 0x76, 0x01, 0x91, 0x61, 0x91, 0xdd, 0x60, 0xc0, 0x01, 0x02, 0x4f, 0x21,
+	0xc0, 0x06, 0x02, 0x9a, 0xfe, 0xc0, 0x06, 0x5a, 0x5c, 0x82, 0x43, 0x5a, 0x54, 0x70, 0xff, 0xbd,
+	0x40, 0xf6, 0x00, 0x03, 0x80, 0x21, 0x10, 0xfd, 0xb5, 0x41, 0x0e, 0x1a, 0x69, 0x0a, 0x43, 0x1a,
+	0x61, 0xff, 0x9a, 0x69, 0x7c, 0x39, 0x0a, 0x43, 0x9a, 0x61, 0x6f, 0x43, 0xf6, 0xd5, 0x23, 0xc3,
+	0x1a, 0x10, 0xbd, 0xc0, 0x41, 0x5e, 0x40, 0x2e, 0xf0, 0xb5, 0xc1, 0xb0, 0xc0, 0x42, 0x12, 0xc3,
+	0x2e, 0xff, 0x04, 0x00, 0x68, 0x46, 0x98, 0x47, 0x80, 0x20, 0xef, 0x43, 0xf6, 0xed, 0x33, 0x41,
+	0x05, 0x69, 0x46, 0xc0, 0x7e, 0x44, 0xa4, 0x08, 0xb1, 0x41, 0xb0, 0xf0, 0xbd, 0x41, 0x06, 0xf3,
+	0xd9, 0x23, 0xc5, 0x04, 0x41, 0x48, 0x21, 0x00, 0x34, 0x22, 0xfb, 0x68, 0x46, 0xc1, 0x03, 0x80,
+	0x25, 0x43, 0xf6, 0x1d, 0xdf, 0x36, 0x98, 0x47, 0x00, 0x24, 0x40, 0x0e, 0x17, 0xed, 0xfe, 0xc1,
+	0x08, 0x06, 0x21, 0x00, 0x2d, 0x19, 0x40, 0x22, 0xff, 0x69, 0x44, 0x28, 0x00, 0xb0, 0x47, 0x00,
+	0x28, 0xff, 0xdd, 0xd1, 0x40, 0x34, 0xbc, 0x42, 0xf4, 0xd1, 0xfb, 0xd9, 0xe7, 0xc3, 0x1e, 0x70,
+	0xb5, 0x34, 0x22, 0x82, 0x79, 0xb0, 0x45, 0x1e, 0xc5, 0x1d, 0x34, 0x22, 0x21, 0x00, 0x45, 0x18,
+	0xff, 0x05, 0x00, 0x10, 0xb1, 0x28, 0x00, 0x02, 0xb0, 0xff, 0x70, 0xbd, 0x44, 0xf6, 0x95, 0x03,
+	0x20, 0x68, 0xfe, 0x43, 0x05, 0xb0, 0xb9, 0x2c, 0x22, 0xa3, 0x5c, 0x01, 0xff, 0x3b, 0x09, 0x2b,
+	0x39, 0xd9, 0x08, 0x23, 0xa3, 0xff, 0x54, 0x1f, 0x4a, 0xf9, 0x33, 0x94, 0x46, 0xff, 0xff, 0x33,
+	0xe3, 0x85, 0x23, 0x8e, 0x63, 0x44, 0x01, 0xd7, 0x2b, 0x23, 0xd8, 0xc1, 0xa4, 0x20, 0xc4, 0x6d,
+	0xde, 0xe7, 0xff, 0x44, 0xf2, 0x88, 0x53, 0xcb, 0xf6, 0x4a, 0x53, 0xff, 0x23, 0x60, 0x63, 0x61,
+	0x00, 0x23, 0xcc, 0xf2, 0xdf, 0x48, 0x33, 0x63, 0x60, 0xa3, 0x40, 0x02, 0xe3, 0x60, 0xff, 0x23,
+	0x62, 0xa3, 0x60, 0xe3, 0x61, 0x23, 0x61, 0xff, 0x63, 0x62, 0x00, 0x23, 0xc4, 0xf2, 0xc8, 0x13,
+	0xff, 0xa3, 0x62, 0x08, 0x22, 0x2c, 0x23, 0xe2, 0x54, 0xfb, 0xd5, 0x33, 0x41, 0x13, 0x25, 0x86,
+	0x6b, 0x46, 0x9e, 0xbf, 0x1d, 0x41, 0xf2, 0x71, 0x13, 0x30, 0xc4, 0x12, 0x33, 0xff, 0x88, 0x23,
+	0x86, 0xd0, 0xe7, 0x03, 0x4a, 0x23, 0x77, 0x8e, 0x94, 0x46, 0x41, 0x1a, 0xb0, 0xd9, 0xed, 0xc0,
+	0x32, 0xbf, 0x22, 0xfd, 0xff, 0xff, 0x10, 0xb5, 0x40, 0x3d, 0x14, 0x3e, 0x42, 0x47, 0xf2, 0x40,
+	0x04, 0x90, 0xb0, 0x45, 0x1f, 0xc1, 0x39, 0xef, 0x40, 0x22, 0x00, 0x21, 0xc3, 0x48, 0x98, 0x47,
+	0x6a, 0x5f, 0x46, 0x73, 0x23, 0x13, 0x70, 0x40, 0x4a, 0x33, 0xc0, 0x45, 0xed, 0x46, 0x45, 0x09,
+	0x10, 0xb0, 0xc1, 0x63, 0x10, 0xb5, 0x43, 0xff, 0xb2, 0x90, 0xb0, 0x04, 0x00, 0x00, 0x2b, 0x22,
+	0x19, 0xdd, 0x40, 0x13, 0xc3, 0x5a, 0xf2, 0x40, 0x4c, 0x12, 0x41, 0x03, 0x41, 0x69, 0xff, 0x6b,
+	0x46, 0x6a, 0x46, 0x1c, 0x70, 0x73, 0x23, 0xe2, 0x41, 0x0a, 0x53, 0x46, 0x14, 0xc7, 0x0b, 0xc1,
+	0x14, 0x0d, 0x20, 0x40, 0xd3, 0x42, 0xfa, 0xc0, 0xe4, 0xc1, 0x55, 0x06, 0x40, 0xaf, 0x00, 0x20,
+	0xf7, 0xa1, 0xb0, 0x02, 0x4a, 0x09, 0x04, 0x00, 0x28, 0xbb, 0xff, 0x6b, 0x46, 0x5b, 0x78, 0x73,
+	0x2b, 0x24, 0xd0, 0x96, 0xd3, 0x1c, 0x10, 0xad, 0x45, 0x1d, 0x28, 0xc0, 0x68, 0xc3, 0x1b, 0x6b,
+	0x7e, 0xc2, 0x1b, 0x12, 0x27, 0x40, 0x22, 0x29, 0x00, 0x45, 0x0b, 0xff, 0x2f, 0x70, 0x98, 0x47,
+	0x37, 0x70, 0x20, 0x00, 0xfd, 0x21, 0xc0, 0x89, 0x6b, 0x46, 0x1b, 0x78, 0x33, 0x70, 0xfd, 0xf8,
+	0xc0, 0x46, 0x83, 0x69, 0x10, 0xb5, 0x03, 0xb1, 0xfa, 0xc3, 0x9b, 0xc3, 0xc8, 0x02, 0xf0, 0xb5,
+	0xce, 0x46, 0x47, 0xff, 0x46, 0x80, 0xb5, 0x03, 0x6a, 0x83, 0xb0, 0x5b, 0xff, 0x5c, 0x90, 0x46,
+	0x5c, 0x00, 0xe4, 0x18, 0x83, 0xff, 0x6a, 0xe4, 0x00, 0x9c, 0x46, 0x64, 0x44, 0x23, 0xff, 0x1d,
+	0x99, 0x46, 0x13, 0x1c, 0x6a, 0x46, 0x43, 0xff, 0xf2, 0xb5, 0x57, 0xd3, 0x71, 0x05, 0x00, 0x0e,
+	0xdf, 0x00, 0x48, 0x46, 0xd1, 0x79, 0xc0, 0x18, 0x07, 0xb8, 0xbf, 0x47, 0x43, 0xf2, 0xcd, 0x73,
+	0x28, 0x44, 0x27, 0x01, 0xff, 0x28, 0x12, 0xd9, 0x43, 0x46, 0x48, 0x46, 0x19, 0xff, 0x0a, 0xb8,
+	0x47, 0xa3, 0x8a, 0x01, 0x33, 0x9b, 0xff, 0xb2, 0x01, 0x33, 0xa3, 0x82, 0x23, 0x68, 0x13, 0xf7,
+	0xb1, 0x31, 0x00, 0xc1, 0x2a, 0x03, 0xb0, 0x0c, 0xbc, 0xff, 0x90, 0x46, 0x99, 0x46, 0xf0, 0xbd,
+	0xa3, 0x8a, 0xfd, 0xf1, 0xc0, 0x22, 0xf8, 0xb5, 0x47, 0x46, 0xce, 0x46, 0xff, 0x06, 0x00, 0x80,
+	0xb5, 0x1c, 0x00, 0x08, 0xab, 0xff, 0x88, 0x46, 0x15, 0x00, 0x1f, 0x78, 0x00, 0x20, 0xff, 0x1e,
+	0xb1, 0x11, 0xb1, 0x0a, 0xb1, 0x00, 0x2f, 0xff, 0x3e, 0xd1, 0x45, 0xf6, 0x14, 0x21, 0x43, 0xf2,
+	0xd7, 0xb9, 0x49, 0x3f, 0xc1, 0xee, 0x01, 0xc0, 0x00, 0x09, 0xc8, 0xff, 0x47, 0x62, 0x1c, 0xfb,
+	0x0f, 0xd0, 0x17, 0xba, 0xf7, 0x42, 0x58, 0x41, 0x41, 0x07, 0x40, 0x22, 0xc0, 0xb2, 0xfe, 0xc1,
+	0x06, 0xc8, 0x47, 0x00, 0x23, 0xff, 0x22, 0xea, 0xff, 0x54, 0x01, 0x33, 0xdb, 0xb2, 0x9c, 0x42,
+	0xfa, 0xbf, 0xd2, 0x24, 0x23, 0x35, 0x62, 0xf4, 0x40, 0x03, 0xf7, 0xff, 0x54, 0x09, 0x9b, 0x41,
+	0x46, 0xb3, 0x62, 0x43, 0xf7, 0xf2, 0x21, 0x63, 0xc5, 0x8c, 0x70, 0xb9, 0x42, 0xf2, 0x7d, 0x81,
+	0x42, 0xfe, 0xb3, 0x60, 0x42, 0xf2, 0x69, 0x42, 0x02, 0xb5, 0x33, 0x40, 0x02, 0x75, 0x42, 0x02,
+	0x73, 0x60, 0xc3, 0x28, 0xf8, 0xff, 0xbd, 0x09, 0x98, 0x43, 0x1e, 0x98, 0x41, 0xc0, 0xfb, 0xb2,
+	0xbb, 0xc0, 0x6b, 0xd6, 0x46, 0x46, 0x46, 0x4f, 0xff, 0x46, 0x04, 0x00, 0xc0, 0xb5, 0x0d, 0x00,
+	0x92, 0xff, 0x46, 0x98, 0x46, 0x00, 0x28, 0x4a, 0xd0, 0x00, 0x9f, 0x2a, 0x48, 0xd0, 0x40, 0x46,
+	0xc3, 0x08, 0x45, 0x2a, 0x24, 0x7b, 0x27, 0x66, 0xc8, 0x2a, 0x00, 0x20, 0xe3, 0x5d, 0x41, 0x06,
+	0xef, 0xab, 0x42, 0x40, 0x41, 0x42, 0x05, 0xb2, 0x67, 0x22, 0xff, 0xc8, 0x47, 0x21, 0x6a, 0x4b,
+	0x5d, 0xff, 0x2b, 0xff, 0x2c, 0xd1, 0xe0, 0x5d, 0x00, 0x22, 0x00, 0x27, 0xff, 0x8b, 0x5c, 0x01,
+	0x32, 0xff, 0x3b, 0x5e, 0x1e, 0xff, 0xb3, 0x41, 0xd2, 0xb2, 0xff, 0x18, 0xff, 0xb2, 0xff, 0x82,
+	0x42, 0xf5, 0xd9, 0x25, 0x23, 0xe3, 0x5c, 0xff, 0xbb, 0x42, 0x1e, 0xd3, 0x7b, 0x00, 0xdb, 0x19,
+	0xff, 0xdb, 0x00, 0x99, 0x46, 0xa3, 0x6a, 0x42, 0x46, 0xff, 0x4b, 0x44, 0x18, 0x00, 0x43, 0xf2,
+	0x25, 0x53, 0xf7, 0x04, 0x30, 0x51, 0x44, 0xae, 0x58, 0xb9, 0x23, 0x6a, 0xff, 0x5f, 0x55, 0xa3,
+	0x6a, 0x4b, 0x44, 0x98, 0x82, 0xf5, 0x1c, 0xc2, 0x2c, 0xa2, 0x40, 0x56, 0x00, 0x20, 0xb8, 0xe7,
+	0xee, 0x41, 0x99, 0xf5, 0xe7, 0x1c, 0x40, 0x01, 0xf2, 0xe7, 0xf8, 0x6d, 0xb5, 0x40, 0x20, 0x25,
+	0x06, 0xc0, 0x0e, 0xb9, 0x44, 0xc2, 0x2a, 0xaf, 0xf2, 0x00, 0x05, 0x0f, 0x41, 0x42, 0x04, 0x40,
+	0x8a, 0xb2, 0xff, 0x83, 0x22, 0xa0, 0x47, 0x24, 0x23, 0x00, 0x20, 0x5f, 0xf3, 0x5c, 0x29, 0x00,
+	0xbb, 0x40, 0x29, 0x84, 0xc0, 0x53, 0x7d, 0xa0, 0xc0, 0x74, 0xa5, 0x73, 0x30, 0x00, 0x39, 0xc4,
+	0x4b, 0xa7, 0x00, 0x20, 0xf8, 0xc0, 0x87, 0xdb, 0x11, 0x8f, 0xcc, 0x11, 0x90, 0xfa, 0xc4, 0x11,
+	0xb9, 0xce, 0x11, 0xf0, 0xb5, 0xc6, 0x46, 0x1c, 0x9f, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x41, 0x11,
+	0xc4, 0x4d, 0x48, 0xd7, 0x00, 0xb5, 0x16, 0x40, 0x11, 0x9c, 0xc5, 0x4e, 0x08, 0xc0, 0xa6, 0x42,
+	0x13, 0xeb, 0x5c, 0xc1, 0x07, 0xc1, 0x13, 0x9d, 0xc4, 0x79, 0xc0, 0xff, 0x47, 0x01, 0x2e, 0x1d,
+	0xd0, 0xa6, 0xb1, 0x02, 0xff, 0x2e, 0x0d, 0xd1, 0xec, 0x61, 0x63, 0x1e, 0x9c, 0xff, 0x41, 0xe3,
+	0xb2, 0x43, 0xf6, 0x79, 0x04, 0x28, 0xdb, 0x00, 0x32, 0xc3, 0x19, 0x04, 0xa0, 0xc0, 0x19, 0x01,
+	0xe0, 0xfa, 0x41, 0x40, 0x04, 0xc0, 0x44, 0xf0, 0xbd, 0x2b, 0x6a, 0xda, 0xff, 0x5d, 0x53, 0x00,
+	0x9b, 0x18, 0xaa, 0x6a, 0xdb, 0xff, 0x00, 0x9c, 0x50, 0xe5, 0xe7, 0xac, 0x61, 0xe3, 0xfa, 0xc0,
+	0x73, 0x4f, 0xc0, 0x73, 0xd6, 0x46, 0xc0, 0xb5, 0x04, 0xd7, 0x00, 0x82, 0xb0, 0xc2, 0x9d, 0x00,
+	0x00, 0xa8, 0xd1, 0x6e, 0x7f, 0xe0, 0x00, 0x2a, 0x6c, 0xd0, 0x18, 0x00, 0xca, 0x74, 0xab, 0x46,
+	0xbc, 0x41, 0x25, 0x06, 0x41, 0x1f, 0xb0, 0x40, 0x25, 0x42, 0xa9, 0x46, 0x40, 0x75, 0xc2, 0x25,
+	0x93, 0x44, 0x75, 0xbd, 0xc0, 0x26, 0xb0, 0xfa, 0xc2, 0xc1, 0x20, 0x44, 0x3a, 0x97, 0xfb, 0xf0,
+	0xf3, 0x58, 0xcf, 0x43, 0x3b, 0x1a, 0x58, 0x44, 0xa9, 0xc3, 0x2e, 0xbf, 0x22, 0xff, 0xb0, 0x47,
+	0x42, 0x46, 0x23, 0x6a, 0x01, 0xa8, 0xeb, 0x9a, 0x5c, 0x41, 0x24, 0xa2, 0x40, 0x24, 0x91, 0x46,
+	0x99, 0x5f, 0x44, 0x42, 0xf6, 0x65, 0x43, 0xc4, 0xfe, 0x23, 0x41, 0x79, 0xed, 0x98, 0xc0, 0xd9,
+	0xf9, 0x53, 0x43, 0x04, 0x42, 0xf6, 0x75, 0xfb, 0x43, 0x06, 0x42, 0x15, 0x01, 0xa8, 0x98, 0x47,
+	0x06, 0xff, 0xb3, 0xff, 0xb1, 0x43, 0xf2, 0x69, 0x5a, 0x01, 0xdf, 0x3e, 0xae, 0x19, 0x00, 0x24,
+	0x40, 0x05, 0x0a, 0x02, 0xff, 0xe0, 0x01, 0x35, 0xa7, 0x42, 0x06, 0xd0, 0x01, 0xff, 0x34, 0x29,
+	0x00, 0x40, 0x46, 0xa4, 0xb2, 0xd0, 0xff, 0x47, 0xae, 0x42, 0xf5, 0xd1, 0x20, 0x00, 0x4b, 0xff,
+	0x46, 0x9b, 0x8a, 0x1c, 0x1b, 0x4b, 0x46, 0x9c, 0xf7, 0x82, 0x02, 0xb0, 0xc9, 0x86, 0x94, 0xe7,
+	0x00, 0x20, 0xd7, 0x00, 0x24, 0xef, 0xc0, 0xde, 0x10, 0xc1, 0x73, 0x21, 0x04, 0x98, 0xc2, 0x3a,
+	0x40, 0x39, 0x41, 0x20, 0x01, 0xd6, 0x43, 0x59, 0xc0, 0x1d, 0x43, 0xbb, 0xf2, 0xe1, 0x46, 0x33,
+	0x00, 0x20, 0x10, 0xc0, 0x6d, 0x70, 0x26, 0x40, 0xbe, 0x04, 0x00, 0xc2, 0x44, 0x44, 0x0c, 0xe0,
+	0x43, 0x6b, 0x46, 0x0c, 0xaf, 0x91, 0x73, 0x29, 0x00, 0xc7, 0x0c, 0x70, 0xd2, 0x0c, 0xea, 0xfa,
+	0xcc, 0x0c, 0xf9, 0xce, 0x0c, 0xf8, 0xb5, 0xce, 0x46, 0x47, 0x9d, 0x46, 0xc1, 0x9a, 0x80, 0xb5,
+	0x06, 0xc0, 0x65, 0xc9, 0x9b, 0x88, 0xef, 0x46, 0x91, 0x46, 0x29, 0x42, 0x79, 0xc0, 0xb2, 0xff,
+	0xde, 0x4c, 0x9c, 0x40, 0xf2, 0x00, 0x12, 0xc2, 0x9c, 0xf6, 0x3d, 0xff, 0x04, 0x30, 0x00, 0x3b,
+	0x00, 0x4a, 0x46, 0x41, 0xf9, 0x46, 0xc5, 0x83, 0x45, 0xf4, 0xef, 0xf3, 0x10, 0x83, 0x03, 0xff,
+	0x60, 0x72, 0xb6, 0xbf, 0xf3, 0x5f, 0x8f, 0x70, 0xf7, 0x47, 0xc0, 0x46, 0xc1, 0x01, 0x03, 0x68,
+	0x83, 0xf3, 0xdf, 0x10, 0x88, 0x70, 0x47, 0x70, 0xc0, 0x82, 0x0d, 0x00, 0x37, 0xc0, 0xb1, 0x08,
+	0x46, 0x7f, 0x30, 0x21, 0xc5, 0x45, 0xc1, 0x27, 0xbb, 0x32, 0x22, 0xc0, 0x2b, 0xf6, 0x9d, 0x13,
+	0xc7, 0x2b, 0x08, 0xbf, 0xb9, 0x60, 0x60, 0xa0, 0x60, 0x70, 0x40, 0x55, 0xe8, 0x7c, 0xc0, 0x53,
+	0xc3, 0x0f, 0xa8, 0xb1, 0x48, 0x42, 0x48, 0x48, 0x0f, 0xb9, 0x52, 0x45, 0xb4, 0x41, 0x3b, 0xf6,
+	0x1d, 0x23, 0x4b, 0x3b, 0x00, 0x57, 0x20, 0xea, 0xe7, 0xd3, 0x0d, 0x5e, 0xca, 0x0d, 0x31, 0xd0,
+	0x0d, 0xfe, 0xc1, 0xd1, 0x06, 0x00, 0x00, 0xb5, 0x0f, 0x00, 0x14, 0x7e, 0x40, 0x8c, 0x00, 0x20,
+	0x06, 0xb1, 0x59, 0xb3, 0xcd, 0x2c, 0x7d, 0x6a, 0xc2, 0x2c, 0x45, 0x23, 0x39, 0x00, 0x30, 0xc5,
+	0x2c, 0xff, 0xb3, 0x43, 0x46, 0xfd, 0x00, 0x75, 0x19, 0x6c, 0xff, 0x60, 0xab, 0x60, 0x7b, 0xb1,
+	0x43, 0xf6, 0x59, 0xdd, 0x28, 0x41, 0xdb, 0x21, 0x88, 0x3a, 0x41, 0x08, 0x47, 0x6b, 0xff, 0x68,
+	0x9c, 0x1c, 0xab, 0x68, 0x6c, 0x60, 0x01, 0xff, 0x3b, 0xab, 0x60, 0x00, 0x2b, 0xf3, 0xd1, 0x00,
+	0xed, 0x20, 0xc3, 0xd0, 0x22, 0xb1, 0xc5, 0xc4, 0xcd, 0xe7, 0x10, 0xaf, 0x00, 0xcb, 0xe7, 0x1d,
+	0x40, 0xd7, 0xf1, 0xc0, 0x3c, 0x03, 0x7f, 0x6a, 0x10, 0xb5, 0x03, 0xb1, 0x98, 0x47, 0xc1, 0x87,
+	0x9f, 0x43, 0xf2, 0xb5, 0x53, 0x10, 0xc0, 0x32, 0xc1, 0x19, 0x30, 0xff, 0x30, 0x98, 0x47, 0xe3,
+	0x6a, 0x0b, 0xb1, 0x20, 0x7d, 0x00, 0xc3, 0x06, 0x70, 0xb5, 0x05, 0x00, 0x0e, 0xc0, 0x29, 0x5f,
+	0x00, 0xb3, 0xf9, 0xb1, 0x10, 0xc6, 0x57, 0x4c, 0xc2, 0x2a, 0xef, 0x40, 0xf2, 0x51, 0x12, 0xc7,
+	0x3a, 0x28, 0x00, 0x44, 0xff, 0x23, 0x18, 0x38, 0xe9, 0x8d, 0xc2, 0x5a, 0x91, 0xff, 0x42, 0x0b,
+	0xd1, 0x06, 0x64, 0xc4, 0x52, 0x44, 0xdf, 0xf2, 0x15, 0x13, 0x31, 0x78, 0x43, 0x07, 0x20, 0x00,
+	0xae, 0xc1, 0x3e, 0xe1, 0xe7, 0x04, 0xc0, 0x1f, 0xf9, 0xc0, 0x1f, 0xf0, 0xbf, 0xb5, 0x47, 0x46,
+	0xce, 0x46, 0x80, 0x40, 0x99, 0x83, 0xff, 0xb0, 0x07, 0x00, 0x90, 0x46, 0x00, 0x28, 0x41, 0x5f,
+	0xd0, 0x00, 0x29, 0x3f, 0xd0, 0xcf, 0x18, 0x36, 0xc8, 0x18, 0x76, 0xc1, 0xdb, 0x01, 0xa8, 0x46,
+	0xa0, 0x53, 0x18, 0x37, 0xc1, 0x02, 0xfb, 0x38, 0x00, 0x4d, 0xdb, 0xee, 0xb1, 0x43, 0x46, 0xdb,
+	0xea, 0xc1, 0xdb, 0x59, 0xc6, 0xdb, 0x09, 0xc1, 0xdb, 0xa0, 0x45, 0x0c, 0xbe, 0xc2, 0xdb, 0x38,
+	0x00, 0xa4, 0xb2, 0xc8, 0xc4, 0xdb, 0x03, 0x7d, 0xb0, 0xc3, 0x98, 0xf0, 0xbd, 0x40, 0x46, 0xf8,
+	0xc0, 0xd8, 0xfd, 0xc1, 0xc0, 0x00, 0xf4, 0xe7, 0x44, 0x23, 0xc2, 0x5a, 0xbf, 0x10, 0xb5, 0x1a,
+	0xb9, 0x43, 0x6a, 0x43, 0x49, 0x46, 0xff, 0x21, 0x43, 0x5a, 0x01, 0x33, 0x9b, 0xb2, 0x43, 0xff,
+	0x52, 0x9a, 0x42, 0x05, 0xd1, 0x00, 0x23, 0x43, 0xff, 0x64, 0x83, 0x6a, 0x00, 0x2b, 0xf1, 0xd1,
+	0xf1, 0x9f, 0xe7, 0x02, 0x6c, 0xd1, 0x5c, 0x41, 0x3a, 0x43, 0x25, 0xe9, 0xea, 0xc0, 0x36, 0xf8,
+	0xc2, 0x85, 0x16, 0x40, 0xc0, 0x00, 0x28, 0x3e, 0xfe, 0x40, 0x35, 0x3c, 0xd0, 0x00, 0x2a, 0x3a,
+	0xd0, 0x18, 0xea, 0x4c, 0x36, 0x3a, 0xc8, 0x89, 0x20, 0xc0, 0xca, 0x25, 0x53, 0x3a, 0xdf, 0x00,
+	0x31, 0x00, 0x30, 0x30, 0x44, 0x04, 0xbb, 0x43, 0xf7, 0xf6, 0xd1, 0x63, 0xc7, 0x8e, 0xc8, 0xb9,
+	0x42, 0xf6, 0xfb, 0x35, 0x63, 0xc1, 0x02, 0xe3, 0x61, 0x42, 0xf6, 0xdd, 0xd5, 0x53, 0x41, 0x02,
+	0xa3, 0x40, 0x02, 0xb5, 0x42, 0x02, 0x63, 0x60, 0x57, 0x42, 0xf6, 0xd5, 0x42, 0x07, 0xa3, 0x40,
+	0x02, 0xc1, 0xc2, 0x04, 0xdf, 0xe3, 0x60, 0x60, 0x64, 0xf8, 0xc0, 0x5c, 0xc6, 0xe7, 0x6d, 0x0d,
+	0xc4, 0x5c, 0x70, 0xb5, 0xc1, 0x1e, 0x04, 0x00, 0x45, 0xf4, 0xf7, 0xc0, 0xb2, 0x63, 0xc8, 0x20,
+	0x44, 0xf2, 0x85, 0x03, 0xfe, 0x45, 0x1b, 0x05, 0x00, 0x78, 0xb9, 0x44, 0xf2, 0x1d, 0xdf, 0x16,
+	0x01, 0x22, 0x01, 0x21, 0x40, 0x04, 0x06, 0x20, 0x7f, 0x00, 0xb0, 0x47, 0x01, 0x22, 0x02, 0x21,
+	0xc3, 0x01, 0x85, 0x00, 0xc2, 0x01, 0x28, 0x40, 0x74, 0xc5, 0xce, 0x41, 0x14, 0xc5, 0x35, 0xc0,
+	0xa5, 0xb2, 0xc1, 0x10, 0x85, 0x42, 0x16, 0x41, 0x15, 0x9d, 0x46, 0x15, 0x38, 0xdf, 0xb1, 0x44,
+	0xf2, 0xa9, 0x03, 0xc7, 0x34, 0x70, 0xbd, 0xab, 0x7f, 0x21, 0x42, 0x04, 0x40, 0x45, 0x04, 0xf5,
+	0xc0, 0xd4, 0x0c, 0xe7, 0x00, 0x05, 0x00, 0xc2, 0x12, 0x44, 0x29, 0x16, 0x00, 0xc0, 0xfb, 0xb2,
+	0x94, 0xc8, 0x29, 0x01, 0x2c, 0x10, 0xd0, 0x64, 0x7f, 0xb1, 0x02, 0x2c, 0x04, 0xd0, 0x03, 0x2c,
+	0x40, 0x62, 0xff, 0x20, 0xee, 0x62, 0x70, 0xbd, 0xae, 0x62, 0x00, 0xef, 0x20, 0xfb, 0xe7, 0x01,
+	0xc0, 0x39, 0xf8, 0xe7, 0x2e, 0xae, 0xc0, 0x02, 0xf5, 0xe7, 0x6e, 0x40, 0x01, 0xf2, 0xc6, 0xf6,
+	0x88, 0xeb, 0xb1, 0x08, 0x4c, 0x5f, 0xae, 0x46, 0x14, 0x18, 0x34, 0x98, 0x77, 0x47, 0x2c, 0x60,
+	0xc3, 0xe6, 0xef, 0xe7, 0x10, 0xcd, 0x48, 0x66, 0x40, 0x09, 0xba, 0x22, 0xc3, 0x34, 0xc3, 0x69,
+	0xf9, 0x53, 0xc5, 0x68, 0x5d, 0x10, 0xc6, 0x3f, 0x16, 0x00, 0x98, 0x48, 0x18, 0x6c, 0x42, 0x18,
+	0xfd, 0x34, 0xc8, 0x2c, 0x32, 0x00, 0x29, 0x00, 0x23, 0x68, 0xac, 0xc1, 0xd4, 0x41, 0x19, 0xed,
+	0xe7, 0xd9, 0x0d, 0x3d, 0xcc, 0x0d, 0x63, 0xdc, 0xca, 0x0d, 0x40, 0x85, 0x43, 0x10, 0xb5, 0x43,
+	0x07, 0x30, 0xb9, 0xf7, 0x43, 0xf6, 0x45, 0xc4, 0x9d, 0x00, 0x20, 0x10, 0xbd, 0xfa, 0xc1, 0x79,
+	0xfb, 0xc2, 0xd6, 0x4e, 0x46, 0x45, 0x46, 0xde, 0xff, 0x46, 0x57, 0x46, 0xe0, 0xb5, 0x03, 0x69,
+	0x83, 0xff, 0xb0, 0x5d, 0x1c, 0x99, 0x46, 0x03, 0x7e, 0x06, 0xff, 0x00, 0x44, 0x69, 0x05, 0x61,
+	0xdb, 0x07, 0x4b, 0xff, 0xd4, 0x03, 0x7e, 0x9b, 0x07, 0x48, 0xd4, 0x00, 0xff, 0x2c, 0x4a, 0xd0,
+	0x63, 0x68, 0xa2, 0x68, 0xeb, 0xff, 0x1a, 0x9a, 0x42, 0x45, 0xd8, 0x43, 0xf2, 0xd9, 0xfe, 0xc0,
+	0xda, 0x14, 0x0a, 0x43, 0xf2, 0x19, 0x58, 0x43, 0xb7, 0xf2, 0x11, 0x5b, 0x41, 0x15, 0x82, 0x44,
+	0x40, 0x01, 0x08, 0xfe, 0xc0, 0x00, 0x0b, 0x01, 0x93, 0x0a, 0xe0, 0x77, 0x69, 0xfd, 0xe3, 0x42,
+	0x22, 0x7f, 0xb3, 0x7b, 0x68, 0xba, 0x68, 0xff, 0x3c, 0x00, 0xeb, 0x1a, 0x93, 0x42, 0x29, 0xd3,
+	0xff, 0x50, 0x46, 0xc0, 0x47, 0x23, 0x7c, 0x01, 0x2b, 0xff, 0xef, 0xd1, 0x73, 0x69, 0x65, 0x60,
+	0x00, 0x93, 0xff, 0x3b, 0xb3, 0x18, 0x00, 0xa2, 0x68, 0x00, 0x21, 0xff, 0x07, 0xe0, 0x63, 0x44,
+	0x5b, 0x1b, 0x9a, 0x42, 0xff, 0x0d, 0xd9, 0x03, 0x68, 0x01, 0x00, 0x73, 0xb1, 0xff, 0x18, 0x00,
+	0x87, 0x68, 0x43, 0x68, 0xbc, 0x46, 0xff, 0x9d, 0x42, 0xf2, 0xd2, 0x4f, 0x46, 0x63, 0x44, 0xfd,
+	0xdb, 0xc0, 0x06, 0xf1, 0xd8, 0x00, 0x9b, 0x83, 0x42, 0xff, 0x0e, 0xd0, 0x08, 0x00, 0x21, 0x00,
+	0xd8, 0x47, 0xff, 0xce, 0xe7, 0x02, 0x22, 0x33, 0x7e, 0x13, 0x43, 0xdf, 0x33, 0x76, 0x03, 0xb0,
+	0x3c, 0x42, 0xe4, 0xa2, 0x46, 0xfd, 0xab, 0x40, 0xe5, 0x21, 0x00, 0x50, 0x46, 0x01, 0x9b, 0xaf,
+	0x98, 0x47, 0xbe, 0xe7, 0xc3, 0x4c, 0xe8, 0x48, 0x4c, 0x80, 0x7a, 0x42, 0x4c, 0x3b, 0x48, 0x4c,
+	0x43, 0xf6, 0x25, 0x53, 0x47, 0x98, 0x7f, 0x00, 0x23, 0x23, 0x61, 0x43, 0xf2, 0x91, 0xc2, 0x48,
+	0xaf, 0x00, 0x20, 0x23, 0x60, 0x41, 0x51, 0xe3, 0xc2, 0x78, 0x80, 0x7a, 0xcc, 0x78, 0x48, 0xc6,
+	0x78, 0x43, 0xf6, 0x95, 0x53, 0xc6, 0x0f, 0xa6, 0x40, 0x55, 0xc0, 0x46, 0xce, 0x0b, 0x42, 0x0a,
+	0x53, 0x44, 0xb8, 0x43, 0xa7, 0xf6, 0x8d, 0x63, 0x46, 0xb8, 0x40, 0x64, 0xe5, 0x4a, 0x0f, 0x11,
+	0xf4, 0xc4, 0x64, 0xd3, 0x10, 0x61, 0xd1, 0x10, 0xb1, 0x43, 0xf6, 0x41, 0xfd, 0x63, 0xd1, 0x10,
+	0x70, 0xb5, 0x0d, 0x00, 0x04, 0x00, 0x64, 0x42, 0x3d, 0x44, 0x11, 0x6f, 0x43, 0x3e, 0x46, 0x2e,
+	0x7d, 0x63, 0xc8, 0x3e, 0xfc, 0x40, 0xb4, 0xc1, 0x82, 0xd6, 0x46, 0x4f, 0x46, 0x46, 0x46, 0xfd,
+	0xc0, 0xc0, 0x4e, 0x82, 0xb0, 0x8a, 0x46, 0x00, 0x28, 0xdb, 0x6c, 0xd0, 0xcc, 0x4f, 0x47, 0x7a,
+	0xc5, 0x4f, 0x07, 0xb8, 0xf6, 0x40, 0xf7, 0x23, 0x7e, 0xc0, 0x81, 0x08, 0x13, 0x43, 0x23, 0xff,
+	0x76, 0x43, 0xf2, 0xc1, 0x43, 0xa0, 0x44, 0x51, 0xb7, 0x46, 0x40, 0x46, 0x41, 0x14, 0x01, 0x26,
+	0xc0, 0x14, 0x28, 0xff, 0x57, 0xd1, 0x53, 0x46, 0x22, 0x69, 0x5a, 0x60, 0xff, 0x63, 0x69, 0x9c,
+	0x46, 0x00, 0x2b, 0x48, 0xd0, 0xff, 0x53, 0x46, 0x60, 0x46, 0x99, 0x68, 0x00, 0x27, 0xff, 0xb6,
+	0x1a, 0x09, 0xe0, 0x85, 0x68, 0xa9, 0x46, 0xff, 0x4b, 0x44, 0x9b, 0x1a, 0x8b, 0x42, 0x0c, 0xd2,
+	0xdf, 0x03, 0x68, 0x07, 0x00, 0x63, 0x40, 0x7d, 0x43, 0x68, 0xbd, 0x9a, 0x40, 0x7c, 0x85, 0x68,
+	0xf3, 0x18, 0xc1, 0x06, 0x8b, 0xff, 0x42, 0xf2, 0xd3, 0x84, 0x45, 0x2d, 0xd0, 0x38, 0xde, 0xc0,
+	0xd1, 0x11, 0x53, 0x51, 0x46, 0x44, 0xf4, 0x22, 0x02, 0xbf, 0x25, 0x23, 0x7e, 0x00, 0x26, 0x93,
+	0xc0, 0x1c, 0x23, 0xff, 0x7e, 0x1d, 0x42, 0x14, 0xd0, 0x42, 0xf6, 0x65, 0xf7, 0x43, 0x01, 0xa8,
+	0x43, 0x07, 0x23, 0x7e, 0x20, 0x00, 0xdd, 0xab, 0x41, 0x23, 0xf6, 0xa1, 0x63, 0x43, 0x04, 0x42,
+	0xf6, 0x7d, 0x75, 0x46, 0x07, 0x30, 0x00, 0x02, 0xb0, 0x1c, 0x44, 0x8b, 0xcd, 0xf0, 0x40, 0x77,
+	0x94, 0xe7, 0x41, 0xb2, 0xc5, 0x2c, 0x98, 0x47, 0xfb, 0xd0, 0xe7, 0x41, 0x39, 0x23, 0x7e, 0x7f,
+	0x22, 0xb3, 0xfc, 0xc0, 0x10, 0xc1, 0x39, 0x00, 0x20, 0xb8, 0x47, 0x13, 0x3e, 0xfd, 0xe2, 0xc0,
+	0x53, 0x00, 0xb9, 0x00, 0xbe, 0x70, 0x47, 0xff, 0xc0, 0x46, 0x03, 0x68, 0x13, 0xb9, 0x05, 0xe0,
+	0xff, 0x1b, 0x68, 0x1b, 0xb1, 0x99, 0x42, 0xfb, 0xd1, 0xcf, 0x01, 0x20, 0x00, 0xe0, 0xc0, 0x4e,
+	0xc2, 0x05, 0x70, 0xb5, 0x2f, 0x05, 0x00, 0x0c, 0x00, 0x45, 0x07, 0x9c, 0x40, 0x07, 0x80, 0x57,
+	0xbf, 0xe0, 0x01, 0x20, 0x45, 0xf6, 0x98, 0x42, 0x9e, 0x39, 0x3e, 0x48, 0x9e, 0x2b, 0x68, 0x23,
+	0x60, 0x2c, 0x40, 0x98, 0xc1, 0x0d, 0xbf, 0x0b, 0x60, 0x01, 0x60, 0x70, 0x47, 0xc0, 0x01, 0xb1,
+	0xff, 0x1a, 0x68, 0x02, 0x60, 0x18, 0x00, 0x70, 0x47, 0xfe, 0x41, 0x12, 0x0e, 0x00, 0x14, 0x00,
+	0xb8, 0xb1, 0xb1, 0xab, 0xb1, 0x10, 0xc6, 0x5f, 0xb8, 0x42, 0x11, 0x28, 0x41, 0x11, 0x03, 0xfe,
+	0x43, 0x82, 0x63, 0x1e, 0x1c, 0x40, 0x3c, 0xb9, 0x00, 0xff, 0x20, 0x6b, 0x60, 0xac, 0x60, 0xec,
+	0x60, 0x2e, 0x56, 0x42, 0xac, 0xea, 0xe7, 0x41, 0xf6, 0xf9, 0xc4, 0xbf, 0xd8, 0xc8, 0xbf, 0xba,
+	0xc3, 0x0f, 0x40, 0xc8, 0x0f, 0xa3, 0x68, 0xe2, 0x40, 0x5c, 0x0b, 0xff, 0xd0, 0x00, 0x20, 0x62,
+	0x68, 0x13, 0x40, 0x22, 0xff, 0x68, 0xd3, 0x5c, 0x2b, 0x70, 0xa3, 0x68, 0x01, 0x3b, 0x33, 0xa3,
+	0x42, 0x12, 0xe5, 0xe7, 0x0a, 0x42, 0x12, 0xc1, 0x92, 0xe8, 0xc1, 0x12, 0xc1, 0x11, 0x45, 0x11,
+	0x51, 0xc6, 0x32, 0xc0, 0xb2, 0x98, 0xef, 0x47, 0xe2, 0x68, 0x63, 0xc2, 0x0f, 0xd5, 0x54, 0xe3,
+	0xff, 0x68, 0xa2, 0x68, 0x61, 0x68, 0x9a, 0x1a, 0x8a, 0xff, 0x42, 0x01, 0xd9, 0x59, 0x1a, 0xa1,
+	0x60, 0x01, 0xd1, 0x33, 0xc0, 0xd0, 0xc2, 0x39, 0xc1, 0xb4, 0xb8, 0xcc, 0xd1, 0xc0, 0xb2, 0xfd,
+	0x67, 0x42, 0x23, 0x98, 0x47, 0xe0, 0x68, 0xa3, 0x68, 0xfb, 0xc0, 0x1a, 0xc1, 0xcf, 0xf8, 0xb5,
+	0x0c, 0x00, 0x05, 0x7a, 0xc0, 0xad, 0xdc, 0xc5, 0xad, 0x47, 0xc0, 0xb2, 0xee, 0xc8, 0x9c, 0x7f,
+	0x46, 0xf2, 0x20, 0x03, 0x40, 0xf2, 0x00, 0x40, 0x67, 0xef, 0x80, 0x03, 0x1b, 0x68, 0xc1, 0x09,
+	0x1a, 0x02, 0x9b, 0xff, 0x06, 0x16, 0x40, 0x5b, 0x0f, 0x1e, 0x43, 0x4e, 0xff, 0xf2, 0x00, 0x43,
+	0xcb, 0xf6, 0xff, 0x53, 0xe0, 0xbf, 0x18, 0x43, 0x42, 0x58, 0x41, 0xb2, 0x43, 0xe9, 0x01, 0xff,
+	0xb8, 0x47, 0x23, 0x8c, 0x03, 0x22, 0xdb, 0x07, 0xef, 0x00, 0xd4, 0x68, 0xe0, 0x40, 0xac, 0x8c,
+	0x13, 0x40, 0xff, 0x00, 0x2b, 0xfb, 0xd1, 0x05, 0x22, 0xa6, 0x85, 0xff, 0x63, 0x70, 0xa2, 0x70,
+	0xe3, 0x70, 0x41, 0xf6, 0xfd, 0x02, 0x40, 0x14, 0xff, 0x72, 0x23, 0x81, 0x23, 0x8c, 0xbf, 0x1a,
+	0x42, 0xfc, 0xd1, 0x10, 0x23, 0x41, 0x03, 0x63, 0x1a, 0x44, 0x03, 0x08, 0x42, 0x03, 0x23, 0x73,
+	0xc5, 0x0d, 0xc2, 0x06, 0x47, 0x03, 0xf7, 0x22, 0xe3, 0x81, 0xc5, 0x02, 0x80, 0x22, 0x23, 0x82,
+	0x6e, 0x47, 0x09, 0x00, 0x12, 0x63, 0x49, 0x03, 0x22, 0xa3, 0x46, 0x03, 0xff, 0x03, 0x22, 0x23,
+	0x77, 0xa3, 0x62, 0x23, 0x70, 0xfe, 0xc3, 0x17, 0x41, 0xf6, 0x00, 0x43, 0xc4, 0xf2, 0x00, 0x7f,
+	0x23, 0x6c, 0x61, 0x9c, 0x42, 0x31, 0xd0, 0x40, 0x30, 0xbf, 0x13, 0x84, 0x20, 0x20, 0x22, 0xce,
+	0x40, 0x45, 0x1a, 0xff, 0x50, 0xbf, 0xf3, 0x4f, 0x8f, 0xbf, 0xf3, 0x6f, 0xff, 0x8f, 0x40, 0xf2,
+	0x84, 0x11, 0x5a, 0x50, 0x5a, 0xb7, 0x60, 0x20, 0x32, 0xc7, 0x04, 0x00, 0x20, 0x41, 0x04, 0xf8,
+	0xfd, 0xbd, 0x43, 0x11, 0x02, 0x23, 0x22, 0x78, 0x13, 0x42, 0xff, 0x0a, 0xd0, 0x22, 0x78, 0x9a,
+	0x43, 0x22, 0x70, 0x98, 0x40, 0x18, 0x43, 0x05, 0xc4, 0x01, 0x01, 0x23, 0x40, 0x04, 0xc4, 0x1b,
+	0x7d, 0xbf, 0xe7, 0x40, 0xf2, 0x40, 0x13, 0xc2, 0xc0, 0x17, 0x1d, 0x7b, 0x60, 0xc7, 0xc0, 0x76,
+	0x42, 0x69, 0x11, 0x73, 0xc0, 0x34, 0xcf, 0x71, 0x13, 0x8c, 0x19, 0x40, 0x07, 0xc3, 0xb2, 0x02,
+	0x21, 0xff, 0x42, 0x69, 0x13, 0x78, 0x0b, 0x43, 0x13, 0x70, 0x5b, 0x01, 0x31, 0xc3, 0x05, 0x70,
+	0x47, 0xc3, 0x04, 0x8b, 0xca, 0x04, 0xff, 0x43, 0x69, 0x58, 0x89, 0x80, 0x06, 0x80, 0x0f, 0xdb,
+	0x03, 0x38, 0xc1, 0x6a, 0x01, 0x30, 0xc6, 0x0e, 0x7e, 0x0b, 0xf5, 0x43, 0xc2, 0x14, 0x76, 0x45,
+	0x0a, 0xc0, 0x46, 0x43, 0x69, 0x7f, 0x03, 0x20, 0x10, 0xb5, 0x1a, 0x8c, 0x10, 0xc1, 0x25, 0xff,
+	0x20, 0x1c, 0x78, 0x1a, 0x78, 0xa4, 0x07, 0x82, 0x7f, 0x43, 0xe4, 0x0f, 0x1a, 0x70, 0x01, 0x30,
+	0x43, 0x05, 0xff, 0x0f, 0x20, 0x9a, 0x78, 0x01, 0x40, 0x82, 0x43, 0xff, 0x11, 0x43, 0x99, 0x70,
+	0x3c, 0xb1, 0x02, 0x21, 0xef, 0x1a, 0x78, 0x0a, 0x43, 0x40, 0x07, 0x31, 0x1a, 0x8c, 0xf9, 0x11,
+	0x41, 0x65, 0xc2, 0x90, 0x1f, 0x24, 0x43, 0x69, 0x21, 0xbf, 0x40, 0x18, 0x89, 0xa0, 0x43, 0x01,
+	0x41, 0x18, 0x70, 0xdf, 0x19, 0x81, 0x19, 0x8c, 0x08, 0x40, 0x07, 0x19, 0x89, 0xbf, 0x06, 0x48,
+	0x01, 0x40, 0x10, 0x02, 0x40, 0x53, 0x72, 0xb7, 0x02, 0x40, 0x0a, 0x42, 0x1f, 0x1a, 0x81, 0x45,
+	0x0e, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x41, 0x69, 0x01, 0x2a, 0x06, 0xff, 0xd0, 0x02, 0x2a, 0x08,
+	0xd0, 0x12, 0xb9, 0x63, 0xff, 0xb1, 0x01, 0x23, 0x4b, 0x71, 0x70, 0x47, 0x2b, 0xff, 0xb9, 0x04,
+	0x33, 0x0b, 0x71, 0xfa, 0xe7, 0x3b, 0xbf, 0xb9, 0x0a, 0x71, 0xf7, 0xe7, 0x04, 0xc0, 0x04, 0xf4,
+	0xfb, 0xe7, 0x01, 0x40, 0x04, 0xf1, 0xe7, 0x4a, 0x71, 0xef, 0xec, 0xc0, 0x46, 0x41, 0x4a, 0x10,
+	0xb5, 0xc1, 0x4a, 0x18, 0x68, 0x42, 0xff, 0x69, 0x91, 0x79, 0x53, 0x79, 0x0b, 0x40, 0x01, 0xbf,
+	0x21, 0x19, 0x42, 0x0b, 0xd1, 0x02, 0x40, 0x01, 0x0f, 0xeb, 0xd1, 0x04, 0x40, 0x01, 0x00, 0xc0,
+	0x17, 0x91, 0x71, 0x03, 0xff, 0x68, 0x00, 0x21, 0x98, 0x47, 0xf9, 0xe7, 0x91, 0x7f, 0x71, 0x92,
+	0x8c, 0x83, 0x68, 0x92, 0xb2, 0x41, 0x03, 0x15, 0xf2, 0x40, 0x03, 0x43, 0xc2, 0x05, 0xed, 0xff,
+	0x12, 0xca, 0x12, 0xc1, 0x80, 0xdf, 0x30, 0xbf, 0x70, 0x47, 0x44, 0x40, 0x13, 0x10, 0xb5, 0xee,
+	0x40, 0x8f, 0x13, 0x5a, 0x68, 0xc0, 0x83, 0x60, 0x43, 0xf6, 0xbb, 0xfd, 0x43, 0xc3, 0xd3, 0x43,
+	0xf6, 0x95, 0x46, 0x02, 0xad, 0xd6, 0x46, 0x02, 0xc5, 0x23, 0x45, 0x02, 0xcd, 0xc6, 0x04, 0x69,
+	0x23, 0xbb, 0x1f, 0x20, 0xc3, 0x02, 0x10, 0xbd, 0x70, 0xc4, 0xde, 0xf4, 0xe6, 0xc5, 0xde, 0x43,
+	0x4c, 0xc2, 0xe7, 0xc3, 0xd1, 0x98, 0x47, 0x2c, 0xb7, 0x60, 0x23, 0x69, 0x41, 0xd2, 0x10, 0xd5,
+	0xc0, 0xd1, 0x69, 0xfe, 0x43, 0xb3, 0x41, 0x22, 0xa3, 0x70, 0x62, 0x70, 0x23, 0xdf, 0x70, 0x3e,
+	0x3a, 0x23, 0x69, 0xc3, 0x9a, 0x00, 0x20, 0x0f, 0x23, 0x75, 0x70, 0xbd, 0x43, 0x03, 0xce, 0xa5,
+	0x43, 0x05, 0xc4, 0x01, 0xf4, 0xc4, 0xa5, 0xc2, 0x02, 0xd5, 0xc0, 0x35, 0x02, 0x21, 0x02, 0x68,
+	0x52, 0xc6, 0x9d, 0x69, 0xc5, 0x9d, 0xc1, 0x04, 0x8b, 0xca, 0x04, 0x03, 0xc1, 0x04, 0x7e, 0xc2,
+	0x02, 0x10, 0x78, 0x80, 0x07, 0xc0, 0x0f, 0xc2, 0x9d, 0xdf, 0x68, 0x11, 0x81, 0x04, 0x21, 0x45,
+	0x08, 0xc0, 0x46, 0xef, 0xc3, 0x07, 0x0c, 0xd5, 0x40, 0x83, 0x42, 0x40, 0xf2, 0xef, 0x05, 0x13,
+	0x7d, 0x21, 0xc0, 0x48, 0x02, 0xc0, 0xf2, 0xbf, 0x01, 0x03, 0x13, 0x62, 0x53, 0x68, 0x41, 0x08,
+	0x43, 0xaa, 0x44, 0x07, 0x42, 0x4a, 0x07, 0x93, 0x44, 0x07, 0x03, 0xc6, 0x0e, 0x03, 0xfa, 0x48,
+	0x07, 0xd3, 0x44, 0x07, 0x70, 0x47, 0x40, 0xf6, 0x00, 0xb7, 0x03, 0x01, 0x22, 0xc0, 0x05, 0x03,
+	0x1a, 0x40, 0x91, 0xc0, 0xd9, 0x46, 0x41, 0xcd, 0xc0, 0x62, 0x02, 0x04, 0xc1, 0x0a, 0x12, 0x13,
+	0xfd, 0x8b, 0x40, 0x09, 0xd0, 0x3f, 0x23, 0x13, 0x75, 0x0a, 0x5f, 0x4b, 0xd0, 0x61, 0x13, 0x80,
+	0x41, 0x69, 0x01, 0x41, 0x06, 0xff, 0x13, 0x1e, 0x20, 0x02, 0xe0, 0x1a, 0x7d, 0x10, 0xff, 0x42,
+	0x04, 0xd1, 0x1a, 0x7d, 0x11, 0x42, 0xf9, 0x7d, 0xd0, 0xc1, 0x0d, 0x1e, 0x20, 0x40, 0x42, 0xfb,
+	0xc1, 0x3e, 0xff, 0xa5, 0xff, 0xff, 0xf0, 0xb5, 0x83, 0x06, 0x01, 0xbf, 0xd1, 0x40, 0x2a, 0x02,
+	0xd9, 0x0d, 0x40, 0x05, 0xf0, 0xdd, 0xbd, 0x40, 0x0e, 0x04, 0x04, 0x25, 0x40, 0x0e, 0x14, 0x23,
+	0xfb, 0x8b, 0x1d, 0xc2, 0x14, 0x23, 0x75, 0x28, 0x4b, 0x01, 0xdb, 0x25, 0x23, 0xc2, 0x14, 0x1e,
+	0x26, 0xc1, 0x14, 0x02, 0xe0, 0xff, 0x1c, 0x7d, 0x26, 0x42, 0x02, 0xd1, 0x1c, 0x7d, 0xfd, 0x25,
+	0x40, 0x14, 0x46, 0x08, 0xc2, 0xb1, 0x57, 0x1e, 0xff, 0x76, 0x00, 0x00, 0x23, 0x07, 0xe0, 0xac,
+	0xb2, 0xff, 0xf5, 0x18, 0x02, 0x33, 0x2c, 0x80, 0x9c, 0xb2, 0xff, 0x02, 0x31, 0xa2, 0x42, 0x0c,
+	0xd9, 0x0d, 0x78, 0xff, 0x9f, 0x42, 0xf4, 0xdd, 0x4c, 0x78, 0x02, 0x31, 0xef, 0x24, 0x02, 0x2c,
+	0x43, 0xc5, 0x06, 0xa2, 0x42, 0xf2, 0xf9, 0xd8, 0x41, 0x13, 0xc1, 0x12, 0x1b, 0x7a, 0xdb, 0x07,
+	0x01, 0x5f, 0xd4, 0x40, 0x2a, 0x19, 0xd0, 0x51, 0x33, 0x0b, 0x5e, 0x33, 0xbb, 0xa5, 0xe7, 0x41,
+	0x33, 0xa2, 0xe7, 0x44, 0xc0, 0x32, 0x04, 0x76, 0xc0, 0x00, 0x70, 0xb5, 0x42, 0x30, 0x26, 0x45,
+	0x08, 0xc3, 0x30, 0xf9, 0x1e, 0x40, 0x12, 0xc0, 0x87, 0x24, 0x03, 0x42, 0x05, 0xd0, 0xff, 0x98,
+	0x43, 0x03, 0x88, 0x01, 0x35, 0x1b, 0x0a, 0xff, 0x0b, 0x70, 0x01, 0x34, 0xa2, 0x42, 0x0f, 0xd9,
+	0xff, 0x6d, 0x00, 0x56, 0x1e, 0x09, 0x19, 0x2d, 0x1b, 0xff, 0x63, 0x19, 0x1b, 0x88, 0x9b, 0xb2,
+	0x0b, 0x70, 0xff, 0xa6, 0x42, 0x01, 0xd9, 0x1b, 0x0a, 0x4b, 0x70, 0xdb, 0x02, 0x34, 0x41, 0x2f,
+	0xf3, 0xd8, 0xc0, 0x4a, 0xbd, 0x43, 0xfa, 0xc0, 0x1e, 0x00, 0xc1, 0x5d, 0x23, 0x1a, 0x70, 0x01,
+	0x32, 0xbf, 0x1a, 0x70, 0x40, 0xf2, 0x04, 0x02, 0x40, 0xd4, 0x02, 0xfd, 0x11, 0x40, 0xbf, 0x59,
+	0x60, 0x51, 0x68, 0x99, 0x60, 0xff, 0x91, 0x68, 0xd9, 0x60, 0x11, 0x7b, 0x19, 0x70, 0xbf, 0x52,
+	0x7b, 0x1a, 0x74, 0x70, 0x47, 0xc1, 0x0b, 0x02, 0xfe, 0xc1, 0x2a, 0x23, 0x1a, 0x78, 0x00, 0x20,
+	0x0a, 0x43, 0xeb, 0x1a, 0x70, 0xcb, 0x04, 0x8a, 0x42, 0x04, 0xc0, 0x46, 0x41, 0xd7, 0xf2, 0x00,
+	0x43, 0xc0, 0x7b, 0x71, 0x41, 0x74, 0xda, 0x69, 0x3f, 0x0a, 0x40, 0xda, 0x61, 0x01, 0x22, 0xc1,
+	0x0f, 0xc0, 0x05, 0x6f, 0x02, 0x0e, 0x23, 0x10, 0x42, 0x80, 0x13, 0x76, 0xc2, 0x96, 0x5f, 0xd0,
+	0x80, 0x21, 0x13, 0x7e, 0x40, 0xa8, 0x76, 0xc1, 0x0d, 0xfe, 0xc1, 0x00, 0x06, 0x28, 0x0f, 0xd8,
+	0x01, 0x23, 0x54, 0xaf, 0x22, 0x83, 0x40, 0x1a, 0xc0, 0xb9, 0x40, 0x40, 0x12, 0x07, 0xf6, 0xc1,
+	0x0b, 0x03, 0x5a, 0x40, 0x17, 0x10, 0x43, 0x58, 0x70, 0x72, 0xc1, 0x78, 0x0d, 0xc4, 0x78, 0x40,
+	0x07, 0x42, 0x03, 0x23, 0x41, 0x13, 0xff, 0x91, 0x78, 0x19, 0x40, 0x88, 0x42, 0x09, 0xd0, 0xff,
+	0xff, 0x21, 0x91, 0x71, 0x91, 0x78, 0x99, 0x43, 0xff, 0x03, 0x40, 0x0b, 0x43, 0x93, 0x70, 0x93,
+	0x79, 0xbf, 0x00, 0x2b, 0xfc, 0xd0, 0x70, 0x47, 0xc5, 0xe1, 0x0c, 0xf5, 0x31, 0xc5, 0xe1, 0x30,
+	0xca, 0xe1, 0x01, 0x23, 0x48, 0xf2, 0x3f, 0x03, 0x02, 0xec, 0x60, 0x23, 0x80, 0xc4, 0xd1, 0xc4,
+	0xd3, 0x7a, 0xc0, 0x17, 0x13, 0x41, 0x06, 0x63, 0x60, 0x0a, 0x4b, 0xc5, 0x06, 0xbf, 0xa3, 0x23,
+	0x20, 0x22, 0x23, 0x62, 0xc7, 0x07, 0x63, 0xdf, 0x81, 0x40, 0xf2, 0x44, 0x13, 0x40, 0x4d, 0x03,
+	0x1d, 0xfd, 0x60, 0xc1, 0x54, 0x80, 0x80, 0xff, 0xff, 0x10, 0xb5, 0xbf, 0x04, 0x00, 0x08, 0xb3,
+	0xc0, 0x68, 0x41, 0x1b, 0xc0, 0xa9, 0xb2, 0xc2, 0x1d, 0xc0, 0x1c, 0x52, 0xc1, 0x1c, 0x01, 0xc1,
+	0x1d, 0x98, 0xfb, 0x47, 0x4e, 0x40, 0x0e, 0x04, 0x21, 0x80, 0x22, 0xce, 0xfe, 0x40, 0x03, 0x99,
+	0x50, 0xbf, 0xf3, 0x4f, 0x8f, 0xbf, 0xf7, 0xf3, 0x6f, 0x8f, 0xc2, 0x21, 0x01, 0xe2, 0x68, 0x13,
+	0x3d, 0x80, 0x44, 0xe3, 0xbd, 0x00, 0x20, 0xdf, 0xc0, 0x39, 0xc1, 0x13, 0xe5, 0x40, 0xce, 0x13,
+	0x5e, 0xcd, 0x13, 0x42, 0x13, 0x1a, 0x60, 0x00, 0xff, 0x22, 0x08, 0x21, 0xe3, 0x68, 0x9a, 0x61,
+	0x1a, 0xdb, 0x69, 0x11, 0xc0, 0x10, 0x08, 0x21, 0xc3, 0x01, 0x02, 0x21, 0x6f, 0x1a, 0x88, 0x0a,
+	0x43, 0xc1, 0x17, 0x1a, 0x80, 0x43, 0x04, 0xb6, 0x41, 0x17, 0xd8, 0xe7, 0xc1, 0x16, 0xc0, 0xb1,
+	0xcd, 0x16, 0x6b, 0x36, 0xc8, 0x16, 0x02, 0x21, 0x40, 0x24, 0x88, 0x8b, 0xc2, 0x0e, 0x49, 0x26,
+	0xff, 0xe8, 0xe7, 0xc2, 0x68, 0x11, 0x62, 0x20, 0x21, 0xd8, 0x43, 0x04, 0xc1, 0x6e, 0x41, 0x08,
+	0xc2, 0x68, 0x44, 0x08, 0x88, 0x80, 0xc7, 0x07, 0xc0, 0x0f, 0xc0, 0x5e, 0xc4, 0xf3, 0x41, 0x49,
+	0x10, 0xb5, 0xf6, 0xc1, 0x49, 0x1c, 0x68, 0x40, 0x27, 0x89, 0xd2, 0x05, 0x07, 0xff, 0xd5, 0x22,
+	0x68, 0x12, 0xb1, 0x20, 0x00, 0x90, 0xf7, 0x47, 0xe3, 0x68, 0x40, 0x52, 0x12, 0x9a, 0x81, 0x10,
+	0xff, 0xbd, 0xc0, 0x46, 0xf0, 0xb5, 0xc6, 0x46, 0x0c, 0xbf, 0x00, 0x80, 0x46, 0x45, 0xf6, 0x44,
+	0x45, 0x6b, 0x46, 0xff, 0x00, 0xb5, 0xc0, 0xb2, 0x84, 0xb0, 0x40, 0xf2, 0xfb, 0xbe, 0x62, 0x44,
+	0x25, 0x06, 0xb0, 0x47, 0x45, 0xf6, 0xfb, 0x24, 0x32, 0x40, 0x02, 0x02, 0x11, 0x00, 0x01, 0xab,
+	0xff, 0x9c, 0x46, 0xa1, 0xc9, 0xa1, 0xc3, 0x01, 0x9b, 0xff, 0xa3, 0x42, 0x07, 0xd0, 0x53, 0x68,
+	0xa3, 0x42, 0xdf, 0x00, 0xd1, 0x9a, 0xe0, 0x93, 0xc2, 0x01, 0x96, 0xe0, 0xff, 0xe3, 0x69, 0x03,
+	0x21, 0xdb, 0x07, 0x00, 0xd4, 0xdf, 0x78, 0xe0, 0x01, 0x21, 0xe3, 0x42, 0x26, 0x90, 0x23, 0xff,
+	0x03, 0x21, 0xc0, 0xf2, 0x20, 0x03, 0x23, 0x60, 0xfc, 0xc3, 0x03, 0xc0, 0x1e, 0x53, 0x63, 0x60,
+	0x24, 0x23, 0x63, 0x9f, 0x62, 0x43, 0x46, 0x1c, 0x60, 0x41, 0x9c, 0x41, 0xb3, 0x9c, 0xfe, 0x40,
+	0x0f, 0x82, 0xe0, 0x60, 0x46, 0x13, 0x00, 0x62, 0xf7, 0xcb, 0x62, 0xc0, 0xc1, 0x16, 0x00, 0xd1,
+	0x81, 0xe0, 0xfe, 0x43, 0x17, 0x81, 0xe0, 0x92, 0x68, 0x16, 0x23, 0xa2, 0xda, 0x40, 0x02, 0x7e,
+	0x40, 0x15, 0x0e, 0x00, 0x40, 0x5f, 0x12, 0x9e, 0x77, 0x40, 0x80, 0x25, 0xc0, 0x5f, 0x02, 0x56,
+	0x51, 0x45, 0x73, 0xff, 0x40, 0xf2, 0x80, 0x10, 0x0f, 0x00, 0x16, 0x50, 0xff, 0x16, 0x60, 0x5e,
+	0x1c, 0xf6, 0xb2, 0xb7, 0x40, 0xfd, 0x57, 0x48, 0x06, 0x1f, 0x08, 0x17, 0x50, 0x17, 0x60, 0xff,
+	0x47, 0x46, 0x0e, 0x00, 0x9a, 0x1c, 0xd2, 0xb2, 0x5f, 0x17, 0x40, 0xbe, 0x40, 0x37, 0x41, 0x11,
+	0x16, 0x40, 0x10, 0xff, 0x06, 0xb4, 0x46, 0x52, 0xb2, 0x52, 0x09, 0x92, 0xb7, 0x00, 0x62, 0x44,
+	0x47, 0x0c, 0x46, 0x46, 0xc1, 0x0b, 0x0a, 0xff, 0x00, 0x03, 0x33, 0xdb, 0xb2, 0x1e, 0x40, 0xb2,
+	0xff, 0x40, 0x5b, 0xb2, 0x5b, 0x09, 0x9b, 0x00, 0x63, 0xfb, 0x44, 0x5a, 0x46, 0x08, 0x1a, 0x50,
+	0x1a, 0x60, 0x02, 0xff, 0x23, 0x00, 0x20, 0xa3, 0x75, 0xa1, 0x75, 0x04, 0x7f, 0xb0, 0x04, 0xbc,
+	0x90, 0x46, 0xf0, 0xbd, 0xc3, 0x37, 0xdf, 0x02, 0x23, 0x21, 0x68, 0x0b, 0xc0, 0xd2, 0x21, 0x68,
+	0x5f, 0x99, 0x43, 0x21, 0x60, 0x03, 0x44, 0x41, 0x02, 0xc4, 0x01, 0xd9, 0x11, 0x40, 0x43, 0x45,
+	0x42, 0x6d, 0xe7, 0x41, 0x5d, 0x00, 0x20, 0xaf, 0x40, 0xf2, 0xe6, 0x72, 0x41, 0x5a, 0xb0, 0x42,
+	0xda, 0xd7, 0x7f, 0xe7, 0x40, 0xf2, 0x48, 0x13, 0x41, 0x46, 0xc1, 0x6e, 0xff, 0x19, 0x60, 0x75,
+	0xe7, 0x00, 0x23, 0x9b, 0x00, 0xff, 0x16, 0x33, 0x82, 0xe7, 0x01, 0x23, 0xfa, 0xe7, 0xf7, 0x14,
+	0x3b, 0xf8, 0xc0, 0xa7, 0x02, 0x21, 0x02, 0x68, 0x7b, 0x13, 0x68, 0x40, 0xf1, 0x60, 0x01, 0x31,
+	0xd3, 0x42, 0x12, 0xfe, 0x41, 0x7c, 0xc0, 0x46, 0x03, 0x68, 0x58, 0x6a, 0x00, 0xf9, 0x04, 0x41,
+	0x81, 0xc0, 0xf6, 0xb5, 0x03, 0x22, 0x0e, 0x00, 0xdf, 0x04, 0x68, 0x82, 0xb0, 0xe3, 0xc2, 0xce,
+	0x42, 0xf6, 0x6f, 0x65, 0x43, 0x01, 0xa8, 0x41, 0x98, 0x25, 0x68, 0xc0, 0x98, 0xff, 0x22, 0x23,
+	0x68, 0xad, 0x07, 0x93, 0x43, 0xed, 0xdf, 0x0f, 0x23, 0x60, 0x01, 0x32, 0x43, 0x08, 0x61, 0x6a,
+	0xff, 0x0c, 0x4b, 0x76, 0x00, 0x0b, 0x40, 0x40, 0xf2, 0xff, 0xfe, 0x71, 0x31, 0x40, 0x19, 0x43,
+	0x42, 0xf6, 0xef, 0x75, 0x43, 0x61, 0x62, 0xc3, 0x0c, 0x98, 0x47, 0x3d, 0xed, 0xb1, 0xc1, 0x0c,
+	0x13, 0x43, 0xc7, 0x0b, 0x00, 0x20, 0x02, 0xff, 0xb0, 0x70, 0xbd, 0x01, 0xf8, 0xff, 0xff, 0x28,
+	0x9f, 0x23, 0x02, 0x68, 0xd1, 0x54, 0xc7, 0xfd, 0x46, 0x92, 0x43, 0xbb, 0x16, 0x00, 0xc3, 0xfd,
+	0x40, 0xf2, 0x84, 0x42, 0x38, 0x98, 0xff, 0x47, 0x63, 0x1e, 0x01, 0x2b, 0x06, 0xd9, 0x1c, 0xff,
+	0xb9, 0x2b, 0x68, 0x80, 0x22, 0x36, 0xb1, 0x9a, 0xfd, 0x75, 0xc1, 0xf0, 0x2b, 0x68, 0x04, 0x22,
+	0x00, 0x2e, 0x5f, 0xf8, 0xd1, 0x1a, 0x75, 0xf7, 0xc2, 0x3e, 0x70, 0xc2, 0xad, 0xff, 0x1e, 0x68,
+	0x35, 0x68, 0x2c, 0x7e, 0xe4, 0xb2, 0xff, 0x63, 0xb2, 0x00, 0x2b, 0x37, 0xdb, 0x02, 0x23, 0x7f,
+	0x23, 0x42, 0x00, 0xd0, 0x2b, 0x76, 0x01, 0xc4, 0x01, 0xff, 0x63, 0x07, 0x16, 0xd5, 0x6b, 0x8b,
+	0x1b, 0x07, 0x6f, 0x14, 0xd5, 0xb0, 0x68, 0x49, 0x1c, 0xc0, 0xb2, 0x41, 0x1c, 0xf7, 0x40, 0xf2,
+	0xa8, 0xc4, 0x1b, 0xb3, 0x68, 0x30, 0x00, 0xff, 0x98, 0x47, 0x04, 0x23, 0x2b, 0x76, 0x70, 0xbd,
+	0xbd, 0xf0, 0x4c, 0x0a, 0x40, 0xf2, 0xa5, 0x72, 0xc7, 0xdd, 0x28, 0xff, 0x23, 0xe9, 0x5c, 0x30,
+	0x00, 0xc9, 0xb2, 0xf3, 0xae, 0xc0, 0x47, 0xe6, 0xe7, 0x70, 0xce, 0x0a, 0x9a, 0xc8, 0x0a, 0x30,
+	0x0b, 0x00, 0x73, 0x40, 0x09, 0xb4, 0xc0, 0x62, 0xff, 0x2b, 0xff, 0x2b, 0xff, 0x2b, 0xe0, 0xff,
+	0x2b, 0xff, 0x2b, 0xff, 0x2b, 0xff, 0x2b, 0xff, 0x2b, 0x41, 0xf2, 0x61, 0xf7, 0x13, 0x10, 0xb5,
+	0x43, 0x05, 0x41, 0xf6, 0x0d, 0x53, 0xfe, 0x43, 0x02, 0x42, 0xf2, 0x59, 0x33, 0x43, 0xf2, 0x6d,
+	0xf9, 0x14, 0x43, 0x03, 0x40, 0x01, 0x04, 0x06, 0x20, 0xa0, 0x47, 0xfd, 0xfc, 0xc0, 0x0b, 0xf0,
+	0xb5, 0x45, 0x46, 0xde, 0x46, 0xff, 0x57, 0x46, 0x4e, 0x46, 0x41, 0xf6, 0x00, 0x03, 0xf7, 0xe0,
+	0xb5, 0xc4, 0x40, 0x08, 0xda, 0x69, 0x43, 0x49, 0xff, 0x05, 0x00, 0x0a, 0x40, 0x80, 0x21, 0xda,
+	0x61, 0xbf, 0xda, 0x69, 0x83, 0xb0, 0x0a, 0x43, 0xc1, 0x01, 0x40, 0xfb, 0x39, 0x8a, 0xc0, 0x01,
+	0x44, 0xf2, 0x00, 0x02, 0x3c, 0xdd, 0x39, 0x40, 0x09, 0x12, 0x13, 0x8b, 0x40, 0xfe, 0xd0, 0x46,
+	0xff, 0xf2, 0x38, 0x03, 0x6a, 0x46, 0xc0, 0xf2, 0x80, 0xff, 0x03, 0x1b, 0x88, 0x40, 0xf2, 0x0f,
+	0x0b, 0x13, 0xdf, 0x80, 0x46, 0xf2, 0x3a, 0x03, 0xc3, 0x03, 0x45, 0xf2, 0xd7, 0xad, 0x64, 0x53,
+	0xc0, 0x03, 0x3c, 0xc4, 0x03, 0x00, 0x9e, 0xf5, 0x93, 0x40, 0x03, 0x3e, 0x44, 0x03, 0x30, 0x0a,
+	0xd3, 0x80, 0xfd, 0x5b, 0x40, 0x0e, 0x00, 0x04, 0x18, 0x40, 0xa0, 0x47, 0xbf, 0x44, 0xf6, 0x89,
+	0x47, 0x00, 0x21, 0x40, 0x03, 0x07, 0xff, 0xc4, 0xf2, 0x20, 0x11, 0xb8, 0x47, 0x40, 0xf2, 0x7f,
+	0xff, 0x0a, 0x81, 0x46, 0x50, 0x46, 0x30, 0xc2, 0x06, 0xef, 0x71, 0x18, 0x01, 0x1c, 0xc0, 0x06,
+	0x08, 0x48, 0x46, 0xff, 0xc0, 0x47, 0x5b, 0x46, 0x81, 0x46, 0x28, 0x60, 0xdb, 0x30, 0x0d, 0x41,
+	0x0d, 0x00, 0x21, 0x43, 0x0b, 0x53, 0x46, 0xff, 0x83, 0x46, 0x30, 0x0b, 0x03, 0x40, 0x18, 0x00,
+	0x7f, 0xa0, 0x47, 0x36, 0x0e, 0x01, 0x1c, 0x58, 0xc0, 0x09, 0xff, 0x2e, 0x73, 0x45, 0xf2, 0xb1,
+	0x26, 0x01, 0x9b, 0xff, 0x49, 0x46, 0x1a, 0x03, 0x12, 0x0d, 0x6b, 0x73, 0xbf, 0x1b, 0x0d, 0x2a,
+	0x81, 0x6b, 0x81, 0x40, 0x11, 0x06, 0xff, 0x68, 0x60, 0x98, 0x46, 0x92, 0x46, 0xb0, 0x47, 0x7f,
+	0x81, 0x46, 0x40, 0x46, 0xa0, 0x47, 0x80, 0x40, 0x19, 0xdf, 0xa0, 0x47, 0x01, 0x1c, 0x40, 0x40,
+	0x04, 0x01, 0x1c, 0xff, 0x48, 0x46, 0xb8, 0x47, 0x28, 0x61, 0x03, 0xb0, 0xff, 0x3c, 0xbc, 0x90,
+	0x46, 0x99, 0x46, 0xa2, 0x46, 0xff, 0xab, 0x46, 0xf0, 0xbd, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8,
+	0xb5, 0x40, 0xf2, 0x14, 0x05, 0x44, 0xf6, 0xef, 0x21, 0x13, 0x00, 0x21, 0x40, 0x83, 0x05, 0x2e,
+	0x68, 0xfd, 0x04, 0x41, 0x24, 0x03, 0xcc, 0xf2, 0xc8, 0x31, 0x30, 0xff, 0x1c, 0x98, 0x47, 0x03,
+	0x00, 0x20, 0x1c, 0xab, 0xff, 0xb9, 0x45, 0xf2, 0x59, 0x04, 0x4c, 0xf6, 0xcd, 0xfd, 0x41, 0x41,
+	0x35, 0xc3, 0xf6, 0x4c, 0x51, 0xa0, 0x47, 0xff, 0x43, 0xf2, 0x33, 0x31, 0x07, 0x1c, 0xc3, 0xf6,
+	0xef, 0x73, 0x71, 0x30, 0x1c, 0x42, 0x32, 0x13, 0x39, 0x1c, 0xfe, 0xc4, 0x77, 0x60, 0xf8, 0xbd,
+	0xc0, 0x46, 0xc0, 0x23, 0x7d, 0x48, 0x40, 0x54, 0xdb, 0x05, 0x9a, 0x61, 0x70, 0xc0, 0x3c, 0x7f,
+	0x4c, 0x11, 0x43, 0xf2, 0xfd, 0x03, 0x10, 0xc1, 0x9b, 0x5f, 0x01, 0x08, 0x6c, 0x03, 0x22, 0x43,
+	0x0a, 0x10, 0xc0, 0x09, 0xff, 0x40, 0xf2, 0xb4, 0x20, 0x43, 0xf2, 0xcd, 0x03, 0xfa, 0xc2, 0xa2,
+	0x00, 0xc3, 0x05, 0x02, 0x28, 0x00, 0xdc, 0x70, 0xf5, 0xbd, 0x40, 0x0d, 0x14, 0xc0, 0x04, 0x04,
+	0x25, 0x00, 0x43, 0xdf, 0xf2, 0x35, 0x13, 0x44, 0x35, 0x43, 0x0d, 0x29, 0x00, 0xb7, 0x20, 0x6c,
+	0x98, 0x40, 0x14, 0xcc, 0x13, 0xc1, 0xae, 0x5a, 0xff, 0x6a, 0x08, 0x2a, 0xe9, 0xd0, 0xd8, 0x69,
+	0x1a, 0xff, 0x1d, 0x41, 0x00, 0x09, 0x18, 0x52, 0x18, 0x44, 0xff, 0x21, 0x61, 0x5c, 0x11, 0x70,
+	0x69, 0x78, 0x51, 0xff, 0x70, 0xa9, 0x78, 0x91, 0x70, 0xda, 0x69, 0x51, 0xff, 0x1c, 0x07, 0x22,
+	0x0a, 0x40, 0xda, 0x61, 0x5a, 0xbf, 0x6a, 0x01, 0x32, 0x5a, 0x62, 0xd4, 0xc2, 0x85, 0xce, 0xfb,
+	0x46, 0x47, 0x40, 0x1d, 0xcc, 0x14, 0x42, 0xf6, 0x65, 0xbf, 0x46, 0x42, 0xf6, 0x75, 0x45, 0x80,
+	0x41, 0x1e, 0x04, 0xcf, 0x23, 0x1d, 0x83, 0xb0, 0xc1, 0x50, 0xc0, 0x00, 0x05, 0x98, 0xfe, 0xc0,
+	0x07, 0x07, 0x09, 0x15, 0xe0, 0x6f, 0x46, 0x23, 0xff, 0x6a, 0x01, 0x39, 0x5a, 0x00, 0xd2, 0x18,
+	0x42, 0xff, 0x44, 0x10, 0x78, 0x01, 0x33, 0x38, 0x70, 0x50, 0xff, 0x78, 0x92, 0x78, 0x78, 0x70,
+	0xba, 0x70, 0x4a, 0xff, 0x46, 0x01, 0xa8, 0x13, 0x40, 0x23, 0x62, 0x61, 0xff, 0x62, 0xa8, 0x47,
+	0x68, 0x46, 0xa3, 0x6a, 0x98, 0xff, 0x47, 0x01, 0xa8, 0xb0, 0x47, 0x61, 0x6a, 0x00, 0xff, 0x29,
+	0xe4, 0xd1, 0x01, 0xa8, 0xa8, 0x47, 0x03, 0xfb, 0xb0, 0x0c, 0xc2, 0x59, 0xf0, 0xbd, 0x10, 0xb5,
+	0x45, 0xff, 0xf2, 0xc5, 0x73, 0x14, 0x00, 0x0a, 0x00, 0x01, 0x2d, 0x00, 0x40, 0x34, 0x10, 0x82,
+	0x41, 0x19, 0x03, 0xc1, 0x3a, 0x40, 0xaf, 0x9f, 0xf6, 0x65, 0x43, 0x01, 0xa8, 0xc3, 0x3c, 0xc0,
+	0x41, 0x23, 0xfb, 0x44, 0x22, 0xc1, 0x34, 0x9a, 0x5a, 0x0a, 0xb1, 0x00, 0x67, 0x22, 0x5a, 0x64,
+	0xc0, 0x26, 0x46, 0x07, 0x24, 0xb1, 0xc7, 0x53, 0xbe, 0x45, 0x02, 0x5a, 0x61, 0x02, 0xb0, 0x10,
+	0x40, 0x49, 0xcc, 0xdd, 0x12, 0x42, 0x04, 0x01, 0xdb, 0x05, 0x40, 0x0f, 0x02, 0xf0, 0xef, 0xb5,
+	0x90, 0x62, 0x43, 0xc0, 0x33, 0x99, 0x61, 0x99, 0xd5, 0x60, 0x40, 0x05, 0x03, 0x40, 0xb4, 0x04,
+	0xc1, 0xbe, 0xa3, 0x62, 0xff, 0xc0, 0x23, 0x4f, 0x21, 0x01, 0x25, 0x1b, 0x06, 0xff, 0xa3, 0x62,
+	0x63, 0x5c, 0x42, 0x20, 0xab, 0x43, 0xbb, 0x63, 0x54, 0x40, 0xc6, 0x43, 0x5d, 0x31, 0x41, 0x07,
+	0x58, 0xff, 0x50, 0x01, 0x30, 0x04, 0x39, 0x58, 0x50, 0x40, 0xfd, 0xf6, 0x42, 0x0c, 0x03, 0xd9,
+	0x69, 0x41, 0x38, 0x01, 0xf7, 0x43, 0xd9, 0x61, 0x41, 0x67, 0x40, 0xf2, 0x00, 0x41, 0xff, 0x42,
+	0xf6, 0x11, 0x76, 0x83, 0xb0, 0x2c, 0x32, 0xd3, 0x40, 0x23, 0x40, 0x07, 0x41, 0xb3, 0x06, 0x41,
+	0x30, 0xb0, 0x47, 0xff, 0x50, 0x21, 0x04, 0x23, 0x01, 0x26, 0x62, 0x5c, 0xff, 0x38, 0x20, 0x9a,
+	0x43, 0x62, 0x54, 0x62, 0x5c, 0xff, 0x03, 0x27, 0xaa, 0x43, 0x32, 0x43, 0xd2, 0xb2, 0xff, 0x62,
+	0x54, 0x0f, 0x22, 0x21, 0x5c, 0x91, 0x43, 0xff, 0x39, 0x43, 0x21, 0x54, 0x51, 0x21, 0x67, 0x5c,
+	0xff, 0x9f, 0x43, 0x67, 0x54, 0x63, 0x5c, 0xab, 0x43, 0xff, 0x33, 0x43, 0xdb, 0xb2, 0x63, 0x54,
+	0x23, 0x5c, 0xfe, 0x41, 0x84, 0x1a, 0x40, 0x30, 0x23, 0x1a, 0x43, 0x22, 0x5f, 0x54, 0x43, 0xf2,
+	0x9d, 0x03, 0xc1, 0x19, 0xc2, 0x44, 0xfd, 0xfb, 0x40, 0x31, 0x43, 0x47, 0x43, 0xf2, 0x4d, 0x04,
+	0x44, 0xc7, 0xf2, 0xf9, 0x52, 0xc1, 0x06, 0xc1, 0x9d, 0xc0, 0x00, 0x02, 0x03, 0xdc, 0xc1, 0xa8,
+	0xc0, 0xc2, 0x44, 0xf2, 0xd1, 0xc5, 0x05, 0x02, 0x02, 0xea, 0xc6, 0x04, 0xdd, 0xc6, 0x04, 0x01,
+	0xc4, 0x04, 0x6b, 0x46, 0xd8, 0xdf, 0x1d, 0x42, 0xf2, 0xed, 0x63, 0x43, 0x51, 0x50, 0xb9, 0xfd,
+	0x6b, 0xc2, 0x9b, 0xd9, 0x79, 0x42, 0xf6, 0xfd, 0x73, 0xdc, 0xc7, 0x9b, 0xc1, 0x04, 0x42, 0xf6,
+	0xa9, 0x48, 0x04, 0x00, 0x20, 0xfb, 0x03, 0xb0, 0xc0, 0xc7, 0x22, 0x43, 0x00, 0x5b, 0x08, 0xff,
+	0x01, 0x20, 0xd2, 0x05, 0x93, 0x42, 0x00, 0xdc, 0xff, 0x00, 0x20, 0x70, 0x47, 0xc0, 0x46, 0x42,
+	0x00, 0xff, 0x12, 0x0e, 0x11, 0x00, 0x10, 0xb5, 0x01, 0x24, 0xff, 0xc3, 0x17, 0x7f, 0x39, 0x23,
+	0x43, 0x1e, 0x29, 0xff, 0x0e, 0xdc, 0x00, 0x29, 0x18, 0xdb, 0x80, 0x24, 0xff, 0x40, 0x02, 0x40,
+	0x0a, 0x24, 0x04, 0x04, 0x43, 0xff, 0x16, 0x29, 0x09, 0xdd, 0x20, 0x00, 0x96, 0x3a, 0xff, 0x90,
+	0x40, 0x43, 0x43, 0x18, 0x00, 0x10, 0xbd, 0xff, 0x00, 0xf0, 0x79, 0xfe, 0x03, 0x00, 0xf9, 0xe7,
+	0xff, 0x80, 0x20, 0xc0, 0x03, 0x08, 0x41, 0x17, 0x22, 0xff, 0x00, 0x19, 0x51, 0x1a, 0xc8, 0x40,
+	0xf0, 0xe7, 0x7f, 0x4a, 0x1c, 0xef, 0xd0, 0x00, 0x23, 0xed, 0xc0, 0xa4, 0xff, 0x84, 0x46, 0x08,
+	0x1c, 0x61, 0x46, 0xff, 0xe7, 0xff, 0x1f, 0xb5, 0x00, 0xf0, 0x69, 0xfb, 0x00, 0x28, 0x7f, 0x01,
+	0xd4, 0x00, 0x21, 0xc8, 0x42, 0x1f, 0xc0, 0x8e, 0xff, 0x00, 0xf0, 0x01, 0xfb, 0x40, 0x42, 0x01,
+	0x30, 0xf5, 0x10, 0xc2, 0x02, 0x5b, 0xc1, 0x06, 0xdb, 0x00, 0x20, 0x10, 0x5b, 0xbd, 0x01, 0xc0,
+	0x00, 0xc0, 0x46, 0xc1, 0x04, 0x51, 0xc1, 0x04, 0x55, 0xdd, 0xcb, 0x04, 0x0d, 0xc1, 0x04, 0xdc,
+	0xcb, 0x04, 0x03, 0xc1, 0x04, 0xfd, 0xda, 0xc7, 0x04, 0xf0, 0xb5, 0xc6, 0x46, 0x4e, 0x02, 0xff,
+	0x47, 0x02, 0x76, 0x0a, 0x7b, 0x0a, 0x44, 0x00, 0xff, 0xc5, 0x0f, 0xf7, 0x00, 0x48, 0x00, 0x98,
+	0x46, 0xff, 0x00, 0xb5, 0x24, 0x0e, 0x2a, 0x00, 0xdb, 0x00, 0xff, 0x00, 0x0e, 0xc9, 0x0f, 0xbc,
+	0x46, 0x8d, 0x42, 0xff, 0x67, 0xd0, 0x22, 0x1a, 0x00, 0x2a, 0x00, 0xdc, 0xff, 0xa5, 0xe0, 0x00,
+	0x28, 0x3a, 0xd1, 0x00, 0x2f, 0xff, 0x00, 0xd1, 0x93, 0xe0, 0x51, 0x1e, 0x00, 0x29, 0xff, 0x00,
+	0xd0, 0xbb, 0xe0, 0x01, 0x24, 0xdb, 0x1b, 0xff, 0x5a, 0x01, 0x46, 0xd5, 0x9b, 0x01, 0x9e, 0x09,
+	0xff, 0x30, 0x00, 0x00, 0xf0, 0xba, 0xfe, 0x05, 0x38, 0xff, 0x86, 0x40, 0x84, 0x42, 0x00, 0xdd,
+	0x9c, 0xe0, 0xff, 0x04, 0x1b, 0x32, 0x00, 0x20, 0x20, 0x01, 0x34, 0xff, 0xe2, 0x40, 0x04, 0x1b,
+	0xa6, 0x40, 0x33, 0x00, 0xff, 0x5e, 0x1e, 0xb3, 0x41, 0x00, 0x24, 0x13, 0x43, 0xff, 0x5a, 0x07,
+	0x04, 0xd0, 0x0f, 0x22, 0x1a, 0x40, 0xff, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0xff,
+	0x29, 0xd5, 0x01, 0x34, 0xff, 0x2c, 0x00, 0xd1, 0xff, 0x80, 0xe0, 0x2a, 0x00, 0x9b, 0x01, 0x5b,
+	0x0a, 0xff, 0xe4, 0xb2, 0x5b, 0x02, 0xe4, 0x05, 0x58, 0x0a, 0x7f, 0xd2, 0x07, 0x20, 0x43, 0x10,
+	0x43, 0x04, 0xc0, 0xd0, 0xfe, 0x40, 0x61, 0x2c, 0xe3, 0xd0, 0x80, 0x21, 0x38, 0x00, 0xff, 0xc9,
+	0x04, 0x08, 0x43, 0x84, 0x46, 0x1b, 0x2a, 0xff, 0x00, 0xdd, 0x81, 0xe0, 0x20, 0x20, 0x61, 0x46,
+	0xff, 0xd1, 0x40, 0x82, 0x1a, 0x60, 0x46, 0x90, 0x40, 0xff, 0x02, 0x00, 0x50, 0x1e, 0x82, 0x41,
+	0x0a, 0x43, 0xff, 0x9b, 0x1a, 0x5a, 0x01, 0xb8, 0xd4, 0x5a, 0x07, 0xff, 0xce, 0xd1, 0xde, 0x08,
+	0x2a, 0x00, 0xff, 0x2c, 0xfe, 0xc0, 0x2b, 0x2e, 0x00, 0xd1, 0xac, 0xe0, 0x80, 0x23, 0xff, 0xdb,
+	0x03, 0x33, 0x43, 0x5b, 0x02, 0x5b, 0x0a, 0xff, 0xff, 0x24, 0xcf, 0xe7, 0x21, 0x1a, 0x00, 0x29,
+	0xff, 0x51, 0xdd, 0x90, 0xb3, 0xff, 0x2c, 0xb8, 0xd0, 0xff, 0x80, 0x20, 0x3e, 0x00, 0xc0, 0x04,
+	0x06, 0x43, 0xff, 0xb4, 0x46, 0x1b, 0x29, 0x00, 0xdd, 0xa9, 0xe0, 0xff, 0x20, 0x26, 0x60, 0x46,
+	0xc8, 0x40, 0x71, 0x1a, 0xff, 0x66, 0x46, 0x8e, 0x40, 0x31, 0x00, 0x4e, 0x1e, 0xff, 0xb1, 0x41,
+	0x01, 0x43, 0x5b, 0x18, 0x59, 0x01, 0xfd, 0xd4, 0x44, 0x29, 0x86, 0xe0, 0x01, 0x22, 0x75, 0x49,
+	0xff, 0x1a, 0x40, 0x5b, 0x08, 0x0b, 0x40, 0x13, 0x43, 0xff, 0x98, 0xe7, 0x00, 0x2c, 0x00, 0xd0,
+	0xa3, 0xe0, 0xff, 0x00, 0x2b, 0x00, 0xd0, 0xb1, 0xe0, 0x3b, 0x00, 0xff, 0x00, 0x2f, 0x60, 0xd1,
+	0x00, 0x26, 0x00, 0x22, 0xfd, 0x73, 0x40, 0x1a, 0xe4, 0xb2, 0x9a, 0xe7, 0x14, 0x00, 0xff, 0x87,
+	0xe7, 0x00, 0x2f, 0x4b, 0xd0, 0x48, 0x1e, 0xff, 0x00, 0x28, 0x55, 0xd1, 0x63, 0x44, 0x01, 0x24,
+	0xff, 0x5a, 0x01, 0xaf, 0xd5, 0x02, 0x24, 0xdc, 0xe7, 0xff, 0x22, 0xbb, 0x62, 0x1c, 0xd2, 0xb2,
+	0x01, 0x2a, 0xff, 0xde, 0xdd, 0xde, 0x1b, 0x72, 0x01, 0x34, 0xd5, 0xff, 0xfe, 0x1a, 0x0d, 0x00,
+	0x5d, 0xe7, 0x2a, 0x00, 0xef, 0x00, 0x23, 0x7f, 0xe7, 0xc0, 0x4a, 0x4a, 0x24, 0x1a, 0xff, 0x13,
+	0x40, 0x69, 0xe7, 0x00, 0x29, 0x62, 0xd1, 0xff, 0x61, 0x1c, 0xc8, 0xb2, 0x01, 0x28, 0x4d, 0xdd,
+	0xff, 0xff, 0x29, 0x48, 0xd0, 0x63, 0x44, 0x5b, 0x08, 0xfd, 0x0c, 0xc0, 0x09, 0xff, 0x2a, 0x40,
+	0xd0, 0x0a, 0x00, 0xff, 0x7a, 0xe7, 0x01, 0x22, 0x9b, 0x1a, 0x85, 0xe7, 0xff, 0xec, 0xb1, 0xff,
+	0x28, 0x22, 0xd0, 0x80, 0x24, 0xbf, 0xe4, 0x04, 0x52, 0x42, 0x23, 0x43, 0x41, 0x47, 0x86, 0xff,
+	0xe0, 0x1c, 0x00, 0x20, 0x25, 0xd4, 0x40, 0xaa, 0xff, 0x1a, 0x93, 0x40, 0x5a, 0x1e, 0x93, 0x41,
+	0x23, 0xbf, 0x43, 0x62, 0x46, 0x04, 0x00, 0xd3, 0xc0, 0x18, 0x27, 0xfd, 0xe7, 0x40, 0x44, 0xd0,
+	0x28, 0xe7, 0x00, 0x22, 0x00, 0xff, 0x24, 0xab, 0xe7, 0x0c, 0x00, 0x37, 0xe7, 0x00, 0xff, 0x2b,
+	0x49, 0xd0, 0xd2, 0x43, 0x00, 0x2a, 0xed, 0xff, 0xd0, 0xff, 0x28, 0xe0, 0xd1, 0x63, 0x46, 0xff,
+	0xff, 0x24, 0x0d, 0x00, 0x2c, 0xe7, 0xff, 0x29, 0x0f, 0xef, 0xd0, 0x01, 0x00, 0x74, 0x40, 0x07,
+	0x5d, 0xd0, 0xff, 0xfd, 0x24, 0x41, 0x7d, 0x22, 0xe7, 0x80, 0x22, 0x41, 0x46, 0xff, 0xd2, 0x03,
+	0x11, 0x42, 0x02, 0xd0, 0x16, 0x42, 0xff, 0x00, 0xd1, 0x3b, 0x00, 0xff, 0x24, 0x18, 0xe7, 0xf6,
+	0xc0, 0x06, 0x23, 0x26, 0x40, 0x41, 0xea, 0xd1, 0x00, 0x2b, 0xfb, 0x54, 0xd0, 0xc1, 0x09, 0x0e,
+	0xe7, 0x63, 0x44, 0x5a, 0xff, 0x01, 0x00, 0xd4, 0x3b, 0xe7, 0x2c, 0x4a, 0x0c, 0xff, 0x00, 0x13,
+	0x40, 0x06, 0xe7, 0x01, 0x21, 0x5d, 0xff, 0xe7, 0xdc, 0xb9, 0xf3, 0xb3, 0xc9, 0x43, 0x59, 0x7e,
+	0x40, 0x2a, 0x35, 0xd0, 0x1b, 0x29, 0x47, 0xdc, 0xc0, 0x27, 0xfb, 0x26, 0xcc, 0xc0, 0x59, 0x8b,
+	0x40, 0x59, 0x1e, 0x8b, 0xfe, 0xc0, 0x27, 0x63, 0x44, 0x04, 0x00, 0x4b, 0xe7, 0xc3, 0xbf, 0xb9,
+	0x3b, 0x00, 0x6f, 0xb3, 0x0d, 0x40, 0x16, 0xeb, 0xff, 0xe6, 0x3b, 0x00, 0x04, 0x00, 0x0d, 0x00,
+	0xe7, 0xaf, 0xe6, 0xff, 0x28, 0x1c, 0xc2, 0x36, 0x49, 0xc0, 0x36, 0xe1, 0xde, 0x40, 0x53, 0x00,
+	0xd1, 0xdd, 0xe6, 0xc1, 0x4c, 0x1f, 0xd5, 0xed, 0xfb, 0xc0, 0x33, 0xd7, 0xe6, 0x43, 0x27, 0xd3,
+	0xe6, 0x80, 0xbb, 0x22, 0x40, 0x40, 0x27, 0x10, 0x42, 0xb3, 0x40, 0x27, 0xb1, 0xec, 0x40, 0x27,
+	0x41, 0x11, 0xc8, 0xe6, 0xc1, 0x33, 0xc5, 0xe6, 0x01, 0x77, 0x23, 0x7e, 0xe7, 0xc1, 0x13, 0xc0,
+	0xe6, 0x80, 0x40, 0x67, 0xf7, 0xf6, 0x03, 0xf6, 0x40, 0x17, 0xba, 0xe6, 0x33, 0x00, 0xfe, 0xc1,
+	0x42, 0xe7, 0xe6, 0x00, 0x22, 0x26, 0xe7, 0x01, 0x7f, 0x23, 0xbd, 0xe7, 0xff, 0xff, 0xff, 0x7d,
+	0xc0, 0x00, 0xff, 0xfb, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x46, 0xde, 0xff, 0x46, 0x45, 0x46, 0xe0,
+	0xb5, 0x43, 0x00, 0x44, 0xff, 0x02, 0xc6, 0x0f, 0x1b, 0x0e, 0x83, 0xb0, 0x0f, 0xdf, 0x1c, 0x64,
+	0x0a, 0xb2, 0x46, 0x41, 0x39, 0xff, 0x2b, 0xff, 0x28, 0xd0, 0x80, 0x22, 0xe4, 0x00, 0xd2, 0x04,
+	0xff, 0x14, 0x43, 0x7f, 0x22, 0x52, 0x42, 0x90, 0x46, 0xef, 0x40, 0xf2, 0x00, 0x09, 0xc0, 0x00,
+	0x0b, 0x98, 0x44, 0xff, 0x78, 0x00, 0x7d, 0x02, 0xfb, 0x0f, 0x00, 0x0e, 0xff, 0x6d, 0x0a, 0x00,
+	0x93, 0x28, 0xb3, 0xff, 0x28, 0xff, 0x45, 0xd0, 0x80, 0x23, 0x00, 0x21, 0xed, 0x00, 0xff, 0xdb,
+	0x04, 0x1d, 0x43, 0x7f, 0x38, 0x47, 0x46, 0xff, 0x38, 0x1a, 0x4f, 0x46, 0x0f, 0x43, 0xbf, 0x00,
+	0xfb, 0xb9, 0x46, 0x40, 0x1f, 0x9a, 0x87, 0x4f, 0x53, 0x40, 0xff, 0x4a, 0x46, 0xba, 0x58, 0x01,
+	0x93, 0x97, 0x46, 0xef, 0x00, 0x2c, 0x4d, 0xd1, 0x45, 0x0f, 0x40, 0xf2, 0x08, 0x7e, 0xc0, 0x13,
+	0xff, 0x08, 0x40, 0xf2, 0x02, 0x0b, 0x41, 0x12, 0xff, 0x00, 0x28, 0xd9, 0xd1, 0x25, 0xbb, 0x00,
+	0x20, 0xeb, 0x01, 0x21, 0x41, 0x0d, 0x7a, 0x40, 0x0d, 0x42, 0x46, 0x10, 0xff, 0x1a, 0x4a, 0x46,
+	0x0a, 0x43, 0x92, 0x00, 0xba, 0xf7, 0x58, 0x1d, 0x00, 0x40, 0x0f, 0x9b, 0x2c, 0x00, 0x9a, 0xff,
+	0x46, 0x8b, 0x46, 0x5b, 0x46, 0x02, 0x2b, 0x30, 0xff, 0xd1, 0x53, 0x46, 0xff, 0x21, 0x00, 0x24,
+	0x37, 0x3f, 0xe0, 0xb4, 0xb9, 0x40, 0xf2, 0x04, 0x41, 0x26, 0x40, 0x12, 0xff, 0x01, 0x0b, 0xb0,
+	0xe7, 0xff, 0x20, 0x5d, 0xb9, 0xdf, 0x02, 0x21, 0xdc, 0xe7, 0x28, 0xc0, 0xea, 0xe4, 0xfc, 0xff,
+	0x43, 0x1f, 0x9d, 0x40, 0x76, 0x23, 0x5b, 0x42, 0xff, 0x18, 0x1a, 0x00, 0x21, 0xb1, 0xe7, 0x03,
+	0x21, 0x57, 0xaf, 0xe7, 0x20, 0xc0, 0x05, 0xd8, 0xc0, 0x05, 0x9c, 0xc2, 0x05, 0xf7, 0x1b, 0x1a,
+	0x98, 0x46, 0x36, 0x92, 0xe7, 0x40, 0xf2, 0xfd, 0x0c, 0xc4, 0x24, 0x03, 0x0b, 0x8b, 0xe7, 0x03,
+	0x2b, 0x7f, 0x00, 0xd1, 0xa5, 0xe0, 0x55, 0x46, 0x01, 0x40, 0xbe, 0xf7, 0x81, 0xe0, 0x01, 0xc0,
+	0x38, 0x00, 0x24, 0x2b, 0x40, 0xff, 0x64, 0x02, 0xc9, 0x05, 0x60, 0x0a, 0xdb, 0x07, 0x7f, 0x08,
+	0x43, 0x18, 0x43, 0x03, 0xb0, 0x3c, 0xc0, 0xee, 0x5f, 0x99, 0x46, 0xa2, 0x46, 0xab, 0x40, 0xf0,
+	0x80, 0xc0, 0x89, 0xbf, 0xe4, 0x03, 0xff, 0x21, 0xed, 0xe7, 0x41, 0x26, 0xea, 0xfe, 0xc0, 0x5b,
+	0x59, 0x1a, 0x1b, 0x29, 0x66, 0xdd, 0x01, 0xb7, 0x9a, 0x13, 0x40, 0xc1, 0x0e, 0xe1, 0xe7, 0xc1,
+	0xe8, 0x1c, 0xff, 0x42, 0x38, 0xd0, 0x1d, 0x42, 0x51, 0xd0, 0x1c, 0xff, 0x43, 0x64, 0x02, 0x64,
+	0x0a, 0x33, 0x00, 0xff, 0xff, 0x21, 0xd5, 0xe7, 0x63, 0x01, 0x6c, 0x01, 0xa3, 0xff, 0x42, 0x3b,
+	0xd2, 0x1b, 0x26, 0x00, 0x21, 0x01, 0xff, 0x38, 0x01, 0x25, 0x1f, 0x00, 0x49, 0x00, 0x5b, 0xfe,
+	0x40, 0xda, 0x01, 0xdb, 0x9c, 0x42, 0x01, 0xd8, 0x1b, 0xff, 0x1b, 0x29, 0x43, 0x01, 0x3e, 0x00,
+	0x2e, 0xf3, 0xff, 0xd1, 0x1c, 0x00, 0x63, 0x1e, 0x9c, 0x41, 0x0c, 0xff, 0x43, 0x01, 0x00, 0x7f,
+	0x31, 0x00, 0x29, 0xce, 0xff, 0xdd, 0x63, 0x07, 0x04, 0xd0, 0x0f, 0x23, 0x23, 0xfb, 0x40, 0x04,
+	0x40, 0x28, 0x04, 0x34, 0x23, 0x01, 0x03, 0xff, 0xd5, 0x01, 0x00, 0x2d, 0x4b, 0x80, 0x31, 0x1c,
+	0xff, 0x40, 0xfe, 0x29, 0x0d, 0xdd, 0x01, 0x23, 0x01, 0x37, 0x9a, 0xff, 0x21, 0xc0, 0x1e, 0x24,
+	0xa4, 0x43, 0x1e, 0x46, 0x1c, 0xfd, 0x9c, 0xc0, 0x26, 0x01, 0x9a, 0xa4, 0x01, 0x64, 0x0a, 0xff,
+	0xc9, 0xb2, 0x13, 0x40, 0x95, 0xe7, 0x1b, 0x1b, 0xff, 0x1a, 0x26, 0x01, 0x21, 0xc2, 0xe7, 0x00,
+	0x9b, 0xff, 0x8b, 0x46, 0x9a, 0x46, 0x00, 0x24, 0x4d, 0xe7, 0xbf, 0x63, 0x02, 0xe5, 0xd5, 0x00,
+	0x25, 0xc0, 0xa4, 0x03, 0xfd, 0x2c, 0x42, 0x0d, 0x00, 0x9b, 0xff, 0x21, 0x81, 0xe7, 0xff, 0x01,
+	0x95, 0xc1, 0xe7, 0x23, 0x00, 0x20, 0x20, 0xff, 0xcb, 0x40, 0x41, 0x1a, 0x8c, 0x40, 0x61, 0x1e,
+	0xef, 0x8c, 0x41, 0x1c, 0x43, 0xcb, 0x20, 0x63, 0x01, 0x05, 0x95, 0xd5, 0xc1, 0x16, 0x01, 0xc2,
+	0x1d, 0x68, 0xc6, 0x19, 0x41, 0x40, 0x61, 0x7c, 0x48, 0x21, 0x41, 0x6f, 0x59, 0xe7, 0xc0, 0x46,
+	0x60, 0x80, 0x39, 0xf9, 0xa0, 0xc0, 0x00, 0xc0, 0xa4, 0xf7, 0x70, 0xb5, 0x42, 0x00, 0xff, 0x45,
+	0x02, 0x4e, 0x02, 0x4c, 0x00, 0xc3, 0x0f, 0xff, 0x6d, 0x0a, 0x12, 0x0e, 0x76, 0x0a, 0x24, 0x0e,
+	0xff, 0xc9, 0x0f, 0x01, 0x20, 0xff, 0x2a, 0x06, 0xd0, 0xff, 0xff, 0x2c, 0x03, 0xd0, 0xa2, 0x42,
+	0x01, 0xd1, 0xff, 0xb5, 0x42, 0x06, 0xd0, 0x70, 0xbd, 0x00, 0x2d, 0xff, 0xfc, 0xd1, 0xff, 0x2c,
+	0xfa, 0xd1, 0x00, 0x2e, 0xf7, 0xf8, 0xd1, 0x8b, 0x40, 0x04, 0x01, 0x20, 0x00, 0x2a, 0xff, 0xf3,
+	0xd1, 0x28, 0x00, 0x45, 0x1e, 0xa8, 0x41, 0x7f, 0xef, 0xe7, 0x00, 0x20, 0xed, 0xe7, 0xf0, 0xc2,
+	0x12, 0x3f, 0x4c, 0x02, 0xc3, 0x0f, 0x48, 0x00, 0xc1, 0x12, 0x40, 0x30, 0xfe, 0xc0, 0x12, 0xff,
+	0x2a, 0x1d, 0xd0, 0xff, 0x28, 0x10, 0xff, 0xd0, 0x3a, 0xb9, 0x6e, 0x42, 0x6e, 0x41, 0xf6, 0xff,
+	0xb2, 0x80, 0xb9, 0x7c, 0xb9, 0x00, 0x20, 0x3d, 0xff, 0xb1, 0x03, 0xe0, 0x00, 0xb9, 0x0c, 0xb1,
+	0x8b, 0xff, 0x42, 0x11, 0xd0, 0x01, 0x21, 0x58, 0x42, 0x08, 0xff, 0x43, 0xf0, 0xbd, 0x00, 0x2c,
+	0xec, 0xd0, 0x02, 0xff, 0x20, 0x40, 0x42, 0xf9, 0xe7, 0x00, 0x2e, 0xf2, 0xfe, 0xc0, 0x17, 0x01,
+	0x39, 0x08, 0x43, 0xf3, 0xe7, 0x00, 0xff, 0x2d, 0xdf, 0xd0, 0xf3, 0xe7, 0x82, 0x42, 0xeb, 0xff,
+	0xdc, 0x04, 0xdb, 0xa5, 0x42, 0xe8, 0xd8, 0x00, 0xf5, 0x20, 0x40, 0x01, 0xd2, 0xc0, 0x0c, 0x1e,
+	0x08, 0x43, 0xe4, 0x3a, 0xc2, 0x1c, 0x4d, 0x40, 0x2f, 0x46, 0x02, 0x76, 0x40, 0x1c, 0xc1, 0x30,
+	0xee, 0xc1, 0x2f, 0xff, 0x2a, 0x16, 0x40, 0x2f, 0x10, 0xd0, 0x42, 0xff, 0xb9, 0x70, 0x42, 0x70,
+	0x41, 0xc0, 0xb2, 0x9c, 0xf7, 0xb1, 0x20, 0xb1, 0xc3, 0x13, 0xf0, 0xbd, 0x9c, 0xb1, 0xe7, 0x99,
+	0x42, 0x14, 0x40, 0x17, 0xc0, 0xa7, 0x43, 0xf7, 0xe7, 0x7f, 0x02, 0x20, 0x00, 0x2d, 0xf4, 0xd1,
+	0xea, 0xc1, 0x01, 0xef, 0x2e, 0xf0, 0xd1, 0xe4, 0x40, 0x1b, 0xe9, 0xd1, 0x00, 0xee, 0xc0, 0x02,
+	0xea, 0xd0, 0xed, 0xc2, 0x02, 0xea, 0xe7, 0xa2, 0xff, 0x42, 0x06, 0xdc, 0xe0, 0xdb, 0xae, 0x42,
+	0x03, 0xfe, 0x40, 0x1e, 0xae, 0x42, 0xdb, 0xd3, 0xdd, 0xe7, 0x01, 0xeb, 0x20, 0x49, 0xc0, 0x2b,
+	0xd9, 0xc0, 0x1e, 0x46, 0x46, 0x4f, 0xff, 0x46, 0xd6, 0x46, 0x43, 0x02, 0xc0, 0xb5, 0x46, 0xbf,
+	0x00, 0x5b, 0x0a, 0x36, 0x0e, 0x88, 0xc0, 0xa5, 0xc4, 0xff, 0x0f, 0x00, 0x2e, 0x51, 0xd0, 0xff,
+	0x2e, 0x23, 0xff, 0xd0, 0x80, 0x20, 0xdb, 0x00, 0xc0, 0x04, 0x18, 0xdf, 0x43, 0x81, 0x46, 0x00,
+	0x27, 0xc0, 0xba, 0x0a, 0x7f, 0xff, 0x3e, 0x43, 0x46, 0x58, 0x00, 0x5d, 0x02, 0x00, 0xbb, 0x0e,
+	0xdb, 0xc0, 0x29, 0x98, 0x46, 0x08, 0xc0, 0xf1, 0x42, 0xbf, 0xd0, 0xeb, 0x00, 0x80, 0x25, 0xed,
+	0x40, 0xf1, 0x00, 0xff, 0x23, 0x7f, 0x38, 0x41, 0x46, 0x36, 0x18, 0x61, 0xff, 0x40, 0x70, 0x1c,
+	0x1f, 0x43, 0x0f, 0x2f, 0x69, 0x7f, 0xd8, 0x7b, 0x4a, 0xbf, 0x00, 0xd2, 0x59, 0xc0, 0xe0, 0xf7,
+	0x2b, 0x48, 0xd1, 0x47, 0x0e, 0x08, 0x27, 0xff, 0x26, 0xfa, 0xc0, 0xef, 0x0a, 0x41, 0x10, 0x00,
+	0x28, 0xdd, 0xd1, 0x00, 0xfb, 0x2d, 0x3e, 0x40, 0x2c, 0x01, 0x23, 0xe0, 0xe7, 0x41, 0xb6, 0xc0,
+	0xe8, 0x20, 0xd0, 0x41, 0xd0, 0xcf, 0xe0, 0xc1, 0xcf, 0xad, 0xff, 0xe0, 0x00, 0x22, 0x00, 0x20,
+	0x19, 0x40, 0xcc, 0xff, 0xb2, 0x40, 0x02, 0xd2, 0x05, 0x40, 0x0a, 0xe4, 0xbf, 0x07, 0x10, 0x43,
+	0x20, 0x43, 0x1c, 0x44, 0xcf, 0xf0, 0xbf, 0xbd, 0x7b, 0xb9, 0x04, 0x27, 0x00, 0xc0, 0x12, 0x01,
+	0xfb, 0x0a, 0xb2, 0x40, 0xf0, 0x02, 0x23, 0x00, 0x2d, 0xbe, 0xff, 0xd0, 0x03, 0x23, 0xbc, 0xe7,
+	0x01, 0x24, 0xff, 0xff, 0x22, 0x0c, 0x40, 0x00, 0x20, 0xe3, 0xe7, 0x18, 0xfe, 0xc0, 0xed, 0xfc,
+	0xfa, 0x4a, 0x46, 0x43, 0x1f, 0x76, 0xff, 0x26, 0x9a, 0x40, 0x76, 0x42, 0x91, 0x46, 0x36, 0xdd,
+	0x1a, 0xc3, 0x32, 0x99, 0xe7, 0x0c, 0xc2, 0x21, 0x03, 0x0a, 0xed, 0x94, 0x42, 0xfd, 0xe9, 0xfa,
+	0x48, 0xfd, 0x23, 0x9a, 0xe7, 0xff, 0x80, 0x20, 0x00, 0x24, 0xc0, 0x03, 0xff, 0x22, 0x7f, 0xc1,
+	0xe7, 0x4d, 0x46, 0x53, 0x46, 0xb2, 0x40, 0x01, 0xff, 0x21, 0x00, 0x53, 0x46, 0xae, 0xe7, 0x4b,
+	0x46, 0xff, 0x1b, 0x0c, 0x98, 0x46, 0x4a, 0x46, 0x4f, 0xf6, 0xff, 0xff, 0x73, 0x1a, 0x40, 0x2b,
+	0x40, 0x1c, 0x00, 0xff, 0x54, 0x43, 0x2f, 0x0c, 0xa4, 0x46, 0x45, 0x46, 0xff, 0x44, 0x46, 0x7d,
+	0x43, 0x57, 0x43, 0x62, 0x46, 0xff, 0x63, 0x43, 0x12, 0x0c, 0xff, 0x18, 0xd2, 0x19, 0xff, 0x93,
+	0x42, 0x03, 0xd9, 0x80, 0x23, 0x5b, 0x02, 0xdf, 0x98, 0x46, 0x45, 0x44, 0x67, 0xc2, 0x0b, 0x14,
+	0x04, 0xff, 0x3b, 0x40, 0xe4, 0x18, 0xa3, 0x01, 0x5f, 0x1e, 0xff, 0xbb, 0x41, 0x12, 0x0c, 0xa4,
+	0x0e, 0x55, 0x19, 0xff, 0x1c, 0x43, 0xad, 0x01, 0x25, 0x43, 0x2b, 0x01, 0xfd, 0x04, 0xc0, 0xbf,
+	0x06, 0x00, 0x6a, 0x08, 0x1d, 0x40, 0xff, 0x15, 0x43, 0x32, 0x00, 0x7f, 0x32, 0x00, 0x2a, 0xd7,
+	0x27, 0xdd, 0x6b, 0xc2, 0xc8, 0x2b, 0xc3, 0xc8, 0x35, 0x2b, 0xfe, 0xc0, 0xe9, 0x32, 0x00, 0x28,
+	0x4b, 0x80, 0x32, 0x1d, 0xff, 0x40, 0xfe, 0x2a, 0x8d, 0xdc, 0x01, 0x24, 0xa8, 0xff, 0x01, 0x40,
+	0x0a, 0xd2, 0xb2, 0x0c, 0x40, 0x70, 0xfe, 0xc0, 0x2a, 0x4b, 0x46, 0xc0, 0x03, 0x03, 0x42, 0x08,
+	0xff, 0xd0, 0x05, 0x42, 0x05, 0xd1, 0x28, 0x43, 0x40, 0xff, 0x02, 0x40, 0x0a, 0x44, 0x46, 0xff,
+	0x22, 0x63, 0xba, 0x40, 0x2b, 0x18, 0x42, 0x03, 0xff, 0x22, 0x5d, 0x40, 0x45, 0xa3, 0x9f, 0x1a,
+	0x1b, 0x2b, 0x05, 0xdd, 0x40, 0x46, 0x40, 0x55, 0x55, 0xbf, 0xe7, 0x06, 0x00, 0xc9, 0xe7, 0x2a,
+	0xc0, 0xe5, 0xda, 0xff, 0x40, 0xc3, 0x1a, 0x9d, 0x40, 0x2b, 0x00, 0x5d, 0xbf, 0x1e, 0xab, 0x41,
+	0x13, 0x43, 0x5a, 0x41, 0x1d, 0x22, 0x6f, 0x1a, 0x40, 0x04, 0x2a, 0x40, 0x1d, 0x33, 0x5a, 0x41,
+	0x26, 0xeb, 0x24, 0x01, 0x42, 0x53, 0x3c, 0x40, 0x10, 0x9b, 0x01, 0x58, 0x95, 0x0a, 0xc1, 0x0f,
+	0x36, 0xc0, 0x1c, 0x01, 0xc0, 0x47, 0xc3, 0x1a, 0x0c, 0xaf, 0x40, 0xff, 0x22, 0x2d, 0xc0, 0xe5,
+	0xe0, 0xc4, 0xe4, 0xf8, 0xff, 0xb5, 0xce, 0x46, 0x47, 0x46, 0x44, 0x00, 0xc2, 0xbf, 0x0f, 0x80,
+	0xb5, 0x47, 0x02, 0x48, 0x40, 0x08, 0x84, 0xff, 0x46, 0x66, 0x46, 0x7b, 0x0a, 0x48, 0x00, 0x99,
+	0x7f, 0x46, 0x24, 0x0e, 0x15, 0x00, 0xdb, 0x00, 0xc1, 0xd5, 0xff, 0xf6, 0x00, 0xff, 0x28, 0x00,
+	0xd1, 0x8d, 0xe0, 0xfe, 0xc0, 0x6f, 0x08, 0x47, 0x46, 0x79, 0x40, 0x91, 0x42, 0xff, 0x65, 0xd0,
+	0x22, 0x1a, 0x00, 0x2a, 0x00, 0xdc, 0xdf, 0x9c, 0xe0, 0x00, 0x28, 0x3c, 0xc0, 0xe9, 0x00, 0xd1,
+	0xff, 0x8a, 0xe0, 0x51, 0x1e, 0x00, 0x29, 0x00, 0xd0, 0xfb, 0xb3, 0xe0, 0xc0, 0x1e, 0x1b, 0x5a,
+	0x01, 0x43, 0xd5, 0xdf, 0x9b, 0x01, 0x9f, 0x09, 0x38, 0xc0, 0x6b, 0x11, 0xfa, 0xff, 0x05, 0x38,
+	0x87, 0x40, 0x84, 0x42, 0x00, 0xdd, 0xdf, 0x94, 0xe0, 0x04, 0x1b, 0x3a, 0xc0, 0x31, 0x01, 0x34,
+	0xff, 0xe2, 0x40, 0x04, 0x1b, 0xa7, 0x40, 0x3b, 0x00, 0xf6, 0xc1, 0x57, 0x00, 0x24, 0xcf, 0x32,
+	0x26, 0xd5, 0x01, 0x34, 0xff, 0xff, 0x2c, 0x00, 0xd1, 0x77, 0xe0, 0x01, 0x22, 0xff, 0x9b, 0x01,
+	0x5b, 0x0a, 0xe4, 0xb2, 0x2a, 0x40, 0xff, 0x5b, 0x02, 0xe4, 0x05, 0x58, 0x0a, 0xd2, 0x07, 0xdf,
+	0x20, 0x43, 0x10, 0x43, 0x0c, 0x42, 0x96, 0xf8, 0xbd, 0xff, 0xff, 0x2c, 0xe1, 0xd0, 0x80, 0x21,
+	0xc9, 0x04, 0x7f, 0x0e, 0x43, 0x1b, 0x2a, 0x7a, 0xdc, 0x31, 0xc0, 0x16, 0xff, 0xd1, 0x40, 0x82,
+	0x1a, 0x96, 0x40, 0x72, 0x1e, 0xef, 0x96, 0x41, 0x0e, 0x43, 0xc1, 0x21, 0xbb, 0xd4, 0x5a, 0xff,
+	0x07, 0xd1, 0xd1, 0x01, 0x22, 0xdf, 0x08, 0x2a, 0xff, 0x40, 0xff, 0x2c, 0x33, 0xd1, 0x00, 0x2f,
+	0x00, 0xff, 0xd1, 0xa6, 0xe0, 0x80, 0x23, 0xdb, 0x03, 0x3b, 0xff, 0x43, 0x5b, 0x02, 0x5b, 0x0a,
+	0xff, 0x24, 0xd2, 0xff, 0xe7, 0x21, 0x1a, 0x00, 0x29, 0x4b, 0xdd, 0x58, 0xef, 0xb3, 0xff, 0x2c,
+	0xba, 0x40, 0xd2, 0xc0, 0x04, 0x06, 0xff, 0x43, 0x1b, 0x29, 0x00, 0xdd, 0xac, 0xe0, 0x30, 0xff,
+	0x00, 0x20, 0x27, 0xc8, 0x40, 0x79, 0x1a, 0x8e, 0xff, 0x40, 0x71, 0x1e, 0x8e, 0x41, 0x06, 0x43,
+	0x9b, 0xaf, 0x19, 0x59, 0x01, 0xd7, 0x44, 0x26, 0x84, 0x40, 0x26, 0x76, 0xff, 0x49, 0x1a, 0x40,
+	0x5b, 0x08, 0x0b, 0x40, 0x13, 0xf7, 0x43, 0x9e, 0xe7, 0xc0, 0x40, 0xd0, 0x72, 0xe7, 0x6d, 0xff,
+	0xe7, 0x3b, 0x00, 0x00, 0x2f, 0xc5, 0xd1, 0x00, 0xfb, 0x22, 0x7b, 0xc0, 0x16, 0xe4, 0xb2, 0xa4,
+	0xe7, 0x14, 0xfb, 0x00, 0x90, 0xc0, 0x06, 0x4b, 0xd0, 0x48, 0x1e, 0x00, 0xff, 0x28, 0x55, 0xd1,
+	0x9b, 0x19, 0x01, 0x24, 0x5a, 0xff, 0x01, 0xb5, 0xd5, 0x02, 0x24, 0xdf, 0xe7, 0x2a, 0xff, 0xbb,
+	0x62, 0x1c, 0xd2, 0xb2, 0x01, 0x2a, 0x71, 0xff, 0xdd, 0x9f, 0x1b, 0x7a, 0x01, 0x34, 0xd5, 0xf7,
+	0xff, 0x1a, 0x0d, 0x00, 0x66, 0xe7, 0x01, 0x22, 0x00, 0xef, 0x23, 0x2a, 0x40, 0x88, 0xc0, 0x11,
+	0x5f, 0x4a, 0x24, 0xff, 0x1a, 0x13, 0x40, 0x71, 0xe7, 0x00, 0x29, 0x69, 0xff, 0xd1, 0x61, 0x1c,
+	0xc8, 0xb2, 0x01, 0x28, 0x4d, 0xff, 0xdd, 0xff, 0x29, 0x48, 0xd0, 0x9b, 0x19, 0x5b, 0xff, 0x08,
+	0x0c, 0x00, 0x65, 0xe7, 0xff, 0x2a, 0x40, 0xff, 0xd0, 0x0a, 0x00, 0x82, 0xe7, 0x01, 0x26, 0x9b,
+	0xff, 0x1b, 0x8a, 0xe7, 0xe4, 0xb1, 0xff, 0x28, 0x21, 0xff, 0xd0, 0x80, 0x24, 0xe4, 0x04, 0x52,
+	0x42, 0x23, 0xfe, 0x40, 0x43, 0x00, 0xdd, 0x90, 0xe0, 0x1c, 0x00, 0x20, 0xff, 0x25, 0xd4, 0x40,
+	0xaa, 0x1a, 0x93, 0x40, 0x5a, 0xff, 0x1e, 0x93, 0x41, 0x23, 0x43, 0xf3, 0x1a, 0x04, 0xdf, 0x00,
+	0x0d, 0x00, 0x30, 0xe7, 0xc0, 0x40, 0xd0, 0x31, 0xfd, 0xe7, 0xc0, 0x96, 0x24, 0xab, 0xe7, 0x0c,
+	0x00, 0x40, 0xff, 0xe7, 0x00, 0x2b, 0x52, 0xd0, 0xd2, 0x43, 0x00, 0xff, 0x2a, 0xee, 0xd0, 0xff,
+	0x28, 0xe1, 0xd1, 0x33, 0xff, 0x00, 0xff, 0x24, 0x0d, 0x00, 0x35, 0xe7, 0xff, 0xbf, 0x29, 0x10,
+	0xd0, 0x01, 0x00, 0x79, 0x40, 0x07, 0x68, 0xf7, 0xd0, 0xff, 0x24, 0xc1, 0x78, 0x2b, 0xe7, 0x80,
+	0x22, 0xff, 0x49, 0x46, 0xd2, 0x03, 0x11, 0x42, 0x03, 0xd0, 0xdf, 0x61, 0x46, 0x11, 0x42, 0x00,
+	0xc2, 0x0a, 0x20, 0xe7, 0xfe, 0x40, 0x07, 0x23, 0x2f, 0xe7, 0x00, 0x2c, 0xe9, 0xd1, 0xef, 0x00,
+	0x2b, 0x5d, 0xd0, 0x41, 0x0a, 0x16, 0xe7, 0x9b, 0xff, 0x19, 0x5a, 0x01, 0x00, 0xd4, 0x40, 0xe7,
+	0x2e, 0xff, 0x4a, 0x0c, 0x00, 0x13, 0x40, 0x0e, 0xe7, 0xdc, 0x57, 0xb9, 0x5b, 0xbb, 0xc1, 0x41,
+	0x33, 0x40, 0x20, 0x07, 0xc0, 0x2c, 0xff, 0x58, 0xe7, 0xe4, 0xb9, 0x00, 0x2b, 0x40, 0xd0, 0xf7,
+	0xc9, 0x43, 0x59, 0x40, 0x2e, 0x37, 0xd0, 0x1b, 0x29, 0xdb, 0x42, 0xdc, 0xc0, 0x2b, 0x27, 0xcc,
+	0xc0, 0x5b, 0x8b, 0x40, 0xf7, 0x59, 0x1e, 0x8b, 0xc0, 0x2b, 0x9b, 0x19, 0x04, 0x00, 0xff, 0x45,
+	0xe7, 0xcb, 0xb9, 0x26, 0xbb, 0x80, 0x27, 0xff, 0x00, 0x22, 0xff, 0x03, 0x23, 0xe7, 0x33, 0x00,
+	0xbe, 0x41, 0x30, 0xe7, 0xe6, 0xff, 0x28, 0x1e, 0xc2, 0x3a, 0x49, 0xba, 0xc0, 0x3a, 0xe1, 0xc1,
+	0x5e, 0xd1, 0xdd, 0xe6, 0x41, 0x51, 0x00, 0x6f, 0xd4, 0x3e, 0xe7, 0xf3, 0xc0, 0x51, 0xd6, 0xe6,
+	0x43, 0x2c, 0xdf, 0xd2, 0xe6, 0x80, 0x22, 0x48, 0x40, 0x2c, 0x10, 0x42, 0x7f, 0xaa, 0xd0, 0x60,
+	0x46, 0x10, 0x42, 0xa7, 0x40, 0x2c, 0xed, 0x0d, 0xc0, 0x2c, 0xc6, 0xe6, 0x41, 0x2e, 0xc3, 0xe6,
+	0x01, 0xbb, 0x23, 0x74, 0xc2, 0x14, 0xbe, 0xe6, 0x00, 0x40, 0x18, 0x24, 0x5a, 0xc0, 0x02, 0xb9,
+	0xc0, 0x04, 0xc2, 0xe7, 0xc0, 0xc6, 0x7d, 0xc0, 0x00, 0xef, 0xfb, 0x41, 0x02, 0x43, 0xc0, 0xc6,
+	0x49, 0x0a, 0x1b, 0xff, 0x0e, 0x00, 0x20, 0x7e, 0x2b, 0x0c, 0xdd, 0x9d, 0xff, 0x2b, 0x0b, 0xdc,
+	0x80, 0x20, 0x00, 0x04, 0x01, 0xff, 0x43, 0x95, 0x2b, 0x09, 0xdc, 0x96, 0x20, 0xc3, 0xff, 0x1a,
+	0xd9, 0x40, 0x48, 0x42, 0x02, 0xb9, 0x08, 0xff, 0x00, 0x70, 0x47, 0x02, 0x4b, 0xd0, 0x18, 0xfb,
+	0xbf, 0xe7, 0x96, 0x3b, 0x99, 0x40, 0xf5, 0xc1, 0x0f, 0x7f, 0xff, 0x70, 0xb5, 0x00, 0x28, 0x30,
+	0xd0, 0xc3, 0x17, 0x7f, 0xc4, 0x18, 0x5c, 0x40, 0xc5, 0x0f, 0x20, 0x40, 0xc2, 0xff, 0x8c, 0xf8,
+	0x9e, 0x23, 0x1b, 0x1a, 0x96, 0x2b, 0xff, 0x0d, 0xdc, 0x96, 0x22, 0xd2, 0x1a, 0x94, 0x40, 0xff,
+	0x2a, 0x00, 0x64, 0x02, 0x64, 0x0a, 0xdb, 0xb2, 0x5f, 0x64, 0x02, 0xdb, 0x05, 0x60, 0x40, 0xb6,
+	0x18, 0x40, 0xb6, 0x7f, 0x70, 0xbd, 0x99, 0x2b, 0x19, 0xdc, 0x99, 0xc0, 0x07, 0xff, 0x00, 0x2a,
+	0x29, 0xdd, 0x94, 0x40, 0x22, 0x00, 0xdf, 0x14, 0x4c, 0x14, 0x40, 0x51, 0xc1, 0xc7, 0x21, 0x0a,
+	0xfe, 0xc3, 0xc7, 0x34, 0x62, 0x01, 0x13, 0xd4, 0xa4, 0x01, 0xee, 0x41, 0x0e, 0x2a, 0x00, 0xe0,
+	0xc1, 0x71, 0x23, 0x00, 0x24, 0xff, 0xdc, 0xe7, 0x05, 0x22, 0x21, 0x00, 0x12, 0x1a, 0xf7, 0xd1,
+	0x40, 0xb9, 0xc2, 0x16, 0x62, 0x1e, 0x94, 0x41, 0xff, 0x0c, 0x43, 0xda, 0xe7, 0x05, 0x4b, 0x2a,
+	0x00, 0xff, 0x1c, 0x40, 0x9f, 0x23, 0xa4, 0x01, 0x1b, 0x1a, 0xbe, 0x41, 0x0c, 0xc8, 0xe7, 0x22,
+	0x00, 0xd5, 0xc1, 0x27, 0xfb, 0xff, 0x10, 0xb5, 0x04, 0x00, 0x38, 0xb3, 0x00, 0xf0, 0x85, 0x41,
+	0x44, 0x25, 0x0a, 0x44, 0x25, 0xc9, 0x24, 0x40, 0x24, 0xc0, 0x23, 0x17, 0xaa, 0xc4, 0x23, 0x27,
+	0xc2, 0x23, 0x13, 0xd0, 0x23, 0x12, 0xc4, 0x23, 0xe3, 0xdd, 0xe7, 0xc1, 0x22, 0xe0, 0xe7, 0xb9,
+	0xc0, 0x22, 0xd2, 0x1a, 0xff, 0x91, 0x40, 0x0a, 0x00, 0x51, 0x1e, 0x8a, 0x41, 0xff, 0x05, 0x21,
+	0x09, 0x1a, 0xcc, 0x40, 0x14, 0x43, 0xaf, 0xdb, 0xe7, 0x04, 0x4b, 0xc9, 0x22, 0xcc, 0xc0, 0x22,
+	0xd7, 0xfe, 0xc2, 0x22, 0x1c, 0x21, 0x01, 0x23, 0x1b, 0x04, 0x98, 0xff, 0x42, 0x01, 0xd3, 0x00,
+	0x0c, 0x10, 0x39, 0x1b, 0x7d, 0x0a, 0x42, 0x02, 0x0a, 0x08, 0x39, 0x1b, 0x09, 0x42, 0x02, 0xff,
+	0x09, 0x04, 0x39, 0x02, 0xa2, 0x10, 0x5c, 0x40, 0xff, 0x18, 0x70, 0x47, 0xc0, 0x46, 0x04, 0x03,
+	0x02, 0xcb, 0x02, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc0, 0x59, 0x25, 0x0e, 0xff, 0x4b, 0x0f,
+	0x4c, 0xe4, 0x1a, 0xa4, 0x10, 0xa5, 0xff, 0x42, 0x09, 0xd1, 0x00, 0x25, 0x00, 0xf0, 0x4b, 0xdf,
+	0xfa, 0x0c, 0x4c, 0x0c, 0x4b, 0x43, 0x04, 0x07, 0xd1, 0xff, 0x70, 0xbd, 0x06, 0x4a, 0xab, 0x00,
+	0x9b, 0x18, 0xff, 0x1b, 0x68, 0x98, 0x47, 0x01, 0x35, 0xec, 0xe7, 0x7e, 0x49, 0x03, 0xee, 0xe7,
+	0x2c, 0x5c, 0x00, 0x00, 0xc1, 0x00, 0x7d, 0x30, 0xc4, 0x01, 0x00, 0x23, 0x10, 0xb5, 0x9a, 0xc0,
+	0xb6, 0xff, 0x10, 0xbd, 0xcc, 0x5c, 0xc4, 0x54, 0x01, 0x33, 0x7f, 0xf8, 0xe7, 0x03, 0x00, 0x82,
+	0x18, 0x93, 0x40, 0x04, 0xff, 0x70, 0x47, 0x19, 0x70, 0x01, 0x33, 0xf9, 0xe7, 0xde, 0xc0, 0x08,
+	0x02, 0x00, 0x00, 0x05, 0x80, 0x01, 0x08, 0x58, 0xce, 0x00, 0x01, 0x09, 0x00, 0x00, 0x02, 0x23,
+	0xc0, 0x02, 0xe6, 0x00, 0xff, 0x63, 0x02, 0x23, 0x04, 0x00, 0x00, 0x9a, 0x00, 0xff, 0x80, 0x20,
+	0x01, 0x20, 0xa0, 0x00, 0x00, 0x22, 0xff, 0xc0, 0x03, 0xa8, 0x00, 0xc0, 0x03, 0x02, 0x46, 0xfb,
+	0xb2, 0x00, 0x80, 0x4e, 0x22, 0xba, 0x00, 0x56, 0x22, 0xff, 0x4f, 0x22, 0x00, 0x00, 0x78, 0x14,
+	0x00, 0x00, 0x4d, 0xda, 0xc0, 0x00, 0x82, 0x13, 0xc0, 0x02, 0xc0, 0x00, 0x8c, 0xc0, 0x00, 0x55,
+	0x9e, 0xc0, 0x00, 0xbc, 0xc0, 0x00, 0x06, 0xc0, 0x00, 0xfa, 0xc0, 0x00, 0x35, 0x18, 0xc0, 0x07,
+	0x26, 0xc0, 0x00, 0x6e, 0x13, 0xff, 0x00, 0xff, 0x00, 0xd0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+	0xd5, 0x00, 0x40, 0xc0, 0x59, 0x56, 0x45, 0xff, 0x52, 0x5f, 0x4e, 0x4f, 0x54, 0x45, 0x53, 0x3a,
+	0xff, 0x20, 0x28, 0x44, 0x45, 0x42, 0x55, 0x47, 0x29, 0xff, 0x20, 0x42, 0x6f, 0x6f, 0x74, 0x6c,
+	0x6f, 0x61, 0xff, 0x64, 0x65, 0x72, 0x20, 0x70, 0x61, 0x74, 0x63, 0xff, 0x68, 0x2c, 0x20, 0x46,
+	0x69, 0x78, 0x65, 0x64, 0xff, 0x20, 0x49, 0x32, 0x43, 0x20, 0x68, 0x61, 0x6e, 0xff, 0x67, 0x20,
+	0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0xf7, 0x69, 0x6f, 0x6e, 0x80, 0x7f, 0x52, 0x45, 0x56, 0x3a,
+	0x7f, 0x20, 0x30, 0x2e, 0x31, 0x32, 0x2e, 0x30, 0xc1, 0x12, 0xbf, 0x3a, 0x20, 0x34, 0x37, 0x2e,
+	0x30, 0xc0, 0x02, 0x2e, 0xff, 0x2e, 0x2f, 0x68, 0x61, 0x6c, 0x2f, 0x73, 0x72, 0xfd, 0x63, 0xc1,
+	0x01, 0x5f, 0x61, 0x64, 0x63, 0x5f, 0x61, 0x7f, 0x73, 0x79, 0x6e, 0x63, 0x2e, 0x63, 0x00, 0xcd,
+	0x06, 0xcf, 0x64, 0x61, 0x63, 0x5f, 0x85, 0x06, 0xcd, 0x06, 0x69, 0x32, 0xc8, 0xc0, 0x06, 0x47,
+	0x0e, 0xcf, 0x07, 0x6f, 0x80, 0x05, 0xcc, 0x04, 0x74, 0x69, 0xf7, 0x6d, 0x65, 0x72, 0xc8, 0x19,
+	0x75, 0x74, 0x69, 0x6c, 0xf9, 0x73, 0x42, 0x07, 0x42, 0x02, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0xfc,
+	0xc9, 0x1a, 0xcd, 0x07, 0x72, 0x69, 0x6e, 0x67, 0x62, 0x75, 0x73, 0x66, 0x66, 0x02, 0x11, 0xc1,
+	0x08, 0x70, 0x6c, 0x2f, 0xc0, 0x2f, 0x00, 0xc1, 0x01, 0xc1, 0x31, 0xc7, 0x21, 0xc0, 0x05, 0xc0,
+	0x2e, 0xc2, 0x05, 0xc0, 0x01, 0xca, 0x05, 0xe3, 0x72, 0x74, 0xc3, 0x05, 0xc0, 0x01, 0xc3, 0x05,
+	0x00, 0x04, 0x00, 0x17, 0x42, 0x00, 0x08, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x10, 0x00, 0xc4, 0x0d,
+	0x3f, 0x73, 0x65, 0x72, 0x63, 0x6f, 0x6d, 0x82, 0x0e, 0x83, 0x02, 0xf6, 0x41, 0x0f, 0x16, 0x4e,
+	0xc0, 0xd8, 0x4d, 0x00, 0x00, 0xf8, 0xaa, 0xc0, 0x00, 0x3c, 0xc4, 0x01, 0xdc, 0xc8, 0x03, 0xe6,
+	0xc4, 0x00, 0xdc, 0xaa, 0xc4, 0x03, 0x44, 0xc8, 0x00, 0xfe, 0xc8, 0x07, 0xba, 0xc0, 0x00, 0x9e,
+	0x85, 0x4e, 0xc3, 0x01, 0xdc, 0xc8, 0x03, 0xc9, 0x0f, 0xc1, 0x03, 0xc9, 0x0f, 0xa8, 0x7e, 0xc0,
+	0x03, 0x8c, 0x51, 0x00, 0x00, 0xea, 0x50, 0xc3, 0x00, 0x6d, 0xe8, 0xc0, 0x00, 0x7e, 0x51, 0xc3,
+	0x00, 0x74, 0x51, 0xc7, 0x03, 0xd9, 0x74, 0xc4, 0x04, 0xc1, 0x03, 0x84, 0x51, 0xc7, 0x00, 0x20,
+	0x52, 0xfe, 0xc0, 0x29, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0xbf, 0x9e, 0x46, 0x70, 0x47,
+	0x21, 0x11, 0xcb, 0x03, 0xf5, 0xef, 0x10, 0x00, 0x00, 0xa3, 0xc0, 0x3f, 0x02, 0x0b, 0x30, 0xf7,
+	0x00, 0x02, 0x0c, 0xc0, 0x00, 0xcb, 0x17, 0x00, 0x80, 0x0d, 0xb2, 0x41, 0x44, 0xfa, 0xc3
+};
+
+const ads_fw_image_t ads_fw_v2_lz_image = {
+	47,									// rev
+	19544,								// len
+	0x6b32bc12,							// crc
+	ADS_FW_LZ,							// format
+	ads_fw_v2_lz_data,
+	sizeof(ads_fw_v2_lz_data)
+};
@@ -10,54 +10,108 @@
 #include "Arduino.h"
 #include "Wire.h"
 
-static void (*ads_read_callback)(uint8_t *);
-
-static uint8_t read_buffer[ADS_TRANSFER_SIZE];
-
-#define ADS_DEFAULT_ADDR		(0x12)			// Default I2C address of the ADS one axis sensor
-
-static uint32_t ADS_RESET_PIN = 0;
-static uint32_t ADS_INTERRUPT_PIN = 0;
-
+/*
+ * Maximum number of ADS devices the HAL can service at once. attachInterrupt
+ * does not pass a context to the interrupt service routine, so each device
+ * is assigned one of a fixed set of service routines below.
+ */
+#define ADS_HAL_MAX_DEVICES		(16)
 
-static uint8_t _address = ADS_DEFAULT_ADDR;
+/*
+ * Longest write the Wire library sends in one transaction, the size of its
+ * transmit buffer. 32 bytes on AVR, larger on most other cores.
+ */
+#ifndef ADS_HAL_MAX_WRITE
+#if defined(I2C_BUFFER_LENGTH)
+#define ADS_HAL_MAX_WRITE		(I2C_BUFFER_LENGTH)
+#elif defined(BUFFER_LENGTH)
+#define ADS_HAL_MAX_WRITE		(BUFFER_LENGTH)
+#else
+#define ADS_HAL_MAX_WRITE		(32)
+#endif
+#endif
 
-volatile bool _ads_int_enabled = false;
+static ads_dev_t * ads_hal_devs[ADS_HAL_MAX_DEVICES];
 
 
 /************************************************************************/
 /*                        HAL Stub Functions                            */
 /************************************************************************/
 static inline void ads_hal_gpio_pin_write(uint8_t pin, uint8_t val);
-static void ads_hal_pin_int_init(void);
-static void ads_hal_i2c_init(void);
+static void ads_hal_pin_int_init(ads_dev_t * dev);
+static void ads_hal_i2c_init(ads_dev_t * dev);
 
 
 /**
- * @brief ADS data ready interrupt. Reads out packet from ADS and fires 
+ * @brief Returns the TwoWire instance the device is attached to
+ */
+static inline TwoWire * ads_hal_wire(ads_dev_t * dev)
+{
+	return (dev->bus != NULL) ? (TwoWire *)dev->bus : &Wire;
+}
+
+/**
+ * @brief ADS data ready interrupt. Reads out packet from ADS and fires
  *  		callback in ads.c
  */
-void ads_hal_interrupt(void)
+static void ads_hal_interrupt(ads_dev_t * dev)
 {
-	if(ads_hal_read_buffer(read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
+	// Latch the time of the edge before the read
+	dev->drdy_timestamp = micros();
+	
+	if(ads_hal_read_buffer(dev, dev->read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
 	{
-		ads_read_callback(read_buffer);
+		dev->read_callback(dev, dev->read_buffer);
 	}
 }
 
+/*
+ * Per slot interrupt service routines, dispatching to ads_hal_interrupt
+ * with the device registered in that slot.
+ */
+#define ADS_HAL_ISR(n)		static void ads_hal_isr_##n(void) { ads_hal_interrupt(ads_hal_devs[n]); }
+
+ADS_HAL_ISR(0)  ADS_HAL_ISR(1)  ADS_HAL_ISR(2)  ADS_HAL_ISR(3)
+ADS_HAL_ISR(4)  ADS_HAL_ISR(5)  ADS_HAL_ISR(6)  ADS_HAL_ISR(7)
+ADS_HAL_ISR(8)  ADS_HAL_ISR(9)  ADS_HAL_ISR(10) ADS_HAL_ISR(11)
+ADS_HAL_ISR(12) ADS_HAL_ISR(13) ADS_HAL_ISR(14) ADS_HAL_ISR(15)
+
+static void (* const ads_hal_isr[ADS_HAL_MAX_DEVICES])(void) = {
+	ads_hal_isr_0,  ads_hal_isr_1,  ads_hal_isr_2,  ads_hal_isr_3,
+	ads_hal_isr_4,  ads_hal_isr_5,  ads_hal_isr_6,  ads_hal_isr_7,
+	ads_hal_isr_8,  ads_hal_isr_9,  ads_hal_isr_10, ads_hal_isr_11,
+	ads_hal_isr_12, ads_hal_isr_13, ads_hal_isr_14, ads_hal_isr_15,
+};
+
+/**
+ * @brief Attach the devices interrupt service routine to its data ready pin
+ */
+static inline void ads_hal_attach(ads_dev_t * dev)
+{
+	attachInterrupt(digitalPinToInterrupt(dev->datardy_pin), ads_hal_isr[dev->hal_slot], FALLING);
+}
+
 /**
- * @brief Initializes the pin ADS_INTERRUPT_PIN as a falling edge pin change interrupt.
+ * @brief Detach the devices interrupt service routine from its data ready pin
+ */
+static inline void ads_hal_detach(ads_dev_t * dev)
+{
+	detachInterrupt(digitalPinToInterrupt(dev->datardy_pin));
+}
+
+/**
+ * @brief Initializes the pin datardy_pin as a falling edge pin change interrupt.
  *			Assign the interrupt service routine as ads_hal_interrupt. Enable pullup
- *			Enable interrupt	
+ *			Enable interrupt
  */
-static void ads_hal_pin_int_init(void)
+static void ads_hal_pin_int_init(ads_dev_t * dev)
 {
- 	pinMode(ADS_INTERRUPT_PIN, INPUT_PULLUP);
-	attachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN), ads_hal_interrupt, FALLING);
+ 	pinMode(dev->datardy_pin, INPUT_PULLUP);
+	ads_hal_attach(dev);
 }
 
 /**
- * @brief Write pin to level of val	
+ * @brief Write pin to level of val
  */
 static inline void ads_hal_gpio_pin_write(uint8_t pin, uint8_t val)
 {
@@ -72,24 +126,64 @@ void ads_hal_delay(uint16_t delay_ms)
 	delay(delay_ms);
 }
 
+/**
+ * @brief Microsecond delay routine.
+ */
+void ads_hal_delay_us(uint16_t delay_us)
+{
+	delayMicroseconds(delay_us);
+}
+
+/**
+ * @brief Monotonic microsecond time stamp. Wraps around at 2^32.
+ */
+uint32_t ads_hal_micros(void)
+{
+	return micros();
+}
+
+/**
+ * @brief Free running processor cycle count. Wraps around at 2^32. The DWT
+ *			cycle counter of Cortex-M3 and up, enabled on first use, otherwise
+ *			micros() in cycles of F_CPU.
+ */
+uint32_t ads_hal_cycles(void)
+{
+#if defined(DWT) && defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CoreDebug_DEMCR_TRCENA_Msk)
+	if(!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+	{
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CYCCNT = 0;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	}
+	
+	return DWT->CYCCNT;
+#elif defined(F_CPU)
+	return micros() * (uint32_t)(F_CPU / 1000000UL);
+#else
+	return micros();
+#endif
+}
+
 /**
  * @brief Enable/Disable the pin change data ready interrupt
  *
+ * @param dev			ADS device
  * @param enable		true = enable, false = disable
  */
-void ads_hal_pin_int_enable(bool enable)
+void ads_hal_pin_int_enable(ads_dev_t * dev, bool enable)
 {
-	// Copy enable to local variable to store enabled state of pin change interrupt
-	_ads_int_enabled = enable;
-	
+	// Copy enable to device to store enabled state of pin change interrupt
+	dev->int_enabled = enable;
+
 	// Enable/Disable the pin change data ready interrupt
 	if(enable)
 	{
-		attachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN), ads_hal_interrupt, FALLING);
+		ads_hal_attach(dev);
 	}
 	else
 	{
-		detachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN));
+		ads_hal_detach(dev);
 	}
 }
 
@@ -97,136 +191,242 @@ void ads_hal_pin_int_enable(bool enable)
  * @brief Configure I2C bus, 7 bit address, 400kHz frequency enable clock stretching
  *			if available.
  */
-static void ads_hal_i2c_init(void)
+static void ads_hal_i2c_init(ads_dev_t * dev)
 {
-	Wire.begin();
-	Wire.setClock(400000);	
+	TwoWire * wire = ads_hal_wire(dev);
+
+	wire->begin();
+	wire->setClock(400000);
 }
 
 /**
  * @brief Write buffer of data to the Angular Displacement Sensor
  *
+ * @param dev			ADS device
  * @param buffer[in]	Write buffer
  * @param len			Length of buffer.
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @return	ADS_OK if successful, ADS_ERR_NACK_DATA if a data byte was not
+ *			acknowledged, after the ADS may have taken the bytes before it,
+ *			ADS_ERR_IO if the address was not acknowledged or the write failed
  */
-int ads_hal_write_buffer(uint8_t * buffer, uint8_t len)
+int ads_hal_write_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len)
 {
-	// Disable the interrupt, if interrupt is enabled
-	if(_ads_int_enabled)
-		detachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN));
-	
+	TwoWire * wire = ads_hal_wire(dev);
+	uint8_t i;
+
+	// Disable the interrupts of every device sharing this bus, so no
+	// interrupt service routine starts a read in the middle of the write
+	for(i = 0; i < ADS_HAL_MAX_DEVICES; i++)
+	{
+		if(ads_hal_devs[i] != NULL && ads_hal_devs[i]->bus == dev->bus && ads_hal_devs[i]->int_enabled)
+			ads_hal_detach(ads_hal_devs[i]);
+	}
+
 	// Write the the buffer to the ADS sensor
-	Wire.beginTransmission(_address);
-	Wire.write(buffer, len);
-	int ret_val = Wire.endTransmission();
-	
-	// Re-enable the interrupt, if the interrupt was enabled
-	if(_ads_int_enabled)
+	wire->beginTransmission(dev->addr);
+	wire->write(buffer, len);
+	int ret_val = wire->endTransmission();
+
+	// Re-enable the interrupts that were enabled
+	for(i = 0; i < ADS_HAL_MAX_DEVICES; i++)
 	{
-		attachInterrupt(digitalPinToInterrupt(ADS_INTERRUPT_PIN), ads_hal_interrupt, FALLING);
-		
-		// Read data packet if interrupt was missed
-		if(digitalRead(ADS_INTERRUPT_PIN) == 0)
+		ads_dev_t * bus_dev = ads_hal_devs[i];
+
+		if(bus_dev == NULL || bus_dev->bus != dev->bus || !bus_dev->int_enabled)
+			continue;
+
+		ads_hal_attach(bus_dev);
+
+		// Read data packet if interrupt was missed. Detached while reading,
+		// so the interrupt can not preempt the packet being queued
+		if(digitalRead(bus_dev->datardy_pin) == 0)
 		{
-			if(ads_hal_read_buffer(read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
-			{
-				ads_read_callback(read_buffer);
-			}
+			ads_hal_detach(bus_dev);
+			ads_hal_interrupt(bus_dev);
+			ads_hal_attach(bus_dev);
 		}
 	}
-	
+
+	// 2 is a NACK of the address, 3 of a data byte
 	if(!ret_val)
 		return ADS_OK;
+	else if(ret_val == 3)
+		return ADS_ERR_NACK_DATA;
 	else
 		return ADS_ERR_IO;
 }
 
+/**
+ * @brief Longest buffer ads_hal_write_buffer sends in one bus transaction
+ *
+ * @param dev			ADS device
+ * @return	Maximum write length in bytes
+ */
+uint8_t ads_hal_max_write(ads_dev_t * dev)
+{
+	(void)dev;
+	
+	return (ADS_HAL_MAX_WRITE < 255) ? ADS_HAL_MAX_WRITE : 255;
+}
+
 /**
  * @brief Read buffer of data from the Angular Displacement Sensor
  *
+ * @param dev			ADS device
  * @param buffer[out]	Read buffer
  * @param len			Length of data to read in number of bytes.
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_hal_read_buffer(uint8_t * buffer, uint8_t len)
+int ads_hal_read_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len)
 {
-	Wire.requestFrom(_address, len);
-	
-	uint8_t i = 0; 
-	
-	while(Wire.available())
+	TwoWire * wire = ads_hal_wire(dev);
+
+	wire->requestFrom(dev->addr, len);
+
+	uint8_t i = 0;
+
+	while(wire->available())
 	{
-		buffer[i] = Wire.read();
+		buffer[i] = wire->read();
 		i++;
 	}
-	
+
 	if(i == len)
 		return ADS_OK;
 	else
 		return ADS_ERR_IO;
 }
 
+/**
+ * @brief Write a command to the Angular Displacement Sensor and read back its reply
+ *
+ * @param dev			ADS device
+ * @param wbuf[in]		Command buffer
+ * @param wlen			Length of command
+ * @param rbuf[out]		Reply buffer
+ * @param rlen			Length of reply
+ * @param delay_ms		Time the ADS needs between command and reply
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_write_read(ads_dev_t * dev, uint8_t * wbuf, uint8_t wlen, uint8_t * rbuf, uint8_t rlen, uint16_t delay_ms)
+{
+	if(ads_hal_write_buffer(dev, wbuf, wlen) != ADS_OK)
+		return ADS_ERR_IO;
+
+	ads_hal_delay(delay_ms);
+
+	return ads_hal_read_buffer(dev, rbuf, rlen);
+}
+
 /**
  * @brief Reset the Angular Displacement Sensor
+ *
+ * @param dev			ADS device
  */
-void ads_hal_reset(void)
+void ads_hal_reset(ads_dev_t * dev)
 {
 	// Configure reset line as an output
-	pinMode(ADS_RESET_PIN, OUTPUT);
-	
+	pinMode(dev->reset_pin, OUTPUT);
+
 	// Bring reset low for 10ms then release
-	ads_hal_gpio_pin_write(ADS_RESET_PIN, 0);
+	ads_hal_gpio_pin_write(dev->reset_pin, 0);
 	ads_hal_delay(10);
-	ads_hal_gpio_pin_write(ADS_RESET_PIN, 1);
+	ads_hal_gpio_pin_write(dev->reset_pin, 1);
 }
 
 /**
- * @brief Initializes the hardware abstraction layer 
+ * @brief Holds the Angular Displacement Sensor in reset, off the bus, or
+ *			releases it to boot
  *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @param dev			ADS device
+ * @param hold			true = hold in reset, false = release
  */
-int ads_hal_init(void (*callback)(uint8_t*), uint32_t reset_pin, uint32_t datardy_pin)
+void ads_hal_hold_reset(ads_dev_t * dev, bool hold)
 {
-	// Copy pin numbers for reset and data ready to local variables
-	ADS_RESET_PIN     = reset_pin;
-	ADS_INTERRUPT_PIN = datardy_pin;
-	
+	pinMode(dev->reset_pin, OUTPUT);
+
+	ads_hal_gpio_pin_write(dev->reset_pin, hold ? 0 : 1);
+}
+
+/**
+ * @brief Initializes the hardware abstraction layer
+ *
+ * @param dev			ADS device
+ * @return	ADS_OK if successful ADS_ERR_IO if failed, ADS_ERR if no
+ *			interrupt slot is free
+ */
+int ads_hal_init(ads_dev_t * dev, void (*callback)(ads_dev_t*,uint8_t*), uint32_t reset_pin, uint32_t datardy_pin)
+{
+	uint8_t slot;
+
+	// Find the slot of a device being reinitialized, or else a free slot
+	for(slot = 0; slot < ADS_HAL_MAX_DEVICES; slot++)
+	{
+		if(ads_hal_devs[slot] == dev)
+			break;
+	}
+
+	if(slot == ADS_HAL_MAX_DEVICES)
+	{
+		for(slot = 0; slot < ADS_HAL_MAX_DEVICES; slot++)
+		{
+			if(ads_hal_devs[slot] == NULL)
+				break;
+		}
+	}
+
+	if(slot == ADS_HAL_MAX_DEVICES)
+		return ADS_ERR;
+
+	// Copy pin numbers for reset and data ready to the device
+	dev->reset_pin   = reset_pin;
+	dev->datardy_pin = datardy_pin;
+	dev->hal_slot    = slot;
+
+	if(dev->addr == 0)
+		dev->addr = ADS_DEFAULT_ADDR;
+
+	// NULL is the default bus, named so devices on it compare equal
+	if(dev->bus == NULL)
+		dev->bus = &Wire;
+
 	// Set callback pointer
-	ads_read_callback = callback;
-	
-	// Reset the ads
-	ads_hal_reset();
-	
-	// Wait for ads to initialize
-	ads_hal_delay(2000);
-	
-	// Configure and enable interrupt pin
-	ads_hal_pin_int_init();
-	
+	dev->read_callback = callback;
+
+	// Reset the ads, ads_init waits for it to answer
+	ads_hal_reset(dev);
+
+	// Register the device and configure and enable interrupt pin
+	ads_hal_devs[slot] = dev;
+	dev->int_enabled = true;
+	ads_hal_pin_int_init(dev);
+
 	// Initialize the I2C bus
-	ads_hal_i2c_init();
+	ads_hal_i2c_init(dev);
 
 	return ADS_OK;
 }
 
 /**
- * @brief Gets the current i2c address that the hal layer is addressing. 	
+ * @brief Gets the current i2c address that the hal layer is addressing.
  *				Used by device firmware update (dfu)
- * @return	uint8_t _address
+ *
+ * @param dev			ADS device
+ * @return	uint8_t address
  */
-uint8_t ads_hal_get_address(void)
+uint8_t ads_hal_get_address(ads_dev_t * dev)
 {
-	return _address;
+	return dev->addr;
 }
 
 /**
- * @brief Sets the i2c address that the hal layer is addressing *	
+ * @brief Sets the i2c address that the hal layer is addressing *
  *				Used by device firmware update (dfu)
  *
+ * @param dev			ADS device
  * @param address		i2c address hal to communicate with
  */
-void ads_hal_set_address(uint8_t address)
+void ads_hal_set_address(ads_dev_t * dev, uint8_t address)
 {
-	_address = address;
+	dev->addr = address;
 }
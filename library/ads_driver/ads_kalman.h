@@ -0,0 +1,133 @@
+/**
+ * ads_kalman.h
+ *
+ * Kalman tracker of one ADS channel, an alternative to a low pass and
+ * deadzone for control loops. A low pass trades noise for lag through its
+ * cutoff, and a deadzone adds lag of its own; the tracker models the
+ * channel as moving with a constant velocity, or a constant acceleration,
+ * so following steady motion costs no lag, and smooths noise in proportion
+ * to how much the motion may change between samples. It takes time stamped
+ * samples, so late or missed samples are accounted for, and besides the
+ * smoothed angle reports the angular velocity and a prediction of the angle
+ * ahead of the last sample, to make up for the age of the sample and the
+ * latency of whatever acts on it.
+ *
+ * Two numbers tune it: the noise of the samples, which can be measured
+ * with the sensor held still, and how much the motion may change.
+ */
+
+#ifndef ADS_KALMAN_H_
+#define ADS_KALMAN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ads.h"
+
+/* Longest interval between samples, a longer one starts the track again
+   at the next sample. Also the furthest ahead a prediction reaches. */
+#ifndef ADS_KALMAN_MAX_GAP_US
+#define ADS_KALMAN_MAX_GAP_US		(250000)
+#endif
+
+/* Spread of the velocity, degrees/s, and of the acceleration, degrees/s^2,
+   a new track starts with */
+#ifndef ADS_KALMAN_INIT_VELOCITY
+#define ADS_KALMAN_INIT_VELOCITY	(500.0f)
+#endif
+
+#ifndef ADS_KALMAN_INIT_ACCEL
+#define ADS_KALMAN_INIT_ACCEL		(5000.0f)
+#endif
+
+/* Motion model, the number of states tracked */
+typedef enum {
+	ADS_KALMAN_CV = 2,					// Constant velocity, angle and velocity
+	ADS_KALMAN_CA = 3					// Constant acceleration, angle, velocity and acceleration
+} ADS_KALMAN_MODEL_T;
+
+typedef struct {
+	uint8_t states;						// ADS_KALMAN_MODEL_T
+	bool settled;						// Tracking, from the first sample
+	float r;							// Sample noise variance
+	float q;							// Process noise variance, of the acceleration or jerk
+	uint32_t lead_us;					// Prediction lead past the time it is asked for
+	uint32_t last_us;					// Time stamp of the last sample
+	float x[3];							// Angle, velocity and acceleration as of last_us
+	float p[3][3];						// Covariance of x
+	float residual;						// Last sample less the angle predicted for it
+} ads_kalman_t;
+
+/**
+ * @brief Initializes a tracker
+ *
+ * @param k				Tracker
+ * @param model			ADS_KALMAN_CV or ADS_KALMAN_CA
+ * @param noise			Standard deviation of the samples, e.g. 0.05 degrees
+ * @param process		Standard deviation of the change in motion: of the
+ *						acceleration, degrees/s^2, for ADS_KALMAN_CV, of the
+ *						jerk, degrees/s^3, for ADS_KALMAN_CA. Higher follows
+ *						sudden moves closer, lower is smoother.
+ * @param lead_us		Prediction lead, e.g. the latency of the control loop,
+ *						at most ADS_KALMAN_MAX_GAP_US
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_kalman_init(ads_kalman_t * k, ADS_KALMAN_MODEL_T model, float noise, float process, uint32_t lead_us);
+
+/**
+ * @brief Clears the track, the next sample starts it again
+ *
+ * @param k				Tracker
+ */
+void ads_kalman_reset(ads_kalman_t * k);
+
+/**
+ * @brief Takes one sample. The first sample, or the first after a gap of
+ *			more than ADS_KALMAN_MAX_GAP_US, starts the track at rest there.
+ *
+ * @param k				Tracker
+ * @param sample		New sample
+ * @param timestamp_us	ads_hal_micros() when it was taken, e.g. ads_sample_t
+ *						timestamp, or ads_hal_micros() after ads_read_polled
+ */
+void ads_kalman_update(ads_kalman_t * k, float sample, uint32_t timestamp_us);
+
+/**
+ * @brief Takes the channel of a time stamped sample, if the sample updated it
+ *
+ * @param k				Tracker
+ * @param sample		Sample from ads_timestamped_callback or ads_read_batch
+ * @param data_type		Channel tracked, ADS_SAMPLE or ADS_STRETCH_SAMPLE
+ * @return	true if the sample was of data_type and was taken
+ */
+bool ads_kalman_update_sample(ads_kalman_t * k, const ads_sample_t * sample, uint8_t data_type);
+
+/**
+ * @brief Smoothed angle as of the last sample
+ *
+ * @param k				Tracker
+ * @return	angle, or stretch, 0 before the first sample
+ */
+float ads_kalman_angle(const ads_kalman_t * k);
+
+/**
+ * @brief Angular velocity as of the last sample
+ *
+ * @param k				Tracker
+ * @return	velocity per second, 0 before the first sample
+ */
+float ads_kalman_velocity(const ads_kalman_t * k);
+
+/**
+ * @brief Predicts the angle lead_us past time_us from the track. Passing the
+ *			time of use, ads_hal_micros(), makes up for the age of the last
+ *			sample as well as for the lead.
+ *
+ * @param k				Tracker
+ * @param time_us		Time the prediction is for, before the lead
+ * @return	angle, the last angle for times before the last sample, 0 before
+ *			the first sample
+ */
+float ads_kalman_predict(const ads_kalman_t * k, uint32_t time_us);
+
+#endif /* ADS_KALMAN_H_ */
@@ -0,0 +1,318 @@
+/**
+ * ads_median.cpp
+ *
+ * Sliding window median and Hampel filters
+ */
+
+#include <math.h>
+#include "ads_median.h"
+
+/* MADs per standard deviation of normal noise */
+#define ADS_MEDIAN_MAD_SCALE		(1.4826f)
+
+/* Sample at heap position i, i from -window / 2 to window / 2 */
+#define HEAP(m, i)					((m)->heap[(i) + (m)->window / 2])
+
+/* Samples in the min heap, above the median, and in the max heap, below it */
+#define MIN_COUNT(m)				(((m)->count - 1) / 2)
+#define MAX_COUNT(m)				((m)->count / 2)
+
+/**
+ * @brief Compares the samples at heap positions i and j
+ */
+static bool heap_less(const ads_median_t * m, int8_t i, int8_t j)
+{
+	return m->data[HEAP(m, i)] < m->data[HEAP(m, j)];
+}
+
+/**
+ * @brief Swaps the samples at heap positions i and j if i holds the smaller
+ *
+ * @return	true if swapped
+ */
+static bool heap_order(ads_median_t * m, int8_t i, int8_t j)
+{
+	uint8_t t;
+	
+	if(!heap_less(m, i, j))
+		return false;
+	
+	t = HEAP(m, i);
+	HEAP(m, i) = HEAP(m, j);
+	HEAP(m, j) = t;
+	
+	m->pos[HEAP(m, i)] = i;
+	m->pos[HEAP(m, j)] = j;
+	
+	return true;
+}
+
+/**
+ * @brief Moves a sample down the min heap from its child i, the children of
+ *			position p being 2p and 2p + 1
+ */
+static void min_down(ads_median_t * m, int8_t i)
+{
+	for(; i <= MIN_COUNT(m); i *= 2)
+	{
+		if(i > 1 && i < MIN_COUNT(m) && heap_less(m, i + 1, i))
+			i++;
+		
+		if(!heap_order(m, i, i / 2))
+			break;
+	}
+}
+
+/**
+ * @brief Moves a sample down the max heap from its child i, the children of
+ *			position p being 2p and 2p - 1
+ */
+static void max_down(ads_median_t * m, int8_t i)
+{
+	for(; i >= -MAX_COUNT(m); i *= 2)
+	{
+		if(i < -1 && i > -MAX_COUNT(m) && heap_less(m, i, i - 1))
+			i--;
+		
+		if(!heap_order(m, i / 2, i))
+			break;
+	}
+}
+
+/**
+ * @brief Moves the sample at i up the min heap
+ *
+ * @return	true if it became the median
+ */
+static bool min_up(ads_median_t * m, int8_t i)
+{
+	while(i > 0 && heap_order(m, i, i / 2))
+		i /= 2;
+	
+	return i == 0;
+}
+
+/**
+ * @brief Moves the sample at i up the max heap
+ *
+ * @return	true if it became the median
+ */
+static bool max_up(ads_median_t * m, int8_t i)
+{
+	while(i < 0 && heap_order(m, i / 2, i))
+		i /= 2;
+	
+	return i == 0;
+}
+
+/**
+ * @brief Initializes a running median
+ *
+ * @param median		Median
+ * @param window		Samples, odd, 1 to ADS_MEDIAN_MAX_WINDOW
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if window is out of range
+ */
+int ads_median_init(ads_median_t * median, uint8_t window)
+{
+	if(window == 0 || window > ADS_MEDIAN_MAX_WINDOW || !(window & 1))
+		return ADS_ERR_BAD_PARAM;
+	
+	memset(median, 0, sizeof(*median));
+	
+	median->window = window;
+	
+	ads_median_reset(median);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Empties the window
+ *
+ * @param median		Median
+ */
+void ads_median_reset(ads_median_t * median)
+{
+	uint8_t i;
+	
+	// Samples fill the median, then the max and min heaps in turn
+	for(i = 0; i < median->window; i++)
+	{
+		median->pos[i] = (int8_t)(((i + 1) / 2) * ((i & 1) ? -1 : 1));
+		HEAP(median, median->pos[i]) = i;
+	}
+	
+	median->count = 0;
+	median->head = 0;
+}
+
+/**
+ * @brief Takes one sample, in place of the oldest once the window is full.
+ *			The window fills from the first samples, the upper median is
+ *			returned while it holds an even number.
+ *
+ * @param median		Median
+ * @param sample		New sample
+ * @return	median of the window
+ */
+float ads_median_apply(ads_median_t * median, float sample)
+{
+	bool fill = (median->count < median->window);
+	int8_t p = median->pos[median->head];
+	float oldest = median->data[median->head];
+	
+	median->data[median->head] = sample;
+	median->head = (median->head + 1 < median->window) ? median->head + 1 : 0;
+	
+	if(fill)
+		median->count++;
+	
+	if(p > 0)
+	{
+		// Above the median, down if larger than the sample replaced, else up
+		// and across the median if it passes it
+		if(!fill && oldest < sample)
+			min_down(median, p * 2);
+		else if(min_up(median, p))
+			max_down(median, -1);
+	}
+	else if(p < 0)
+	{
+		if(!fill && sample < oldest)
+			max_down(median, p * 2);
+		else if(max_up(median, p))
+			min_down(median, 1);
+	}
+	else
+	{
+		// The median replaced, whichever heap it now belongs in
+		if(MAX_COUNT(median))
+			max_down(median, -1);
+		
+		if(MIN_COUNT(median))
+			min_down(median, 1);
+	}
+	
+	return median->data[HEAP(median, 0)];
+}
+
+/**
+ * @brief Initializes a Hampel filter
+ *
+ * @param hampel		Hampel filter
+ * @param window		Samples, odd, 3 to ADS_MEDIAN_MAX_WINDOW
+ * @param threshold		Scaled MADs a sample may be from the median, e.g. 3,
+ *						a standard deviation each for normal noise
+ * @param min_deviation	Distance from the median always accepted, e.g. a few
+ *						times the noise of a still sensor, whose MAD is ~0
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_hampel_init(ads_hampel_t * hampel, uint8_t window, float threshold, float min_deviation)
+{
+	if(window < 3 || !(threshold > 0) || !(min_deviation >= 0))
+		return ADS_ERR_BAD_PARAM;
+	
+	if(ads_median_init(&hampel->median, window) != ADS_OK)
+		return ADS_ERR_BAD_PARAM;
+	
+	ads_median_init(&hampel->deviation, window);
+	
+	hampel->threshold = threshold * ADS_MEDIAN_MAD_SCALE;
+	hampel->min_deviation = min_deviation;
+	hampel->outliers = 0;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Empties the windows, the outlier count is kept
+ *
+ * @param hampel		Hampel filter
+ */
+void ads_hampel_reset(ads_hampel_t * hampel)
+{
+	ads_median_reset(&hampel->median);
+	ads_median_reset(&hampel->deviation);
+}
+
+/**
+ * @brief Takes one sample
+ *
+ * @param hampel		Hampel filter
+ * @param sample		New sample
+ * @return	sample, or the median of the window if sample is an outlier
+ */
+float ads_hampel_apply(ads_hampel_t * hampel, float sample)
+{
+	float median = ads_median_apply(&hampel->median, sample);
+	float deviation = fabsf(sample - median);
+	float limit = hampel->threshold * ads_median_apply(&hampel->deviation, deviation);
+	
+	if(limit < hampel->min_deviation)
+		limit = hampel->min_deviation;
+	
+	if(deviation <= limit)
+		return sample;
+	
+	hampel->outliers++;
+	
+	return median;
+}
+
+static bool median_process(ads_stage_t * stage, float * sample)
+{
+	ads_stage_median_t * s = (ads_stage_median_t *)stage;
+	
+	*sample = ads_median_apply(&s->median, *sample);
+	
+	return true;
+}
+
+static bool hampel_process(ads_stage_t * stage, float * sample)
+{
+	ads_stage_hampel_t * s = (ads_stage_hampel_t *)stage;
+	
+	*sample = ads_hampel_apply(&s->hampel, *sample);
+	
+	return true;
+}
+
+/**
+ * @brief Running median stage. The window fills from the first samples.
+ *
+ * @param stage			Stage
+ * @param window		Samples, odd, 1 to ADS_MEDIAN_MAX_WINDOW
+ * @return	&stage->stage, for ads_pipeline_add, NULL if window is out of range
+ */
+ads_stage_t * ads_stage_median(ads_stage_median_t * stage, uint8_t window)
+{
+	if(ads_median_init(&stage->median, window) != ADS_OK)
+		return NULL;
+	
+	memset(&stage->stage, 0, sizeof(stage->stage));
+	
+	stage->stage.process = median_process;
+	
+	return &stage->stage;
+}
+
+/**
+ * @brief Hampel stage, see ads_hampel_init
+ *
+ * @param stage			Stage
+ * @param window		Samples, odd, 3 to ADS_MEDIAN_MAX_WINDOW
+ * @param threshold		Scaled MADs a sample may be from the median
+ * @param min_deviation	Distance from the median always accepted
+ * @return	&stage->stage, for ads_pipeline_add, NULL if a parameter is out of range
+ */
+ads_stage_t * ads_stage_hampel(ads_stage_hampel_t * stage, uint8_t window, float threshold, float min_deviation)
+{
+	if(ads_hampel_init(&stage->hampel, window, threshold, min_deviation) != ADS_OK)
+		return NULL;
+	
+	memset(&stage->stage, 0, sizeof(stage->stage));
+	
+	stage->stage.process = hampel_process;
+	
+	return &stage->stage;
+}
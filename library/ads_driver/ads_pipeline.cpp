@@ -0,0 +1,287 @@
+/**
+ * ads_pipeline.cpp
+ *
+ * Streaming sample pipeline with per stage cost accounting
+ */
+
+#include <math.h>
+#include "ads_pipeline.h"
+#include "ads_hal.h"
+
+/* Back to back ads_hal_cycles reads taken to find the cost of a measurement */
+#define ADS_PIPELINE_CALIBRATE		(8)
+
+/**
+ * @brief Sets up the common part of a stage
+ */
+static ads_stage_t * stage_init(ads_stage_t * stage, ads_stage_process process)
+{
+	memset(stage, 0, sizeof(*stage));
+	
+	stage->process = process;
+	
+	return stage;
+}
+
+static bool filter_process(ads_stage_t * stage, float * sample)
+{
+	ads_stage_filter_t * s = (ads_stage_filter_t *)stage;
+	
+	*sample = ads_filter_apply(&s->filter, *sample);
+	
+	return true;
+}
+
+static bool deadzone_process(ads_stage_t * stage, float * sample)
+{
+	ads_stage_deadzone_t * s = (ads_stage_deadzone_t *)stage;
+	
+	if(!s->settled)
+	{
+		s->out = *sample;
+		s->settled = true;
+	}
+	else if(s->hysteresis)
+	{
+		if(*sample > s->out + s->width)
+			s->out = *sample - s->width;
+		else if(*sample < s->out - s->width)
+			s->out = *sample + s->width;
+	}
+	else if(fabsf(*sample - s->out) > s->width)
+	{
+		s->out = *sample;
+	}
+	
+	*sample = s->out;
+	
+	return true;
+}
+
+static bool event_process(ads_stage_t * stage, float * sample)
+{
+	ads_stage_event_t * s = (ads_stage_event_t *)stage;
+	
+	if(!s->settled)
+	{
+		s->above = (*sample > s->high);
+		s->settled = true;
+	}
+	else if(!s->above && *sample > s->high)
+	{
+		s->above = true;
+		s->events++;
+		s->callback(stage, ADS_EVENT_RISE, *sample);
+	}
+	else if(s->above && *sample < s->low)
+	{
+		s->above = false;
+		s->events++;
+		s->callback(stage, ADS_EVENT_FALL, *sample);
+	}
+	
+	return true;
+}
+
+/**
+ * @brief Initializes an empty pipeline, passing samples through
+ *
+ * @param pipeline		Pipeline
+ * @param budget_cycles	Cycles a sample may take, 0 for no budget
+ */
+void ads_pipeline_init(ads_pipeline_t * pipeline, uint32_t budget_cycles)
+{
+	memset(pipeline, 0, sizeof(*pipeline));
+	
+	pipeline->budget_cycles = budget_cycles;
+	
+#if ADS_PIPELINE_COST
+	// Cheapest measurement of nothing, what reading the counter costs
+	pipeline->overhead_cycles = UINT32_MAX;
+	
+	for(uint8_t i = 0; i < ADS_PIPELINE_CALIBRATE; i++)
+	{
+		uint32_t start = ads_hal_cycles();
+		uint32_t cycles = ads_hal_cycles() - start;
+		
+		if(cycles < pipeline->overhead_cycles)
+			pipeline->overhead_cycles = cycles;
+	}
+#endif
+}
+
+/**
+ * @brief Appends a stage to the pipeline. A stage belongs to one pipeline.
+ *
+ * @param pipeline		Pipeline
+ * @param stage			Stage, from ads_stage_* or a custom stage with
+ *						process set. Must stay valid while the pipeline is used
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if stage is NULL, as
+ *			returned by an ads_stage_* for bad parameters, or has no process
+ */
+int ads_pipeline_add(ads_pipeline_t * pipeline, ads_stage_t * stage)
+{
+	if(stage == NULL || stage->process == NULL)
+		return ADS_ERR_BAD_PARAM;
+	
+	stage->next = NULL;
+	
+	if(pipeline->last != NULL)
+		pipeline->last->next = stage;
+	else
+		pipeline->first = stage;
+	
+	pipeline->last = stage;
+	pipeline->stages++;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Passes one sample through the stages of the pipeline
+ *
+ * @param pipeline		Pipeline
+ * @param sample		Input sample, replaced by the output sample
+ * @return	true if a sample came out of the last stage, false if a stage
+ *			held it back
+ */
+bool ads_pipeline_apply(ads_pipeline_t * pipeline, float * sample)
+{
+	ads_stage_t * stage;
+	bool pass = true;
+#if ADS_PIPELINE_COST
+	uint32_t total = 0;
+#endif
+
+	pipeline->samples_in++;
+	
+	for(stage = pipeline->first; stage != NULL && pass; stage = stage->next)
+	{
+#if ADS_PIPELINE_COST
+		uint32_t start = ads_hal_cycles();
+		
+		pass = stage->process(stage, sample);
+		
+		uint32_t cycles = ads_hal_cycles() - start;
+		
+		cycles = (cycles > pipeline->overhead_cycles) ? cycles - pipeline->overhead_cycles : 0;
+		
+		stage->samples++;
+		stage->cycles_sum += cycles;
+		
+		if(cycles > stage->cycles_max)
+			stage->cycles_max = cycles;
+		
+		total += cycles;
+#else
+		pass = stage->process(stage, sample);
+#endif
+	}
+	
+#if ADS_PIPELINE_COST
+	pipeline->cycles_sum += total;
+	
+	if(total > pipeline->cycles_max)
+		pipeline->cycles_max = total;
+	
+	if(pipeline->budget_cycles && total > pipeline->budget_cycles)
+		pipeline->over_budget++;
+#endif
+
+	if(pass)
+		pipeline->samples_out++;
+	
+	return pass;
+}
+
+/**
+ * @brief Clears the cost counters of the pipeline and of its stages
+ *
+ * @param pipeline		Pipeline
+ */
+void ads_pipeline_clear_cost(ads_pipeline_t * pipeline)
+{
+	ads_stage_t * stage;
+	
+	for(stage = pipeline->first; stage != NULL; stage = stage->next)
+	{
+		stage->samples = 0;
+		stage->cycles_max = 0;
+		stage->cycles_sum = 0;
+	}
+	
+	pipeline->samples_in = 0;
+	pipeline->samples_out = 0;
+	pipeline->over_budget = 0;
+	pipeline->cycles_max = 0;
+	pipeline->cycles_sum = 0;
+}
+
+/**
+ * @brief Mean cycles taken per sample by a stage
+ *
+ * @param stage			Stage
+ * @return	cycles, 0 if no sample was processed
+ */
+uint32_t ads_stage_cycles(const ads_stage_t * stage)
+{
+	return stage->samples ? (uint32_t)(stage->cycles_sum / stage->samples) : 0;
+}
+
+/**
+ * @brief Filter stage, around stage->filter initialized with ads_filter_init,
+ *			ads_filter_init_dev or ads_filter_init_biquads
+ *
+ * @param stage			Stage
+ * @return	&stage->stage, for ads_pipeline_add
+ */
+ads_stage_t * ads_stage_filter(ads_stage_filter_t * stage)
+{
+	return stage_init(&stage->stage, filter_process);
+}
+
+/**
+ * @brief Deadzone stage
+ *
+ * @param stage			Stage
+ * @param width			Largest input change the output holds through
+ * @param hysteresis	false to jump to the input, true to follow width behind it
+ * @return	&stage->stage, for ads_pipeline_add, NULL if width is negative
+ */
+ads_stage_t * ads_stage_deadzone(ads_stage_deadzone_t * stage, float width, bool hysteresis)
+{
+	if(!(width >= 0))
+		return NULL;
+	
+	memset(stage, 0, sizeof(*stage));
+	
+	stage->width = width;
+	stage->hysteresis = hysteresis;
+	
+	return stage_init(&stage->stage, deadzone_process);
+}
+
+/**
+ * @brief Event stage, with low and high thresholds so noise around one does
+ *			not report events. The first sample sets the state without an event.
+ *
+ * @param stage			Stage
+ * @param low			Falling threshold
+ * @param high			Rising threshold, at least low
+ * @param callback		Receives the events, in the caller's context
+ * @return	&stage->stage, for ads_pipeline_add, NULL if low is above high
+ *			or callback is NULL
+ */
+ads_stage_t * ads_stage_event(ads_stage_event_t * stage, float low, float high, ads_stage_event_callback callback)
+{
+	if(!(low <= high) || callback == NULL)
+		return NULL;
+	
+	memset(stage, 0, sizeof(*stage));
+	
+	stage->low = low;
+	stage->high = high;
+	stage->callback = callback;
+	
+	return stage_init(&stage->stage, event_process);
+}
@@ -0,0 +1,195 @@
+/**
+ * ads_pipeline.h
+ *
+ * Streaming sample pipeline of one channel, bend or stretch, of one ADS.
+ * Stages are chained in the order they are added, each keeps its own state
+ * in a stage object owned by the caller, so the same stages can be used for
+ * any number of sensors and channels. Samples pass from stage to stage until
+ * one holds them back, e.g. a decimator between its outputs.
+ *
+ * The processor cycles taken by each stage are measured with ads_hal_cycles
+ * and kept with the stage, and the pipeline counts samples whose processing
+ * exceeded its budget, to keep the chain within the time the ISR or the
+ * loop has for it. Set ADS_PIPELINE_COST to 0 to leave the counting out.
+ *
+ * Custom stages embed an ads_stage_t first and set its process function.
+ */
+
+#ifndef ADS_PIPELINE_H_
+#define ADS_PIPELINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ads.h"
+#include "ads_filter.h"
+
+/* Measure the cycles taken by each stage */
+#ifndef ADS_PIPELINE_COST
+#define ADS_PIPELINE_COST			(1)
+#endif
+
+/* Event of an event stage */
+typedef enum {
+	ADS_EVENT_RISE = 0,					// Sample rose above the high threshold
+	ADS_EVENT_FALL						// Sample fell below the low threshold
+} ADS_EVENT_T;
+
+typedef struct ads_stage_s ads_stage_t;
+
+/**
+ * @brief Processes one sample in place
+ *
+ * @param stage			Stage
+ * @param sample		Input sample, replaced by the output sample
+ * @return	true if the sample goes on to the next stage, false if held back
+ */
+typedef bool (*ads_stage_process)(ads_stage_t * stage, float * sample);
+
+/**
+ * @brief Receives the events of an event stage
+ *
+ * @param stage			Event stage, e.g. to find its user_data
+ * @param event			ADS_EVENT_RISE or ADS_EVENT_FALL
+ * @param sample		Sample that crossed the threshold
+ */
+typedef void (*ads_stage_event_callback)(ads_stage_t * stage, uint8_t event, float sample);
+
+/* Stage of a pipeline, first member of every stage type */
+struct ads_stage_s {
+	ads_stage_process process;
+	ads_stage_t * next;					// Next stage of the pipeline, NULL for the last
+	void * user_data;					// Free for application use
+
+	/* Cost, see ADS_PIPELINE_COST */
+	uint32_t samples;					// Samples processed
+	uint32_t cycles_max;				// Most cycles taken by one sample
+	uint64_t cycles_sum;				// Cycles taken, mean = cycles_sum / samples
+};
+
+/* Low or high pass filter, initialize filter with ads_filter_init* */
+typedef struct {
+	ads_stage_t stage;
+	ads_filter_t filter;
+} ads_stage_filter_t;
+
+/*
+ * Deadzone, the output holds until the input moves more than width from it,
+ * then jumps to the input. With hysteresis the output follows width behind
+ * instead, without the jump.
+ */
+typedef struct {
+	ads_stage_t stage;
+	float width;
+	bool hysteresis;
+	bool settled;						// Output set, from the first input
+	float out;
+} ads_stage_deadzone_t;
+
+/*
+ * Event detector, calls back when the sample rises above high or falls
+ * below low. Samples pass unchanged.
+ */
+typedef struct {
+	ads_stage_t stage;
+	float low;							// Falling threshold
+	float high;							// Rising threshold, above low
+	ads_stage_event_callback callback;
+	bool settled;						// State set, from the first input
+	bool above;							// Last crossing was rising
+	uint32_t events;					// Events reported
+} ads_stage_event_t;
+
+/* Chain of stages processing one channel */
+typedef struct {
+	ads_stage_t * first;
+	ads_stage_t * last;
+	uint8_t stages;						// Stages in the chain
+
+	/* Cost, see ADS_PIPELINE_COST */
+	uint32_t budget_cycles;				// Cycles a sample may take, 0 for no budget
+	uint32_t overhead_cycles;			// Cost of a measurement, subtracted from each
+	uint32_t samples_in;				// Samples entered
+	uint32_t samples_out;				// Samples out of the last stage
+	uint32_t over_budget;				// Samples that took more than budget_cycles
+	uint32_t cycles_max;				// Most cycles taken by one sample, all stages
+	uint64_t cycles_sum;				// Cycles taken, mean = cycles_sum / samples_in
+} ads_pipeline_t;
+
+/**
+ * @brief Initializes an empty pipeline, passing samples through
+ *
+ * @param pipeline		Pipeline
+ * @param budget_cycles	Cycles a sample may take, 0 for no budget
+ */
+void ads_pipeline_init(ads_pipeline_t * pipeline, uint32_t budget_cycles);
+
+/**
+ * @brief Appends a stage to the pipeline. A stage belongs to one pipeline.
+ *
+ * @param pipeline		Pipeline
+ * @param stage			Stage, from ads_stage_* or a custom stage with
+ *						process set. Must stay valid while the pipeline is used
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if stage is NULL, as
+ *			returned by an ads_stage_* for bad parameters, or has no process
+ */
+int ads_pipeline_add(ads_pipeline_t * pipeline, ads_stage_t * stage);
+
+/**
+ * @brief Passes one sample through the stages of the pipeline
+ *
+ * @param pipeline		Pipeline
+ * @param sample		Input sample, replaced by the output sample
+ * @return	true if a sample came out of the last stage, false if a stage
+ *			held it back
+ */
+bool ads_pipeline_apply(ads_pipeline_t * pipeline, float * sample);
+
+/**
+ * @brief Clears the cost counters of the pipeline and of its stages
+ *
+ * @param pipeline		Pipeline
+ */
+void ads_pipeline_clear_cost(ads_pipeline_t * pipeline);
+
+/**
+ * @brief Mean cycles taken per sample by a stage
+ *
+ * @param stage			Stage
+ * @return	cycles, 0 if no sample was processed
+ */
+uint32_t ads_stage_cycles(const ads_stage_t * stage);
+
+/**
+ * @brief Filter stage, around stage->filter initialized with ads_filter_init,
+ *			ads_filter_init_dev or ads_filter_init_biquads
+ *
+ * @param stage			Stage
+ * @return	&stage->stage, for ads_pipeline_add
+ */
+ads_stage_t * ads_stage_filter(ads_stage_filter_t * stage);
+
+/**
+ * @brief Deadzone stage
+ *
+ * @param stage			Stage
+ * @param width			Largest input change the output holds through
+ * @param hysteresis	false to jump to the input, true to follow width behind it
+ * @return	&stage->stage, for ads_pipeline_add, NULL if width is negative
+ */
+ads_stage_t * ads_stage_deadzone(ads_stage_deadzone_t * stage, float width, bool hysteresis);
+
+/**
+ * @brief Event stage, with low and high thresholds so noise around one does
+ *			not report events. The first sample sets the state without an event.
+ *
+ * @param stage			Stage
+ * @param low			Falling threshold
+ * @param high			Rising threshold, at least low
+ * @param callback		Receives the events, in the caller's context
+ * @return	&stage->stage, for ads_pipeline_add, NULL if low is above high
+ *			or callback is NULL
+ */
+ads_stage_t * ads_stage_event(ads_stage_event_t * stage, float low, float high, ads_stage_event_callback callback);
+
+#endif /* ADS_PIPELINE_H_ */
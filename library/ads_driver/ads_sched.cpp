@@ -0,0 +1,276 @@
+/**
+ * ads_sched.cpp
+ *
+ * Bus scheduler for several ADS sensors in polled mode on one I2C bus
+ */
+
+#include "ads_sched.h"
+
+/**
+ * @brief Estimated bus utilization of reading one entry, per mille
+ */
+static inline uint32_t ads_sched_entry_load(ads_sched_t * sched, uint32_t period_us)
+{
+	return (sched->read_cost_us * 1000 + period_us / 2) / period_us;
+}
+
+/**
+ * @brief Advances the 64 bit elapsed time to now, so it outlasts the wrap
+ *			of ads_hal_micros() every 71.6 minutes
+ */
+static void ads_sched_clock(ads_sched_t * sched)
+{
+	uint32_t now = ads_hal_micros();
+	
+	sched->elapsed_us += now - sched->clock_us;
+	sched->clock_us = now;
+}
+
+/**
+ * @brief Initializes an empty schedule
+ *
+ * @param sched			Schedule
+ * @param bit_rate		I2C bus bit rate in Hz, e.g. 400000
+ * @param callback		Receives every sample read, with its read time stamp
+ */
+void ads_sched_init(ads_sched_t * sched, uint32_t bit_rate, ads_timestamped_callback callback)
+{
+	sched->count = 0;
+	sched->bit_rate = bit_rate;
+	sched->read_cost_us = (ADS_SCHED_READ_BITS * 1000000UL + bit_rate - 1) / bit_rate + ADS_SCHED_READ_OVERHEAD_US;
+	sched->callback = callback;
+	sched->start_us = 0;
+	sched->clock_us = 0;
+	sched->elapsed_us = 0;
+	sched->reads = 0;
+	sched->errors = 0;
+	sched->busy_us = 0;
+}
+
+/**
+ * @brief Adds an initialized ADS device to the schedule, to be read at the
+ *			target rate. All devices of a schedule must share one bus.
+ *
+ * @param sched			Schedule
+ * @param dev			ADS device
+ * @param sps			Target read rate
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the schedule is full,
+ *			the device is queued, on another bus or the bus would be over
+ *			utilized
+ */
+int ads_sched_add(ads_sched_t * sched, ads_dev_t * dev, ADS_SPS_T sps)
+{
+	uint32_t period_us = ADS_SPS_TO_US(sps);
+	
+	if(sched->count == ADS_SCHED_MAX_DEVICES || period_us == 0)
+		return ADS_ERR_BAD_PARAM;
+	
+	if(dev->queued || (sched->count != 0 && sched->entries[0].dev->bus != dev->bus))
+		return ADS_ERR_BAD_PARAM;
+	
+	// Admission, earliest deadline first meets every deadline up to full load
+	if(ads_sched_utilization(sched) + ads_sched_entry_load(sched, period_us) > ADS_SCHED_MAX_UTILIZATION)
+		return ADS_ERR_BAD_PARAM;
+	
+	ads_sched_entry_t * entry = &sched->entries[sched->count++];
+	
+	entry->dev = dev;
+	entry->period_us = period_us;
+	entry->release_us = 0;
+	entry->reads = 0;
+	entry->misses = 0;
+	entry->max_late_us = 0;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Estimated bus utilization of the schedule, per mille
+ *
+ * @param sched			Schedule
+ * @return	utilization, 1000 = bus always busy
+ */
+uint16_t ads_sched_utilization(ads_sched_t * sched)
+{
+	uint32_t load = 0;
+	uint8_t i;
+	
+	for(i = 0; i < sched->count; i++)
+	{
+		load += ads_sched_entry_load(sched, sched->entries[i].period_us);
+	}
+	
+	return (uint16_t)load;
+}
+
+/**
+ * @brief Places every device of the schedule in polled mode, with the data
+ *			ready interrupt disabled, and releases the first reads
+ *
+ * @param sched			Schedule
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_sched_start(ads_sched_t * sched)
+{
+	uint8_t i;
+	
+	for(i = 0; i < sched->count; i++)
+	{
+		ads_dev_t * dev = sched->entries[i].dev;
+		
+		ads_hal_pin_int_enable(dev, false);
+		
+		if(ads_polled(dev, true) != ADS_OK)
+			return ADS_ERR_IO;
+	}
+	
+	sched->start_us = ads_hal_micros();
+	sched->clock_us = sched->start_us;
+	sched->elapsed_us = 0;
+	
+	// Stagger the first releases by one read each, so they do not all collide
+	for(i = 0; i < sched->count; i++)
+	{
+		sched->entries[i].release_us = sched->start_us + i * sched->read_cost_us;
+	}
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Performs the reads that are due, earliest deadline first. Call from
+ *			the application loop at least as often as the shortest period,
+ *			and at least every 71 minutes for the elapsed time to be kept.
+ *
+ * @param sched			Schedule
+ * @return	number of samples delivered, ADS_ERR_IO if a read failed
+ */
+int ads_sched_run(ads_sched_t * sched)
+{
+	int delivered = 0;
+	uint8_t reads;
+	uint8_t i;
+	
+	ads_sched_clock(sched);
+	
+	// At most one read per device per call, so an overloaded bus can not
+	// hold the application loop
+	for(reads = 0; reads < sched->count; reads++)
+	{
+		uint32_t now = ads_hal_micros();
+		ads_sched_entry_t * next = NULL;
+		
+		// Released read with the earliest deadline
+		for(i = 0; i < sched->count; i++)
+		{
+			ads_sched_entry_t * entry = &sched->entries[i];
+			
+			if((int32_t)(now - entry->release_us) < 0)
+				continue;
+			
+			if(next == NULL || (int32_t)((entry->release_us + entry->period_us) - (next->release_us + next->period_us)) < 0)
+				next = entry;
+		}
+		
+		if(next == NULL)
+			break;
+		
+		ads_sample_t sample;
+		uint8_t count;
+		
+		int ret_val = ads_read_batch(next->dev, &sample, 1, &count);
+		
+		uint32_t done = ads_hal_micros();
+		uint32_t late = now - next->release_us;
+		
+		sched->busy_us += done - now;
+		
+		if(late > next->max_late_us)
+			next->max_late_us = late;
+		
+		// Deadline is the next release, skip the periods that passed unread
+		uint32_t skipped = late / next->period_us;
+		
+		next->misses += skipped;
+		next->release_us += (skipped + 1) * next->period_us;
+		
+		if(ret_val != ADS_OK)
+		{
+			sched->errors++;
+			return ADS_ERR_IO;
+		}
+		
+		next->reads++;
+		sched->reads++;
+		
+		if(count != 0)
+		{
+			if(sched->callback != NULL)
+				sched->callback(next->dev, &sample);
+			
+			delivered++;
+		}
+	}
+	
+	return delivered;
+}
+
+/**
+ * @brief Time until the next read is due, for the application to sleep or
+ *			do other work
+ *
+ * @param sched			Schedule
+ * @return	microseconds, 0 if a read is due
+ */
+uint32_t ads_sched_idle_us(ads_sched_t * sched)
+{
+	uint32_t now = ads_hal_micros();
+	uint32_t idle = 0xFFFFFFFF;
+	uint8_t i;
+	
+	for(i = 0; i < sched->count; i++)
+	{
+		int32_t until = (int32_t)(sched->entries[i].release_us - now);
+		
+		if(until <= 0)
+			return 0;
+		
+		if((uint32_t)until < idle)
+			idle = until;
+	}
+	
+	return (sched->count != 0) ? idle : 0;
+}
+
+/**
+ * @brief Copies the statistics of the schedule, per sensor statistics are
+ *			in sched->entries
+ *
+ * @param sched			Schedule
+ * @param stats[out]	Statistics
+ */
+void ads_sched_get_stats(ads_sched_t * sched, ads_sched_stats_t * stats)
+{
+	uint8_t i;
+	
+	stats->reads = sched->reads;
+	stats->errors = sched->errors;
+	stats->misses = 0;
+	
+	for(i = 0; i < sched->count; i++)
+	{
+		stats->misses += sched->entries[i].misses;
+	}
+	
+	ads_sched_clock(sched);
+	
+	stats->busy_us = sched->busy_us;
+	stats->elapsed_us = sched->elapsed_us;
+	stats->estimated_permille = ads_sched_utilization(sched);
+	stats->measured_permille = 0;
+	
+	// A read still timed after the clock was taken may leave busy past elapsed
+	if(stats->elapsed_us != 0)
+		stats->measured_permille = (stats->busy_us >= stats->elapsed_us) ? 1000 :
+			(uint16_t)((stats->busy_us * 1000) / stats->elapsed_us);
+}
@@ -0,0 +1,145 @@
+/**
+ * ads_sched.h
+ *
+ * Bus scheduler for several ADS sensors in polled mode on one I2C bus. The
+ * scheduler owns the bus: each sensor is read at its own target rate, the
+ * read due soonest first (earliest deadline first), from the application
+ * loop. A read released at time r has its deadline one period later, at
+ * the next release. Bus utilization is estimated on admission and measured
+ * while running, and reads that slip past their deadline are counted.
+ *
+ * Only devices in polled mode are scheduled. ads_read_batch drains the
+ * queue of a device in queued mode instead of reading it, so queued devices
+ * are refused rather than read in an order of their own.
+ */
+
+#ifndef ADS_SCHED_H_
+#define ADS_SCHED_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads.h"
+
+#ifndef ADS_SCHED_MAX_DEVICES
+#define ADS_SCHED_MAX_DEVICES		(8)		// Maximum number of sensors per scheduler
+#endif
+
+/* Bit times of one polled read, start + address + 3 data bytes with ack + stop */
+#ifndef ADS_SCHED_READ_BITS
+#define ADS_SCHED_READ_BITS			(38)
+#endif
+
+/* Processor time per read around the bus transfer, microseconds */
+#ifndef ADS_SCHED_READ_OVERHEAD_US
+#define ADS_SCHED_READ_OVERHEAD_US	(20)
+#endif
+
+/* Highest estimated bus utilization admitted, per mille. Headroom for the
+ * application loop, a read can not be preempted once started */
+#ifndef ADS_SCHED_MAX_UTILIZATION
+#define ADS_SCHED_MAX_UTILIZATION	(900)
+#endif
+
+/* One sensor of the schedule */
+typedef struct {
+	ads_dev_t * dev;					// ADS device, in polled mode while scheduled
+	uint32_t period_us;					// Read period at the target rate
+	uint32_t release_us;				// Release time of the next read
+	uint32_t reads;						// Reads completed
+	uint32_t misses;					// Periods without a read, deadline passed
+	uint32_t max_late_us;				// Longest time from release to read
+} ads_sched_entry_t;
+
+/* Bus schedule statistics */
+typedef struct {
+	uint32_t reads;						// Reads completed, all sensors
+	uint32_t misses;					// Deadline misses, all sensors
+	uint32_t errors;					// Reads failed on the bus
+	uint64_t busy_us;					// Time spent in reads
+	uint64_t elapsed_us;				// Time since ads_sched_start
+	uint16_t estimated_permille;		// Estimated bus utilization of the schedule
+	uint16_t measured_permille;			// busy_us / elapsed_us, at most 1000
+} ads_sched_stats_t;
+
+typedef struct {
+	ads_sched_entry_t entries[ADS_SCHED_MAX_DEVICES];
+	uint8_t count;						// Sensors in entries
+	uint32_t bit_rate;					// Bus bit rate, Hz
+	uint32_t read_cost_us;				// Estimated time of one read
+	ads_timestamped_callback callback;	// Receives every sample read
+	uint32_t start_us;					// ads_hal_micros() at ads_sched_start
+	uint32_t clock_us;					// ads_hal_micros() elapsed_us was last advanced to
+	uint64_t elapsed_us;				// Time since ads_sched_start, past the wrap of ads_hal_micros()
+	uint32_t reads;
+	uint32_t errors;
+	uint64_t busy_us;
+} ads_sched_t;
+
+/**
+ * @brief Initializes an empty schedule
+ *
+ * @param sched			Schedule
+ * @param bit_rate		I2C bus bit rate in Hz, e.g. 400000
+ * @param callback		Receives every sample read, with its read time stamp
+ */
+void ads_sched_init(ads_sched_t * sched, uint32_t bit_rate, ads_timestamped_callback callback);
+
+/**
+ * @brief Adds an initialized ADS device to the schedule, to be read at the
+ *			target rate. All devices of a schedule must share one bus.
+ *
+ * @param sched			Schedule
+ * @param dev			ADS device
+ * @param sps			Target read rate
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the schedule is full,
+ *			the device is queued, on another bus or the bus would be over
+ *			utilized
+ */
+int ads_sched_add(ads_sched_t * sched, ads_dev_t * dev, ADS_SPS_T sps);
+
+/**
+ * @brief Estimated bus utilization of the schedule, per mille
+ *
+ * @param sched			Schedule
+ * @return	utilization, 1000 = bus always busy
+ */
+uint16_t ads_sched_utilization(ads_sched_t * sched);
+
+/**
+ * @brief Places every device of the schedule in polled mode, with the data
+ *			ready interrupt disabled, and releases the first reads
+ *
+ * @param sched			Schedule
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_sched_start(ads_sched_t * sched);
+
+/**
+ * @brief Performs the reads that are due, earliest deadline first. Call from
+ *			the application loop at least as often as the shortest period,
+ *			and at least every 71 minutes for the elapsed time to be kept.
+ *
+ * @param sched			Schedule
+ * @return	number of samples delivered, ADS_ERR_IO if a read failed
+ */
+int ads_sched_run(ads_sched_t * sched);
+
+/**
+ * @brief Time until the next read is due, for the application to sleep or
+ *			do other work
+ *
+ * @param sched			Schedule
+ * @return	microseconds, 0 if a read is due
+ */
+uint32_t ads_sched_idle_us(ads_sched_t * sched);
+
+/**
+ * @brief Copies the statistics of the schedule, per sensor statistics are
+ *			in sched->entries
+ *
+ * @param sched			Schedule
+ * @param stats[out]	Statistics
+ */
+void ads_sched_get_stats(ads_sched_t * sched, ads_sched_stats_t * stats);
+
+#endif /* ADS_SCHED_H_ */
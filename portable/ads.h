@@ -9,12 +9,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "ads_hal.h"
 #include "ads_err.h"
 #include "ads_util.h"
 
-typedef void (*ads_callback)(float*,uint8_t);	// Callback function prototype for interrupt mode
-
 typedef enum {
 	ADS_CALIBRATE_FIRST = 0,			// First calibration point, typically 0 degrees
 	ADS_CALIBRATE_SECOND,				// Second calibration point, 45-255 degrees
@@ -35,6 +34,22 @@ typedef enum {
 	ADS_500_HZ = 32,					// 500 samples per second, Interrupt Mode, max rate
 } ADS_SPS_T;
 
+/* Longest time ads_init and ads_wake wait for the ADS to answer after reset */
+#ifndef ADS_INIT_TIMEOUT_MS
+#define ADS_INIT_TIMEOUT_MS		(2000)
+#endif
+
+/* Interval between readiness probes while the ADS boots */
+#ifndef ADS_INIT_PROBE_MS
+#define ADS_INIT_PROBE_MS		(5)
+#endif
+
+/* Sample period in microseconds of an ADS_SPS_T, 16384 ticks per second */
+#define ADS_SPS_TO_US(sps)		((uint32_t)(sps) * 15625 / 256)
+
+/* Sample rate in Hz of an ADS_SPS_T */
+#define ADS_SPS_TO_HZ(sps)		(16384.0f / (float)(sps))
+
 /* Device ids */
 typedef enum {
 	ADS_ONE_AXIS = 1,
@@ -44,119 +59,199 @@ typedef enum {
 typedef struct {
 	ADS_SPS_T sps;						// Sample rate for interrupt mode
 	ads_callback ads_sample_callback;	// Pointer to callback function
+	ads_raw_callback ads_raw_sample_callback;	// Fixed point callback, no float conversion when set
+	ads_timestamped_callback ads_timestamped_sample_callback;	// Time stamped callback, replaces ads_sample_callback when set
 	uint32_t reset_pin; 				// Pin number connected to ADS reset line
 	uint32_t datardy_pin;				// Pin number connected to ADS interrupt line
 	uint8_t addr;						// I2C 7-bit address of ADS sensor
+	void * bus;							// HAL specific bus handle, NULL selects the default bus
+	bool queued;						// Queue packets for ads_read_queued instead of calling ads_sample_callback
 } ads_init_t;
 
 /**
  * @brief Reads ADS sample data when ADS is in polled mode
  *
+ * @param	dev			ADS device
  * @param	sample[out]		floating point array returns new sample 
  * @param	data_type[out]	returns if the data read is bend or stretch data
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_read_polled(float * sample, uint8_t * data_type);
+int ads_read_polled(ads_dev_t * dev, float * sample, uint8_t * data_type);
+
+/**
+ * @brief Reads ADS sample data when ADS is in polled mode, in Q9.6 fixed point
+ *
+ * @param	dev			ADS device
+ * @param	sample[out]		fixed point array returns new sample 
+ * @param	data_type[out]	returns if the data read is bend or stretch data
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_read_polled_raw(ads_dev_t * dev, ads_q6_t * sample, uint8_t * data_type);
+
+/**
+ * @brief Drains packets queued by the data ready interrupt in queued mode,
+ *			oldest first. Never blocks, safe to call while the interrupt runs.
+ *			dev->queue_overflows counts packets dropped because the queue was
+ *			full, dev->queue_high_water the deepest the queue has been.
+ *
+ * @param	dev			ADS device
+ * @param	packets[out]	array receiving the queued packets
+ * @param	max			size of packets
+ * @param	count[out]	number of packets returned
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the device is not in queued mode
+ */
+int ads_read_queued(ads_dev_t * dev, ads_packet_t * packets, uint8_t max, uint8_t * count);
+
+/**
+ * @brief Reads and decodes up to max samples in one call. In queued mode
+ *			drains the queue filled by the data ready interrupt, otherwise
+ *			reads back to back from an ADS in polled mode. Packets that are
+ *			not samples are skipped.
+ *
+ * @param	dev			ADS device
+ * @param	out[out]	array receiving the decoded samples, oldest first
+ * @param	max			size of out
+ * @param	count[out]	number of samples returned
+ * @return	ADS_OK if successful ADS_ERR_IO if a read failed, count holds
+ *			the samples read before the failure
+ */
+int ads_read_batch(ads_dev_t * dev, ads_sample_t * out, uint8_t max, uint8_t * count);
+
+/**
+ * @brief Copies the bend sample interval statistics, measured from data ready
+ *			time stamps in interrupt and queued mode. Safe to call while the
+ *			interrupt runs.
+ *
+ * @param	dev			ADS device
+ * @param	stats[out]	interval statistics
+ * @return	ADS_OK
+ */
+int ads_get_interval_stats(ads_dev_t * dev, ads_interval_stats_t * stats);
+
+/**
+ * @brief Clears the bend sample interval statistics, from the next bend sample
+ *
+ * @param	dev			ADS device
+ */
+void ads_reset_interval_stats(ads_dev_t * dev);
 
 /**
  * @brief Places ADS in free run or sleep mode
  *
+ * @param	dev			ADS device
  * @param	run	true if activating ADS, false is putting in suspend mode
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_run(bool run);
+int ads_run(ads_dev_t * dev, bool run);
 
 /**
  * @brief Places ADS in poll mode or sleep. Each time sensor data is read a new sample is taken
  *
+ * @param	dev			ADS device
  * @param	poll	true if activating ADS, false is putting in suspend mode
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_polled(bool poll);
+int ads_polled(ads_dev_t * dev, bool poll);
 
 /**
  * @brief Enables and Disables the reading of linear displacment data
  *
+ * @param	dev			ADS device
  * @param	enable	true if enabling ADS to read stretch, false is disabling
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_stretch_en(bool enable);
+int ads_stretch_en(ads_dev_t * dev, bool enable);
 
 /**
  * @brief Sets the sample rate of the ADS in free run mode
  *
+ * @param	dev			ADS device
  * @param	sps ADS_SPS_T sample rate
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_set_sample_rate(ADS_SPS_T sps);
+int ads_set_sample_rate(ads_dev_t * dev, ADS_SPS_T sps);
 
 /**
  * @brief Enables the ADS data ready interrupt line
  *
+ * @param	dev			ADS device
  * @param	run	true if activating ADS, false is putting in suspend mode
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_enable_interrupt(bool enable);
+int ads_enable_interrupt(ads_dev_t * dev, bool enable);
 
 /**
  * @brief Updates the I2C address of the selected ADS. The default address 
  *		  is 0x12. Use this function to program an ADS to allow multiple
  *		  devices on the same I2C bus.
  *
+ * @param	dev			ADS device
  * @param	address	new address of the ADS
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_update_device_address(uint8_t address);
+int ads_update_device_address(ads_dev_t * dev, uint8_t address);
 
 /**
- * @brief Initializes the hardware abstraction layer and sample rate of the ADS
+ * @brief Initializes the hardware abstraction layer and sample rate of the ADS.
+ *			Resets the ADS and probes for its device id until it answers,
+ *			the time taken is left in dev->startup_us.
  *
+ * @param	dev			ADS device
  * @param	ads_init_t	initialization structure of the ADS
- * @return	ADS_OK if successful ADS_ERR if failed
+ * @return	ADS_OK if successful ADS_ERR if failed, ADS_ERR_TIMEOUT if the
+ *			ADS did not answer within ADS_INIT_TIMEOUT_MS, ADS_ERR_DEV_ID if
+ *			the device answering is not a one axis ADS
  */
-int ads_init(ads_init_t * ads_init);
+int ads_init(ads_dev_t * dev, ads_init_t * ads_init);
 
 /**
  * @brief Calibrates one axis ADS. ADS_CALIBRATE_FIRST should be at 0 degrees on
  *				ADS_CALIBRATE_SECOND can be at 45 - 255 degrees, recommended 90 degrees.
  *
+ * @param	dev			ADS device
  * @param	ads_calibration_step 	ADS_CALIBRATE_STEP_T to perform
  * @param degrees uint8_t angle at which sensor is bent when performing 
  *				ADS_CALIBRATE_FIRST, and ADS_CALIBRATE_SECOND
  * @return	ADS_OK if successful ADS_ERR_IO or ADS_BAD_PARAM if failed
  */
-int ads_calibrate(ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees);
+int ads_calibrate(ads_dev_t * dev, ADS_CALIBRATION_STEP_T ads_calibration_step, uint8_t degrees);
 
 /**
  * @brief Shutdown ADS. Requires reset to wake up from Shutdown. ~50nA in shutdwon
  *
+ * @param	dev			ADS device
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_shutdown(void);
+int ads_shutdown(ads_dev_t * dev);
 
 /**
- * @brief Wakes up ADS from shutdown. Delay is necessary for ADS to reinitialize 
+ * @brief Wakes up ADS from shutdown. Waits until the ADS answers again, the
+ *			time taken is left in dev->startup_us.
  *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @param	dev			ADS device
+ * @return	ADS_OK if successful, ADS_ERR_TIMEOUT if the ADS did not answer
+ *			within ADS_INIT_TIMEOUT_MS
  */
-int ads_wake(void);
+int ads_wake(ads_dev_t * dev);
 
 /**
  * @brief Checks that the device id is ADS_ONE_AXIS. ADS should not be in free run
  * 			when this function is called.
  *
+ * @param	dev			ADS device
  * @return	ADS_OK if dev_id is ADS_ONE_AXIS, ADS_ERR_DEV_ID if not
  */
- int ads_get_dev_id(void);
+ int ads_get_dev_id(ads_dev_t * dev);
  
  /**
  * @brief Returns the device type in ads_dev_type. ADS should not be in free run
  * 			when this function is called.
  *
+ * @param	dev			ADS device
  * @param ads_dev_type  recipient of the device type
  * @return	ADS_OK if dev_id is one of ADS_DEV_TYPE_T, ADS_ERR_DEV_ID if not
  */
- int ads_get_dev_type(ADS_DEV_TYPE_T * ads_dev_type);
+ int ads_get_dev_type(ads_dev_t * dev, ADS_DEV_TYPE_T * ads_dev_type);
 
 
 #endif /* ADS_H_ */
@@ -0,0 +1,241 @@
+/**
+ * ads_cmd.c
+ *
+ * Asynchronous commands
+ */
+
+#include "ads_cmd.h"
+
+/**
+ * @brief Prepares a command
+ *
+ * @param cmd			Command
+ * @param command		ADS_COMMAND_T to send
+ * @param arg1,arg2		Command arguments, packet bytes 1 and 2
+ * @param reply_type	ADS_PACKET_T of the reply, ADS_CMD_NO_REPLY if none
+ */
+void ads_cmd_init(ads_cmd_t * cmd, uint8_t command, uint8_t arg1, uint8_t arg2, uint8_t reply_type)
+{
+	cmd->command[0] = command;
+	cmd->command[1] = arg1;
+	cmd->command[2] = arg2;
+	cmd->reply_type = reply_type;
+	cmd->reply[0] = cmd->reply[1] = cmd->reply[2] = 0;
+	cmd->status = ADS_OK;
+	cmd->callback = NULL;
+	cmd->sent = false;
+	cmd->next = NULL;
+}
+
+/**
+ * @brief Prepares a command reading the firmware version, see ads_cmd_fw_ver
+ *
+ * @param cmd			Command
+ */
+void ads_cmd_get_fw_ver(ads_cmd_t * cmd)
+{
+	ads_cmd_init(cmd, ADS_GET_FW_VER, 0, 0, ADS_FW_VER);
+}
+
+/**
+ * @brief Prepares a command reading the device type, see ads_cmd_dev_type
+ *
+ * @param cmd			Command
+ */
+void ads_cmd_get_dev_type(ads_cmd_t * cmd)
+{
+	ads_cmd_init(cmd, ADS_GET_DEV_ID, 0, 0, ADS_DEV_ID);
+}
+
+/**
+ * @brief Prepares a command setting the sample rate in free run mode
+ *
+ * @param cmd			Command
+ * @param sps			ADS_SPS_T sample rate
+ */
+void ads_cmd_set_sample_rate(ads_cmd_t * cmd, ADS_SPS_T sps)
+{
+	ads_cmd_init(cmd, ADS_SPS, 0, 0, ADS_CMD_NO_REPLY);
+	ads_uint16_encode(sps, &cmd->command[1]);
+}
+
+/**
+ * @brief Applies the driver side state of a command as it is sent, as the
+ *			blocking functions in ads.cpp do
+ */
+static void ads_cmd_apply(ads_dev_t * dev, ads_cmd_t * cmd)
+{
+	switch(cmd->command[0])
+	{
+	case ADS_SPS:
+		dev->sample_period_us = ADS_SPS_TO_US(ads_uint16_decode(&cmd->command[1]));
+		dev->interval_restart = true;
+		break;
+	case ADS_RUN:
+		dev->interval_restart = true;
+		break;
+	case ADS_READ_STRETCH:
+		dev->stretch_en = cmd->command[1];
+		break;
+	case ADS_SET_ADDRESS:
+		ads_hal_set_address(dev, cmd->command[1]);
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * @brief Completes the command at the head of the queue of the device
+ */
+static void ads_cmd_complete(ads_dev_t * dev, int status)
+{
+	ads_cmd_t * cmd = dev->cmd_head;
+	
+	dev->cmd_head = cmd->next;
+	if(dev->cmd_head == NULL)
+		dev->cmd_tail = NULL;
+	
+	cmd->next = NULL;
+	cmd->status = status;
+	
+	if(cmd->callback != NULL)
+		cmd->callback(dev, cmd);
+}
+
+/**
+ * @brief Writes the command at the head of the queue of the device
+ */
+static int ads_cmd_send(ads_dev_t * dev, ads_cmd_t * cmd)
+{
+	// Arm the reply capture before the ADS can answer
+	dev->cmd_replied = false;
+	dev->cmd_reply_type = cmd->reply_type;
+	
+	cmd->sent = true;
+	cmd->sent_us = ads_hal_micros();
+	
+	if(ads_hal_write_buffer(dev, cmd->command, ADS_TRANSFER_SIZE) != ADS_OK)
+	{
+		dev->cmd_reply_type = ADS_CMD_NO_REPLY;
+		return ADS_ERR_IO;
+	}
+	
+	// Address changes take effect on the write, reply from the new address
+	ads_cmd_apply(dev, cmd);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Queues a command to the device and sends it if none is in flight
+ *
+ * @param dev			ADS device
+ * @param cmd			Prepared command, owned by the driver until completed
+ * @param callback		Completion callback, NULL to poll with ads_cmd_done
+ * @return	ADS_OK if queued, ADS_ERR_OP_IN_PROGRESS if cmd is already queued
+ */
+int ads_cmd_submit(ads_dev_t * dev, ads_cmd_t * cmd, ads_cmd_callback callback)
+{
+	if(cmd->status == ADS_ERR_OP_IN_PROGRESS)
+		return ADS_ERR_OP_IN_PROGRESS;
+	
+	cmd->status = ADS_ERR_OP_IN_PROGRESS;
+	cmd->callback = callback;
+	cmd->sent = false;
+	cmd->next = NULL;
+	
+	if(dev->cmd_tail != NULL)
+		dev->cmd_tail->next = cmd;
+	else
+		dev->cmd_head = cmd;
+	
+	dev->cmd_tail = cmd;
+	
+	ads_cmd_poll(dev);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Advances the commands of the device: completes the command in
+ *			flight on its reply, a failed write or timeout, and sends the
+ *			next. Call from the application loop while commands are queued.
+ *
+ * @param dev			ADS device
+ * @return	number of commands completed
+ */
+int ads_cmd_poll(ads_dev_t * dev)
+{
+	int completed = 0;
+	ads_cmd_t * cmd;
+	
+	while((cmd = dev->cmd_head) != NULL)
+	{
+		if(!cmd->sent)
+		{
+			if(ads_cmd_send(dev, cmd) != ADS_OK)
+			{
+				ads_cmd_complete(dev, ADS_ERR_IO);
+				completed++;
+				continue;
+			}
+		}
+		
+		if(cmd->reply_type == ADS_CMD_NO_REPLY)
+		{
+			ads_cmd_complete(dev, ADS_OK);
+			completed++;
+			continue;
+		}
+		
+		uint32_t elapsed = ads_hal_micros() - cmd->sent_us;
+		
+		// Not yet delivered by the interrupt, read it directly once the ADS
+		// has had time to answer. The device interrupt is held off for the
+		// read, a sample read instead of the reply is passed on as usual.
+		if(!dev->cmd_replied && elapsed >= ADS_CMD_REPLY_DELAY_MS * 1000UL)
+		{
+			bool int_enabled = dev->int_enabled;
+			
+			if(int_enabled)
+				ads_hal_pin_int_enable(dev, false);
+			
+			if(!dev->cmd_replied &&
+			   ads_hal_read_buffer(dev, dev->read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
+			{
+				dev->drdy_timestamp = ads_hal_micros();
+				dev->read_callback(dev, dev->read_buffer);
+			}
+			
+			if(int_enabled)
+				ads_hal_pin_int_enable(dev, true);
+		}
+		
+		if(dev->cmd_replied)
+		{
+			cmd->reply[0] = dev->cmd_reply[0];
+			cmd->reply[1] = dev->cmd_reply[1];
+			cmd->reply[2] = dev->cmd_reply[2];
+			dev->cmd_replied = false;
+			
+			ads_cmd_complete(dev, ADS_OK);
+			completed++;
+			continue;
+		}
+		
+		if(elapsed >= ADS_CMD_TIMEOUT_MS * 1000UL)
+		{
+			dev->cmd_reply_type = ADS_CMD_NO_REPLY;
+			
+			ads_cmd_complete(dev, ADS_ERR_TIMEOUT);
+			completed++;
+			continue;
+		}
+		
+		// Reply still outstanding
+		break;
+	}
+	
+	return completed;
+}
@@ -0,0 +1,125 @@
+/**
+ * ads_cmd.h
+ *
+ * Asynchronous commands. A command is written to the ADS without waiting for
+ * its reply and without disabling the data ready interrupt, so samples keep
+ * streaming while a firmware version is read or a rate changed. Commands to
+ * one device are queued and sent one at a time. A reply is matched by its
+ * packet type as it arrives, through the data ready interrupt or, once the
+ * ADS has had time to answer, a direct read that passes any sample on.
+ *
+ * Commands are owned by the application and must stay valid until they
+ * complete. Completion is delivered by callback from ads_cmd_poll, or seen
+ * by polling ads_cmd_done. Submit and poll from one thread only.
+ */
+
+#ifndef ADS_CMD_H_
+#define ADS_CMD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads.h"
+
+/* Time the ADS needs between a command and its reply */
+#ifndef ADS_CMD_REPLY_DELAY_MS
+#define ADS_CMD_REPLY_DELAY_MS		(2)
+#endif
+
+/* Time after which a command without reply fails with ADS_ERR_TIMEOUT */
+#ifndef ADS_CMD_TIMEOUT_MS
+#define ADS_CMD_TIMEOUT_MS			(50)
+#endif
+
+typedef void (*ads_cmd_callback)(ads_dev_t*,ads_cmd_t*);	// Command completion callback prototype
+
+struct ads_cmd_s {
+	uint8_t command[ADS_TRANSFER_SIZE];	// Command packet, see ADS_COMMAND_T
+	uint8_t reply_type;					// Reply packet expected, see ADS_PACKET_T, or ADS_CMD_NO_REPLY
+	uint8_t reply[ADS_TRANSFER_SIZE];	// Reply packet, once completed
+	volatile int status;				// ADS_ERR_OP_IN_PROGRESS until completed, then ADS_OK or error
+	ads_cmd_callback callback;			// Called from ads_cmd_poll on completion, may be NULL
+	void * user_data;					// Free for application use
+	
+	/* Owned by the driver while queued */
+	bool sent;							// Written to the ADS
+	uint32_t sent_us;					// ads_hal_micros() when written
+	ads_cmd_t * next;					// Next queued command of the device
+};
+
+/**
+ * @brief Prepares a command
+ *
+ * @param cmd			Command
+ * @param command		ADS_COMMAND_T to send
+ * @param arg1,arg2		Command arguments, packet bytes 1 and 2
+ * @param reply_type	ADS_PACKET_T of the reply, ADS_CMD_NO_REPLY if none
+ */
+void ads_cmd_init(ads_cmd_t * cmd, uint8_t command, uint8_t arg1, uint8_t arg2, uint8_t reply_type);
+
+/**
+ * @brief Prepares a command reading the firmware version, see ads_cmd_fw_ver
+ *
+ * @param cmd			Command
+ */
+void ads_cmd_get_fw_ver(ads_cmd_t * cmd);
+
+/**
+ * @brief Prepares a command reading the device type, see ads_cmd_dev_type
+ *
+ * @param cmd			Command
+ */
+void ads_cmd_get_dev_type(ads_cmd_t * cmd);
+
+/**
+ * @brief Prepares a command setting the sample rate in free run mode
+ *
+ * @param cmd			Command
+ * @param sps			ADS_SPS_T sample rate
+ */
+void ads_cmd_set_sample_rate(ads_cmd_t * cmd, ADS_SPS_T sps);
+
+/**
+ * @brief Queues a command to the device and sends it if none is in flight
+ *
+ * @param dev			ADS device
+ * @param cmd			Prepared command, owned by the driver until completed
+ * @param callback		Completion callback, NULL to poll with ads_cmd_done
+ * @return	ADS_OK if queued, ADS_ERR_OP_IN_PROGRESS if cmd is already queued
+ */
+int ads_cmd_submit(ads_dev_t * dev, ads_cmd_t * cmd, ads_cmd_callback callback);
+
+/**
+ * @brief Advances the commands of the device: completes the command in
+ *			flight on its reply, a failed write or timeout, and sends the
+ *			next. Call from the application loop while commands are queued.
+ *
+ * @param dev			ADS device
+ * @return	number of commands completed
+ */
+int ads_cmd_poll(ads_dev_t * dev);
+
+/**
+ * @brief Returns true once the command has completed, see cmd->status
+ */
+static inline bool ads_cmd_done(ads_cmd_t * cmd)
+{
+	return cmd->status != ADS_ERR_OP_IN_PROGRESS;
+}
+
+/**
+ * @brief Firmware version from a completed ads_cmd_get_fw_ver
+ */
+static inline uint16_t ads_cmd_fw_ver(ads_cmd_t * cmd)
+{
+	return ads_uint16_decode(&cmd->reply[1]);
+}
+
+/**
+ * @brief Device type from a completed ads_cmd_get_dev_type
+ */
+static inline ADS_DEV_TYPE_T ads_cmd_dev_type(ads_cmd_t * cmd)
+{
+	return (ADS_DEV_TYPE_T)cmd->reply[1];
+}
+
+#endif /* ADS_CMD_H_ */
@@ -0,0 +1,134 @@
+/**
+ * ads_dev.h
+ *
+ * ADS device context, one per sensor
+ */
+
+#ifndef ADS_DEV_H_
+#define ADS_DEV_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ADS_TRANSFER_SIZE		(3)
+
+/* Packets held by the queued mode sample queue. Power of two, at most 128 */
+#ifndef ADS_QUEUE_LEN
+#define ADS_QUEUE_LEN			(16)
+#endif
+
+#if (ADS_QUEUE_LEN & (ADS_QUEUE_LEN - 1)) != 0 || ADS_QUEUE_LEN > 128
+#error "ADS_QUEUE_LEN must be a power of two no larger than 128"
+#endif
+
+typedef struct ads_dev_s ads_dev_t;
+typedef struct ads_cmd_s ads_cmd_t;
+
+#define ADS_CMD_NO_REPLY		(0xFF)		// Command has no reply packet
+
+/* Q9.6 fixed point sample as sent by the ADS, 1/64 degree or mm per LSB */
+typedef int16_t ads_q6_t;
+
+typedef void (*ads_callback)(ads_dev_t*,float*,uint8_t);	// Callback function prototype for interrupt mode
+typedef void (*ads_raw_callback)(ads_dev_t*,ads_q6_t*,uint8_t);	// Fixed point callback prototype for interrupt mode
+
+/* Raw packet read from the ADS with the time of its data ready edge */
+typedef struct {
+	uint8_t packet[ADS_TRANSFER_SIZE];	// Packet as read, see ADS_PACKET_T
+	uint32_t timestamp;					// ads_hal_micros() at the data ready edge
+} ads_packet_t;
+
+/* Decoded, time stamped sample */
+typedef struct {
+	float sample[2];					// Bend and stretch as of this packet, as passed to ads_callback
+	uint8_t data_type;					// ADS_SAMPLE or ADS_STRETCH_SAMPLE, the entry of sample updated
+	uint32_t timestamp;					// ads_hal_micros() at the data ready edge, or when read in polled mode
+} ads_sample_t;
+
+typedef void (*ads_timestamped_callback)(ads_dev_t*,ads_sample_t*);	// Time stamped callback prototype for interrupt mode
+
+/* Interval between consecutive bend samples, from data ready time stamps */
+typedef struct {
+	uint32_t samples;					// Bend samples time stamped
+	uint32_t intervals;					// Intervals measured, restarts are not measured
+	uint32_t min_us;					// Shortest interval
+	uint32_t max_us;					// Longest interval
+	uint64_t sum_us;					// Sum of the intervals, mean = sum_us / intervals
+	uint32_t late;						// Intervals over 1.5 sample periods, a sample delayed or lost
+	uint32_t missed;					// Samples lost, estimated from the length of late intervals
+} ads_interval_stats_t;
+
+/* Timing of the last firmware update, see ads_dfu_get_stats */
+typedef struct {
+	uint32_t pages;						// Pages acknowledged
+	uint32_t polls;						// Acknowledgement reads, including those before the acknowledgement
+	uint32_t retries;					// Writes resent and acknowledgements waited for again
+	uint32_t erase_us;					// Time from image length sent to acknowledged
+	uint32_t ack_min_us;				// Shortest time from page sent to acknowledged
+	uint32_t ack_max_us;				// Longest time from page sent to acknowledged
+	uint32_t ack_sum_us;				// Sum of page acknowledgement times, mean = ack_sum_us / pages
+	uint32_t writes;					// Bus writes of page data
+	uint32_t write_sum_us;				// Time spent sending pages on the bus
+	uint32_t total_us;					// Whole update, image length sent to last page acknowledged
+} ads_dfu_stats_t;
+
+/*
+ * Device context for one ADS sensor. Allocated by the application, one per
+ * sensor, and passed to every driver and hal function. Fields are filled in
+ * by ads_init and should not be modified by the application.
+ */
+struct ads_dev_s {
+	/* Hardware abstraction layer state */
+	void * bus;							// HAL specific bus handle, NULL is set to the default bus by ads_hal_init
+	uint32_t reset_pin;					// Pin number connected to ADS reset line
+	uint32_t datardy_pin;				// Pin number connected to ADS interrupt line
+	uint8_t addr;						// I2C 7-bit address of ADS sensor
+	uint8_t hal_slot;					// Interrupt slot assigned by the HAL
+	volatile bool int_enabled;			// Data ready interrupt enabled
+	void (*read_callback)(ads_dev_t*,uint8_t*);		// Packet callback into ads.cpp
+	uint8_t read_buffer[ADS_TRANSFER_SIZE];			// Interrupt read buffer
+	volatile uint32_t drdy_timestamp;	// ads_hal_micros() latched at the last data ready edge
+
+	/* Driver state */
+	ads_callback sample_callback;		// Application sample callback
+	bool stretch_en;					// Stretch measurements enabled
+	uint32_t startup_us;				// Time from reset to first answer, measured by ads_init and ads_wake
+	float sample[2];					// Last bend and stretch sample
+	ads_raw_callback raw_callback;		// Application fixed point sample callback, replaces sample_callback
+	ads_q6_t raw_sample[2];				// Last bend and stretch sample in fixed point
+	ads_timestamped_callback timestamped_callback;	// Application time stamped callback, replaces sample_callback
+
+	/* Sample timing, written from the data ready interrupt only. The
+	 * sequence count is odd while interval is being updated */
+	uint32_t sample_period_us;			// Bend sample period at the set sample rate
+	ads_interval_stats_t interval;		// Bend sample interval statistics
+	uint32_t interval_last;				// Data ready time stamp of the last bend sample
+	volatile uint8_t interval_seq;		// Sequence count of interval updates
+	volatile bool interval_restart;		// Do not measure the next interval, sampling restarted
+	volatile bool interval_reset;		// Clear interval at the next bend sample
+
+	/* Queued mode sample queue. Single producer, the data ready interrupt,
+	 * and single consumer, ads_read_queued. Indexes run free and are masked */
+	bool queued;						// Queue packets instead of firing sample_callback
+	ads_packet_t queue[ADS_QUEUE_LEN];
+	volatile uint8_t queue_head;		// Next slot to fill, written by the interrupt only
+	volatile uint8_t queue_tail;		// Next slot to drain, written by ads_read_queued only
+	volatile uint32_t queue_overflows;	// Packets dropped because the queue was full
+	volatile uint8_t queue_high_water;	// Most packets ever waiting in the queue
+
+	/* Asynchronous commands, see ads_cmd.h. The interrupt only captures the
+	 * reply of the command in flight, the rest is owned by ads_cmd_poll */
+	ads_cmd_t * cmd_head;				// Command in flight, followed by queued commands
+	ads_cmd_t * cmd_tail;				// Last queued command
+	volatile uint8_t cmd_reply_type;	// Reply packet to capture, ADS_CMD_NO_REPLY if none
+	volatile bool cmd_replied;			// Reply captured in cmd_reply
+	uint8_t cmd_reply[ADS_TRANSFER_SIZE];	// Reply captured by the interrupt
+
+	/* Firmware update, see ads_dfu.h */
+	uint32_t dfu_ack_us;				// Expected page acknowledgement time, learned from past pages, 0 if unknown
+	ads_dfu_stats_t dfu_stats;			// Timing of the last firmware update
+
+	void * user_data;					// Free for application use, not touched by the driver
+};
+
+#endif /* ADS_DEV_H_ */
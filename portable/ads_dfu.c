@@ -0,0 +1,619 @@
+/**
+ * ads_dfu.c
+ *
+ * Device firmware update through the ADS bootloader
+ */
+
+#include "ads_dfu.h"
+
+/**
+ * @brief Microsecond delay of any length.
+ */
+static void ads_dfu_delay_us(uint32_t delay_us)
+{
+	if(delay_us >= 1000)
+		ads_hal_delay((uint16_t)(delay_us / 1000));
+	
+	ads_hal_delay_us((uint16_t)(delay_us % 1000));
+}
+
+/**
+ * @brief Continues a CRC-32 over len more bytes, the CRC of ads_fw_image_t.
+ *			Reflected polynomial 0xEDB88320, as zlib's crc32.
+ *
+ * @param crc			CRC-32 of the bytes before, 0 to start
+ * @param data[in]		Bytes
+ * @param len			Number of bytes
+ * @return	CRC-32 of the bytes so far
+ */
+uint32_t ads_dfu_crc32(uint32_t crc, const uint8_t * data, uint32_t len)
+{
+	// A nibble at a time, a 64 byte table
+	static const uint32_t table[16] = {
+		0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+		0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+	};
+	
+	crc = ~crc;
+	
+	while(len--)
+	{
+		crc ^= *data++;
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+	}
+	
+	return ~crc;
+}
+
+/**
+ * @brief Reads the firmware version on the device, to compare with the
+ *			revision of a streamed image
+ *
+ * @param dev			ADS device
+ * @param fw_ver[out]	Firmware version
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_dfu_get_fw_ver(ads_dev_t * dev, uint16_t * fw_ver)
+{
+	uint8_t buffer[] = {ADS_GET_FW_VER, 0, 0};
+	
+	ads_hal_pin_int_enable(dev, false);
+	
+	int ret_val = ads_hal_write_read(dev, buffer, ADS_TRANSFER_SIZE, buffer, ADS_TRANSFER_SIZE, 2);
+	
+	ads_hal_pin_int_enable(dev, true);
+	
+	if(ret_val != ADS_OK || buffer[0] != ADS_FW_VER)
+		return ADS_ERR_IO;
+	
+	*fw_ver = ads_uint16_decode(&buffer[1]);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Resets the ADS into bootloader mode
+ *
+ * @param dev			ADS device
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_dfu_reset(ads_dev_t * dev)
+{
+	uint8_t packet[ADS_TRANSFER_SIZE];
+	 
+	packet[0] = ADS_DFU;
+	packet[1] = packet[2] = 0;
+	 
+	return ads_hal_write_buffer(dev, packet, ADS_TRANSFER_SIZE);
+}
+ 
+/**
+ * @brief Image reader over an image in memory, ctx points to the image.
+ *			For the compiled in images, or a file mapped with mmap.
+ */
+int ads_dfu_mem_reader(void * ctx, uint32_t offset, uint8_t * buffer, uint8_t len)
+{
+	memcpy(buffer, (const uint8_t *)ctx + offset, len);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Prepares an update of len bytes pulled from reader, starting from
+ *			the beginning of the image with the default retry budget
+ *
+ * @param dfu			Update to prepare
+ * @param len			Length of the image in bytes
+ * @param reader		Image reader
+ * @param ctx			Reader context
+ */
+void ads_dfu_init(ads_dfu_t * dfu, uint32_t len, ads_dfu_reader reader, void * ctx)
+{
+	memset(dfu, 0, sizeof(*dfu));
+	
+	dfu->len = len;
+	dfu->reader = reader;
+	dfu->ctx = ctx;
+	dfu->retries = ADS_DFU_RETRIES;
+}
+
+/**
+ * @brief Writes a chunk of a page or the image length, resending it while the
+ *			bootloader refuses its address and retries are left.
+ *
+ * @return	ADS_OK if successful, ADS_ERR_IO if the retry budget ran out,
+ *			ADS_ERR_NACK_DATA if the bootloader refused a data byte
+ */
+static int ads_dfu_write(ads_dev_t * dev, ads_dfu_t * dfu, uint8_t * buffer, uint8_t len)
+{
+	int ret_val;
+	
+	while((ret_val = ads_hal_write_buffer(dev, buffer, len)) != ADS_OK)
+	{
+		// The bytes before a refused data byte may have been taken, and
+		// would be counted twice if resent
+		if(ret_val == ADS_ERR_NACK_DATA)
+		{
+			dfu->lost = true;
+			return ADS_ERR_NACK_DATA;
+		}
+		
+		if(dfu->retries_used >= dfu->retries)
+			return ADS_ERR_IO;
+		
+		dfu->retries_used++;
+		dev->dfu_stats.retries++;
+		
+		// Give a busy bootloader time to finish
+		ads_hal_delay(1);
+	}
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Starts waiting for an acknowledgement. The first poll is a
+ *			sixteenth early, so a page written faster is seen early, then
+ *			polls back off exponentially until ADS_DFU_ACK_TIMEOUT_MS.
+ *
+ * @param dfu			Update
+ * @param expect_us		Expected acknowledgement time, 0 if unknown
+ * @param learn			Learn the page write time from the acknowledgement
+ */
+static void ads_dfu_wait_start(ads_dfu_t * dfu, uint32_t expect_us, bool learn)
+{
+	dfu->state = ADS_DFU_WAIT_ACK;
+	dfu->learn = learn;
+	dfu->wait_start_us = ads_hal_micros();
+	dfu->poll_us = (expect_us > ADS_DFU_POLL_MIN_US) ? expect_us - expect_us / 16 : 0;
+	dfu->missed_us = 0;
+	dfu->backoff_us = (expect_us / 32 > ADS_DFU_POLL_MIN_US) ? expect_us / 32 : ADS_DFU_POLL_MIN_US;
+}
+
+/**
+ * @brief Accounts for an acknowledgement of the image length or a page
+ *
+ * @param ack_us		Time to the acknowledgement, midway between the last
+ *						poll that missed it and the poll that read it
+ */
+static void ads_dfu_acked(ads_dev_t * dev, ads_dfu_t * dfu, uint32_t ack_us)
+{
+	dfu->ack_pending = false;
+	dfu->state = ADS_DFU_SEND;
+	
+	// Do not learn from a late or resumed acknowledgement
+	if(!dfu->learn)
+		ack_us = 0;
+	
+	// The image length, before any page is sent
+	if(!dfu->erased)
+	{
+		dfu->erased = true;
+		
+		if(ack_us)
+			dev->dfu_stats.erase_us = ack_us;
+		
+		return;
+	}
+	
+	dfu->pages++;
+	dev->dfu_stats.pages++;
+	
+	if(ack_us)
+	{
+		dev->dfu_stats.ack_sum_us += ack_us;
+		
+		if(ack_us < dev->dfu_stats.ack_min_us)
+			dev->dfu_stats.ack_min_us = ack_us;
+		
+		if(ack_us > dev->dfu_stats.ack_max_us)
+			dev->dfu_stats.ack_max_us = ack_us;
+		
+		// Track the page write time, a quarter weight for each new page
+		if(dev->dfu_ack_us == 0)
+			dev->dfu_ack_us = ack_us;
+		else
+			dev->dfu_ack_us = dev->dfu_ack_us - dev->dfu_ack_us / 4 + ack_us / 4;
+	}
+	
+	if(dfu->progress != NULL)
+		dfu->progress(dev, dfu);
+}
+
+/**
+ * @brief Advances the update described by dfu by one bus transaction without
+ *			waiting. Starts a run from dfu->done, sends the next page or
+ *			polls for the acknowledgement being waited for, if it is time to.
+ *			The ADS needs to be reset into bootloader mode prior to starting
+ *			with dfu->done at 0, see ads_dfu_run.
+ *
+ * @param dev			ADS device
+ * @param dfu			Update, prepared with ads_dfu_init
+ * @param wait_us[out]	Time until the next call has work to do
+ * @return	ADS_ERR_OP_IN_PROGRESS while the update goes on, else as ads_dfu_run
+ */
+int ads_dfu_step(ads_dev_t * dev, ads_dfu_t * dfu, uint32_t * wait_us)
+{
+	uint8_t packet[ADS_DFU_PAGE_SIZE];
+	int ret_val = ADS_OK;
+	
+	*wait_us = 0;
+	
+	if(dfu->state == ADS_DFU_IDLE)
+	{
+		// Where the bootloader is in the image is not known to resume from
+		if(dfu->lost)
+			return ADS_ERR_NACK_DATA;
+		
+		if(dfu->len == 0 || dfu->reader == NULL || dfu->done > dfu->len || (dfu->done == dfu->len && !dfu->ack_pending))
+			return ADS_ERR_BAD_PARAM;
+		
+		// Time this update, expecting the erase to take as long as the last one
+		uint32_t erase_us = dev->dfu_stats.erase_us;
+		
+		memset(&dev->dfu_stats, 0, sizeof(dev->dfu_stats));
+		dev->dfu_stats.erase_us = erase_us;
+		dev->dfu_stats.ack_min_us = 0xFFFFFFFF;
+		
+		dfu->retries_used = 0;
+		dfu->start_us = ads_hal_micros();
+		
+		// Store a local copy of the current i2c address
+		dfu->address = ads_hal_get_address(dev);
+		
+		// Set the i2c address to the booloader address
+		ads_hal_set_address(dev, ADS_BOOTLOADER_ADDRESS);
+		
+		// Longest write of page data, a whole page unless the HAL buffer is smaller
+		dfu->max_write = ads_hal_max_write(dev);
+		
+		if(dfu->max_write > ADS_DFU_PAGE_SIZE)
+			dfu->max_write = ADS_DFU_PAGE_SIZE;
+		
+		if(dfu->ack_pending)
+		{
+			// An acknowledgement left by a failed run is waited for without
+			// expecting it at any time, and its time is not learned
+			ads_dfu_wait_start(dfu, 0, false);
+		}
+		else if(!dfu->erased)
+		{
+			// Transmit the length of the new firmware to the bootloader
+			packet[0] = (uint8_t)(dfu->len & 0xff);
+			packet[1] = (uint8_t)((dfu->len >> 8) & 0xff);
+			packet[2] = (uint8_t)((dfu->len>>16) & 0xff);
+			packet[3] = (uint8_t)((dfu->len>>24) & 0xff);
+			
+			ret_val = ads_dfu_write(dev, dfu, packet, 4);
+			
+			if(ret_val == ADS_OK)
+			{
+				dfu->ack_pending = true;
+				ads_dfu_wait_start(dfu, erase_us, true);
+			}
+		}
+		else
+			dfu->state = ADS_DFU_SEND;
+	}
+	else if(dfu->state == ADS_DFU_SEND)
+	{
+		// Transfer the new firmware image a page at a time, the last page may be short
+		uint32_t page_end = (dfu->done / ADS_DFU_PAGE_SIZE + 1) * ADS_DFU_PAGE_SIZE;
+		
+		if(page_end > dfu->len)
+			page_end = dfu->len;
+		
+		// Pull the rest of the page, all of it unless resuming within it
+		ret_val = dfu->reader(dfu->ctx, dfu->done, &packet[dfu->done % ADS_DFU_PAGE_SIZE], (uint8_t)(page_end - dfu->done));
+		
+		// Hold back the last page of an image that does not match its CRC, so
+		// the bootloader never completes it
+		if(ret_val == ADS_OK && dfu->check_crc && page_end == dfu->len &&
+		   ads_dfu_crc32(dfu->crc_done, &packet[dfu->done % ADS_DFU_PAGE_SIZE], page_end - dfu->done) != dfu->crc)
+			ret_val = ADS_ERR_CRC;
+		
+		// Send the page in as few writes as the HAL takes, all of it in one
+		// on most platforms, counting each write the bootloader takes
+		uint32_t write_start = ads_hal_micros();
+		
+		while(ret_val == ADS_OK && dfu->done < page_end)
+		{
+			uint8_t first = dfu->done % ADS_DFU_PAGE_SIZE;
+			uint8_t chunk = (page_end - dfu->done < dfu->max_write) ? (uint8_t)(page_end - dfu->done) : dfu->max_write;
+			
+			ret_val = ads_dfu_write(dev, dfu, &packet[first], chunk);
+			
+			if(ret_val == ADS_OK)
+			{
+				dfu->crc_done = ads_dfu_crc32(dfu->crc_done, &packet[first], chunk);
+				dfu->done += chunk;
+				dev->dfu_stats.writes++;
+			}
+		}
+		
+		dev->dfu_stats.write_sum_us += ads_hal_micros() - write_start;
+		
+		if(ret_val == ADS_OK)
+		{
+			dfu->ack_pending = true;
+			ads_dfu_wait_start(dfu, dev->dfu_ack_us, true);
+		}
+	}
+	else
+	{
+		uint8_t ack = 0;
+		uint32_t poll_us = ads_hal_micros() - dfu->wait_start_us;
+		
+		if(poll_us < dfu->poll_us)
+		{
+			*wait_us = dfu->poll_us - poll_us;
+			return ADS_ERR_OP_IN_PROGRESS;
+		}
+		
+		dev->dfu_stats.polls++;
+		
+		// Get acknowledgement of the fw length or the recieved page
+		if(ads_hal_read_buffer(dev, &ack, 1) == ADS_OK && ack == 's')
+		{
+			ads_dfu_acked(dev, dfu, dfu->missed_us + (poll_us - dfu->missed_us) / 2);
+		}
+		else
+		{
+			dfu->missed_us = poll_us;
+			
+			if(ads_hal_micros() - dfu->wait_start_us < (uint32_t)ADS_DFU_ACK_TIMEOUT_MS * 1000)
+			{
+				*wait_us = dfu->backoff_us;
+				dfu->poll_us = ads_hal_micros() - dfu->wait_start_us + dfu->backoff_us;
+				dfu->backoff_us = (dfu->backoff_us * 2 < ADS_DFU_POLL_MAX_US) ? dfu->backoff_us * 2 : ADS_DFU_POLL_MAX_US;
+			}
+			else if(dfu->retries_used < dfu->retries)
+			{
+				dfu->retries_used++;
+				dev->dfu_stats.retries++;
+				
+				// Poll again from the start
+				ads_dfu_wait_start(dfu, 0, false);
+			}
+			else
+				ret_val = ADS_ERR_TIMEOUT;
+		}
+	}
+	
+	if(ret_val == ADS_OK && (dfu->done < dfu->len || dfu->ack_pending))
+		return ADS_ERR_OP_IN_PROGRESS;
+	
+	// Complete or failed, a failed run resumes from here when called again
+	// unless a refused data byte lost count of the bytes taken
+	dfu->state = ADS_DFU_IDLE;
+	
+	dev->dfu_stats.total_us = ads_hal_micros() - dfu->start_us;
+	
+	if(dev->dfu_stats.ack_min_us == 0xFFFFFFFF)
+		dev->dfu_stats.ack_min_us = 0;
+	
+	// restore i2c address
+	ads_hal_set_address(dev, dfu->address);
+	
+	return ret_val;
+}
+
+/**
+ * @brief Writes the image described by dfu to the ADS bootloader, from
+ *			dfu->done on. The ADS needs to be reset into bootloader mode
+ *			prior to starting with dfu->done at 0. The bootloader counts the
+ *			bytes it takes and has no page addresses, so a write refused at
+ *			its address is resent and a late acknowledgement waited for
+ *			again, within dfu->retries for the whole run. Bytes taken are
+ *			never resent, so a write refused at a data byte, after the bytes
+ *			before it may have been taken, fails the update for good.
+ *
+ *			If the update fails dfu->done is left at the bytes the bootloader
+ *			took, and dfu->ack_pending set if their page is not acknowledged.
+ *			While the ADS stays in the bootloader, without a reset or power
+ *			loss, calling this function again resumes there with a fresh
+ *			retry budget. After ADS_ERR_NACK_DATA it returns that again, the
+ *			ADS must be reset into the bootloader and updated from the start.
+ *
+ *			With dfu->check_crc set the image read is checked against
+ *			dfu->crc before its last page is sent. A corrupt image is never
+ *			completed, the ADS stays in the bootloader to be updated again.
+ *
+ * @param dev			ADS device
+ * @param dfu			Update, prepared with ads_dfu_init
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the update is complete,
+ *			ADS_ERR_IO if the bootloader kept refusing a write, ADS_ERR_NACK_DATA
+ *			if it refused a data byte, ADS_ERR_TIMEOUT if it did not
+ *			acknowledge, ADS_ERR_CRC if check_crc is set and the image read
+ *			does not match crc, or the error returned by the reader
+ */
+int ads_dfu_run(ads_dev_t * dev, ads_dfu_t * dfu)
+{
+	uint32_t wait_us;
+	int ret_val;
+	
+	while((ret_val = ads_dfu_step(dev, dfu, &wait_us)) == ADS_ERR_OP_IN_PROGRESS)
+	{
+		if(wait_us)
+			ads_dfu_delay_us(wait_us);
+	}
+	
+	return ret_val;
+}
+
+/**
+ * @brief Writes a firmware image pulled page by page from reader to the ADS
+ *			bootloader, with ADS_DFU_RETRIES retries. The ADS needs to be reset
+ *			into bootloader mode prior to calling this function
+ *
+ * @param dev			ADS device
+ * @param len			Length of the image in bytes
+ * @param reader		Image reader
+ * @param ctx			Reader context
+ * @return	ADS_OK if successful, ADS_ERR_IO, ADS_ERR_NACK_DATA or
+ *			ADS_ERR_TIMEOUT if the bootloader did not take the image, or the
+ *			error returned by reader. The timing of the
+ *			update is kept for ads_dfu_get_stats
+ */
+int ads_dfu_update_stream(ads_dev_t * dev, uint32_t len, ads_dfu_reader reader, void * ctx)
+{
+	ads_dfu_t dfu;
+	
+	ads_dfu_init(&dfu, len, reader, ctx);
+	
+	return ads_dfu_run(dev, &dfu);
+}
+
+/**
+ * @brief Writes a compressed firmware image, see ads_dfu_lz.h, to the ADS
+ *			bootloader, decompressing it page by page. The ADS needs to be
+ *			reset into bootloader mode prior to calling this function
+ *
+ * @param dev			ADS device
+ * @param image[in]		Compressed image
+ * @param len			Length of the compressed image
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if image is not a
+ *			compressed image, ADS_ERR if it is corrupt or ADS_ERR_TIMEOUT if failed
+ */
+int ads_dfu_update_lz(ads_dev_t * dev, const uint8_t * image, uint32_t len)
+{
+	ads_dfu_lz_t lz;
+	
+	if(ads_dfu_lz_init(&lz, image, len) != ADS_OK)
+		return ADS_ERR_BAD_PARAM;
+	
+	return ads_dfu_update_stream(dev, ads_dfu_lz_length(&lz), &ads_dfu_lz_reader, &lz);
+}
+
+/**
+ * @brief Gets the timing of the last firmware update of the device
+ *
+ * @param dev			ADS device
+ * @param stats[out]	Timing of the last update
+ */
+void ads_dfu_get_stats(ads_dev_t * dev, ads_dfu_stats_t * stats)
+{
+	*stats = dev->dfu_stats;
+}
+
+/**
+ * @brief Predicts how long writing an image of len bytes to the device takes,
+ *			from the timing of its last firmware update
+ *
+ * @param dev			ADS device
+ * @param len			Length of the image in bytes
+ * @return	Predicted time in microseconds, 0 if no update has been timed
+ */
+uint32_t ads_dfu_estimate_us(ads_dev_t * dev, uint32_t len)
+{
+	const ads_dfu_stats_t * stats = &dev->dfu_stats;
+	
+	if(stats->pages == 0)
+		return 0;
+	
+	uint32_t pages = (len + ADS_DFU_PAGE_SIZE - 1) / ADS_DFU_PAGE_SIZE;
+	
+	// Each page costs what it did last time, reading, sending and waiting for it
+	return stats->erase_us + pages * ((stats->total_us - stats->erase_us) / stats->pages);
+}
+
+/**
+ * @brief Checks if a firmware image is newer than the firmware on the device
+ *
+ * @param dev			ADS device
+ * @param image			Image, NULL if none
+ * @return	TRUE if update needed. FALSE if no updated needed
+ */
+bool ads_dfu_check_image(ads_dev_t * dev, const ads_fw_image_t * image)
+{
+	uint16_t fw_ver;
+	
+	if(image == NULL || ads_dfu_get_fw_ver(dev, &fw_ver) != ADS_OK)
+		return false;
+	
+	return fw_ver < image->rev;
+}
+
+/**
+ * @brief Prepares an update with a firmware image, after reading it through
+ *			once to check it against its CRC
+ *
+ * @param dfu			Update to prepare
+ * @param image			Image, NULL if none
+ * @param lz			Decoder of a compressed image, must stay valid during
+ *						the update, unused for a raw image
+ * @return	ADS_OK if successful, ADS_ERR_DEV_ID if image is NULL,
+ *			ADS_ERR_BAD_PARAM if a compressed image is invalid or lz is NULL,
+ *			ADS_ERR_CRC if the image does not match its CRC
+ */
+int ads_dfu_init_image(ads_dfu_t * dfu, const ads_fw_image_t * image, ads_dfu_lz_t * lz)
+{
+	uint8_t page[ADS_DFU_PAGE_SIZE];
+	uint32_t offset, crc = 0;
+	
+	if(image == NULL)
+		return ADS_ERR_DEV_ID;
+	
+	if(image->format == ADS_FW_RAW)
+		ads_dfu_init(dfu, image->len, &ads_dfu_mem_reader, (void *)image->data);
+	else if(image->format == ADS_FW_LZ && lz != NULL && ads_dfu_lz_init(lz, image->data, image->size) == ADS_OK &&
+			ads_dfu_lz_length(lz) == image->len)
+		ads_dfu_init(dfu, image->len, &ads_dfu_lz_reader, lz);
+	else
+		return ADS_ERR_BAD_PARAM;
+	
+	// Check the whole image before the bootloader erases the flash for it
+	for(offset = 0; offset < image->len; offset += ADS_DFU_PAGE_SIZE)
+	{
+		uint8_t len = (image->len - offset < ADS_DFU_PAGE_SIZE) ? (uint8_t)(image->len - offset) : ADS_DFU_PAGE_SIZE;
+		
+		if(dfu->reader(dfu->ctx, offset, page, len) != ADS_OK)
+			return ADS_ERR_CRC;
+		
+		crc = ads_dfu_crc32(crc, page, len);
+	}
+	
+	if(crc != image->crc)
+		return ADS_ERR_CRC;
+	
+	// The decoder only reads forward, start it again for the update
+	if(image->format == ADS_FW_LZ)
+		ads_dfu_lz_init(lz, image->data, image->size);
+	
+	// Checked again as it is sent
+	dfu->check_crc = true;
+	dfu->crc = crc;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Writes a firmware image to the ADS bootloader, decompressing a
+ *			compressed image page by page. The ADS needs to be reset into
+ *			bootloader mode prior to calling this function
+ *
+ * @param dev			ADS device
+ * @param image			Image, NULL if none
+ * @return	ADS_OK if successful, ADS_ERR_DEV_ID if image is NULL, ADS_ERR_CRC
+ *			if the image does not match its CRC, checked before the flash is
+ *			erased, or as ads_dfu_run
+ */
+int ads_dfu_update_image(ads_dev_t * dev, const ads_fw_image_t * image)
+{
+	ads_dfu_t dfu;
+	int ret_val;
+	
+	if(image != NULL && image->format == ADS_FW_LZ)
+	{
+		ads_dfu_lz_t lz;
+		
+		ret_val = ads_dfu_init_image(&dfu, image, &lz);
+		
+		return (ret_val == ADS_OK) ? ads_dfu_run(dev, &dfu) : ret_val;
+	}
+	
+	ret_val = ads_dfu_init_image(&dfu, image, NULL);
+	
+	return (ret_val == ADS_OK) ? ads_dfu_run(dev, &dfu) : ret_val;
+}
@@ -7,7 +7,11 @@
 
 /*
  * Include firmware update images for ADS_ONE_AXIS versions 1 and 2. 
- * At least one version type should be set to (1) if firmware update capabilities are desired.
+ * At least one version type should be set to (1) to use ads_dfu_update.
+ * Set both to (0) to keep the images out of flash and stream the image
+ * from a file, SD card or serial link with ads_dfu_update_stream.
+ * These options, and ADS_FW_COMPRESSED, select the images referenced by the
+ * file that sets them before including this header, see ads_dfu_image.
  * 
  * To indentify the one axis version you have, please refer to the physical one axis sensor:
  * - Sensor version 1 will have an "indentation" near pin 1.
@@ -21,8 +25,14 @@
 #define ADS_FW_INCLUDE_ADS1_V2 1 // Set this to 1 to include version 2 firmware image
 #endif
 
-#if ADS_FW_INCLUDE_ADS1_V1 == 0 && ADS_FW_INCLUDE_ADS1_V2 == 0
-#pragma message "Please enable at least one of ADS_FW_INCLUDE_ADS1_V1 or ADS_FW_INCLUDE_ADS1_V2 in your sketch"
+/*
+ * Set to (1) to include the compressed images, ads_fw_lz.cpp and ads_fw_v2_lz.cpp,
+ * in place of the raw images. They take 18% and 27% less flash, and are
+ * decompressed page by page during ads_dfu_update, which then needs another
+ * 2^ADS_DFU_LZ_WINDOW_BITS bytes of stack, see ads_dfu_lz.h.
+ */
+#ifndef ADS_FW_COMPRESSED
+#define ADS_FW_COMPRESSED 0
 #endif
 
 #include <stdint.h>
@@ -31,218 +41,326 @@
 #include "ads_err.h"
 #include "ads_hal.h"
 #include "ads_util.h"
+#include "ads_dfu_lz.h"
+#include "ads_fw.h"
 
-#if ADS_FW_INCLUDE_ADS1_V1 == 1
-	#include "ads_fw.h"
+#define ADS_BOOTLOADER_ADDRESS (0x12)
+#define ADS_DFU_PAGE_SIZE (64)			// Bootloader page, acknowledged after each
+
+/* The options below are compiled into ads_dfu.cpp, set them for the whole build */
+
+/* Longest wait for the bootloader to acknowledge the image length or a page */
+#ifndef ADS_DFU_ACK_TIMEOUT_MS
+#define ADS_DFU_ACK_TIMEOUT_MS (500)
 #endif
 
-#if ADS_FW_INCLUDE_ADS1_V2 == 1
-	#include "ads_fw_v2.h"
+/* Writes resent and acknowledgements waited for again before an update fails */
+#ifndef ADS_DFU_RETRIES
+#define ADS_DFU_RETRIES (8)
 #endif
 
-#define ADS_BOOTLOADER_ADDRESS (0x12)
+#define ADS_DFU_POLL_MIN_US (50)		// Acknowledgement poll interval once the expected time has passed
+#define ADS_DFU_POLL_MAX_US (2000)		// Poll interval backs off up to this
 
 /**
- * @brief Checks if the firmware image in the driver is newer than 
- *			the firmware on the device.
+ * @brief Firmware image reader for ads_dfu_update_stream. Fills buffer with
+ *			len bytes of the image starting at offset. Called with increasing
+ *			offsets, one page at a time.
  *
- * @param ads_dev_type	Get fw version command
- * @return	TRUE if update needed. FALSE if no updated needed
+ * @param ctx			Reader context passed to ads_dfu_update_stream
+ * @param offset		Offset into the image
+ * @param buffer[out]	Image data
+ * @param len			Bytes to read, at most ADS_DFU_PAGE_SIZE
+ * @return	ADS_OK if successful, error code to abort the update
+ */
+typedef int (*ads_dfu_reader)(void * ctx, uint32_t offset, uint8_t * buffer, uint8_t len);
+
+typedef struct ads_dfu_s ads_dfu_t;
+
+/**
+ * @brief Progress callback of ads_dfu_run, called after each acknowledged page
+ *
+ * @param dev			ADS device
+ * @param dfu			Update in progress, see done and pages
+ */
+typedef void (*ads_dfu_progress)(ads_dev_t * dev, const ads_dfu_t * dfu);
+
+/* Step of an update, see ads_dfu_step */
+typedef enum {
+	ADS_DFU_IDLE = 0,					// Not started, finished or stopped by an error
+	ADS_DFU_SEND,						// Next page to be sent
+	ADS_DFU_WAIT_ACK					// Waiting for the acknowledgement of the length or a page
+} ADS_DFU_STATE_T;
+
+/* Firmware update, prepared with ads_dfu_init and run with ads_dfu_run */
+struct ads_dfu_s {
+	uint32_t len;						// Length of the image in bytes
+	ads_dfu_reader reader;				// Image reader
+	void * ctx;							// Reader context
+	uint8_t retries;					// Retry budget of each ads_dfu_run, ADS_DFU_RETRIES by default
+	ads_dfu_progress progress;			// Progress callback, NULL for none
+	bool check_crc;						// Check the image against crc before its last page is sent
+	uint32_t crc;						// Expected CRC-32 of the image, see ads_dfu_crc32
+	void * user_data;					// Free for application use
+
+	uint32_t done;						// Bytes taken by the bootloader, where ads_dfu_run resumes
+	bool ack_pending;					// Page up to done, or the image length, not acknowledged yet
+	bool erased;						// Image length acknowledged, flash erased for the image
+	uint32_t pages;						// Pages acknowledged
+	uint32_t crc_done;					// CRC-32 of the bytes up to done
+	uint8_t retries_used;				// Retries used by the last ads_dfu_run
+	bool lost;							// A data byte was not acknowledged, the bytes taken are unknown
+	
+	/* Run state, kept by ads_dfu_step */
+	uint8_t state;						// ADS_DFU_STATE_T
+	uint8_t address;					// Application address, restored when the run ends
+	uint8_t max_write;					// Longest write of page data
+	bool learn;							// Learn the page write time from the acknowledgement waited for
+	uint32_t start_us;					// ads_hal_micros() at the start of the run
+	uint32_t wait_start_us;				// ads_hal_micros() when the acknowledgement wait started
+	uint32_t poll_us;					// Next poll, from wait_start_us
+	uint32_t missed_us;					// Last poll that missed the acknowledgement, from wait_start_us
+	uint32_t backoff_us;				// Interval to the poll after the next
+};
+
+/**
+ * @brief Continues a CRC-32 over len more bytes, the CRC of ads_fw_image_t.
+ *			Reflected polynomial 0xEDB88320, as zlib's crc32.
+ *
+ * @param crc			CRC-32 of the bytes before, 0 to start
+ * @param data[in]		Bytes
+ * @param len			Number of bytes
+ * @return	CRC-32 of the bytes so far
+ */
+uint32_t ads_dfu_crc32(uint32_t crc, const uint8_t * data, uint32_t len);
+
+/**
+ * @brief Reads the firmware version on the device, to compare with the
+ *			revision of a streamed image
+ *
+ * @param dev			ADS device
+ * @param fw_ver[out]	Firmware version
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-bool ads_dfu_check(ADS_DEV_TYPE_T ads_dev_type);
+int ads_dfu_get_fw_ver(ads_dev_t * dev, uint16_t * fw_ver);
 
 /**
  * @brief Resets the ADS into bootloader
  *
+ * @param dev			ADS device
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_dfu_reset(void);
+int ads_dfu_reset(ads_dev_t * dev);
 
 /**
- * @brief Writes firmware image, contained in ads_fw.h, to the ADS bootloader 
- *			  The ADS needs to be reset into bootloader mode prior to calling
- *				this function
+ * @brief Writes a firmware image pulled page by page from reader to the ADS
+ *			bootloader, with ADS_DFU_RETRIES retries. The ADS needs to be reset
+ *			into bootloader mode prior to calling this function
  *
- * @return	ADS_OK if successful, ADS_ERR_DEV_ID if no device support or ADS_ERR_TIMEOUT if failed
+ * @param dev			ADS device
+ * @param len			Length of the image in bytes
+ * @param reader		Image reader
+ * @param ctx			Reader context
+ * @return	ADS_OK if successful, ADS_ERR_IO, ADS_ERR_NACK_DATA or
+ *			ADS_ERR_TIMEOUT if the bootloader did not take the image, or the
+ *			error returned by reader. The timing of the
+ *			update is kept for ads_dfu_get_stats
  */
-int ads_dfu_update(ADS_DEV_TYPE_T ads_dev_type);
+int ads_dfu_update_stream(ads_dev_t * dev, uint32_t len, ads_dfu_reader reader, void * ctx);
 
+/**
+ * @brief Prepares an update of len bytes pulled from reader, starting from
+ *			the beginning of the image with the default retry budget
+ *
+ * @param dfu			Update to prepare
+ * @param len			Length of the image in bytes
+ * @param reader		Image reader
+ * @param ctx			Reader context
+ */
+void ads_dfu_init(ads_dfu_t * dfu, uint32_t len, ads_dfu_reader reader, void * ctx);
 
 /**
- * @brief Reads acknowledgment byte from the ADS bootloader
- *			(internal function).
+ * @brief Writes the image described by dfu to the ADS bootloader, from
+ *			dfu->done on, retrying writes refused at their address and late
+ *			acknowledgements. If it fails, calling it again resumes after the
+ *			last byte the bootloader took while the ADS stays in the
+ *			bootloader, unless a data byte was not acknowledged
  *
- * @return	ADS_OK if successful ADS_ERR_TIMEOUT if failed
+ * @param dev			ADS device
+ * @param dfu			Update, prepared with ads_dfu_init
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the update is complete,
+ *			ADS_ERR_IO if the bootloader kept refusing a write, ADS_ERR_NACK_DATA
+ *			if it refused a data byte, ADS_ERR_TIMEOUT if it did not
+ *			acknowledge, ADS_ERR_CRC if check_crc is set and the image read
+ *			does not match crc, or the error returned by the reader
  */
-inline int _ads_dfu_get_ack(void)
-{
-	uint8_t timeout = 254;
-	uint8_t ack = 0;
-	
-	do
-	{
-		ads_hal_read_buffer(&ack, 1);
-	} while(--timeout && ack != 's');
-	
-	if(timeout)
-		return ADS_OK;
-	else
-		return ADS_ERR_TIMEOUT;
-}
+int ads_dfu_run(ads_dev_t * dev, ads_dfu_t * dfu);
 
 /**
- * @brief Checks if the firmware image in the driver is newer than 
- *			the firmware on the device.
+ * @brief Advances the update described by dfu by one bus transaction without
+ *			waiting, for updating several ADS on independent buses at once.
+ *			ads_dfu_run calls it until it returns other than
+ *			ADS_ERR_OP_IN_PROGRESS, sleeping wait_us between calls
+ *
+ * @param dev			ADS device
+ * @param dfu			Update, prepared with ads_dfu_init
+ * @param wait_us[out]	Time until the next call has work to do
+ * @return	ADS_ERR_OP_IN_PROGRESS while the update goes on, else as ads_dfu_run
+ */
+int ads_dfu_step(ads_dev_t * dev, ads_dfu_t * dfu, uint32_t * wait_us);
+
+/**
+ * @brief Gets the timing of the last firmware update of the device
+ *
+ * @param dev			ADS device
+ * @param stats[out]	Timing of the last update
+ */
+void ads_dfu_get_stats(ads_dev_t * dev, ads_dfu_stats_t * stats);
+
+/**
+ * @brief Predicts how long writing an image of len bytes to the device takes,
+ *			from the timing of its last firmware update
+ *
+ * @param dev			ADS device
+ * @param len			Length of the image in bytes
+ * @return	Predicted time in microseconds, 0 if no update has been timed
+ */
+uint32_t ads_dfu_estimate_us(ads_dev_t * dev, uint32_t len);
+
+/**
+ * @brief Image reader over an image in memory, ctx points to the image.
+ *			For the compiled in images, or a file mapped with mmap.
+ */
+int ads_dfu_mem_reader(void * ctx, uint32_t offset, uint8_t * buffer, uint8_t len);
+
+/**
+ * @brief Writes a compressed firmware image, see ads_dfu_lz.h, to the ADS
+ *			bootloader, decompressing it page by page. The ADS needs to be
+ *			reset into bootloader mode prior to calling this function
+ *
+ * @param dev			ADS device
+ * @param image[in]		Compressed image
+ * @param len			Length of the compressed image
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if image is not a
+ *			compressed image, ADS_ERR if it is corrupt or ADS_ERR_TIMEOUT if failed
+ */
+int ads_dfu_update_lz(ads_dev_t * dev, const uint8_t * image, uint32_t len);
+
+
+/**
+ * @brief Checks if a firmware image is newer than the firmware on the device
  *
- * @param ads_get_fw_ver	Get fw version command
+ * @param dev			ADS device
+ * @param image			Image, NULL if none
  * @return	TRUE if update needed. FALSE if no updated needed
  */
-inline bool ads_dfu_check(ADS_DEV_TYPE_T ads_dev_type)
+bool ads_dfu_check_image(ads_dev_t * dev, const ads_fw_image_t * image);
+
+/**
+ * @brief Prepares an update with a firmware image, after reading it through
+ *			once to check it against its CRC
+ *
+ * @param dfu			Update to prepare
+ * @param image			Image, NULL if none
+ * @param lz			Decoder of a compressed image, must stay valid during
+ *						the update, unused for a raw image
+ * @return	ADS_OK if successful, ADS_ERR_DEV_ID if image is NULL,
+ *			ADS_ERR_BAD_PARAM if a compressed image is invalid or lz is NULL,
+ *			ADS_ERR_CRC if the image does not match its CRC
+ */
+int ads_dfu_init_image(ads_dfu_t * dfu, const ads_fw_image_t * image, ads_dfu_lz_t * lz);
+
+/**
+ * @brief Writes a firmware image to the ADS bootloader, decompressing a
+ *			compressed image page by page. The ADS needs to be reset into
+ *			bootloader mode prior to calling this function
+ *
+ * @param dev			ADS device
+ * @param image			Image, NULL if none
+ * @return	ADS_OK if successful, ADS_ERR_DEV_ID if image is NULL, ADS_ERR_CRC
+ *			if the image does not match its CRC, checked before the flash is
+ *			erased, or as ads_dfu_run
+ */
+int ads_dfu_update_image(ads_dev_t * dev, const ads_fw_image_t * image);
+
+/* Image to update a device type with, NULL if none, see ads_dfu_image */
+typedef const ads_fw_image_t * (*ads_dfu_image_lookup)(ADS_DEV_TYPE_T ads_dev_type);
+
+/**
+ * @brief Image for the device type selected by ADS_FW_INCLUDE_ADS1_V1,
+ *			ADS_FW_INCLUDE_ADS1_V2 and ADS_FW_COMPRESSED as set where this
+ *			header is included. Only the images referenced here are linked
+ *
+ * @param ads_dev_type	Device type
+ * @return	Image, NULL if none is included for the device type
+ */
+static inline const ads_fw_image_t * ads_dfu_image(ADS_DEV_TYPE_T ads_dev_type)
 {
-	uint8_t buffer[] = {ADS_GET_FW_VER, 0, 0};
-	uint16_t fw_ver;
-	
-	ads_hal_pin_int_enable(false);
-	
-	ads_hal_write_buffer(buffer, ADS_TRANSFER_SIZE);
-	ads_hal_delay(2);
-	ads_hal_read_buffer(buffer, ADS_TRANSFER_SIZE);
-	
-	ads_hal_pin_int_enable(true);
-	
-	if(buffer[0] == ADS_FW_VER)
-		fw_ver = ads_uint16_decode(&buffer[1]);
-	else
-		return false;
-		
 #if ADS_FW_INCLUDE_ADS1_V1 == 1
-	if (ads_dev_type == ADS_DEV_ONE_AXIS_V1)
-		return fw_ver < ads_fw_rev;
+	if(ads_dev_type == ADS_DEV_ONE_AXIS_V1)
+	#if ADS_FW_COMPRESSED == 1
+		return &ads_fw_lz_image;
+	#else
+		return &ads_fw_image;
+	#endif
 #endif
-	
+
 #if ADS_FW_INCLUDE_ADS1_V2 == 1
-	if (ads_dev_type == ADS_DEV_ONE_AXIS_V2)
-		return fw_ver < ads_fw_v2_rev;
+	if(ads_dev_type == ADS_DEV_ONE_AXIS_V2)
+	#if ADS_FW_COMPRESSED == 1
+		return &ads_fw_v2_lz_image;
+	#else
+		return &ads_fw_v2_image;
+	#endif
 #endif
 
-	return false;
+	(void)ads_dev_type;
+	
+	return NULL;
 }
 
 /**
- * @brief Resets the ADS into bootloader mode
+ * @brief Checks if the firmware image in the driver is newer than 
+ *			the firmware on the device.
  *
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @param dev			ADS device
+ * @param ads_dev_type	Get fw version command
+ * @return	TRUE if update needed. FALSE if no updated needed
  */
-inline int ads_dfu_reset(void)
+static inline bool ads_dfu_check(ads_dev_t * dev, ADS_DEV_TYPE_T ads_dev_type)
 {
-	uint8_t packet[ADS_TRANSFER_SIZE];
-	 
-	packet[0] = ADS_DFU;
-	packet[1] = packet[2] = 0;
-	 
-	return ads_hal_write_buffer(packet, ADS_TRANSFER_SIZE);
+	return ads_dfu_check_image(dev, ads_dfu_image(ads_dev_type));
 }
- 
- /**
- * @brief Writes firmware image to ADS contained in ads_fw.h
+
+/**
+ * @brief Prepares an update with the image in ads_fw.cpp or ads_fw_v2.cpp for
+ *			the device type, or their compressed versions
  *
- * @return	ADS_OK if successful, ADS_ERR_DEV_ID if no device support or ADS_ERR_TIMEOUT if failed
+ * @param dfu			Update to prepare
+ * @param ads_dev_type	Device type
+ * @param lz			Decoder of a compressed image, must stay valid during
+ *						the update, unused unless ADS_FW_COMPRESSED is set
+ * @return	ADS_OK if successful, ADS_ERR_DEV_ID if no image is included for
+ *			the device type, ADS_ERR_BAD_PARAM if the compressed image is invalid,
+ *			ADS_ERR_CRC if the image does not match its CRC
  */
-inline int ads_dfu_update(ADS_DEV_TYPE_T ads_dev_type)
+static inline int ads_dfu_init_fw(ads_dfu_t * dfu, ADS_DEV_TYPE_T ads_dev_type, ads_dfu_lz_t * lz)
 {
-	const uint8_t * fw = NULL;
-	uint32_t len = 0;
-	
-#if ADS_FW_INCLUDE_ADS1_V1 == 1
-	if (ads_dev_type == ADS_DEV_ONE_AXIS_V1)
-	{
-		fw = ads_fw;
-		len = sizeof(ads_fw);
-	}
-#endif
-	
-#if ADS_FW_INCLUDE_ADS1_V2 == 1
-	if (ads_dev_type == ADS_DEV_ONE_AXIS_V2)
-	{
-		fw = ads_fw_v2;
-		len = sizeof(ads_fw_v2);
-	}
-#endif
+	return ads_dfu_init_image(dfu, ads_dfu_image(ads_dev_type), lz);
+}
 
-	if (fw == NULL || len == 0)
-		return ADS_ERR_DEV_ID;
-	
-	uint8_t page_size = 64;
-	uint8_t block_len = page_size;
-	
-	uint8_t packet[page_size];
-	
-	// Store a local copy of the current i2c address
-	uint8_t address = ads_hal_get_address();
-	
-	// Set the i2c address to the booloader address
-	ads_hal_set_address(ADS_BOOTLOADER_ADDRESS);
-	
-	// Transmit the length of the new firmware to the bootloader
-	packet[0] = (uint8_t)(len & 0xff);
-	packet[1] = (uint8_t)((len >> 8) & 0xff);
-	packet[2] = (uint8_t)((len>>16) & 0xff);
-	packet[3] = (uint8_t)((len>>24) & 0xff);
-	
-	ads_hal_write_buffer(packet, 4);
-	
-	// Get acknowledgement of the fw length
-	if(_ads_dfu_get_ack() != ADS_OK)
-	{
-		// restore i2c address
-		ads_hal_set_address(address);		
-		return ADS_ERR_TIMEOUT;
-	}
-	
-	// Transfer the new firmware image
-	uint32_t nb_blocks = len/block_len;
-	uint32_t rem_data  = len % block_len;
-	
-	for(uint32_t i = 0; i < nb_blocks; i++)
-	{
-		// Copy the next page
-		memcpy(packet, &fw[i*page_size], page_size);
-		
-		// Send the page
-		ads_hal_write_buffer(packet, page_size/2);
-		ads_hal_write_buffer(&packet[page_size/2], page_size/2);
-		
-		// Get acknowledgement of the recieved page
-		if(_ads_dfu_get_ack() != ADS_OK)
-		{
-			// restore i2c address
-			ads_hal_set_address(address);
-			return ADS_ERR_TIMEOUT;
-		}
-	}
-	
-	// Transfer the remainder and get acknowledgement
-	memcpy(packet, &fw[nb_blocks*block_len], rem_data);
-	
-	if(rem_data > page_size/2)
-	{
-		ads_hal_write_buffer(packet, page_size/2);
-		ads_hal_write_buffer(&packet[page_size/2], rem_data - page_size/2);
-	}
-	else
-		ads_hal_write_buffer(packet, rem_data);
-	
-	if(_ads_dfu_get_ack() != ADS_OK)
-	{
-		// restore i2c address
-		ads_hal_set_address(address);		
-		return ADS_ERR_TIMEOUT;
-	}
-	
-	// restore i2c address
-	ads_hal_set_address(address);
-	
-	return ADS_OK;
+/**
+ * @brief Writes firmware image, contained in ads_fw.cpp, to the ADS bootloader 
+ *			  The ADS needs to be reset into bootloader mode prior to calling
+ *				this function
+ *
+ * @param dev			ADS device
+ * @return	ADS_OK if successful, ADS_ERR_DEV_ID if no device support, ADS_ERR_CRC
+ *			if the image is corrupt or ADS_ERR_TIMEOUT if failed
+ */
+static inline int ads_dfu_update(ads_dev_t * dev, ADS_DEV_TYPE_T ads_dev_type)
+{
+	return ads_dfu_update_image(dev, ads_dfu_image(ads_dev_type));
 }
 
 #endif /* ADS_DFU_ */
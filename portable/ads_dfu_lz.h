@@ -0,0 +1,194 @@
+/**
+ * ads_dfu_lz.h
+ *
+ * Compressed firmware images for ads_dfu_update_stream. Images are LZSS
+ * compressed on the host by portable/tools/ads_fw_pack.c and decompressed one
+ * bootloader page at a time while they are written, so only the compressed
+ * image is kept in flash. The decoder needs a history window in RAM of
+ * 2^ADS_DFU_LZ_WINDOW_BITS bytes and a few bytes of state.
+ *
+ * Image format, multi byte fields little endian:
+ *	"ADZ"					Magic
+ *	window bits				log2 of the history window the image was compressed with
+ *	uint32_t length			Length of the decompressed image
+ *	groups					A flag byte, then up to 8 items, one per flag bit
+ *							starting from the least significant bit. A set bit is
+ *							a literal byte, a clear bit a uint16_t match token:
+ *							the upper window bits hold distance - 1, the lower
+ *							bits length - ADS_DFU_LZ_MIN_MATCH
+ */
+
+#ifndef ADS_DFU_LZ_H_
+#define ADS_DFU_LZ_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ads_err.h"
+
+/* History window of the decoder, images compressed with a larger window are rejected */
+#ifndef ADS_DFU_LZ_WINDOW_BITS
+#define ADS_DFU_LZ_WINDOW_BITS		(10)
+#endif
+
+#define ADS_DFU_LZ_WINDOW			(1 << ADS_DFU_LZ_WINDOW_BITS)
+#define ADS_DFU_LZ_HEADER_SIZE		(8)
+#define ADS_DFU_LZ_MIN_MATCH		(3)		// Shortest match, length field 0
+
+/* Decoder state, one per image being written */
+typedef struct {
+	const uint8_t * src;				// Compressed image
+	uint32_t src_len;					// Length of the compressed image
+	uint32_t src_pos;					// Next byte of src to decode
+	uint32_t len;						// Length of the decompressed image
+	uint32_t pos;						// Bytes decompressed so far
+	uint8_t window_bits;				// Window bits of the image
+	uint8_t flags;						// Remaining flag bits of the current group
+	uint8_t flag_count;					// Items left in the current group
+	uint16_t match_len;					// Bytes left to copy of the current match
+	uint16_t match_dist;				// Distance back of the current match
+	uint8_t window[ADS_DFU_LZ_WINDOW];	// Last decompressed bytes, indexed by pos
+} ads_dfu_lz_t;
+
+/**
+ * @brief Prepares the decoder for a compressed image
+ *
+ * @param lz			Decoder
+ * @param image[in]		Compressed image, must stay valid during the update
+ * @param len			Length of the compressed image
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if image is not a
+ *			compressed image or needs a larger window than ADS_DFU_LZ_WINDOW_BITS
+ */
+static inline int ads_dfu_lz_init(ads_dfu_lz_t * lz, const uint8_t * image, uint32_t len)
+{
+	if(lz == NULL || image == NULL || len < ADS_DFU_LZ_HEADER_SIZE)
+		return ADS_ERR_BAD_PARAM;
+
+	if(image[0] != 'A' || image[1] != 'D' || image[2] != 'Z')
+		return ADS_ERR_BAD_PARAM;
+
+	if(image[3] < 1 || image[3] > ADS_DFU_LZ_WINDOW_BITS || image[3] > 15)
+		return ADS_ERR_BAD_PARAM;
+
+	lz->src = image;
+	lz->src_len = len;
+	lz->src_pos = ADS_DFU_LZ_HEADER_SIZE;
+	lz->len = (uint32_t)image[4] | ((uint32_t)image[5] << 8) |
+			  ((uint32_t)image[6] << 16) | ((uint32_t)image[7] << 24);
+	lz->pos = 0;
+	lz->window_bits = image[3];
+	lz->flags = 0;
+	lz->flag_count = 0;
+	lz->match_len = 0;
+	lz->match_dist = 0;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Length of the decompressed image, the length to pass to
+ *			ads_dfu_update_stream
+ */
+static inline uint32_t ads_dfu_lz_length(const ads_dfu_lz_t * lz)
+{
+	return lz->len;
+}
+
+/**
+ * @brief Image reader for ads_dfu_update_stream decompressing the image
+ *			prepared by ads_dfu_lz_init, ctx points to the decoder. The image
+ *			is decompressed once, so reads go back no further than the window.
+ *			Reads further on skip ahead. Both let an update resume.
+ *
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if offset is out of the
+ *			window or past the end, ADS_ERR if the compressed image is corrupt
+ */
+static inline int ads_dfu_lz_reader(void * ctx, uint32_t offset, uint8_t * buffer, uint8_t len)
+{
+	ads_dfu_lz_t * lz = (ads_dfu_lz_t *)ctx;
+	uint8_t length_bits = 16 - lz->window_bits;
+
+	if(offset > lz->len || len > lz->len - offset || (offset < lz->pos && lz->pos - offset > ADS_DFU_LZ_WINDOW))
+		return ADS_ERR_BAD_PARAM;
+
+	// Bytes already decompressed are still in the window
+	while(len && offset < lz->pos)
+	{
+		*buffer++ = lz->window[offset & (ADS_DFU_LZ_WINDOW - 1)];
+		offset++;
+		len--;
+	}
+
+	if(len == 0)
+		return ADS_OK;
+
+	// Decompress up to offset, into the buffer, which is overwritten after
+	while(lz->pos < offset)
+	{
+		uint32_t skip = offset - lz->pos;
+		int ret_val = ads_dfu_lz_reader(ctx, lz->pos, buffer, (skip < len) ? (uint8_t)skip : len);
+
+		if(ret_val != ADS_OK)
+			return ret_val;
+	}
+
+	while(len)
+	{
+		uint8_t byte;
+
+		if(lz->match_len)
+		{
+			// Copy from history, matches may overlap the bytes they produce
+			byte = lz->window[(lz->pos - lz->match_dist) & (ADS_DFU_LZ_WINDOW - 1)];
+			lz->match_len--;
+		}
+		else
+		{
+			if(lz->flag_count == 0)
+			{
+				if(lz->src_pos >= lz->src_len)
+					return ADS_ERR;
+
+				lz->flags = lz->src[lz->src_pos++];
+				lz->flag_count = 8;
+			}
+
+			bool literal = lz->flags & 1;
+			lz->flags >>= 1;
+			lz->flag_count--;
+
+			if(literal)
+			{
+				if(lz->src_pos >= lz->src_len)
+					return ADS_ERR;
+
+				byte = lz->src[lz->src_pos++];
+			}
+			else
+			{
+				if(lz->src_len - lz->src_pos < 2)
+					return ADS_ERR;
+
+				uint16_t token = (uint16_t)lz->src[lz->src_pos] | ((uint16_t)lz->src[lz->src_pos + 1] << 8);
+				lz->src_pos += 2;
+
+				lz->match_dist = (token >> length_bits) + 1;
+				lz->match_len = (token & ((1 << length_bits) - 1)) + ADS_DFU_LZ_MIN_MATCH;
+
+				if(lz->match_dist > lz->pos)
+					return ADS_ERR;
+
+				continue;
+			}
+		}
+
+		lz->window[lz->pos & (ADS_DFU_LZ_WINDOW - 1)] = byte;
+		lz->pos++;
+		*buffer++ = byte;
+		len--;
+	}
+
+	return ADS_OK;
+}
+
+#endif /* ADS_DFU_LZ_H_ */
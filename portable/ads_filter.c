@@ -0,0 +1,263 @@
+/**
+ * ads_filter.c
+ *
+ * Rate aware Butterworth filters as cascaded biquads
+ */
+
+#include "ads_filter.h"
+
+#define ADS_FILTER_PI			(3.14159265f)
+
+/**
+ * @brief Designs the filter for a sample period and settles its state at the
+ *			last input, passing samples through if the period is unknown
+ */
+static void ads_filter_redesign(ads_filter_t * filter, uint32_t period_us)
+{
+	filter->period_us = period_us;
+	filter->stages = 0;
+	
+	if(period_us)
+		filter->stages = ads_filter_design((ADS_FILTER_TYPE_T)filter->type, filter->order, filter->cutoff_hz,
+										   1000000.0f / period_us, filter->coef);
+	
+	if(filter->settled)
+		ads_filter_reset(filter, filter->last);
+}
+
+/**
+ * @brief Designs a Butterworth filter as cascaded biquads, the first order
+ *			section of an odd order last
+ *
+ * @param type			ADS_FILTER_LOWPASS or ADS_FILTER_HIGHPASS
+ * @param order			Filter order, 1 to ADS_FILTER_MAX_ORDER
+ * @param cutoff_hz		Cutoff frequency, limited to ADS_FILTER_MAX_CUTOFF * sample_hz
+ * @param sample_hz		Sample rate
+ * @param coef[out]		Biquads, (order + 1) / 2 of them
+ * @return	Number of biquads designed, 0 if a parameter is out of range
+ */
+uint8_t ads_filter_design(ADS_FILTER_TYPE_T type, uint8_t order, float cutoff_hz, float sample_hz, ads_biquad_t * coef)
+{
+	uint8_t i;
+	
+	if(order == 0 || order > ADS_FILTER_MAX_ORDER || !(cutoff_hz > 0) || !(sample_hz > 0) ||
+	   (type != ADS_FILTER_LOWPASS && type != ADS_FILTER_HIGHPASS))
+		return 0;
+	
+	if(cutoff_hz > ADS_FILTER_MAX_CUTOFF * sample_hz)
+		cutoff_hz = ADS_FILTER_MAX_CUTOFF * sample_hz;
+	
+	// Bilinear transform, prewarped to put the cutoff where it was designed
+	float k = tanf(ADS_FILTER_PI * cutoff_hz / sample_hz);
+	float k2 = k * k;
+	
+	// Pole pairs of the Butterworth polynomial, each a second order section,
+	// at angles from the negative real axis of (2i + 1) pi / 2N, or of
+	// (i + 1) pi / N next to the real pole of an odd order
+	for(i = 0; i < order / 2; i++)
+	{
+		float q = 1.0f / (2.0f * cosf(ADS_FILTER_PI * (2 * i + 1 + (order & 1)) / (2 * order)));
+		float norm = 1.0f / (1.0f + k / q + k2);
+		
+		if(type == ADS_FILTER_LOWPASS)
+		{
+			coef[i].b0 = k2 * norm;
+			coef[i].b1 = 2.0f * coef[i].b0;
+		}
+		else
+		{
+			coef[i].b0 = norm;
+			coef[i].b1 = -2.0f * norm;
+		}
+		
+		coef[i].b2 = coef[i].b0;
+		coef[i].a1 = 2.0f * (k2 - 1.0f) * norm;
+		coef[i].a2 = (1.0f - k / q + k2) * norm;
+	}
+	
+	// Real pole of an odd order, a first order section
+	if(order & 1)
+	{
+		float norm = 1.0f / (1.0f + k);
+		
+		coef[i].b0 = (type == ADS_FILTER_LOWPASS) ? k * norm : norm;
+		coef[i].b1 = (type == ADS_FILTER_LOWPASS) ? coef[i].b0 : -coef[i].b0;
+		coef[i].b2 = 0;
+		coef[i].a1 = (k - 1.0f) * norm;
+		coef[i].a2 = 0;
+		i++;
+	}
+	
+	return i;
+}
+
+/**
+ * @brief Initializes a filter for a fixed sample rate
+ *
+ * @param filter		Filter
+ * @param type			ADS_FILTER_LOWPASS or ADS_FILTER_HIGHPASS
+ * @param order			Filter order, 1 to ADS_FILTER_MAX_ORDER
+ * @param cutoff_hz		Cutoff frequency
+ * @param sample_hz		Sample rate, e.g. the polling rate in polled mode
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_filter_init(ads_filter_t * filter, ADS_FILTER_TYPE_T type, uint8_t order, float cutoff_hz, float sample_hz)
+{
+	memset(filter, 0, sizeof(*filter));
+	
+	filter->type = type;
+	filter->order = order;
+	filter->cutoff_hz = cutoff_hz;
+	
+	return ads_filter_set_rate(filter, sample_hz);
+}
+
+/**
+ * @brief Initializes a filter following the sample rate of a device in
+ *			interrupt mode. The filter is designed for dev->sample_period_us,
+ *			and again by ads_filter_apply when ads_set_sample_rate changes it.
+ *			Samples pass through until the device has a sample rate.
+ *
+ * @param filter		Filter
+ * @param type			ADS_FILTER_LOWPASS or ADS_FILTER_HIGHPASS
+ * @param order			Filter order, 1 to ADS_FILTER_MAX_ORDER
+ * @param cutoff_hz		Cutoff frequency
+ * @param dev			ADS device
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_filter_init_dev(ads_filter_t * filter, ADS_FILTER_TYPE_T type, uint8_t order, float cutoff_hz, ads_dev_t * dev)
+{
+	ads_biquad_t coef[ADS_FILTER_MAX_STAGES];
+	
+	// Check the design at any rate the cutoff fits
+	if(dev == NULL || ads_filter_design(type, order, cutoff_hz, cutoff_hz * 4, coef) == 0)
+		return ADS_ERR_BAD_PARAM;
+	
+	memset(filter, 0, sizeof(*filter));
+	
+	filter->type = type;
+	filter->order = order;
+	filter->cutoff_hz = cutoff_hz;
+	filter->dev = dev;
+	
+	ads_filter_redesign(filter, dev->sample_period_us);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Initializes a filter with fixed coefficients, e.g. made with
+ *			ADS_FILTER_LOWPASS_BIQUAD
+ *
+ * @param filter		Filter
+ * @param coef[in]		Biquads, copied
+ * @param stages		Number of biquads, 1 to ADS_FILTER_MAX_STAGES
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if stages is out of range
+ */
+int ads_filter_init_biquads(ads_filter_t * filter, const ads_biquad_t * coef, uint8_t stages)
+{
+	if(stages == 0 || stages > ADS_FILTER_MAX_STAGES)
+		return ADS_ERR_BAD_PARAM;
+	
+	memset(filter, 0, sizeof(*filter));
+	memcpy(filter->coef, coef, stages * sizeof(ads_biquad_t));
+	
+	filter->stages = stages;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Designs the filter again for another sample rate and stops
+ *			following the device, if any. The state is settled at the last
+ *			input, so the output does not jump.
+ *
+ * @param filter		Filter, initialized with ads_filter_init or ads_filter_init_dev
+ * @param sample_hz		Sample rate
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the filter has fixed
+ *			coefficients or sample_hz is not positive
+ */
+int ads_filter_set_rate(ads_filter_t * filter, float sample_hz)
+{
+	ads_biquad_t coef[ADS_FILTER_MAX_STAGES];
+	uint8_t stages = ads_filter_design((ADS_FILTER_TYPE_T)filter->type, filter->order, filter->cutoff_hz, sample_hz, coef);
+	
+	if(stages == 0)
+		return ADS_ERR_BAD_PARAM;
+	
+	memcpy(filter->coef, coef, sizeof(coef));
+	
+	filter->dev = NULL;
+	filter->period_us = (uint32_t)(1000000.0f / sample_hz + 0.5f);
+	filter->stages = stages;
+	
+	if(filter->settled)
+		ads_filter_reset(filter, filter->last);
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Settles the filter as if value had been its input forever
+ *
+ * @param filter		Filter
+ * @param value			Constant input
+ */
+void ads_filter_reset(ads_filter_t * filter, float value)
+{
+	uint8_t i;
+	
+	filter->last = value;
+	filter->settled = true;
+	
+	for(i = 0; i < filter->stages; i++)
+	{
+		const ads_biquad_t * c = &filter->coef[i];
+		float den = 1.0f + c->a1 + c->a2;
+		
+		// Output of the section for a constant input, its DC gain times value
+		float out = (den != 0) ? (c->b0 + c->b1 + c->b2) / den * value : 0;
+		
+		filter->z[i][1] = c->b2 * value - c->a2 * out;
+		filter->z[i][0] = c->b1 * value - c->a1 * out + filter->z[i][1];
+		
+		value = out;
+	}
+}
+
+/**
+ * @brief Filters one sample. The first sample settles the state, so the
+ *			output starts there instead of rising from 0. A filter following
+ *			a device whose sample rate changed is designed again first, in
+ *			the caller's context.
+ *
+ * @param filter		Filter
+ * @param sample		New input sample
+ * @return	filtered sample
+ */
+float ads_filter_apply(ads_filter_t * filter, float sample)
+{
+	uint8_t i;
+	
+	if(filter->dev != NULL && filter->dev->sample_period_us != filter->period_us)
+		ads_filter_redesign(filter, filter->dev->sample_period_us);
+	
+	if(!filter->settled)
+		ads_filter_reset(filter, sample);
+	
+	filter->last = sample;
+	
+	for(i = 0; i < filter->stages; i++)
+	{
+		const ads_biquad_t * c = &filter->coef[i];
+		float * z = filter->z[i];
+		float out = c->b0 * sample + z[0];
+		
+		z[0] = c->b1 * sample - c->a1 * out + z[1];
+		z[1] = c->b2 * sample - c->a2 * out;
+		
+		sample = out;
+	}
+	
+	return sample;
+}
@@ -0,0 +1,207 @@
+/**
+ * ads_filter_bank.c
+ *
+ * Filter bank with structure of arrays state and vector kernels
+ */
+
+#include "ads_filter_bank.h"
+
+/*
+ * Vector operations of the kernel, BANK_LANES channels each. Compilers
+ * define the feature macros from the target options, e.g. -mavx or
+ * -mcpu=cortex-m55, so the widest unit the build targets is used.
+ */
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BANK_KERNEL				"avx"
+#define BANK_LANES				(8)
+typedef __m256 bank_vec_t;
+#define bank_load(p)			_mm256_loadu_ps(p)
+#define bank_store(p, v)		_mm256_storeu_ps((p), (v))
+#define bank_set1(x)			_mm256_set1_ps(x)
+#define bank_add(a, b)			_mm256_add_ps((a), (b))
+#define bank_sub(a, b)			_mm256_sub_ps((a), (b))
+#define bank_mul(a, b)			_mm256_mul_ps((a), (b))
+#elif defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define BANK_KERNEL				"sse"
+#define BANK_LANES				(4)
+typedef __m128 bank_vec_t;
+#define bank_load(p)			_mm_loadu_ps(p)
+#define bank_store(p, v)		_mm_storeu_ps((p), (v))
+#define bank_set1(x)			_mm_set1_ps(x)
+#define bank_add(a, b)			_mm_add_ps((a), (b))
+#define bank_sub(a, b)			_mm_sub_ps((a), (b))
+#define bank_mul(a, b)			_mm_mul_ps((a), (b))
+#elif defined(__ARM_NEON) || (defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2))
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BANK_KERNEL				"neon"
+#else
+#include <arm_mve.h>
+#define BANK_KERNEL				"helium"
+#endif
+#define BANK_LANES				(4)
+typedef float32x4_t bank_vec_t;
+#define bank_load(p)			vld1q_f32(p)
+#define bank_store(p, v)		vst1q_f32((p), (v))
+#define bank_set1(x)			vdupq_n_f32(x)
+#define bank_add(a, b)			vaddq_f32((a), (b))
+#define bank_sub(a, b)			vsubq_f32((a), (b))
+#define bank_mul(a, b)			vmulq_f32((a), (b))
+#else
+#define BANK_KERNEL				"scalar"
+#define BANK_LANES				(1)
+#endif
+
+/**
+ * @brief Settles every channel at its last input, see ads_filter_reset
+ */
+static void bank_settle(ads_filter_bank_t * bank)
+{
+	uint8_t s, c;
+	
+	for(c = 0; c < bank->channels; c++)
+	{
+		float value = bank->last[c];
+		
+		for(s = 0; s < bank->design.stages; s++)
+		{
+			const ads_biquad_t * k = &bank->design.coef[s];
+			float den = 1.0f + k->a1 + k->a2;
+			float out = (den != 0) ? (k->b0 + k->b1 + k->b2) / den * value : 0;
+			
+			bank->z1[s][c] = k->b2 * value - k->a2 * out;
+			bank->z0[s][c] = k->b1 * value - k->a1 * out + bank->z1[s][c];
+			
+			value = out;
+		}
+	}
+	
+	bank->settled = true;
+}
+
+/**
+ * @brief Initializes a bank filtering channels with one design
+ *
+ * @param bank			Filter bank
+ * @param channels		Channels, 1 to ADS_FILTER_BANK_MAX_CHANNELS
+ * @param design		Filter initialized with ads_filter_init, ads_filter_init_dev
+ *						or ads_filter_init_biquads, copied. A design following a
+ *						device is designed again when its sample rate changes.
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if channels is out of range
+ */
+int ads_filter_bank_init(ads_filter_bank_t * bank, uint8_t channels, const ads_filter_t * design)
+{
+	if(channels == 0 || channels > ADS_FILTER_BANK_MAX_CHANNELS)
+		return ADS_ERR_BAD_PARAM;
+	
+	memset(bank, 0, sizeof(*bank));
+	memcpy(&bank->design, design, sizeof(bank->design));
+	
+	bank->channels = channels;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Settles every channel as if its value had been its input forever
+ *
+ * @param bank			Filter bank
+ * @param values		Constant input of each channel
+ */
+void ads_filter_bank_reset(ads_filter_bank_t * bank, const float * values)
+{
+	memcpy(bank->last, values, bank->channels * sizeof(float));
+	
+	bank_settle(bank);
+}
+
+/**
+ * @brief Filters one sample of every channel. The first samples settle the
+ *			state, as for ads_filter_apply.
+ *
+ * @param bank			Filter bank
+ * @param samples		One sample per channel, replaced by the filtered samples
+ */
+void ads_filter_bank_apply(ads_filter_bank_t * bank, float * samples)
+{
+	ads_filter_t * design = &bank->design;
+	uint8_t n = bank->channels;
+	uint8_t s, c = 0;
+	
+	// Designed again for a new sample rate, settled at the last inputs
+	if(design->dev != NULL && design->dev->sample_period_us != design->period_us)
+	{
+		ads_filter_init_dev(design, (ADS_FILTER_TYPE_T)design->type, design->order, design->cutoff_hz, design->dev);
+		
+		if(bank->settled)
+			bank_settle(bank);
+	}
+	
+	// The kernels keep the inputs in bank->last as they load them
+	if(!bank->settled)
+	{
+		memcpy(bank->last, samples, n * sizeof(float));
+		bank_settle(bank);
+	}
+	
+#if BANK_LANES > 1
+	// Whole vectors of channels, each through every section
+	for(; c + BANK_LANES <= n; c += BANK_LANES)
+	{
+		bank_vec_t x = bank_load(&samples[c]);
+		
+		bank_store(&bank->last[c], x);
+		
+		for(s = 0; s < design->stages; s++)
+		{
+			const ads_biquad_t * k = &design->coef[s];
+			bank_vec_t z0 = bank_load(&bank->z0[s][c]);
+			bank_vec_t z1 = bank_load(&bank->z1[s][c]);
+			bank_vec_t y = bank_add(bank_mul(bank_set1(k->b0), x), z0);
+			
+			z0 = bank_add(bank_sub(bank_mul(bank_set1(k->b1), x), bank_mul(bank_set1(k->a1), y)), z1);
+			z1 = bank_sub(bank_mul(bank_set1(k->b2), x), bank_mul(bank_set1(k->a2), y));
+			
+			bank_store(&bank->z0[s][c], z0);
+			bank_store(&bank->z1[s][c], z1);
+			x = y;
+		}
+		
+		bank_store(&samples[c], x);
+	}
+#endif
+
+	// Channels left over, section by section so the loops vectorize where they can
+	for(uint8_t i = c; i < n; i++)
+		bank->last[i] = samples[i];
+	
+	for(s = 0; s < design->stages && c < n; s++)
+	{
+		const ads_biquad_t k = design->coef[s];
+		float * z0 = bank->z0[s];
+		float * z1 = bank->z1[s];
+		uint8_t i;
+		
+		for(i = c; i < n; i++)
+		{
+			float x = samples[i];
+			float y = k.b0 * x + z0[i];
+			
+			z0[i] = k.b1 * x - k.a1 * y + z1[i];
+			z1[i] = k.b2 * x - k.a2 * y;
+			samples[i] = y;
+		}
+	}
+}
+
+/**
+ * @brief Name of the kernel the bank was built with
+ *
+ * @return	"avx", "sse", "neon", "helium" or "scalar"
+ */
+const char * ads_filter_bank_kernel(void)
+{
+	return BANK_KERNEL;
+}
@@ -0,0 +1,74 @@
+/**
+ * ads_filter_bank.h
+ *
+ * One ads_filter design applied to many channels at once, e.g. every bend
+ * and stretch channel of a glove. The state is kept structure of arrays,
+ * one array of channels per biquad state variable, so one sample of every
+ * channel is filtered by a kernel stepping several channels per
+ * instruction: AVX or SSE on x86, NEON or Helium on ARM, plain C elsewhere.
+ * The coefficients are shared by every channel and loaded once per block
+ * of channels, so the cost per channel falls as channels are added.
+ */
+
+#ifndef ADS_FILTER_BANK_H_
+#define ADS_FILTER_BANK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ads.h"
+#include "ads_filter.h"
+
+/* Channels per bank, a multiple of 8 keeps every kernel on full vectors */
+#ifndef ADS_FILTER_BANK_MAX_CHANNELS
+#define ADS_FILTER_BANK_MAX_CHANNELS	(40)
+#endif
+
+typedef struct {
+	ads_filter_t design;				// Design shared by the channels, following its device if any
+	uint8_t channels;					// Channels filtered
+
+	/* State of each biquad, structure of arrays */
+	float z0[ADS_FILTER_MAX_STAGES][ADS_FILTER_BANK_MAX_CHANNELS];
+	float z1[ADS_FILTER_MAX_STAGES][ADS_FILTER_BANK_MAX_CHANNELS];
+	float last[ADS_FILTER_BANK_MAX_CHANNELS];	// Last input, the state is settled at after a redesign
+	bool settled;						// State settled, at the first inputs unless ads_filter_bank_reset
+} ads_filter_bank_t;
+
+/**
+ * @brief Initializes a bank filtering channels with one design
+ *
+ * @param bank			Filter bank
+ * @param channels		Channels, 1 to ADS_FILTER_BANK_MAX_CHANNELS
+ * @param design		Filter initialized with ads_filter_init, ads_filter_init_dev
+ *						or ads_filter_init_biquads, copied. A design following a
+ *						device is designed again when its sample rate changes.
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if channels is out of range
+ */
+int ads_filter_bank_init(ads_filter_bank_t * bank, uint8_t channels, const ads_filter_t * design);
+
+/**
+ * @brief Settles every channel as if its value had been its input forever
+ *
+ * @param bank			Filter bank
+ * @param values		Constant input of each channel
+ */
+void ads_filter_bank_reset(ads_filter_bank_t * bank, const float * values);
+
+/**
+ * @brief Filters one sample of every channel. The first samples settle the
+ *			state, as for ads_filter_apply.
+ *
+ * @param bank			Filter bank
+ * @param samples		One sample per channel, replaced by the filtered samples
+ */
+void ads_filter_bank_apply(ads_filter_bank_t * bank, float * samples);
+
+/**
+ * @brief Name of the kernel the bank was built with
+ *
+ * @return	"avx", "sse", "neon", "helium" or "scalar"
+ */
+const char * ads_filter_bank_kernel(void);
+
+#endif /* ADS_FILTER_BANK_H_ */
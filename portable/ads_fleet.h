@@ -0,0 +1,155 @@
+/**
+ * ads_fleet.h
+ *
+ * Firmware update of many ADS sensors. Every sensor's bootloader answers at
+ * ADS_BOOTLOADER_ADDRESS, so sensors sharing a bus are updated one at a time:
+ * all are held in reset, then each is released, checked with ads_dfu_check,
+ * reset into the bootloader, updated and verified with ads_dfu_check after it
+ * reboots, then held again. Independent buses are updated at the same time,
+ * interleaved with ads_dfu_step, so one bus sends while the flash of the
+ * sensors on the others is busy writing.
+ *
+ * The images are those selected by ads_dfu_image. Include this header where
+ * the ADS_FW_* options are set, as for ads_dfu.h, or pass the images to
+ * ads_fleet_init_images.
+ */
+
+#ifndef ADS_FLEET_H_
+#define ADS_FLEET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ads.h"
+#include "ads_dfu.h"
+
+#ifndef ADS_FLEET_MAX_BUSES
+#define ADS_FLEET_MAX_BUSES			(4)		// Maximum number of independent buses per fleet
+#endif
+
+/* Time the ADS takes from ads_dfu_reset to its bootloader taking the image length */
+#ifndef ADS_FLEET_BOOTLOADER_MS
+#define ADS_FLEET_BOOTLOADER_MS		(50)
+#endif
+
+/* Outcome of the update of one device */
+typedef enum {
+	ADS_FLEET_PENDING = 0,				// Not reached yet
+	ADS_FLEET_BUSY,						// Being checked or updated
+	ADS_FLEET_CURRENT,					// Firmware up to date, not updated
+	ADS_FLEET_UPDATED,					// Updated and verified
+	ADS_FLEET_FAILED					// Did not answer, no image, update failed or not verified, see error
+} ADS_FLEET_STATUS_T;
+
+/* Step of the update of the device a bus is on */
+typedef enum {
+	ADS_FLEET_NEXT = 0,					// Release the next device of the bus
+	ADS_FLEET_BOOT,						// Waiting for the application to answer
+	ADS_FLEET_BOOTLOADER,				// Waiting for the bootloader to start
+	ADS_FLEET_UPDATE,					// Image being written
+	ADS_FLEET_REBOOT,					// Waiting for the new application to answer
+	ADS_FLEET_DONE						// Every device of the bus done
+} ADS_FLEET_STEP_T;
+
+/* One device of the fleet */
+typedef struct {
+	ads_dev_t * dev;					// ADS device, dev->bus and dev->addr set as for ads_init
+	uint32_t reset_pin;					// Pin number connected to ADS reset line
+	uint32_t datardy_pin;				// Pin number connected to ADS interrupt line
+
+	/* Result, filled in by the fleet */
+	ADS_FLEET_STATUS_T status;
+	int error;							// Error of a failed device, ADS_OK otherwise
+	ADS_DEV_TYPE_T dev_type;			// Device type, as found before the update
+	uint16_t fw_before;					// Firmware version before the update
+	uint16_t fw_after;					// Firmware version after the update
+	uint32_t time_us;					// From reset release to verified, or failed
+} ads_fleet_entry_t;
+
+/* Update of the devices of one bus, in the order of the entries */
+typedef struct {
+	void * bus;							// HAL bus handle shared by the devices
+	uint8_t step;						// ADS_FLEET_STEP_T
+	uint8_t index;						// Entry being updated
+	uint32_t step_us;					// ads_hal_micros() when the step started
+	uint32_t due_us;					// ads_hal_micros() when the step has work to do
+	ads_dfu_t dfu;						// Update of the entry
+} ads_fleet_bus_t;
+
+typedef struct {
+	ads_fleet_entry_t * entries;
+	uint8_t count;						// Devices in entries
+	ads_fleet_bus_t buses[ADS_FLEET_MAX_BUSES];
+	uint8_t bus_count;					// Independent buses in buses
+	ads_dfu_image_lookup images;		// Image for each device type
+	ads_dfu_lz_t * lz;					// Decoders of compressed images, one per bus, NULL if none
+	bool force;							// Update devices already up to date too
+	ads_dfu_progress progress;			// Progress of each update, NULL for none
+	uint32_t start_us;					// ads_hal_micros() at ads_fleet_init
+	uint32_t total_us;					// Whole fleet update, set when done
+} ads_fleet_t;
+
+/**
+ * @brief Prepares the update of a fleet of devices and holds every device
+ *			in reset. Devices are grouped by dev->bus as set by ads_hal_init,
+ *			NULL being the default bus, the devices of a bus are updated in
+ *			the order of the entries.
+ *
+ * @param fleet			Fleet
+ * @param entries		Devices, with dev, reset_pin and datardy_pin set.
+ *						Must stay valid during the update
+ * @param count			Number of entries
+ * @param images		Image for each device type, see ads_dfu_image
+ * @param lz			Decoders of compressed images, ADS_FLEET_MAX_BUSES of
+ *						them, NULL if the images are raw
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the devices are on more
+ *			than ADS_FLEET_MAX_BUSES buses, or the error of ads_hal_init
+ */
+int ads_fleet_init_images(ads_fleet_t * fleet, ads_fleet_entry_t * entries, uint8_t count,
+						  ads_dfu_image_lookup images, ads_dfu_lz_t * lz);
+
+/**
+ * @brief Prepares the update of a fleet of devices with the images selected
+ *			by ads_dfu_image, see ads_fleet_init_images
+ *
+ * @param fleet			Fleet
+ * @param entries		Devices, with dev, reset_pin and datardy_pin set.
+ *						Must stay valid during the update
+ * @param count			Number of entries
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if the devices are on more
+ *			than ADS_FLEET_MAX_BUSES buses, or the error of ads_hal_init
+ */
+static inline int ads_fleet_init(ads_fleet_t * fleet, ads_fleet_entry_t * entries, uint8_t count)
+{
+#if ADS_FW_COMPRESSED == 1
+	static ads_dfu_lz_t lz[ADS_FLEET_MAX_BUSES];	// One fleet at a time per file
+	
+	return ads_fleet_init_images(fleet, entries, count, &ads_dfu_image, lz);
+#else
+	return ads_fleet_init_images(fleet, entries, count, &ads_dfu_image, NULL);
+#endif
+}
+
+/**
+ * @brief Advances the update of every bus of the fleet without waiting. When
+ *			every device is done all are released from reset, to be
+ *			initialized again with ads_init.
+ *
+ * @param fleet			Fleet, prepared with ads_fleet_init or ads_fleet_init_images
+ * @param wait_us[out]	Time until the next call has work to do
+ * @return	ADS_ERR_OP_IN_PROGRESS while devices are left, ADS_OK if every
+ *			device is up to date, ADS_ERR if any failed or was not reached,
+ *			see the entries
+ */
+int ads_fleet_poll(ads_fleet_t * fleet, uint32_t * wait_us);
+
+/**
+ * @brief Updates every device of the fleet, sleeping while no bus has work
+ *			to do. See ads_fleet_poll.
+ *
+ * @param fleet			Fleet, prepared with ads_fleet_init or ads_fleet_init_images
+ * @return	ADS_OK if every device is up to date, ADS_ERR if any failed
+ */
+int ads_fleet_run(ads_fleet_t * fleet);
+
+#endif /* ADS_FLEET_H_ */
@@ -7,8 +7,9 @@
 
 #include <stdint.h>
 #include "ads_err.h"
+#include "ads_dev.h"
 
-#define ADS_TRANSFER_SIZE		(3)
+#define ADS_DEFAULT_ADDR		(0x12)			// Default I2C address of the ADS one axis sensor
 
 
 /**
@@ -17,56 +18,122 @@
 void ads_hal_delay(uint16_t delay_ms);
 
 /**
- * @brief Initializes the pin ADS_INTERRUPT_PIN as a falling edge pin change interrupt.
- *			Assign the interrupt service routine as ads_hal_interrupt. Enable pullup
- *			Enable interrupt	
+ * @brief Microsecond delay routine.
  */
-void ads_hal_pin_int_enable(bool enable);
+void ads_hal_delay_us(uint16_t delay_us);
+
+/**
+ * @brief Monotonic microsecond time stamp. Wraps around at 2^32. The HAL
+ *			latches it in dev->drdy_timestamp at each data ready edge, before
+ *			the packet is read and passed to the read callback.
+ */
+uint32_t ads_hal_micros(void);
+
+/**
+ * @brief Free running processor cycle count, for timing short stretches of
+ *			code. Wraps around at 2^32. Targets without a cycle counter count
+ *			ads_hal_micros() in cycles of F_CPU, host HALs count nanoseconds.
+ */
+uint32_t ads_hal_cycles(void);
+
+/**
+ * @brief Enable/Disable the data ready pin change interrupt of the ADS
+ *
+ * @param dev			ADS device
+ * @param enable		true = enable, false = disable
+ */
+void ads_hal_pin_int_enable(ads_dev_t * dev, bool enable);
 
 /**
  * @brief Write buffer of data to the Angular Displacement Sensor
  *
+ * @param dev			ADS device
  * @param buffer[in]	Write buffer
  * @param len			Length of buffer.
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @return	ADS_OK if successful, ADS_ERR_NACK_DATA if a data byte was not
+ *			acknowledged, after the ADS may have taken the bytes before it,
+ *			ADS_ERR_IO if the address was not acknowledged or the write failed
+ */
+int ads_hal_write_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len);
+
+/**
+ * @brief Longest buffer ads_hal_write_buffer sends in one bus transaction
+ *
+ * @param dev			ADS device
+ * @return	Maximum write length in bytes
  */
-int ads_hal_write_buffer(uint8_t * buffer, uint8_t len);
+uint8_t ads_hal_max_write(ads_dev_t * dev);
 
 /**
  * @brief Read buffer of data from the Angular Displacement Sensor
  *
+ * @param dev			ADS device
  * @param buffer[out]	Read buffer
  * @param len			Length of buffer.
  * @return	ADS_OK if successful ADS_ERR_IO if failed
  */
-int ads_hal_read_buffer(uint8_t * buffer, uint8_t len);
+int ads_hal_read_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len);
+
+/**
+ * @brief Write a command to the Angular Displacement Sensor and read back
+ *			its reply, using as few bus transactions as the platform allows
+ *
+ * @param dev			ADS device
+ * @param wbuf[in]		Command buffer
+ * @param wlen			Length of command
+ * @param rbuf[out]		Reply buffer
+ * @param rlen			Length of reply
+ * @param delay_ms		Time the ADS needs between command and reply
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_write_read(ads_dev_t * dev, uint8_t * wbuf, uint8_t wlen, uint8_t * rbuf, uint8_t rlen, uint16_t delay_ms);
 
 /**
  * @brief Reset the Angular Displacement Sensor
+ *
+ * @param dev			ADS device
+ */
+void ads_hal_reset(ads_dev_t * dev);
+
+/**
+ * @brief Holds the Angular Displacement Sensor in reset, off the bus, or
+ *			releases it to boot
+ *
+ * @param dev			ADS device
+ * @param hold			true = hold in reset, false = release
  */
-void ads_hal_reset(void);
+void ads_hal_hold_reset(ads_dev_t * dev, bool hold);
 
 /**
- * @brief Initializes the hardware abstraction layer 
+ * @brief Initializes the hardware abstraction layer for one ADS device and
+ *			resets the ADS. Returns without waiting for the ADS to boot.
+ *			dev->bus and dev->addr must be set before calling.
  *
- * @param callback to ads.cpp, 
+ * @param dev			ADS device
+ * @param callback to ads.cpp,
  * @param reset_pin pin number for reset line of ads
- * @param datardy_pin pin number for data ready interrupt 
- * @return	ADS_OK if successful ADS_ERR_IO if failed
+ * @param datardy_pin pin number for data ready interrupt
+ * @return	ADS_OK if successful ADS_ERR_IO if failed, ADS_ERR if no
+ *			interrupt slot is free
  */
-int ads_hal_init(void (*callback)(uint8_t*), uint32_t reset_pin, uint32_t datardy_pin);
+int ads_hal_init(ads_dev_t * dev, void (*callback)(ads_dev_t*,uint8_t*), uint32_t reset_pin, uint32_t datardy_pin);
 
 /**
- * @brief Gets the current i2c address that the hal layer is addressing. 	
+ * @brief Gets the current i2c address that the hal layer is addressing.
  *				Used by device firmware update (dfu)
- * @return	uint8_t _address
+ *
+ * @param dev			ADS device
+ * @return	uint8_t address
  */
-uint8_t ads_hal_get_address(void);
+uint8_t ads_hal_get_address(ads_dev_t * dev);
 
 /**
- * @brief Sets the current i2c address that the hal layer is addressing. 	
- *				Used by device firmware update (dfu) 
+ * @brief Sets the current i2c address that the hal layer is addressing.
+ *				Used by device firmware update (dfu)
+ *
+ * @param dev			ADS device
+ * @param address		i2c address hal to communicate with
  */
-void ads_hal_set_address(uint8_t address);
+void ads_hal_set_address(ads_dev_t * dev, uint8_t address);
 
 #endif /* ADS_HAL_ */
@@ -0,0 +1,560 @@
+/**
+ * ads_hal_linux.c
+ *
+ * Linux i2c-dev hardware abstraction layer. See ads_hal_linux.h for usage.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include "ads_hal_linux.h"
+
+#define ADS_HAL_LINUX_DEFAULT_I2C	"/dev/i2c-1"
+#define ADS_HAL_LINUX_DEFAULT_GPIO	"/dev/gpiochip0"
+#define ADS_HAL_LINUX_CONSUMER		"ads"
+
+/* Per device line handles, indexed by ads_dev_t.hal_slot */
+typedef struct {
+	ads_dev_t * dev;
+	int reset_fd;						// Output line handle, -1 if not wired
+	int drdy_fd;						// Falling edge event handle, -1 if not wired
+} ads_linux_slot_t;
+
+static ads_linux_slot_t ads_linux_slots[ADS_HAL_LINUX_MAX_DEVICES];
+
+static ads_linux_bus_t ads_linux_default_bus = { -1, -1, NULL, NULL, 0 };
+
+
+/************************************************************************/
+/*                         Bus and Line Helpers                         */
+/************************************************************************/
+
+static int ads_linux_ioctl_rdwr(ads_linux_bus_t * bus, struct i2c_rdwr_ioctl_data * xfer)
+{
+	return (ioctl(bus->fd, I2C_RDWR, xfer) < 0) ? -errno : 0;
+}
+
+static ads_linux_bus_t * ads_linux_bus(ads_dev_t * dev)
+{
+	if(dev->bus != NULL)
+		return (ads_linux_bus_t *)dev->bus;
+
+	if(ads_linux_default_bus.fd < 0)
+		ads_linux_bus_open(&ads_linux_default_bus, ADS_HAL_LINUX_DEFAULT_I2C, ADS_HAL_LINUX_DEFAULT_GPIO);
+
+	return &ads_linux_default_bus;
+}
+
+/**
+ * @brief Issues one combined transfer of msgs in a single kernel round trip.
+ *			Adapters report a NACK of the address as ENXIO, other failures
+ *			of a write may come after the ADS took some of its bytes.
+ */
+static int ads_linux_xfer(ads_dev_t * dev, struct i2c_msg * msgs, uint32_t nmsgs)
+{
+	ads_linux_bus_t * bus = ads_linux_bus(dev);
+	struct i2c_rdwr_ioctl_data xfer;
+	int ret_val;
+
+	if(bus->rdwr == NULL || (bus->fd < 0 && bus->rdwr == ads_linux_ioctl_rdwr))
+		return ADS_ERR_IO;
+
+	xfer.msgs  = msgs;
+	xfer.nmsgs = nmsgs;
+
+	bus->ioctls++;
+
+	ret_val = bus->rdwr(bus, &xfer);
+
+	if(ret_val >= 0)
+		return ADS_OK;
+
+	if(nmsgs == 1 && !(msgs[0].flags & I2C_M_RD) && ret_val != -ENXIO)
+		return ADS_ERR_NACK_DATA;
+
+	return ADS_ERR_IO;
+}
+
+static inline ads_linux_slot_t * ads_linux_slot(ads_dev_t * dev)
+{
+	ads_linux_slot_t * slot = &ads_linux_slots[dev->hal_slot];
+
+	return (slot->dev == dev) ? slot : NULL;
+}
+
+static void ads_linux_close_lines(ads_linux_slot_t * slot)
+{
+	if(slot->reset_fd >= 0)
+		close(slot->reset_fd);
+	if(slot->drdy_fd >= 0)
+		close(slot->drdy_fd);
+
+	slot->reset_fd = slot->drdy_fd = -1;
+}
+
+static int ads_linux_request_lines(ads_linux_bus_t * bus, ads_linux_slot_t * slot, uint32_t reset_pin, uint32_t datardy_pin)
+{
+	if(bus->gpio_fd < 0)
+		return ADS_OK;
+
+	if(reset_pin != ADS_HAL_LINUX_NO_PIN)
+	{
+		struct gpiohandle_request req;
+
+		memset(&req, 0, sizeof(req));
+		req.lineoffsets[0] = reset_pin;
+		req.flags = GPIOHANDLE_REQUEST_OUTPUT;
+		req.default_values[0] = 1;
+		req.lines = 1;
+		strncpy(req.consumer_label, ADS_HAL_LINUX_CONSUMER, sizeof(req.consumer_label) - 1);
+
+		if(ioctl(bus->gpio_fd, GPIO_GET_LINEHANDLE_IOCTL, &req) < 0)
+			return ADS_ERR_IO;
+
+		slot->reset_fd = req.fd;
+	}
+
+	if(datardy_pin != ADS_HAL_LINUX_NO_PIN)
+	{
+		struct gpioevent_request req;
+
+		memset(&req, 0, sizeof(req));
+		req.lineoffset = datardy_pin;
+		req.handleflags = GPIOHANDLE_REQUEST_INPUT;
+		req.eventflags = GPIOEVENT_REQUEST_FALLING_EDGE;
+		strncpy(req.consumer_label, ADS_HAL_LINUX_CONSUMER, sizeof(req.consumer_label) - 1);
+
+		if(ioctl(bus->gpio_fd, GPIO_GET_LINEEVENT_IOCTL, &req) < 0)
+			return ADS_ERR_IO;
+
+		fcntl(req.fd, F_SETFL, fcntl(req.fd, F_GETFL) | O_NONBLOCK);
+		slot->drdy_fd = req.fd;
+	}
+
+	return ADS_OK;
+}
+
+
+/************************************************************************/
+/*                             Linux API                                */
+/************************************************************************/
+
+int ads_linux_bus_open(ads_linux_bus_t * bus, const char * i2c_path, const char * gpio_path)
+{
+	unsigned long funcs = 0;
+
+	bus->fd = -1;
+	bus->gpio_fd = -1;
+	bus->rdwr = ads_linux_ioctl_rdwr;
+	bus->ioctls = 0;
+
+	bus->fd = open(i2c_path, O_RDWR | O_CLOEXEC);
+	if(bus->fd < 0)
+		return ADS_ERR_IO;
+
+	// Plain I2C transfers are required, SMBus only adapters can not be used
+	if(ioctl(bus->fd, I2C_FUNCS, &funcs) < 0 || !(funcs & I2C_FUNC_I2C))
+	{
+		ads_linux_bus_close(bus);
+		return ADS_ERR_IO;
+	}
+
+	if(gpio_path != NULL)
+	{
+		bus->gpio_fd = open(gpio_path, O_RDWR | O_CLOEXEC);
+		if(bus->gpio_fd < 0)
+		{
+			ads_linux_bus_close(bus);
+			return ADS_ERR_IO;
+		}
+	}
+
+	return ADS_OK;
+}
+
+void ads_linux_bus_close(ads_linux_bus_t * bus)
+{
+	if(bus->fd >= 0)
+		close(bus->fd);
+	if(bus->gpio_fd >= 0)
+		close(bus->gpio_fd);
+
+	bus->fd = bus->gpio_fd = -1;
+}
+
+int ads_linux_drdy_fd(ads_dev_t * dev)
+{
+	ads_linux_slot_t * slot = ads_linux_slot(dev);
+
+	return (slot != NULL) ? slot->drdy_fd : -1;
+}
+
+int ads_linux_service(ads_dev_t * dev)
+{
+	ads_linux_slot_t * slot = ads_linux_slot(dev);
+	struct gpioevent_data events[16];
+	int delivered = 0;
+	ssize_t n;
+
+	if(slot == NULL || slot->drdy_fd < 0)
+		return ADS_ERR_IO;
+
+	// Drain all queued edges, one read of the latest packet serves them all.
+	// The kernel stamps each edge in its interrupt handler, with
+	// CLOCK_MONOTONIC since Linux 5.7, the clock of ads_hal_micros
+	while((n = read(slot->drdy_fd, events, sizeof(events))) > 0)
+	{
+		if(dev->int_enabled)
+		{
+			dev->drdy_timestamp = (uint32_t)(events[n / sizeof(events[0]) - 1].timestamp / 1000);
+			delivered = 1;
+		}
+	}
+
+	if(n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+		return ADS_ERR_IO;
+
+	if(delivered)
+	{
+		if(ads_hal_read_buffer(dev, dev->read_buffer, ADS_TRANSFER_SIZE) != ADS_OK)
+			return ADS_ERR_IO;
+
+		dev->read_callback(dev, dev->read_buffer);
+	}
+
+	return delivered;
+}
+
+int ads_linux_wait(ads_dev_t ** devs, uint32_t count, int timeout_ms)
+{
+	struct pollfd fds[ADS_HAL_LINUX_MAX_DEVICES];
+	uint32_t i, nfds = 0;
+	int delivered = 0;
+
+	for(i = 0; i < count && nfds < ADS_HAL_LINUX_MAX_DEVICES; i++)
+	{
+		fds[nfds].fd = ads_linux_drdy_fd(devs[i]);
+		fds[nfds].events = POLLIN;
+		fds[nfds].revents = 0;
+		nfds++;
+	}
+
+	if(poll(fds, nfds, timeout_ms) < 0)
+		return (errno == EINTR) ? 0 : ADS_ERR_IO;
+
+	for(i = 0; i < nfds; i++)
+	{
+		if(fds[i].revents & POLLIN)
+		{
+			int ret_val = ads_linux_service(devs[i]);
+
+			if(ret_val < 0)
+				return ret_val;
+
+			delivered += ret_val;
+		}
+	}
+
+	return delivered;
+}
+
+
+/************************************************************************/
+/*                         HAL Implementation                           */
+/************************************************************************/
+
+/**
+ * @brief Millisecond delay routine.
+ */
+void ads_hal_delay(uint16_t delay_ms)
+{
+	struct timespec ts;
+
+	ts.tv_sec  = delay_ms / 1000;
+	ts.tv_nsec = (long)(delay_ms % 1000) * 1000000L;
+
+	while(clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR)
+		;
+}
+
+/**
+ * @brief Microsecond delay routine.
+ */
+void ads_hal_delay_us(uint16_t delay_us)
+{
+	struct timespec ts;
+
+	ts.tv_sec  = 0;
+	ts.tv_nsec = (long)delay_us * 1000L;
+
+	while(clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, &ts) == EINTR)
+		;
+}
+
+/**
+ * @brief Monotonic microsecond time stamp. Wraps around at 2^32.
+ */
+uint32_t ads_hal_micros(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief Free running cycle count, nanoseconds of CLOCK_MONOTONIC.
+ */
+uint32_t ads_hal_cycles(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief Enable/Disable delivery of data ready edges by ads_linux_service
+ *
+ * @param dev			ADS device
+ * @param enable		true = enable, false = disable
+ */
+void ads_hal_pin_int_enable(ads_dev_t * dev, bool enable)
+{
+	dev->int_enabled = enable;
+}
+
+/**
+ * @brief Write buffer of data to the Angular Displacement Sensor
+ *
+ * @param dev			ADS device
+ * @param buffer[in]	Write buffer
+ * @param len			Length of buffer.
+ * @return	ADS_OK if successful, ADS_ERR_IO if the address was not
+ *			acknowledged, ADS_ERR_NACK_DATA if the write failed otherwise,
+ *			as the ADS may have taken part of it
+ */
+int ads_hal_write_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len)
+{
+	struct i2c_msg msg;
+
+	msg.addr  = dev->addr;
+	msg.flags = 0;
+	msg.len   = len;
+	msg.buf   = buffer;
+
+	return ads_linux_xfer(dev, &msg, 1);
+}
+
+/**
+ * @brief Longest buffer ads_hal_write_buffer sends in one bus transaction.
+ *			An I2C_RDWR message takes any length the HAL is passed.
+ *
+ * @param dev			ADS device
+ * @return	Maximum write length in bytes
+ */
+uint8_t ads_hal_max_write(ads_dev_t * dev)
+{
+	(void)dev;
+
+	return 255;
+}
+
+/**
+ * @brief Read buffer of data from the Angular Displacement Sensor. The
+ *			kernel copies the data straight into buffer.
+ *
+ * @param dev			ADS device
+ * @param buffer[out]	Read buffer
+ * @param len			Length of data to read in number of bytes.
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_read_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len)
+{
+	struct i2c_msg msg;
+
+	msg.addr  = dev->addr;
+	msg.flags = I2C_M_RD;
+	msg.len   = len;
+	msg.buf   = buffer;
+
+	return ads_linux_xfer(dev, &msg, 1);
+}
+
+/**
+ * @brief Write a command to the Angular Displacement Sensor and read back
+ *			its reply. Without a delay both go out in one I2C_RDWR with a
+ *			repeated start, otherwise one transfer each side of the delay.
+ *
+ * @param dev			ADS device
+ * @param wbuf[in]		Command buffer
+ * @param wlen			Length of command
+ * @param rbuf[out]		Reply buffer
+ * @param rlen			Length of reply
+ * @param delay_ms		Time the ADS needs between command and reply
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_write_read(ads_dev_t * dev, uint8_t * wbuf, uint8_t wlen, uint8_t * rbuf, uint8_t rlen, uint16_t delay_ms)
+{
+	struct i2c_msg msgs[2];
+
+	msgs[0].addr  = dev->addr;
+	msgs[0].flags = 0;
+	msgs[0].len   = wlen;
+	msgs[0].buf   = wbuf;
+
+	msgs[1].addr  = dev->addr;
+	msgs[1].flags = I2C_M_RD;
+	msgs[1].len   = rlen;
+	msgs[1].buf   = rbuf;
+
+	if(delay_ms == 0)
+		return ads_linux_xfer(dev, msgs, 2);
+
+	if(ads_linux_xfer(dev, &msgs[0], 1) != ADS_OK)
+		return ADS_ERR_IO;
+
+	ads_hal_delay(delay_ms);
+
+	return ads_linux_xfer(dev, &msgs[1], 1);
+}
+
+/**
+ * @brief Reset the Angular Displacement Sensor
+ *
+ * @param dev			ADS device
+ */
+void ads_hal_reset(ads_dev_t * dev)
+{
+	ads_linux_slot_t * slot = ads_linux_slot(dev);
+	struct gpiohandle_data data;
+
+	if(slot == NULL || slot->reset_fd < 0)
+		return;
+
+	// Bring reset low for 10ms then release
+	memset(&data, 0, sizeof(data));
+	ioctl(slot->reset_fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+	ads_hal_delay(10);
+	data.values[0] = 1;
+	ioctl(slot->reset_fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+}
+
+/**
+ * @brief Holds the Angular Displacement Sensor in reset, off the bus, or
+ *			releases it to boot
+ *
+ * @param dev			ADS device
+ * @param hold			true = hold in reset, false = release
+ */
+void ads_hal_hold_reset(ads_dev_t * dev, bool hold)
+{
+	ads_linux_slot_t * slot = ads_linux_slot(dev);
+	struct gpiohandle_data data;
+
+	if(slot == NULL || slot->reset_fd < 0)
+		return;
+
+	memset(&data, 0, sizeof(data));
+	data.values[0] = hold ? 0 : 1;
+	ioctl(slot->reset_fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+}
+
+/**
+ * @brief Initializes the hardware abstraction layer
+ *
+ * @param dev			ADS device
+ * @param reset_pin		GPIO line offset of the reset line, or ADS_HAL_LINUX_NO_PIN
+ * @param datardy_pin	GPIO line offset of the data ready line, or ADS_HAL_LINUX_NO_PIN
+ * @return	ADS_OK if successful ADS_ERR_IO if failed, ADS_ERR if no
+ *			device slot is free
+ */
+int ads_hal_init(ads_dev_t * dev, void (*callback)(ads_dev_t*,uint8_t*), uint32_t reset_pin, uint32_t datardy_pin)
+{
+	ads_linux_bus_t * bus = ads_linux_bus(dev);
+	ads_linux_slot_t * slot = NULL;
+	uint8_t i;
+
+	// Find the slot of a device being reinitialized, or else a free slot
+	for(i = 0; i < ADS_HAL_LINUX_MAX_DEVICES; i++)
+	{
+		if(ads_linux_slots[i].dev == dev)
+		{
+			slot = &ads_linux_slots[i];
+			ads_linux_close_lines(slot);
+			break;
+		}
+	}
+
+	for(i = 0; slot == NULL && i < ADS_HAL_LINUX_MAX_DEVICES; i++)
+	{
+		if(ads_linux_slots[i].dev == NULL)
+			slot = &ads_linux_slots[i];
+	}
+
+	if(slot == NULL)
+		return ADS_ERR;
+
+	slot->dev = dev;
+	slot->reset_fd = slot->drdy_fd = -1;
+
+	dev->reset_pin   = reset_pin;
+	dev->datardy_pin = datardy_pin;
+	dev->hal_slot    = (uint8_t)(slot - ads_linux_slots);
+
+	if(dev->addr == 0)
+		dev->addr = ADS_DEFAULT_ADDR;
+
+	// NULL is the default bus, named so devices on it compare equal
+	if(dev->bus == NULL)
+		dev->bus = bus;
+
+	dev->read_callback = callback;
+
+	if(ads_linux_request_lines(bus, slot, reset_pin, datardy_pin) != ADS_OK)
+	{
+		ads_linux_close_lines(slot);
+		slot->dev = NULL;
+		return ADS_ERR_IO;
+	}
+
+	// Reset the ads, ads_init waits for it to answer
+	ads_hal_reset(dev);
+
+	dev->int_enabled = true;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Gets the current i2c address that the hal layer is addressing.
+ *
+ * @param dev			ADS device
+ * @return	uint8_t address
+ */
+uint8_t ads_hal_get_address(ads_dev_t * dev)
+{
+	return dev->addr;
+}
+
+/**
+ * @brief Sets the i2c address that the hal layer is addressing
+ *
+ * @param dev			ADS device
+ * @param address		i2c address hal to communicate with
+ */
+void ads_hal_set_address(ads_dev_t * dev, uint8_t address)
+{
+	dev->addr = address;
+}
@@ -0,0 +1,99 @@
+/**
+ * ads_hal_linux.h
+ *
+ * Linux i2c-dev hardware abstraction layer. Implements ads_hal.h on
+ * /dev/i2c-N with I2C_RDWR transfers, and the reset and data ready lines
+ * on a /dev/gpiochipN character device. Link in place of ads_hal_i2c.c.
+ *
+ * Each ads_dev_t.bus points to an opened ads_linux_bus_t. A NULL bus selects
+ * /dev/i2c-1 and /dev/gpiochip0, opened on first use. Several devices may
+ * share a bus, every transfer carries its own address.
+ *
+ * Linux has no interrupt context for user space. Data ready edges are
+ * queued by the kernel on a pollable file descriptor per device; the
+ * application waits on it and calls ads_linux_service, which runs the same
+ * read and callback path as the interrupt on a microcontroller. The driver
+ * is not thread safe, service and API calls for devices on one bus must
+ * come from the same thread.
+ */
+
+#ifndef ADS_HAL_LINUX_H_
+#define ADS_HAL_LINUX_H_
+
+#include <stdint.h>
+#include "ads_hal.h"
+
+#ifndef ADS_HAL_LINUX_MAX_DEVICES
+#define ADS_HAL_LINUX_MAX_DEVICES	(64)	// Maximum number of ADS devices the HAL can service
+#endif
+
+#define ADS_HAL_LINUX_NO_PIN		(0xFFFFFFFF)	// Reset or data ready line not wired
+
+struct i2c_rdwr_ioctl_data;
+
+typedef struct ads_linux_bus_s ads_linux_bus_t;
+
+/**
+ * @brief Bus transfer. Defaults to the I2C_RDWR ioctl, may be replaced to run
+ *			the driver against a user space fake of the bus.
+ *
+ * @return	0 if successful, else a negative errno, -ENXIO if the address was
+ *			not acknowledged
+ */
+typedef int (*ads_linux_rdwr)(ads_linux_bus_t * bus, struct i2c_rdwr_ioctl_data * xfer);
+
+struct ads_linux_bus_s {
+	int fd;								// /dev/i2c-N, -1 if not open
+	int gpio_fd;						// /dev/gpiochipN, -1 if lines are not wired
+	ads_linux_rdwr rdwr;				// Bus transfer
+	void * user_data;					// Free for use by a replacement rdwr
+	uint32_t ioctls;					// Transfer round trips into the kernel
+};
+
+/**
+ * @brief Opens an I2C adapter and optionally a GPIO chip for the reset and
+ *			data ready lines of the sensors on it
+ *
+ * @param bus			Bus to open
+ * @param i2c_path		I2C adapter, e.g. "/dev/i2c-1"
+ * @param gpio_path		GPIO chip, e.g. "/dev/gpiochip0", NULL if not wired
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_linux_bus_open(ads_linux_bus_t * bus, const char * i2c_path, const char * gpio_path);
+
+/**
+ * @brief Closes a bus opened with ads_linux_bus_open
+ *
+ * @param bus			Bus to close
+ */
+void ads_linux_bus_close(ads_linux_bus_t * bus);
+
+/**
+ * @brief Returns the file descriptor that becomes readable on a data ready
+ *			edge of the device, for use with poll or epoll
+ *
+ * @param dev			ADS device
+ * @return	file descriptor, -1 if the data ready line is not wired
+ */
+int ads_linux_drdy_fd(ads_dev_t * dev);
+
+/**
+ * @brief Consumes queued data ready edges of the device and, if the data
+ *			ready interrupt is enabled, reads the sample and fires the callback
+ *
+ * @param dev			ADS device
+ * @return	number of samples delivered, ADS_ERR_IO if failed
+ */
+int ads_linux_service(ads_dev_t * dev);
+
+/**
+ * @brief Waits for data ready edges on any of the devices and services them
+ *
+ * @param devs			ADS devices
+ * @param count			Number of devices
+ * @param timeout_ms	Maximum time to wait, -1 to wait forever
+ * @return	number of samples delivered, ADS_ERR_IO if failed
+ */
+int ads_linux_wait(ads_dev_t ** devs, uint32_t count, int timeout_ms);
+
+#endif /* ADS_HAL_LINUX_H_ */
@@ -0,0 +1,887 @@
+/**
+ * ads_hal_sim.c
+ *
+ * Host side ADS simulator implementing the ads_hal.h interface.
+ * See ads_hal_sim.h for usage.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "ads_hal_sim.h"
+#include "ads.h"
+
+#define ADS_SIM_TICKS_PER_SEC	(16384)
+#define ADS_SIM_DEFAULT_SPS		(163)		// 100 Hz, sensor default after reset
+
+static uint64_t sim_now_us;
+static bool sim_in_advance;
+
+static ads_sim_bus_t sim_default_bus;
+static bool sim_default_bus_init;
+
+/* Min heap of free running sensors ordered by next_sample_us */
+static ads_sim_sensor_t * sim_heap[ADS_SIM_MAX_SENSORS];
+static int32_t sim_heap_len;
+
+
+/************************************************************************/
+/*                          Event Heap                                  */
+/************************************************************************/
+
+static void sim_heap_swap(int32_t a, int32_t b)
+{
+	ads_sim_sensor_t * t = sim_heap[a];
+
+	sim_heap[a] = sim_heap[b];
+	sim_heap[b] = t;
+	sim_heap[a]->heap_idx = a;
+	sim_heap[b]->heap_idx = b;
+}
+
+static void sim_heap_up(int32_t i)
+{
+	while(i > 0)
+	{
+		int32_t parent = (i - 1) / 2;
+
+		if(sim_heap[parent]->next_sample_us <= sim_heap[i]->next_sample_us)
+			break;
+
+		sim_heap_swap(i, parent);
+		i = parent;
+	}
+}
+
+static void sim_heap_down(int32_t i)
+{
+	for(;;)
+	{
+		int32_t l = 2 * i + 1;
+		int32_t r = l + 1;
+		int32_t min = i;
+
+		if(l < sim_heap_len && sim_heap[l]->next_sample_us < sim_heap[min]->next_sample_us)
+			min = l;
+		if(r < sim_heap_len && sim_heap[r]->next_sample_us < sim_heap[min]->next_sample_us)
+			min = r;
+
+		if(min == i)
+			break;
+
+		sim_heap_swap(i, min);
+		i = min;
+	}
+}
+
+static void sim_heap_remove(ads_sim_sensor_t * s)
+{
+	int32_t i = s->heap_idx;
+
+	if(i < 0)
+		return;
+
+	sim_heap_len--;
+	if(i != sim_heap_len)
+	{
+		sim_heap_swap(i, sim_heap_len);
+		sim_heap_up(i);
+		sim_heap_down(sim_heap[i]->heap_idx);
+	}
+
+	s->heap_idx = -1;
+}
+
+static void sim_heap_schedule(ads_sim_sensor_t * s)
+{
+	if(s->heap_idx < 0)
+	{
+		if(sim_heap_len == ADS_SIM_MAX_SENSORS)
+			return;
+
+		s->heap_idx = sim_heap_len;
+		sim_heap[sim_heap_len++] = s;
+		sim_heap_up(s->heap_idx);
+	}
+	else
+	{
+		sim_heap_up(s->heap_idx);
+		sim_heap_down(s->heap_idx);
+	}
+}
+
+
+/************************************************************************/
+/*                        Sensor Emulation                              */
+/************************************************************************/
+
+static inline ads_sim_bus_t * sim_bus(void * bus)
+{
+	return (bus != NULL) ? (ads_sim_bus_t *)bus : ads_sim_bus_default();
+}
+
+static inline uint64_t sim_period_us(ads_sim_sensor_t * s)
+{
+	uint64_t period = ((uint64_t)s->sps * 1000000) / ADS_SIM_TICKS_PER_SEC;
+
+	return period ? period : 1;
+}
+
+static float sim_default_signal(ads_sim_sensor_t * s, uint8_t packet_type, uint64_t t_us)
+{
+	float t = (float)((double)t_us / 1000000.0);
+
+	if(packet_type == ADS_STRETCH_SAMPLE)
+		return s->stretch_amp * sinf(2.0f * 3.14159265f * s->stretch_freq * t);
+
+	return s->bend_amp * sinf(2.0f * 3.14159265f * s->bend_freq * t);
+}
+
+static float sim_raw(ads_sim_sensor_t * s, uint8_t packet_type)
+{
+	ads_sim_signal signal = s->signal ? s->signal : sim_default_signal;
+
+	return signal(s, packet_type, sim_now_us);
+}
+
+/**
+ * @brief Encodes the calibrated measurement of the sensor now in a sample packet
+ */
+static void sim_sample_packet(ads_sim_sensor_t * s, uint8_t packet_type, uint8_t * packet)
+{
+	int ch = (packet_type == ADS_STRETCH_SAMPLE) ? 1 : 0;
+	float value = s->cal_gain[ch] * sim_raw(s, packet_type) + s->cal_offset[ch];
+	float q = value * 64.0f;
+
+	if(q > 32767.0f)
+		q = 32767.0f;
+	else if(q < -32768.0f)
+		q = -32768.0f;
+
+	packet[0] = packet_type;
+	ads_uint16_encode((uint16_t)(int16_t)lrintf(q), &packet[1]);
+}
+
+static void sim_set_addr(ads_sim_sensor_t * s, uint8_t addr)
+{
+	ads_sim_bus_t * bus = s->bus;
+	uint8_t cur = (s->mode == ADS_SIM_BOOTLOADER) ? ADS_SIM_BOOTLOADER_ADDRESS : s->addr;
+
+	if(bus->by_addr[cur & 0x7f] == s)
+		bus->by_addr[cur & 0x7f] = NULL;
+
+	bus->by_addr[addr & 0x7f] = s;
+}
+
+static void sim_set_mode(ads_sim_sensor_t * s, ADS_SIM_MODE_T mode)
+{
+	if(mode == ADS_SIM_BOOTLOADER && s->mode != ADS_SIM_BOOTLOADER)
+	{
+		sim_set_addr(s, ADS_SIM_BOOTLOADER_ADDRESS);
+		s->dfu_len = s->dfu_received = 0;
+		s->dfu_hdr_len = s->dfu_page_fill = 0;
+		s->dfu_ack = false;
+	}
+	else if(mode != ADS_SIM_BOOTLOADER && s->mode == ADS_SIM_BOOTLOADER)
+	{
+		s->bus->by_addr[ADS_SIM_BOOTLOADER_ADDRESS] = NULL;
+		s->bus->by_addr[s->addr & 0x7f] = s;
+	}
+
+	s->mode = mode;
+
+	if(mode == ADS_SIM_RUN)
+	{
+		s->next_sample_us = sim_now_us + sim_period_us(s);
+		sim_heap_schedule(s);
+	}
+	else
+	{
+		sim_heap_remove(s);
+		s->packets = 0;
+	}
+}
+
+/**
+ * @brief Power on reset of the sensor firmware. Address and calibration persist.
+ */
+static void sim_boot(ads_sim_sensor_t * s)
+{
+	sim_set_mode(s, ADS_SIM_STANDBY);
+
+	s->sps = ADS_SIM_DEFAULT_SPS;
+	s->stretch_en = false;
+	s->reply_pending = false;
+	s->packets = 0;
+	s->polled_next = ADS_SAMPLE;
+	s->boot_done_us = sim_now_us + (uint64_t)s->boot_ms * 1000;
+}
+
+static inline bool sim_responding(ads_sim_sensor_t * s)
+{
+	return s != NULL && s->mode != ADS_SIM_SHUTDOWN && sim_now_us >= s->boot_done_us;
+}
+
+/* Next random number of the sensor, xorshift32 */
+static uint32_t sim_random(ads_sim_sensor_t * s)
+{
+	s->random ^= s->random << 13;
+	s->random ^= s->random >> 17;
+	s->random ^= s->random << 5;
+
+	return s->random;
+}
+
+/* Bootloader transfer not acknowledged, at random with dfu_nack_ppm */
+static bool sim_dfu_nack(ads_sim_sensor_t * s)
+{
+	if(s->mode != ADS_SIM_BOOTLOADER || s->dfu_nack_ppm == 0 || sim_random(s) % 1000000 >= s->dfu_nack_ppm)
+		return false;
+
+	s->stats.dfu_nacks++;
+
+	return true;
+}
+
+/* Bootloader write not acknowledged at a data byte, at random with
+   dfu_data_nack_ppm. Returns the bytes taken before it, len if none. */
+static uint8_t sim_dfu_data_nack(ads_sim_sensor_t * s, uint8_t len)
+{
+	if(s->dfu_data_nack_ppm == 0 || len == 0 || sim_random(s) % 1000000 >= s->dfu_data_nack_ppm)
+		return len;
+
+	s->stats.dfu_data_nacks++;
+	s->bus->stats.nacks++;
+
+	return (uint8_t)(sim_random(s) % len);
+}
+
+static void sim_calibrate(ads_sim_sensor_t * s, uint8_t step, uint8_t ref)
+{
+	int ch = (step == ADS_CALIBRATE_STRETCH_ZERO || step == ADS_CALIBRATE_STRETCH_SECOND) ? 1 : 0;
+	float raw = sim_raw(s, ch ? ADS_STRETCH_SAMPLE : ADS_SAMPLE);
+
+	switch(step)
+	{
+	case ADS_CALIBRATE_FIRST:
+	case ADS_CALIBRATE_STRETCH_ZERO:
+		s->cal_raw[ch] = raw;
+		s->cal_ref[ch] = (float)ref;
+		break;
+	case ADS_CALIBRATE_SECOND:
+	case ADS_CALIBRATE_STRETCH_SECOND:
+		if(raw != s->cal_raw[ch])
+		{
+			s->cal_gain[ch] = ((float)ref - s->cal_ref[ch]) / (raw - s->cal_raw[ch]);
+			s->cal_offset[ch] = s->cal_ref[ch] - s->cal_gain[ch] * s->cal_raw[ch];
+		}
+		break;
+	case ADS_CALIBRATE_CLEAR:
+		s->cal_gain[0] = s->cal_gain[1] = 1.0f;
+		s->cal_offset[0] = s->cal_offset[1] = 0.0f;
+		break;
+	default:
+		break;
+	}
+}
+
+static void sim_command(ads_sim_sensor_t * s, const uint8_t * buffer, uint8_t len)
+{
+	if(len < 1)
+		return;
+
+	switch(buffer[0])
+	{
+	case ADS_RUN:
+		sim_set_mode(s, buffer[1] ? ADS_SIM_RUN : ADS_SIM_STANDBY);
+		break;
+	case ADS_SPS:
+		s->sps = ads_uint16_decode(&buffer[1]);
+		if(s->mode == ADS_SIM_RUN)
+			sim_set_mode(s, ADS_SIM_RUN);
+		break;
+	case ADS_RESET:
+		sim_boot(s);
+		break;
+	case ADS_DFU:
+		sim_set_mode(s, ADS_SIM_BOOTLOADER);
+		break;
+	case ADS_SET_ADDRESS:
+		sim_set_addr(s, buffer[1]);
+		s->addr = buffer[1];
+		break;
+	case ADS_POLLED_MODE:
+		sim_set_mode(s, buffer[1] ? ADS_SIM_POLLED : ADS_SIM_STANDBY);
+		break;
+	case ADS_GET_FW_VER:
+		s->reply[0] = ADS_FW_VER;
+		ads_uint16_encode(s->fw_ver, &s->reply[1]);
+		s->reply_pending = true;
+		break;
+	case ADS_CALIBRATE:
+		sim_calibrate(s, buffer[1], buffer[2]);
+		break;
+	case ADS_READ_STRETCH:
+		s->stretch_en = buffer[1];
+		break;
+	case ADS_SHUTDOWN:
+		sim_set_mode(s, ADS_SIM_SHUTDOWN);
+		break;
+	case ADS_GET_DEV_ID:
+		s->reply[0] = ADS_DEV_ID;
+		s->reply[1] = (uint8_t)s->dev_type;
+		s->reply[2] = 0;
+		s->reply_pending = true;
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * @brief Bootloader receive. A 4 byte little endian length followed by the
+ *			image, acknowledged with 's' after the length and each page once the
+ *			flash erase or page write time has passed.
+ */
+static void sim_dfu_write(ads_sim_sensor_t * s, const uint8_t * buffer, uint8_t len)
+{
+	uint8_t i;
+
+	for(i = 0; i < len; i++)
+	{
+		if(s->dfu_hdr_len < 4)
+		{
+			s->dfu_hdr[s->dfu_hdr_len++] = buffer[i];
+
+			if(s->dfu_hdr_len == 4)
+			{
+				s->dfu_len = (uint32_t)s->dfu_hdr[0] | ((uint32_t)s->dfu_hdr[1] << 8) |
+							 ((uint32_t)s->dfu_hdr[2] << 16) | ((uint32_t)s->dfu_hdr[3] << 24);
+				s->dfu_ack = true;
+				s->dfu_ack_us = s->bus->busy_until_us + s->dfu_erase_us;
+			}
+			continue;
+		}
+
+		if(s->dfu_received >= s->dfu_len)
+			break;
+
+		s->dfu_received++;
+		s->dfu_page_fill++;
+
+		if(s->dfu_page_fill == ADS_SIM_DFU_PAGE_SIZE || s->dfu_received == s->dfu_len)
+		{
+			s->dfu_page_fill = 0;
+			s->dfu_ack = true;
+			s->dfu_ack_us = s->bus->busy_until_us + s->dfu_page_us;
+			s->stats.dfu_pages++;
+
+			if(s->dfu_page_jitter_us)
+				s->dfu_ack_us += sim_random(s) % (s->dfu_page_jitter_us + 1);
+		}
+	}
+}
+
+static void sim_dfu_read(ads_sim_sensor_t * s, uint8_t * buffer, uint8_t len)
+{
+	memset(buffer, 0, len);
+
+	if(s->dfu_ack && sim_now_us >= s->dfu_ack_us && len > 0)
+	{
+		buffer[0] = 's';
+		s->dfu_ack = false;
+
+		// Image complete, start the new application
+		if(s->dfu_len != 0 && s->dfu_received == s->dfu_len)
+		{
+			s->fw_ver = s->fw_ver_update;
+			sim_boot(s);
+		}
+	}
+}
+
+/**
+ * @brief Models the bus time of one transfer and returns the sensor at addr.
+ *			Each bus keeps its own timeline, so transfers on independent buses
+ *			overlap while transfers on one bus queue behind each other.
+ */
+static ads_sim_sensor_t * sim_transfer(ads_sim_bus_t * bus, uint8_t addr, uint8_t len)
+{
+	ads_sim_sensor_t * s = bus->by_addr[addr & 0x7f];
+
+	bus->stats.transactions++;
+
+	if(!sim_responding(s) || sim_dfu_nack(s))
+	{
+		bus->stats.nacks++;
+		s = NULL;
+		len = 0;
+	}
+
+	bus->stats.bytes += len;
+
+	if(bus->busy_until_us < sim_now_us)
+		bus->busy_until_us = sim_now_us;
+
+	if(bus->bit_rate)
+	{
+		// Start, address, payload with ack bits, and stop
+		uint64_t bits = 2 + 9 * (1 + (uint64_t)len);
+		uint64_t us = (bits * 1000000 + bus->bit_rate - 1) / bus->bit_rate;
+
+		bus->stats.busy_us += us;
+		bus->busy_until_us += us;
+	}
+
+	bus->stats.busy_us += bus->xfer_overhead_us;
+	bus->busy_until_us += bus->xfer_overhead_us;
+
+	return s;
+}
+
+/**
+ * @brief Delivers a data ready edge of the sensor to the HAL interrupt path
+ */
+static void sim_interrupt(ads_sim_sensor_t * s)
+{
+	ads_dev_t * dev = s->dev;
+	uint8_t guard = 2;
+
+	if(dev != NULL)
+		dev->drdy_timestamp = (uint32_t)s->drdy_us;
+
+	while(dev != NULL && dev->int_enabled && s->packets && guard--)
+	{
+		s->stats.interrupts++;
+
+		if(ads_hal_read_buffer(dev, dev->read_buffer, ADS_TRANSFER_SIZE) == ADS_OK)
+			dev->read_callback(dev, dev->read_buffer);
+	}
+}
+
+/**
+ * @brief Free run sample tick of the sensor
+ */
+static void sim_tick(ads_sim_sensor_t * s)
+{
+	s->stats.samples_dropped += s->packets;
+	s->stats.samples++;
+
+	sim_sample_packet(s, ADS_SAMPLE, s->packet[0]);
+	s->packets = 1;
+
+	if(s->stretch_en)
+	{
+		sim_sample_packet(s, ADS_STRETCH_SAMPLE, s->packet[1]);
+		s->packets = 2;
+	}
+
+	s->drdy_us = sim_now_us;
+
+	sim_interrupt(s);
+}
+
+
+/************************************************************************/
+/*                          Simulator API                               */
+/************************************************************************/
+
+void ads_sim_bus_init(ads_sim_bus_t * bus, uint32_t bit_rate)
+{
+	memset(bus, 0, sizeof(*bus));
+	bus->bit_rate = bit_rate;
+}
+
+ads_sim_bus_t * ads_sim_bus_default(void)
+{
+	if(!sim_default_bus_init)
+	{
+		ads_sim_bus_init(&sim_default_bus, 0);
+		sim_default_bus_init = true;
+	}
+
+	return &sim_default_bus;
+}
+
+void ads_sim_sensor_init(ads_sim_sensor_t * sensor)
+{
+	memset(sensor, 0, sizeof(*sensor));
+
+	sensor->dev_type = ADS_DEV_ONE_AXIS_V2;
+	sensor->fw_ver = 47;
+	sensor->fw_ver_update = 47;
+	sensor->addr = ADS_DEFAULT_ADDR;
+	sensor->boot_ms = 100;
+	sensor->dfu_erase_us = 20000;
+	sensor->dfu_page_us = 2500;
+	sensor->bend_amp = 45.0f;
+	sensor->bend_freq = 1.0f;
+	sensor->stretch_amp = 10.0f;
+	sensor->stretch_freq = 0.5f;
+	sensor->heap_idx = -1;
+	sensor->cal_gain[0] = sensor->cal_gain[1] = 1.0f;
+	sensor->mode = ADS_SIM_SHUTDOWN;
+}
+
+int ads_sim_attach(ads_sim_bus_t * bus, ads_sim_sensor_t * sensor, uint32_t reset_pin, uint32_t datardy_pin)
+{
+	bus = sim_bus(bus);
+
+	if(bus->by_addr[sensor->addr & 0x7f] != NULL)
+		return ADS_ERR_BAD_PARAM;
+
+	sensor->bus = bus;
+	sensor->reset_pin = reset_pin;
+	sensor->datardy_pin = datardy_pin;
+	sensor->random = sensor->seed ? sensor->seed : 0x2545F491;
+	sensor->next = bus->sensors;
+	bus->sensors = sensor;
+	bus->by_addr[sensor->addr & 0x7f] = sensor;
+
+	// Powered off until the reset line is released
+	sensor->mode = ADS_SIM_SHUTDOWN;
+
+	return ADS_OK;
+}
+
+uint64_t ads_sim_now_us(void)
+{
+	return sim_now_us;
+}
+
+void ads_sim_advance(uint64_t us)
+{
+	uint64_t target = sim_now_us + us;
+
+	// Nested calls from delays inside an interrupt only move the clock.
+	// The outer call delivers any events that became due.
+	if(sim_in_advance)
+	{
+		sim_now_us = target;
+		return;
+	}
+
+	sim_in_advance = true;
+
+	while(sim_heap_len > 0 && sim_heap[0]->next_sample_us <= target)
+	{
+		ads_sim_sensor_t * s = sim_heap[0];
+
+		if(s->next_sample_us > sim_now_us)
+			sim_now_us = s->next_sample_us;
+
+		s->next_sample_us += sim_period_us(s);
+		sim_heap_down(0);
+
+		sim_tick(s);
+	}
+
+	sim_now_us = target;
+	sim_in_advance = false;
+}
+
+void ads_sim_reset(void)
+{
+	while(sim_heap_len > 0)
+		sim_heap_remove(sim_heap[0]);
+
+	sim_now_us = 0;
+	ads_sim_bus_init(ads_sim_bus_default(), 0);
+}
+
+
+/************************************************************************/
+/*                         HAL Implementation                           */
+/************************************************************************/
+
+/**
+ * @brief Millisecond delay routine. Advances the virtual clock.
+ */
+void ads_hal_delay(uint16_t delay_ms)
+{
+	ads_sim_advance((uint64_t)delay_ms * 1000);
+}
+
+/**
+ * @brief Microsecond delay routine. Advances the virtual clock.
+ */
+void ads_hal_delay_us(uint16_t delay_us)
+{
+	ads_sim_advance(delay_us);
+}
+
+/**
+ * @brief Monotonic microsecond time stamp. Virtual clock, wraps around at 2^32.
+ */
+uint32_t ads_hal_micros(void)
+{
+	return (uint32_t)sim_now_us;
+}
+
+/**
+ * @brief Free running cycle count, nanoseconds of CLOCK_MONOTONIC. Real
+ *			time, processing takes no virtual time.
+ */
+uint32_t ads_hal_cycles(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief Enable/Disable the pin change data ready interrupt
+ *
+ * @param dev			ADS device
+ * @param enable		true = enable, false = disable
+ */
+void ads_hal_pin_int_enable(ads_dev_t * dev, bool enable)
+{
+	dev->int_enabled = enable;
+}
+
+/**
+ * @brief Write buffer of data to the simulated sensor
+ *
+ * @param dev			ADS device
+ * @param buffer[in]	Write buffer
+ * @param len			Length of buffer.
+ * @return	ADS_OK if successful, ADS_ERR_NACK_DATA if the bootloader did
+ *			not acknowledge a data byte, ADS_ERR_IO if failed
+ */
+int ads_hal_write_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len)
+{
+	// Longer writes do not fit the modelled controller's buffer
+	if(len > ads_hal_max_write(dev))
+		return ADS_ERR_IO;
+
+	ads_sim_sensor_t * s = sim_transfer(sim_bus(dev->bus), dev->addr, len);
+
+	if(s == NULL)
+		return ADS_ERR_IO;
+
+	if(s->mode == ADS_SIM_BOOTLOADER)
+	{
+		uint8_t taken = sim_dfu_data_nack(s, len);
+
+		sim_dfu_write(s, buffer, taken);
+
+		if(taken < len)
+			return ADS_ERR_NACK_DATA;
+	}
+	else
+		sim_command(s, buffer, len);
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Longest buffer ads_hal_write_buffer sends in one bus transaction,
+ *			the max_write of the bus
+ *
+ * @param dev			ADS device
+ * @return	Maximum write length in bytes
+ */
+uint8_t ads_hal_max_write(ads_dev_t * dev)
+{
+	ads_sim_bus_t * bus = sim_bus(dev->bus);
+
+	return bus->max_write ? bus->max_write : 255;
+}
+
+/**
+ * @brief Read buffer of data from the simulated sensor
+ *
+ * @param dev			ADS device
+ * @param buffer[out]	Read buffer
+ * @param len			Length of data to read in number of bytes.
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_read_buffer(ads_dev_t * dev, uint8_t * buffer, uint8_t len)
+{
+	ads_sim_sensor_t * s = sim_transfer(sim_bus(dev->bus), dev->addr, len);
+
+	if(s == NULL)
+		return ADS_ERR_IO;
+
+	if(s->mode == ADS_SIM_BOOTLOADER)
+	{
+		sim_dfu_read(s, buffer, len);
+		return ADS_OK;
+	}
+
+	uint8_t packet[ADS_TRANSFER_SIZE] = {0, 0, 0};
+
+	if(s->reply_pending)
+	{
+		memcpy(packet, s->reply, ADS_TRANSFER_SIZE);
+		s->reply_pending = false;
+	}
+	else if(s->mode == ADS_SIM_POLLED)
+	{
+		sim_sample_packet(s, s->polled_next, packet);
+		s->stats.samples++;
+		s->stats.samples_read++;
+
+		if(s->stretch_en)
+			s->polled_next = (s->polled_next == ADS_SAMPLE) ? ADS_STRETCH_SAMPLE : ADS_SAMPLE;
+	}
+	else if(s->packets)
+	{
+		uint32_t latency = (uint32_t)(s->bus->busy_until_us - s->drdy_us);
+
+		memcpy(packet, s->packet[0], ADS_TRANSFER_SIZE);
+		memcpy(s->packet[0], s->packet[1], ADS_TRANSFER_SIZE);
+		s->packets--;
+
+		s->stats.samples_read++;
+		s->stats.latency_us_sum += latency;
+		if(latency > s->stats.latency_us_max)
+			s->stats.latency_us_max = latency;
+	}
+
+	memcpy(buffer, packet, (len < ADS_TRANSFER_SIZE) ? len : ADS_TRANSFER_SIZE);
+	if(len > ADS_TRANSFER_SIZE)
+		memset(&buffer[ADS_TRANSFER_SIZE], 0, len - ADS_TRANSFER_SIZE);
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Write a command to the simulated sensor and read back its reply
+ *
+ * @param dev			ADS device
+ * @param wbuf[in]		Command buffer
+ * @param wlen			Length of command
+ * @param rbuf[out]		Reply buffer
+ * @param rlen			Length of reply
+ * @param delay_ms		Time the ADS needs between command and reply
+ * @return	ADS_OK if successful ADS_ERR_IO if failed
+ */
+int ads_hal_write_read(ads_dev_t * dev, uint8_t * wbuf, uint8_t wlen, uint8_t * rbuf, uint8_t rlen, uint16_t delay_ms)
+{
+	if(ads_hal_write_buffer(dev, wbuf, wlen) != ADS_OK)
+		return ADS_ERR_IO;
+
+	ads_hal_delay(delay_ms);
+
+	return ads_hal_read_buffer(dev, rbuf, rlen);
+}
+
+/**
+ * @brief Reset the simulated sensor wired to the reset pin of the device
+ *
+ * @param dev			ADS device
+ */
+void ads_hal_reset(ads_dev_t * dev)
+{
+	ads_sim_sensor_t * s;
+
+	// Reset line held low for 10ms
+	ads_hal_delay(10);
+
+	for(s = sim_bus(dev->bus)->sensors; s != NULL; s = s->next)
+	{
+		if(s->reset_pin == dev->reset_pin)
+			sim_boot(s);
+	}
+}
+
+/**
+ * @brief Holds the simulated sensor wired to the reset pin of the device in
+ *			reset, not answering on the bus, or releases it to boot
+ *
+ * @param dev			ADS device
+ * @param hold			true = hold in reset, false = release
+ */
+void ads_hal_hold_reset(ads_dev_t * dev, bool hold)
+{
+	ads_sim_sensor_t * s;
+
+	for(s = sim_bus(dev->bus)->sensors; s != NULL; s = s->next)
+	{
+		if(s->reset_pin != dev->reset_pin)
+			continue;
+
+		if(hold)
+		{
+			sim_set_mode(s, ADS_SIM_SHUTDOWN);
+		}
+		else if(s->mode == ADS_SIM_SHUTDOWN)
+		{
+			// Answer at its address again, taken over while held by a
+			// bootloader at the same address
+			s->bus->by_addr[s->addr & 0x7f] = s;
+			sim_boot(s);
+		}
+	}
+}
+
+/**
+ * @brief Initializes the hardware abstraction layer. Binds the device to the
+ *			simulated sensor with the same reset and data ready pins.
+ *
+ * @param dev			ADS device
+ * @return	ADS_OK if successful ADS_ERR_IO if no sensor is wired to the pins
+ */
+int ads_hal_init(ads_dev_t * dev, void (*callback)(ads_dev_t*,uint8_t*), uint32_t reset_pin, uint32_t datardy_pin)
+{
+	ads_sim_sensor_t * s;
+
+	dev->reset_pin   = reset_pin;
+	dev->datardy_pin = datardy_pin;
+	dev->hal_slot    = 0;
+
+	if(dev->addr == 0)
+		dev->addr = ADS_DEFAULT_ADDR;
+
+	// NULL is the default bus, named so devices on it compare equal
+	if(dev->bus == NULL)
+		dev->bus = ads_sim_bus_default();
+
+	dev->read_callback = callback;
+
+	for(s = sim_bus(dev->bus)->sensors; s != NULL; s = s->next)
+	{
+		if(s->reset_pin == reset_pin && s->datardy_pin == datardy_pin)
+			break;
+	}
+
+	if(s == NULL)
+		return ADS_ERR_IO;
+
+	s->dev = dev;
+
+	// Reset the ads, ads_init waits for it to answer
+	ads_hal_reset(dev);
+
+	dev->int_enabled = true;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Gets the current i2c address that the hal layer is addressing.
+ *
+ * @param dev			ADS device
+ * @return	uint8_t address
+ */
+uint8_t ads_hal_get_address(ads_dev_t * dev)
+{
+	return dev->addr;
+}
+
+/**
+ * @brief Sets the i2c address that the hal layer is addressing
+ *
+ * @param dev			ADS device
+ * @param address		i2c address hal to communicate with
+ */
+void ads_hal_set_address(ads_dev_t * dev, uint8_t address)
+{
+	dev->addr = address;
+}
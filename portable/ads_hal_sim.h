@@ -0,0 +1,198 @@
+/**
+ * ads_hal_sim.h
+ *
+ * Host side ADS simulator. Implements the ads_hal.h interface against
+ * emulated one axis sensors running on a virtual clock, in place of
+ * ads_hal_i2c.c. Link one or the other, not both.
+ *
+ * Each ads_dev_t.bus points to an ads_sim_bus_t (NULL selects a default
+ * bus). Simulated sensors are attached to a bus with the same reset and
+ * data ready pin numbers that are later passed to ads_init, which is how
+ * the HAL wires a driver device to its sensor.
+ *
+ * Time only moves when ads_hal_delay or ads_sim_advance are called. The
+ * device id probe in ads_init, repeated every ADS_INIT_PROBE_MS until the
+ * sensor has booted, therefore costs nothing in wall time.
+ * Bus transfer time is modelled per bus from its bit rate and reported in
+ * the bus and sensor statistics, without moving the clock.
+ *
+ * The bootloader is emulated as ads_dfu.c drives it: the 4 byte image length,
+ * an 's' acknowledgement after the flash erase and after each page write,
+ * with configurable erase and page write times, random page write jitter and
+ * random NACKs, of the address or of a data byte after the bytes before it
+ * were taken. portable/tools/ads_dfu_bench.c benchmarks updates against it.
+ */
+
+#ifndef ADS_HAL_SIM_H_
+#define ADS_HAL_SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ads_hal.h"
+#include "ads_util.h"
+
+#ifndef ADS_SIM_MAX_SENSORS
+#define ADS_SIM_MAX_SENSORS		(4096)		// Maximum number of free running simulated sensors
+#endif
+
+#define ADS_SIM_BOOTLOADER_ADDRESS	(0x12)	// I2C address of the sensor bootloader
+#define ADS_SIM_DFU_PAGE_SIZE		(64)	// Bootloader page size, acknowledged per page
+
+typedef struct ads_sim_sensor_s ads_sim_sensor_t;
+
+/* Sensor firmware state */
+typedef enum {
+	ADS_SIM_STANDBY = 0,				// Powered, not sampling
+	ADS_SIM_RUN,						// Free run, samples at sps with data ready edges
+	ADS_SIM_POLLED,						// New sample taken on every read
+	ADS_SIM_SHUTDOWN,					// No I2C response until reset
+	ADS_SIM_BOOTLOADER					// Firmware update mode at ADS_SIM_BOOTLOADER_ADDRESS
+} ADS_SIM_MODE_T;
+
+/* Statistics of one simulated I2C bus */
+typedef struct {
+	uint32_t transactions;				// Read and write transfers addressed on the bus
+	uint32_t nacks;						// Transfers not acknowledged, of the address or a data byte
+	uint64_t bytes;						// Payload bytes moved
+	uint64_t busy_us;					// Modelled time the bus was occupied
+} ads_sim_bus_stats_t;
+
+/* Statistics of one simulated sensor */
+typedef struct {
+	uint32_t samples;					// Sample packets produced in free run
+	uint32_t samples_read;				// Sample packets read by the host
+	uint32_t samples_dropped;			// Sample packets overwritten before they were read
+	uint32_t interrupts;				// Data ready edges delivered to the HAL
+	uint64_t latency_us_sum;			// Sum of data ready to end of read latency
+	uint32_t latency_us_max;			// Largest data ready to end of read latency
+	uint32_t dfu_pages;					// Bootloader pages written
+	uint32_t dfu_nacks;					// Bootloader transfers not acknowledged at random
+	uint32_t dfu_data_nacks;			// Bootloader writes not acknowledged at a random data byte
+} ads_sim_sensor_stats_t;
+
+typedef struct {
+	uint32_t bit_rate;					// Modelled I2C bit rate, 0 for zero cost transfers
+	uint32_t xfer_overhead_us;			// Controller and driver setup time added to each transfer
+	uint8_t max_write;					// Longest write the modelled controller sends, e.g. 32 for AVR Wire, 0 for 255
+	ads_sim_sensor_t * sensors;			// List of attached sensors
+	ads_sim_sensor_t * by_addr[128];	// Sensor answering at each 7-bit address
+	uint64_t busy_until_us;				// End of the last modelled transfer
+	ads_sim_bus_stats_t stats;
+} ads_sim_bus_t;
+
+/**
+ * @brief Signal generator. Returns the physical bend angle in degrees or
+ *			stretch in mm of the sensor at time t_us.
+ */
+typedef float (*ads_sim_signal)(ads_sim_sensor_t * sensor, uint8_t packet_type, uint64_t t_us);
+
+struct ads_sim_sensor_s {
+	/* Configuration, set before ads_sim_attach */
+	ADS_DEV_TYPE_T dev_type;			// Reported device type
+	uint16_t fw_ver;					// Reported firmware version
+	uint16_t fw_ver_update;				// Firmware version after a completed update
+	uint8_t addr;						// I2C address, persists across reset
+	uint32_t boot_ms;					// Time from reset release to first I2C response
+	uint32_t dfu_erase_us;				// Bootloader flash erase time, before the length is acknowledged
+	uint32_t dfu_page_us;				// Bootloader page write time, before the page is acknowledged
+	uint32_t dfu_page_jitter_us;		// Random extra page write time, up to this
+	uint32_t dfu_nack_ppm;				// Bootloader transfers not acknowledged at random, per million
+	uint32_t dfu_data_nack_ppm;			// Bootloader writes not acknowledged at a random data byte, per million
+	uint32_t seed;						// Seed of the random jitter and NACKs, 0 for a fixed default
+	float bend_amp;						// Default signal, bend amplitude in degrees
+	float bend_freq;					// Default signal, bend frequency in Hz
+	float stretch_amp;					// Default signal, stretch amplitude in mm
+	float stretch_freq;					// Default signal, stretch frequency in Hz
+	ads_sim_signal signal;				// Signal generator, NULL for the default sine
+	void * user_data;					// Free for signal generator use
+
+	/* Wiring */
+	ads_sim_bus_t * bus;
+	ads_sim_sensor_t * next;
+	uint32_t reset_pin;
+	uint32_t datardy_pin;
+	ads_dev_t * dev;					// Driver device bound by ads_hal_init
+
+	/* Firmware state */
+	ADS_SIM_MODE_T mode;
+	uint16_t sps;						// Sample period in 1/16384 s ticks
+	bool stretch_en;
+	uint64_t boot_done_us;				// Not answering before this time
+	uint64_t next_sample_us;			// Next free run sample
+	int32_t heap_idx;					// Position in the event heap, -1 if not queued
+	float cal_gain[2];					// Calibration of bend and stretch
+	float cal_offset[2];
+	float cal_raw[2];					// Raw value at first calibration point
+	float cal_ref[2];					// Reference value at first calibration point
+	uint8_t reply[ADS_TRANSFER_SIZE];	// Command reply returned by next read
+	bool reply_pending;
+	uint8_t packet[2][ADS_TRANSFER_SIZE];	// Unread sample packets, bend then stretch
+	uint8_t packets;
+	uint64_t drdy_us;					// Time data ready was asserted
+	uint8_t polled_next;				// Packet type returned by next polled read
+
+	/* Bootloader state */
+	uint32_t dfu_len;					// Image length, 0 until the header is received
+	uint32_t dfu_received;				// Image bytes received
+	uint8_t dfu_hdr[4];
+	uint8_t dfu_hdr_len;
+	uint8_t dfu_page_fill;				// Bytes received in the current page
+	bool dfu_ack;						// Acknowledgement ready to be read
+	uint64_t dfu_ack_us;				// Not acknowledging before this time, flash busy
+	uint32_t random;					// Random number state, from seed
+
+	ads_sim_sensor_stats_t stats;
+};
+
+/**
+ * @brief Initializes a simulated bus
+ *
+ * @param bus			Bus to initialize
+ * @param bit_rate		Modelled I2C bit rate, e.g. 400000. 0 makes transfers free
+ */
+void ads_sim_bus_init(ads_sim_bus_t * bus, uint32_t bit_rate);
+
+/**
+ * @brief Returns the bus used by devices with a NULL bus handle
+ */
+ads_sim_bus_t * ads_sim_bus_default(void);
+
+/**
+ * @brief Fills a sensor with default configuration, one axis v2 at the
+ *			default address with a 1 Hz, 45 degree sine bend signal
+ *
+ * @param sensor		Sensor to initialize
+ */
+void ads_sim_sensor_init(ads_sim_sensor_t * sensor);
+
+/**
+ * @brief Attaches a powered off sensor to a bus. The sensor boots when its
+ *			reset line is released by ads_hal_reset or ads_hal_hold_reset.
+ *
+ * @param bus			Bus the sensor is on, NULL for the default bus
+ * @param sensor		Sensor, initialized with ads_sim_sensor_init
+ * @param reset_pin		Reset pin number used by the driver for this sensor
+ * @param datardy_pin	Data ready pin number used by the driver for this sensor
+ * @return	ADS_OK if successful ADS_ERR_BAD_PARAM if the address is taken
+ */
+int ads_sim_attach(ads_sim_bus_t * bus, ads_sim_sensor_t * sensor, uint32_t reset_pin, uint32_t datardy_pin);
+
+/**
+ * @brief Current virtual time in microseconds
+ */
+uint64_t ads_sim_now_us(void);
+
+/**
+ * @brief Advances the virtual clock, producing samples and delivering data
+ *			ready interrupts of every sensor due in the interval, in time order.
+ *
+ * @param us			Microseconds to advance
+ */
+void ads_sim_advance(uint64_t us);
+
+/**
+ * @brief Resets the virtual clock and detaches all sensors from the default bus
+ */
+void ads_sim_reset(void);
+
+#endif /* ADS_HAL_SIM_H_ */
@@ -0,0 +1,233 @@
+/**
+ * ads_kalman.c
+ *
+ * Constant velocity and constant acceleration Kalman trackers
+ */
+
+#include "ads_kalman.h"
+
+/**
+ * @brief Starts the track at rest at sample
+ */
+static void kalman_settle(ads_kalman_t * k, float sample, uint32_t timestamp_us)
+{
+	memset(k->x, 0, sizeof(k->x));
+	memset(k->p, 0, sizeof(k->p));
+	
+	k->x[0] = sample;
+	k->p[0][0] = k->r;
+	k->p[1][1] = ADS_KALMAN_INIT_VELOCITY * ADS_KALMAN_INIT_VELOCITY;
+	k->p[2][2] = ADS_KALMAN_INIT_ACCEL * ADS_KALMAN_INIT_ACCEL;
+	k->last_us = timestamp_us;
+	k->residual = 0;
+	k->settled = true;
+}
+
+/**
+ * @brief Moves the track dt seconds ahead. The motion model F is upper
+ *			triangular with 1, dt, dt^2 / 2 on its diagonals, so x and P are
+ *			multiplied in place, lower rows and columns first.
+ */
+static void kalman_predict(ads_kalman_t * k, float dt)
+{
+	float f[3] = { 1.0f, dt, 0.5f * dt * dt };
+	float g[3];
+	uint8_t n = k->states, i, j, m;
+	
+	// x = F x
+	for(i = 0; i < n; i++)
+		for(m = i + 1; m < n; m++)
+			k->x[i] += f[m - i] * k->x[m];
+	
+	// P = F P F'
+	for(j = 0; j < n; j++)
+		for(i = 0; i < n; i++)
+			for(m = i + 1; m < n; m++)
+				k->p[i][j] += f[m - i] * k->p[m][j];
+	
+	for(i = 0; i < n; i++)
+		for(j = 0; j < n; j++)
+			for(m = j + 1; m < n; m++)
+				k->p[i][j] += k->p[i][m] * f[m - j];
+	
+	// P += q g g', the highest derivative changing by a random step over dt
+	g[n - 1] = dt;
+	g[n - 2] = f[2];
+	
+	if(n > 2)
+		g[0] = f[2] * dt / 3.0f;
+	
+	for(i = 0; i < n; i++)
+		for(j = 0; j < n; j++)
+			k->p[i][j] += k->q * g[i] * g[j];
+}
+
+/**
+ * @brief Corrects the track with a sample of the angle
+ */
+static void kalman_correct(ads_kalman_t * k, float sample)
+{
+	float row[3], gain[3];
+	uint8_t n = k->states, i, j;
+	float s = k->p[0][0] + k->r;
+	
+	k->residual = sample - k->x[0];
+	
+	for(i = 0; i < n; i++)
+	{
+		row[i] = k->p[0][i];
+		gain[i] = k->p[i][0] / s;
+		k->x[i] += gain[i] * k->residual;
+	}
+	
+	for(i = 0; i < n; i++)
+		for(j = 0; j < n; j++)
+			k->p[i][j] -= gain[i] * row[j];
+	
+	// Rounding must not leave P unsymmetric
+	for(i = 0; i < n; i++)
+		for(j = i + 1; j < n; j++)
+			k->p[i][j] = k->p[j][i] = 0.5f * (k->p[i][j] + k->p[j][i]);
+}
+
+/**
+ * @brief Initializes a tracker
+ *
+ * @param k				Tracker
+ * @param model			ADS_KALMAN_CV or ADS_KALMAN_CA
+ * @param noise			Standard deviation of the samples, e.g. 0.05 degrees
+ * @param process		Standard deviation of the change in motion: of the
+ *						acceleration, degrees/s^2, for ADS_KALMAN_CV, of the
+ *						jerk, degrees/s^3, for ADS_KALMAN_CA. Higher follows
+ *						sudden moves closer, lower is smoother.
+ * @param lead_us		Prediction lead, e.g. the latency of the control loop,
+ *						at most ADS_KALMAN_MAX_GAP_US
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_kalman_init(ads_kalman_t * k, ADS_KALMAN_MODEL_T model, float noise, float process, uint32_t lead_us)
+{
+	if((model != ADS_KALMAN_CV && model != ADS_KALMAN_CA) || !(noise > 0) || !(process > 0) ||
+	   lead_us > ADS_KALMAN_MAX_GAP_US)
+		return ADS_ERR_BAD_PARAM;
+	
+	memset(k, 0, sizeof(*k));
+	
+	k->states = (uint8_t)model;
+	k->r = noise * noise;
+	k->q = process * process;
+	k->lead_us = lead_us;
+	
+	return ADS_OK;
+}
+
+/**
+ * @brief Clears the track, the next sample starts it again
+ *
+ * @param k				Tracker
+ */
+void ads_kalman_reset(ads_kalman_t * k)
+{
+	k->settled = false;
+	k->residual = 0;
+	
+	memset(k->x, 0, sizeof(k->x));
+}
+
+/**
+ * @brief Takes one sample. The first sample, or the first after a gap of
+ *			more than ADS_KALMAN_MAX_GAP_US, starts the track at rest there.
+ *
+ * @param k				Tracker
+ * @param sample		New sample
+ * @param timestamp_us	ads_hal_micros() when it was taken, e.g. ads_sample_t
+ *						timestamp, or ads_hal_micros() after ads_read_polled
+ */
+void ads_kalman_update(ads_kalman_t * k, float sample, uint32_t timestamp_us)
+{
+	int32_t dt_us = (int32_t)(timestamp_us - k->last_us);
+	
+	if(!k->settled || dt_us > ADS_KALMAN_MAX_GAP_US)
+	{
+		kalman_settle(k, sample, timestamp_us);
+		return;
+	}
+	
+	// A sample stamped no later than the last is taken as of the last
+	if(dt_us > 0)
+	{
+		kalman_predict(k, dt_us * 1e-6f);
+		k->last_us = timestamp_us;
+	}
+	
+	kalman_correct(k, sample);
+}
+
+/**
+ * @brief Takes the channel of a time stamped sample, if the sample updated it
+ *
+ * @param k				Tracker
+ * @param sample		Sample from ads_timestamped_callback or ads_read_batch
+ * @param data_type		Channel tracked, ADS_SAMPLE or ADS_STRETCH_SAMPLE
+ * @return	true if the sample was of data_type and was taken
+ */
+bool ads_kalman_update_sample(ads_kalman_t * k, const ads_sample_t * sample, uint8_t data_type)
+{
+	if(sample->data_type != data_type)
+		return false;
+	
+	if(data_type == ADS_SAMPLE)
+		ads_kalman_update(k, sample->sample[0], sample->timestamp);
+	else if(data_type == ADS_STRETCH_SAMPLE)
+		ads_kalman_update(k, sample->sample[1], sample->timestamp);
+	else
+		return false;
+	
+	return true;
+}
+
+/**
+ * @brief Smoothed angle as of the last sample
+ *
+ * @param k				Tracker
+ * @return	angle, or stretch, 0 before the first sample
+ */
+float ads_kalman_angle(const ads_kalman_t * k)
+{
+	return k->x[0];
+}
+
+/**
+ * @brief Angular velocity as of the last sample
+ *
+ * @param k				Tracker
+ * @return	velocity per second, 0 before the first sample
+ */
+float ads_kalman_velocity(const ads_kalman_t * k)
+{
+	return k->x[1];
+}
+
+/**
+ * @brief Predicts the angle lead_us past time_us from the track. Passing the
+ *			time of use, ads_hal_micros(), makes up for the age of the last
+ *			sample as well as for the lead.
+ *
+ * @param k				Tracker
+ * @param time_us		Time the prediction is for, before the lead
+ * @return	angle, the last angle for times before the last sample, 0 before
+ *			the first sample
+ */
+float ads_kalman_predict(const ads_kalman_t * k, uint32_t time_us)
+{
+	int32_t ahead_us = (int32_t)(time_us - k->last_us);
+	float t;
+	
+	if(ahead_us < 0)
+		return k->x[0];
+	
+	// Extrapolating far past the samples only adds error
+	ahead_us = (ahead_us + k->lead_us > ADS_KALMAN_MAX_GAP_US) ? ADS_KALMAN_MAX_GAP_US : ahead_us + k->lead_us;
+	t = ahead_us * 1e-6f;
+	
+	return k->x[0] + k->x[1] * t + 0.5f * k->x[2] * t * t;
+}
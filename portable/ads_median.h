@@ -0,0 +1,145 @@
+/**
+ * ads_median.h
+ *
+ * Sliding window median and Hampel filters, to reject the single sample
+ * spikes of I2C glitches and connector movement that a low pass would
+ * smear over many outputs and a deadzone passes through.
+ *
+ * The median keeps the window in two heaps around the median, the samples
+ * below it in a max heap and those above in a min heap, with the position
+ * of every sample in them. A new sample replaces the oldest in its place
+ * and moves up or down its heap, and across the median into the other, so
+ * an update takes O(log window) compares instead of a sort of the window.
+ *
+ * The Hampel filter passes samples through unless one is further from the
+ * median than a number of scaled median absolute deviations, the MAD, and
+ * then passes the median instead. So unlike the median alone it adds no
+ * lag and leaves the detail of good samples. The MAD is the running median
+ * of the distance of each sample from the median as of when it came in,
+ * which keeps it O(log window) too.
+ */
+
+#ifndef ADS_MEDIAN_H_
+#define ADS_MEDIAN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ads.h"
+#include "ads_pipeline.h"
+
+/* Longest window, odd, at most 127 */
+#ifndef ADS_MEDIAN_MAX_WINDOW
+#define ADS_MEDIAN_MAX_WINDOW		(31)
+#endif
+
+#if !(ADS_MEDIAN_MAX_WINDOW & 1) || ADS_MEDIAN_MAX_WINDOW > 127
+#error "ADS_MEDIAN_MAX_WINDOW must be odd and no larger than 127"
+#endif
+
+typedef struct {
+	uint8_t window;						// Odd, up to ADS_MEDIAN_MAX_WINDOW
+	uint8_t count;						// Samples in the window
+	uint8_t head;						// Slot of data written next, the oldest once the window is full
+	float data[ADS_MEDIAN_MAX_WINDOW];	// Samples in arrival order
+	int8_t pos[ADS_MEDIAN_MAX_WINDOW];	// Heap position of each sample, negative in the max heap
+	uint8_t heap[ADS_MEDIAN_MAX_WINDOW];	// Samples by heap position + window / 2, the median at window / 2
+} ads_median_t;
+
+typedef struct {
+	ads_median_t median;				// Of the samples
+	ads_median_t deviation;				// Of the distances of the samples from the median
+	float threshold;					// MADs a sample may be from the median, scaled to the noise
+	float min_deviation;				// Distance always accepted, for a still sensor
+	uint32_t outliers;					// Samples replaced by the median
+} ads_hampel_t;
+
+/* Running median pipeline stage */
+typedef struct {
+	ads_stage_t stage;
+	ads_median_t median;
+} ads_stage_median_t;
+
+/* Hampel pipeline stage */
+typedef struct {
+	ads_stage_t stage;
+	ads_hampel_t hampel;
+} ads_stage_hampel_t;
+
+/**
+ * @brief Initializes a running median
+ *
+ * @param median		Median
+ * @param window		Samples, odd, 1 to ADS_MEDIAN_MAX_WINDOW
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if window is out of range
+ */
+int ads_median_init(ads_median_t * median, uint8_t window);
+
+/**
+ * @brief Empties the window
+ *
+ * @param median		Median
+ */
+void ads_median_reset(ads_median_t * median);
+
+/**
+ * @brief Takes one sample, in place of the oldest once the window is full.
+ *			The window fills from the first samples, the upper median is
+ *			returned while it holds an even number.
+ *
+ * @param median		Median
+ * @param sample		New sample
+ * @return	median of the window
+ */
+float ads_median_apply(ads_median_t * median, float sample);
+
+/**
+ * @brief Initializes a Hampel filter
+ *
+ * @param hampel		Hampel filter
+ * @param window		Samples, odd, 3 to ADS_MEDIAN_MAX_WINDOW
+ * @param threshold		Scaled MADs a sample may be from the median, e.g. 3,
+ *						a standard deviation each for normal noise
+ * @param min_deviation	Distance from the median always accepted, e.g. a few
+ *						times the noise of a still sensor, whose MAD is ~0
+ * @return	ADS_OK if successful, ADS_ERR_BAD_PARAM if a parameter is out of range
+ */
+int ads_hampel_init(ads_hampel_t * hampel, uint8_t window, float threshold, float min_deviation);
+
+/**
+ * @brief Empties the windows, the outlier count is kept
+ *
+ * @param hampel		Hampel filter
+ */
+void ads_hampel_reset(ads_hampel_t * hampel);
+
+/**
+ * @brief Takes one sample
+ *
+ * @param hampel		Hampel filter
+ * @param sample		New sample
+ * @return	sample, or the median of the window if sample is an outlier
+ */
+float ads_hampel_apply(ads_hampel_t * hampel, float sample);
+
+/**
+ * @brief Running median stage. The window fills from the first samples.
+ *
+ * @param stage			Stage
+ * @param window		Samples, odd, 1 to ADS_MEDIAN_MAX_WINDOW
+ * @return	&stage->stage, for ads_pipeline_add, NULL if window is out of range
+ */
+ads_stage_t * ads_stage_median(ads_stage_median_t * stage, uint8_t window);
+
+/**
+ * @brief Hampel stage, see ads_hampel_init
+ *
+ * @param stage			Stage
+ * @param window		Samples, odd, 3 to ADS_MEDIAN_MAX_WINDOW
+ * @param threshold		Scaled MADs a sample may be from the median
+ * @param min_deviation	Distance from the median always accepted
+ * @return	&stage->stage, for ads_pipeline_add, NULL if a parameter is out of range
+ */
+ads_stage_t * ads_stage_hampel(ads_stage_hampel_t * stage, uint8_t window, float threshold, float min_deviation);
+
+#endif /* ADS_MEDIAN_H_ */
@@ -0,0 +1,283 @@
+/**
+ * ads_dfu_bench.c
+ *
+ * Host benchmark of firmware updates against the bootloader emulated by
+ * ads_hal_sim.c. Each row updates fresh simulated sensors with one update
+ * strategy and reports the update time, in virtual time, with the bus
+ * transactions and the driver's ads_dfu_stats_t, so changes to the update
+ * path can be judged against numbers. Results are the same for the same
+ * options.
+ *
+ * Build and run from portable/tools:
+ *	cc -O2 -I.. -o ads_dfu_bench ads_dfu_bench.c ../ads.c ../ads_dfu.c ../ads_fleet.c
+ *		../ads_hal_sim.c ../ads_fw_v2.c ../ads_fw_v2_lz.c -lm
+ *	./ads_dfu_bench [-e erase_us] [-p page_us] [-j jitter_us] [-s seed]
+ *
+ * Strategies:
+ *	chunked		Pages sent in 32 byte writes, as with the AVR Wire buffer
+ *	page		Whole pages sent in one write
+ *	lz			Compressed image decompressed page by page
+ *	cold/warm	Page write time unknown, or learned by an update before
+ *	nack		Bootloader transfers not acknowledged at random
+ *	data nack	Bootloader writes not acknowledged at a data byte, failing
+ *				the update
+ *	fleet		Four sensors updated with ads_fleet_run on one to four buses,
+ *				or left on the default bus with dev->bus NULL
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define ADS_FW_INCLUDE_ADS1_V1	(0)
+#define ADS_FW_INCLUDE_ADS1_V2	(1)
+#include "ads.h"
+#include "ads_dfu.h"
+#include "ads_fleet.h"
+#include "ads_hal_sim.h"
+
+#define BENCH_SENSORS		(4)		// Sensors of the fleet rows
+
+/* One row of the benchmark */
+typedef struct {
+	const char * name;
+	uint32_t bit_rate;				// Bus bit rate
+	uint8_t max_write;				// Longest write, 0 for 255
+	bool lz;						// Compressed image
+	bool warm;						// Page write time learned by an update before
+	uint32_t nack_ppm;				// Random NACKs per million bootloader transfers
+	uint32_t data_nack_ppm;			// Random data NACKs per million bootloader writes
+	uint8_t buses;					// Buses of the fleet, 0 for a single sensor
+	bool default_bus;				// Fleet on the default bus, dev->bus NULL
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+	{ "chunked cold",			400000, 32, false, false,     0,     0, 0 },
+	{ "chunked warm",			400000, 32, false, true,      0,     0, 0 },
+	{ "page cold",				400000,  0, false, false,     0,     0, 0 },
+	{ "page warm",				400000,  0, false, true,      0,     0, 0 },
+	{ "page warm 100 kHz",		100000,  0, false, true,      0,     0, 0 },
+	{ "page warm 1 MHz",		1000000, 0, false, true,      0,     0, 0 },
+	{ "lz page warm",			400000,  0, true,  true,      0,     0, 0 },
+	{ "page warm nack 0.1%",	400000,  0, false, true,   1000,     0, 0 },
+	{ "page warm nack 1%",		400000,  0, false, true,  10000,     0, 0 },
+	{ "chunked warm nack 1%",	400000, 32, false, true,  10000,     0, 0 },
+	{ "page cold data nack 1%",	400000,  0, false, false,     0, 10000, 0 },
+	{ "fleet 1 bus",			400000,  0, false, false,     0,     0, 1 },
+	{ "fleet 2 buses",			400000,  0, false, false,     0,     0, 2 },
+	{ "fleet 4 buses",			400000,  0, false, false,     0,     0, 4 },
+	{ "fleet default bus",		400000,  0, false, false,     0,     0, 1, true },
+};
+
+/* Sensor configuration from the command line */
+static uint32_t erase_us = 20000;
+static uint32_t page_us = 2500;
+static uint32_t jitter_us = 0;
+static uint32_t seed = 1;
+
+static ads_sim_bus_t buses[BENCH_SENSORS];
+static ads_sim_sensor_t sensors[BENCH_SENSORS];
+static ads_dev_t devs[BENCH_SENSORS];
+static ads_dfu_lz_t lz[ADS_FLEET_MAX_BUSES];
+static bool bench_lz;
+
+static void bench_callback(ads_dev_t * dev, float * sample, uint8_t data_type)
+{
+	(void)dev;
+	(void)sample;
+	(void)data_type;
+}
+
+static const ads_fw_image_t * bench_image(ADS_DEV_TYPE_T ads_dev_type)
+{
+	if(ads_dev_type != ADS_DEV_ONE_AXIS_V2)
+		return NULL;
+
+	return bench_lz ? &ads_fw_v2_lz_image : &ads_fw_v2_image;
+}
+
+/* Attaches sensor i to its bus, out of date and running the application */
+static void bench_attach(const bench_case_t * c, uint8_t i, ads_sim_bus_t * bus)
+{
+	ads_sim_sensor_t * s = &sensors[i];
+
+	ads_sim_sensor_init(s);
+	s->addr = ADS_DEFAULT_ADDR + i;
+	s->fw_ver = ads_fw_v2_image.rev - 1;
+	s->fw_ver_update = ads_fw_v2_image.rev;
+	s->dfu_erase_us = erase_us;
+	s->dfu_page_us = page_us;
+	s->dfu_page_jitter_us = jitter_us;
+	s->dfu_nack_ppm = c->nack_ppm;
+	s->dfu_data_nack_ppm = c->data_nack_ppm;
+	s->seed = seed + i;
+	ads_sim_attach(bus, s, 10 + i, 20 + i);
+
+	memset(&devs[i], 0, sizeof(devs[i]));
+	devs[i].bus = c->default_bus ? NULL : bus;
+	devs[i].addr = s->addr;
+}
+
+/* Updates a single sensor, returns the result of the update timed */
+static int bench_single(const bench_case_t * c, uint64_t * time_us)
+{
+	ads_dev_t * dev = &devs[0];
+	ads_init_t init = {0};
+	int ret_val = ADS_OK;
+
+	bench_attach(c, 0, &buses[0]);
+
+	init.sps = ADS_100_HZ;
+	init.ads_sample_callback = bench_callback;
+	init.reset_pin = 10;
+	init.datardy_pin = 20;
+	init.bus = dev->bus;
+	init.addr = dev->addr;
+
+	if(ads_init(dev, &init) != ADS_OK)
+		return ADS_ERR_IO;
+
+	for(int run = c->warm ? 0 : 1; run < 2; run++)
+	{
+		ads_hal_pin_int_enable(dev, false);
+
+		if(ads_dfu_reset(dev) != ADS_OK)
+			return ADS_ERR_IO;
+
+		ads_hal_delay(ADS_FLEET_BOOTLOADER_MS);
+
+		// The timed update starts with fresh bus statistics
+		buses[0].stats = (ads_sim_bus_stats_t){0};
+
+		uint64_t start_us = ads_sim_now_us();
+
+		ret_val = ads_dfu_update_image(dev, bench_image(ADS_DEV_ONE_AXIS_V2));
+
+		*time_us = ads_sim_now_us() - start_us;
+
+		// Back in the application, out of date again for the next run
+		ads_hal_delay(300);
+		sensors[0].fw_ver = ads_fw_v2_image.rev - 1;
+	}
+
+	return ret_val;
+}
+
+/* Updates BENCH_SENSORS sensors spread over c->buses buses */
+static int bench_fleet(const bench_case_t * c, uint64_t * time_us)
+{
+	static ads_fleet_entry_t entries[BENCH_SENSORS];
+	static ads_fleet_t fleet;
+
+	for(uint8_t i = 0; i < BENCH_SENSORS; i++)
+	{
+		bench_attach(c, i, c->default_bus ? ads_sim_bus_default() : &buses[i % c->buses]);
+
+		entries[i].dev = &devs[i];
+		entries[i].reset_pin = 10 + i;
+		entries[i].datardy_pin = 20 + i;
+	}
+
+	if(ads_fleet_init_images(&fleet, entries, BENCH_SENSORS, &bench_image, lz) != ADS_OK)
+		return ADS_ERR;
+
+	int ret_val = ads_fleet_run(&fleet);
+
+	*time_us = fleet.total_us;
+
+	return ret_val;
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: ads_dfu_bench [-e erase_us] [-p page_us] [-j jitter_us] [-s seed]\n");
+	exit(2);
+}
+
+int main(int argc, char ** argv)
+{
+	int opt;
+
+	while((opt = getopt(argc, argv, "e:p:j:s:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'e': erase_us = strtoul(optarg, NULL, 0); break;
+		case 'p': page_us = strtoul(optarg, NULL, 0); break;
+		case 'j': jitter_us = strtoul(optarg, NULL, 0); break;
+		case 's': seed = strtoul(optarg, NULL, 0); break;
+		default: usage();
+		}
+	}
+
+	if(optind != argc)
+		usage();
+
+	printf("image %u bytes, %u pages, erase %u us, page write %u us + up to %u us\n\n",
+		   ads_fw_v2_image.len, (ads_fw_v2_image.len + ADS_DFU_PAGE_SIZE - 1) / ADS_DFU_PAGE_SIZE,
+		   erase_us, page_us, jitter_us);
+	printf("%-22s %4s %9s %7s %6s %6s %6s %7s %8s %8s %6s %6s\n", "strategy", "ret", "time ms", "KB/s",
+		   "trans", "nacks", "writes", "polls", "retries", "bus ms", "ack", "erase");
+
+	for(size_t n = 0; n < sizeof(cases) / sizeof(cases[0]); n++)
+	{
+		const bench_case_t * c = &cases[n];
+		ads_dfu_stats_t stats = {0};
+		ads_sim_bus_stats_t bus = {0};
+		uint64_t time_us = 0;
+		int ret_val;
+
+		ads_sim_reset();
+
+		for(uint8_t i = 0; i < BENCH_SENSORS; i++)
+			ads_sim_bus_init(&buses[i], c->bit_rate), buses[i].max_write = c->max_write;
+
+		ads_sim_bus_init(ads_sim_bus_default(), c->bit_rate);
+		ads_sim_bus_default()->max_write = c->max_write;
+
+		bench_lz = c->lz;
+
+		if(c->buses)
+		{
+			ret_val = bench_fleet(c, &time_us);
+
+			// Totals of every sensor and bus, the acknowledgement times of the last
+			for(uint8_t i = 0; i < BENCH_SENSORS; i++)
+			{
+				ads_dfu_stats_t s;
+
+				ads_dfu_get_stats(&devs[i], &s);
+				stats.writes += s.writes;
+				stats.polls += s.polls;
+				stats.retries += s.retries;
+				stats.ack_sum_us += s.ack_sum_us;
+				stats.pages += s.pages;
+				stats.erase_us = s.erase_us;
+				bus.transactions += buses[i].stats.transactions;
+				bus.nacks += buses[i].stats.nacks;
+				bus.busy_us += buses[i].stats.busy_us;
+			}
+
+			if(c->default_bus)
+				bus = ads_sim_bus_default()->stats;
+		}
+		else
+		{
+			ret_val = bench_single(c, &time_us);
+			ads_dfu_get_stats(&devs[0], &stats);
+			bus = buses[0].stats;
+		}
+
+		uint32_t bytes = ads_fw_v2_image.len * (c->buses ? BENCH_SENSORS : 1);
+
+		printf("%-22s %4d %9.1f %7.1f %6u %6u %6u %7u %8u %8.1f %6u %6u\n", c->name, ret_val, time_us / 1000.0,
+			   (ret_val == ADS_OK && time_us) ? bytes * 1000.0 / time_us : 0.0, bus.transactions, bus.nacks, stats.writes, stats.polls,
+			   stats.retries, bus.busy_us / 1000.0, stats.pages ? stats.ack_sum_us / stats.pages : 0, stats.erase_us);
+	}
+
+	printf("\nKB/s: 0 for a failed update, ack: mean page acknowledgement time in us,\n"
+		   "erase: image length to acknowledged in us\n");
+
+	return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * ads_filter_bench.c
+ *
+ * Host benchmark of ads_filter_bank against one ads_filter per channel.
+ * Each row filters the same random signals on every channel with both and
+ * reports the time per sample of all channels and per channel, and the
+ * largest difference between their outputs.
+ *
+ * Build and run from portable/tools, with the target options the bank
+ * kernel is chosen by, e.g. -mavx for AVX:
+ *	cc -O2 -march=native -I.. -o ads_filter_bench ads_filter_bench.c ../ads_filter.c ../ads_filter_bank.c -lm
+ *	./ads_filter_bench [-o order] [-n samples]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ads_filter.h"
+#include "ads_filter_bank.h"
+
+#define BENCH_RATE_HZ		(100.0f)	// Sample rate of the design
+#define BENCH_CUTOFF_HZ		(20.0f)		// Cutoff of the design
+
+static const uint8_t channel_counts[] = { 1, 2, 4, 8, 10, 16, 20, 24, 32, 40 };
+
+static ads_filter_t filters[ADS_FILTER_BANK_MAX_CHANNELS];
+static ads_filter_bank_t bank;
+static float * input;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: ads_filter_bench [-o order] [-n samples]\n");
+	exit(2);
+}
+
+int main(int argc, char ** argv)
+{
+	uint8_t order = 4;
+	uint32_t samples = 200000;
+	uint32_t seed = 1;
+	int opt;
+
+	while((opt = getopt(argc, argv, "o:n:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'o': order = (uint8_t)strtoul(optarg, NULL, 0); break;
+		case 'n': samples = strtoul(optarg, NULL, 0); break;
+		default: usage();
+		}
+	}
+
+	if(optind != argc || order == 0 || order > ADS_FILTER_MAX_ORDER || samples == 0)
+		usage();
+
+	input = malloc((size_t)samples * ADS_FILTER_BANK_MAX_CHANNELS * sizeof(float));
+
+	if(input == NULL)
+		return 1;
+
+	// Random walk on every channel, the same for both
+	for(uint32_t n = 0; n < samples * ADS_FILTER_BANK_MAX_CHANNELS; n++)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		input[n] = (n >= ADS_FILTER_BANK_MAX_CHANNELS ? input[n - ADS_FILTER_BANK_MAX_CHANNELS] : 0) +
+				   (float)(seed & 0xFFFF) / 65536.0f - 0.5f;
+	}
+
+	printf("kernel %s, order %u low pass, %u samples\n\n", ads_filter_bank_kernel(), order, samples);
+	printf("%8s %14s %14s %12s %12s %8s %10s\n", "channels", "filters ns", "bank ns",
+		   "filters ns/ch", "bank ns/ch", "speedup", "max diff");
+
+	for(size_t r = 0; r < sizeof(channel_counts) / sizeof(channel_counts[0]); r++)
+	{
+		uint8_t channels = channel_counts[r];
+		float out[ADS_FILTER_BANK_MAX_CHANNELS];
+		float ref[ADS_FILTER_BANK_MAX_CHANNELS];
+		float max_diff = 0;
+		double start, filters_ns, bank_ns;
+
+		for(uint8_t c = 0; c < channels; c++)
+			ads_filter_init(&filters[c], ADS_FILTER_LOWPASS, order, BENCH_CUTOFF_HZ, BENCH_RATE_HZ);
+
+		ads_filter_bank_init(&bank, channels, &filters[0]);
+
+		// One filter per channel, array of structs
+		start = now_ns();
+
+		for(uint32_t n = 0; n < samples; n++)
+		{
+			const float * x = &input[n * ADS_FILTER_BANK_MAX_CHANNELS];
+
+			for(uint8_t c = 0; c < channels; c++)
+				ref[c] = ads_filter_apply(&filters[c], x[c]);
+		}
+
+		filters_ns = (now_ns() - start) / samples;
+
+		// Bank, structure of arrays
+		start = now_ns();
+
+		for(uint32_t n = 0; n < samples; n++)
+		{
+			const float * x = &input[n * ADS_FILTER_BANK_MAX_CHANNELS];
+
+			for(uint8_t c = 0; c < channels; c++)
+				out[c] = x[c];
+
+			ads_filter_bank_apply(&bank, out);
+		}
+
+		bank_ns = (now_ns() - start) / samples;
+
+		// Outputs of the last sample
+		for(uint8_t c = 0; c < channels; c++)
+			if(fabsf(out[c] - ref[c]) > max_diff)
+				max_diff = fabsf(out[c] - ref[c]);
+
+		printf("%8u %14.1f %14.1f %12.2f %12.2f %7.1fx %10.2e\n", channels, filters_ns, bank_ns,
+			   filters_ns / channels, bank_ns / channels, filters_ns / bank_ns, max_diff);
+	}
+
+	free(input);
+
+	return 0;
+}
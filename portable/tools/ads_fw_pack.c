@@ -0,0 +1,302 @@
+/**
+ * ads_fw_pack.c
+ *
+ * Host tool packaging a vendor firmware image, a raw .bin, as a translation
+ * unit defining the image and its descriptor, see ads_fw.h, with the
+ * revision given and the CRC-32 of the image computed from the .bin. With -z
+ * the image is compressed into the format decoded by ads_dfu_lz.h, then
+ * decompressed again with the driver's decoder and compared to the input
+ * before it is written.
+ *
+ * Build from portable/tools:
+ *	cc -O2 -I.. -o ads_fw_pack ads_fw_pack.c
+ *
+ * The driver's images are generated with, for the library:
+ *	./ads_fw_pack -n ads_fw -r 47 ads_fw.bin ../../library/ads_driver/ads_fw.cpp
+ *	./ads_fw_pack -n ads_fw_v2 -r 47 ads_fw_v2.bin ../../library/ads_driver/ads_fw_v2.cpp
+ *	./ads_fw_pack -z -n ads_fw_lz -r 47 ads_fw.bin ../../library/ads_driver/ads_fw_lz.cpp
+ *	./ads_fw_pack -z -n ads_fw_v2_lz -r 47 ads_fw_v2.bin ../../library/ads_driver/ads_fw_v2_lz.cpp
+ * and the same for portable, to ../ads_fw*.c, with the revision of its images.
+ *
+ * The output defines the ads_fw_image_t <name>_image. The window defaults to
+ * the driver's default of 10 bits, 1 KB of RAM while updating; a larger
+ * window compresses better but the target must be built with at least that
+ * ADS_DFU_LZ_WINDOW_BITS.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Verify with the largest window the format allows */
+#define ADS_DFU_LZ_WINDOW_BITS	(15)
+#include "ads_dfu_lz.h"
+
+#define DEFAULT_WINDOW_BITS	(10)	// Default ADS_DFU_LZ_WINDOW_BITS of the driver
+#define CRC32_POLY		(0xEDB88320)	// CRC-32 of ads_fw_image_t, reflected
+#define HASH_SIZE		(1 << 16)
+#define NIL				(0xFFFFFFFF)
+
+typedef struct {
+	const uint8_t * data;
+	uint32_t len;
+	uint32_t window;
+	uint32_t max_match;
+	uint32_t * head;				// Last position of each hash
+	uint32_t * prev;				// Previous position with the same hash
+} lz_match_t;
+
+static uint32_t lz_hash(const uint8_t * p)
+{
+	return ((uint32_t)p[0] << 8 ^ (uint32_t)p[1] << 4 ^ p[2]) & (HASH_SIZE - 1);
+}
+
+static void lz_insert(lz_match_t * m, uint32_t pos)
+{
+	if(pos + ADS_DFU_LZ_MIN_MATCH > m->len)
+		return;
+
+	uint32_t h = lz_hash(&m->data[pos]);
+	m->prev[pos] = m->head[h];
+	m->head[h] = pos;
+}
+
+/* Longest match for pos within the window, returns its length, 0 if none */
+static uint32_t lz_find(lz_match_t * m, uint32_t pos, uint32_t * dist)
+{
+	uint32_t best = 0;
+
+	if(pos + ADS_DFU_LZ_MIN_MATCH > m->len)
+		return 0;
+
+	uint32_t limit = m->len - pos < m->max_match ? m->len - pos : m->max_match;
+
+	for(uint32_t cand = m->head[lz_hash(&m->data[pos])]; cand != NIL && pos - cand <= m->window; cand = m->prev[cand])
+	{
+		uint32_t n = 0;
+
+		while(n < limit && m->data[cand + n] == m->data[pos + n])
+			n++;
+
+		if(n > best)
+		{
+			best = n;
+			*dist = pos - cand;
+
+			if(best == limit)
+				break;
+		}
+	}
+
+	return best >= ADS_DFU_LZ_MIN_MATCH ? best : 0;
+}
+
+/* Compresses data into out, sized for the worst case, returns the compressed length */
+static uint32_t lz_compress(const uint8_t * data, uint32_t len, uint8_t window_bits, uint8_t * out)
+{
+	uint8_t length_bits = 16 - window_bits;
+	lz_match_t m;
+	uint32_t o = 0, flag_pos = 0, pos = 0;
+	uint8_t items = 8;
+
+	m.data = data;
+	m.len = len;
+	m.window = 1u << window_bits;
+	m.max_match = (1u << length_bits) - 1 + ADS_DFU_LZ_MIN_MATCH;
+	m.head = malloc(HASH_SIZE * sizeof(uint32_t));
+	m.prev = malloc((len + 1) * sizeof(uint32_t));
+	memset(m.head, 0xFF, HASH_SIZE * sizeof(uint32_t));
+
+	out[o++] = 'A';
+	out[o++] = 'D';
+	out[o++] = 'Z';
+	out[o++] = window_bits;
+	out[o++] = (uint8_t)len;
+	out[o++] = (uint8_t)(len >> 8);
+	out[o++] = (uint8_t)(len >> 16);
+	out[o++] = (uint8_t)(len >> 24);
+
+	while(pos < len)
+	{
+		uint32_t dist = 0, next_dist = 0;
+		uint32_t n = lz_find(&m, pos, &dist);
+
+		if(items == 8)
+		{
+			flag_pos = o++;
+			out[flag_pos] = 0;
+			items = 0;
+		}
+
+		// Lazy matching, emit a literal if the next position matches longer
+		if(n)
+		{
+			lz_insert(&m, pos);
+
+			if(lz_find(&m, pos + 1, &next_dist) > n + 1)
+				n = 0;
+		}
+		else
+			lz_insert(&m, pos);
+
+		if(n)
+		{
+			uint16_t token = (uint16_t)(((dist - 1) << length_bits) | (n - ADS_DFU_LZ_MIN_MATCH));
+
+			out[o++] = (uint8_t)token;
+			out[o++] = (uint8_t)(token >> 8);
+
+			for(uint32_t i = 1; i < n; i++)
+				lz_insert(&m, pos + i);
+
+			pos += n;
+		}
+		else
+		{
+			out[flag_pos] |= 1 << items;
+			out[o++] = data[pos++];
+		}
+
+		items++;
+	}
+
+	free(m.head);
+	free(m.prev);
+
+	return o;
+}
+
+static uint32_t crc32(const uint8_t * data, uint32_t len)
+{
+	uint32_t crc = 0xFFFFFFFF;
+
+	for(uint32_t i = 0; i < len; i++)
+	{
+		crc ^= data[i];
+
+		for(int bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (CRC32_POLY & -(crc & 1));
+	}
+
+	return ~crc;
+}
+
+static int lz_verify(const uint8_t * image, uint32_t image_len, const uint8_t * data, uint32_t len)
+{
+	static ads_dfu_lz_t lz;
+	uint8_t page[64];
+
+	if(ads_dfu_lz_init(&lz, image, image_len) != ADS_OK || ads_dfu_lz_length(&lz) != len)
+		return ADS_ERR;
+
+	for(uint32_t offset = 0; offset < len; offset += sizeof(page))
+	{
+		uint8_t n = len - offset < sizeof(page) ? (uint8_t)(len - offset) : sizeof(page);
+
+		if(ads_dfu_lz_reader(&lz, offset, page, n) != ADS_OK || memcmp(page, &data[offset], n) != 0)
+			return ADS_ERR;
+	}
+
+	return ADS_OK;
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: ads_fw_pack [-z] [-w window_bits] -n name -r rev in.bin out.c\n");
+	exit(2);
+}
+
+int main(int argc, char ** argv)
+{
+	const char * name = NULL;
+	long rev = -1;
+	int window_bits = DEFAULT_WINDOW_BITS;
+	int compress = 0;
+	int opt;
+
+	while((opt = getopt(argc, argv, "zw:n:r:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'z': compress = 1; break;
+		case 'w': window_bits = atoi(optarg); break;
+		case 'n': name = optarg; break;
+		case 'r': rev = strtol(optarg, NULL, 0); break;
+		default: usage();
+		}
+	}
+
+	if(name == NULL || rev < 0 || rev > 0xFFFF || window_bits < 8 || window_bits > 15 || argc - optind != 2)
+		usage();
+
+	FILE * in = fopen(argv[optind], "rb");
+	if(in == NULL)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+
+	fseek(in, 0, SEEK_END);
+	long len = ftell(in);
+	fseek(in, 0, SEEK_SET);
+
+	uint8_t * data = malloc(len > 0 ? len : 1);
+	// Worst case is all literals, a flag byte per 8
+	uint8_t * image = malloc(ADS_DFU_LZ_HEADER_SIZE + len + len / 8 + 1);
+
+	if(len <= 0 || fread(data, 1, len, in) != (size_t)len)
+	{
+		fprintf(stderr, "%s: read failed\n", argv[optind]);
+		return 1;
+	}
+	fclose(in);
+
+	uint32_t image_len = (uint32_t)len;
+
+	if(compress)
+	{
+		image_len = lz_compress(data, (uint32_t)len, (uint8_t)window_bits, image);
+
+		if(lz_verify(image, image_len, data, (uint32_t)len) != ADS_OK)
+		{
+			fprintf(stderr, "verify failed\n");
+			return 1;
+		}
+	}
+	else
+		memcpy(image, data, len);
+
+	FILE * out = fopen(argv[optind + 1], "w");
+	if(out == NULL)
+	{
+		perror(argv[optind + 1]);
+		return 1;
+	}
+
+	fprintf(out, "/* Generated by ads_fw_pack from %s, see ads_fw.h */\n", argv[optind]);
+	fprintf(out, "#include \"ads_fw.h\"\n\n");
+	fprintf(out, "static const uint8_t %s_data[] = {\n", name);
+	for(uint32_t n = 0; n < image_len; n++)
+		fprintf(out, "%s0x%02x%s", (n % 16) ? " " : "\t", image[n],
+				(n + 1 == image_len) ? "\n" : ((n % 16 == 15) ? ",\n" : ","));
+	fprintf(out, "};\n\n");
+	fprintf(out, "const ads_fw_image_t %s_image = {\n", name);
+	fprintf(out, "\t%ld,\t\t\t\t\t\t\t\t\t// rev\n", rev);
+	fprintf(out, "\t%ld,\t\t\t\t\t\t\t\t// len\n", len);
+	fprintf(out, "\t0x%08x,\t\t\t\t\t\t\t// crc\n", crc32(data, (uint32_t)len));
+	fprintf(out, "\t%s,\t\t\t\t\t\t\t// format\n", compress ? "ADS_FW_LZ" : "ADS_FW_RAW");
+	fprintf(out, "\t%s_data,\n\tsizeof(%s_data)\n};\n", name, name);
+	fclose(out);
+
+	if(compress)
+		printf("%s: %ld bytes -> %u bytes (%.1f%%), window %d\n", name, len, image_len,
+			   100.0 * image_len / len, 1 << window_bits);
+	else
+		printf("%s: %ld bytes, crc 0x%08x\n", name, len, crc32(data, (uint32_t)len));
+
+	free(data);
+	free(image);
+
+	return 0;
+}
@@ -0,0 +1,210 @@
+/**
+ * ads_linux_fake.c
+ *
+ * Host test of the Linux i2c-dev HAL without an adapter. A user space fake
+ * of one ADS replaces the I2C_RDWR ioctl through ads_linux_bus_t.rdwr, and
+ * records every transfer the HAL issues. Each check drives the driver
+ * through the HAL and looks at both the result and the transfers:
+ *	- ads_init probes the device id and sets the sample rate
+ *	- a command and its reply without delay go out as one combined
+ *	  write and read, one round trip with a repeated start
+ *	- a polled sample read is one round trip of one read message
+ *	- a transfer to an address nobody answers fails with ADS_ERR_IO
+ *
+ * Build and run from portable/tools:
+ *	cc -O2 -I.. -o ads_linux_fake ads_linux_fake.c ../ads.c ../ads_cmd.c ../ads_hal_linux.c
+ *	./ads_linux_fake
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "ads.h"
+#include "ads_hal_linux.h"
+
+#define FAKE_FW_VER			(37)		// Firmware version the fake reports
+#define FAKE_STEP_Q6		(64)		// Bend sample step per polled read, 1 degree
+
+/* Fake ADS, behind the rdwr of one bus */
+typedef struct {
+	uint8_t addr;						// Address it answers at
+	bool polled;						// Polled mode, a new sample per read
+	uint8_t reply[ADS_TRANSFER_SIZE];	// Command reply returned by the next read
+	bool reply_pending;
+	ads_q6_t sample;					// Bend sample of the next read
+
+	/* Transfers seen */
+	uint32_t calls;						// rdwr calls, kernel round trips
+	uint32_t nmsgs;						// Messages of the last call
+	uint16_t flags[2];					// Flags of the first messages of the last call
+} fake_ads_t;
+
+static fake_ads_t fake;
+static ads_linux_bus_t bus;
+static ads_dev_t dev;
+static int failures;
+
+static void fake_write(fake_ads_t * f, const uint8_t * buf, uint16_t len)
+{
+	if(len < 1)
+		return;
+
+	switch(buf[0])
+	{
+	case ADS_GET_DEV_ID:
+		f->reply[0] = ADS_DEV_ID;
+		f->reply[1] = ADS_DEV_ONE_AXIS_V2;
+		f->reply[2] = 0;
+		f->reply_pending = true;
+		break;
+	case ADS_GET_FW_VER:
+		f->reply[0] = ADS_FW_VER;
+		ads_uint16_encode(FAKE_FW_VER, &f->reply[1]);
+		f->reply_pending = true;
+		break;
+	case ADS_POLLED_MODE:
+		f->polled = (len > 1 && buf[1]);
+		break;
+	default:
+		break;
+	}
+}
+
+static void fake_read(fake_ads_t * f, uint8_t * buf, uint16_t len)
+{
+	uint8_t packet[ADS_TRANSFER_SIZE];
+
+	if(f->reply_pending)
+	{
+		memcpy(packet, f->reply, sizeof(packet));
+		f->reply_pending = false;
+	}
+	else
+	{
+		packet[0] = ADS_SAMPLE;
+		ads_uint16_encode((uint16_t)f->sample, &packet[1]);
+
+		if(f->polled)
+			f->sample += FAKE_STEP_Q6;
+	}
+
+	memset(buf, 0xFF, len);
+	memcpy(buf, packet, len < sizeof(packet) ? len : sizeof(packet));
+}
+
+/**
+ * @brief Replacement of the I2C_RDWR ioctl. As the kernel does, fails the
+ *			whole transfer if a message is not acknowledged.
+ */
+static int fake_rdwr(ads_linux_bus_t * b, struct i2c_rdwr_ioctl_data * xfer)
+{
+	fake_ads_t * f = (fake_ads_t *)b->user_data;
+	uint32_t i;
+
+	f->calls++;
+	f->nmsgs = xfer->nmsgs;
+
+	for(i = 0; i < xfer->nmsgs && i < 2; i++)
+		f->flags[i] = xfer->msgs[i].flags;
+
+	for(i = 0; i < xfer->nmsgs; i++)
+	{
+		if(xfer->msgs[i].addr != f->addr)
+			return -ENXIO;
+	}
+
+	for(i = 0; i < xfer->nmsgs; i++)
+	{
+		struct i2c_msg * msg = &xfer->msgs[i];
+
+		if(msg->flags & I2C_M_RD)
+			fake_read(f, msg->buf, msg->len);
+		else
+			fake_write(f, msg->buf, msg->len);
+	}
+
+	return 0;
+}
+
+static void check(const char * name, bool ok)
+{
+	printf("%-44s %s\n", name, ok ? "pass" : "FAIL");
+
+	if(!ok)
+		failures++;
+}
+
+int main(void)
+{
+	ads_init_t init;
+	uint8_t cmd[ADS_TRANSFER_SIZE] = { ADS_GET_FW_VER, 0, 0 };
+	uint8_t reply[ADS_TRANSFER_SIZE];
+	uint32_t calls;
+	int ret_val;
+
+	memset(&fake, 0, sizeof(fake));
+	fake.addr = ADS_DEFAULT_ADDR;
+
+	// A bus with no adapter or GPIO chip open, transfers go to the fake
+	bus.fd = -1;
+	bus.gpio_fd = -1;
+	bus.rdwr = fake_rdwr;
+	bus.user_data = &fake;
+	bus.ioctls = 0;
+
+	memset(&init, 0, sizeof(init));
+	init.sps = ADS_100_HZ;
+	init.reset_pin = ADS_HAL_LINUX_NO_PIN;
+	init.datardy_pin = ADS_HAL_LINUX_NO_PIN;
+	init.bus = &bus;
+
+	ret_val = ads_init(&dev, &init);
+	check("ads_init against the fake", ret_val == ADS_OK);
+	check("every transfer counted as a round trip", bus.ioctls == fake.calls && fake.calls > 0);
+
+	// Combined write and read, no delay between them
+	calls = fake.calls;
+	ret_val = ads_hal_write_read(&dev, cmd, sizeof(cmd), reply, sizeof(reply), 0);
+	check("combined write read succeeds", ret_val == ADS_OK);
+	check("combined write read is one round trip", fake.calls == calls + 1);
+	check("combined write read is write then read",
+		  fake.nmsgs == 2 && !(fake.flags[0] & I2C_M_RD) && (fake.flags[1] & I2C_M_RD));
+	check("combined write read returns the reply",
+		  reply[0] == ADS_FW_VER && ads_uint16_decode(&reply[1]) == FAKE_FW_VER);
+
+	// Delayed reply, one round trip each side of the delay
+	calls = fake.calls;
+	ret_val = ads_hal_write_read(&dev, cmd, sizeof(cmd), reply, sizeof(reply), 1);
+	check("delayed write read is two round trips", ret_val == ADS_OK && fake.calls == calls + 2);
+
+	// Polled samples, one read message per sample
+	ret_val = ads_polled(&dev, true);
+	check("ads_polled", ret_val == ADS_OK && fake.polled);
+
+	for(int i = 0; i < 4; i++)
+	{
+		float sample[2] = { 0, 0 };
+		uint8_t data_type = 0xFF;
+		char name[48];
+
+		calls = fake.calls;
+		ret_val = ads_read_polled(&dev, sample, &data_type);
+
+		snprintf(name, sizeof(name), "polled sample %d in one read round trip", i);
+		check(name, ret_val == ADS_OK && fake.calls == calls + 1 && fake.nmsgs == 1 &&
+			  (fake.flags[0] & I2C_M_RD) && data_type == ADS_SAMPLE && sample[0] == (float)i);
+	}
+
+	// Nobody at the address
+	dev.addr = fake.addr + 1;
+	ret_val = ads_read_polled(&dev, (float[2]){ 0, 0 }, (uint8_t[1]){ 0 });
+	check("unanswered address fails with ADS_ERR_IO", ret_val == ADS_ERR_IO);
+	dev.addr = fake.addr;
+
+	printf("\n%d failed, %u round trips\n", failures, bus.ioctls);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * ads_median_bench.c
+ *
+ * Host benchmark of ads_median against sorting the window for every sample.
+ * Each row takes the same random samples through both for one window size
+ * and reports the time per sample of each, of ads_hampel, and the number of
+ * outputs on which the median and the sort differ, which should be 0.
+ *
+ * Build and run from portable/tools:
+ *	cc -O2 -I.. -o ads_median_bench ads_median_bench.c ../ads_median.c ../ads_pipeline.c ../ads_filter.c ../ads_hal_linux.c -lm
+ *	./ads_median_bench [-n samples]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ads_median.h"
+
+static const uint8_t windows[] = { 3, 5, 7, 9, 15, 21, 31 };
+
+static ads_median_t median;
+static ads_hampel_t hampel;
+static float * input;
+static float * output;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Median of the last window samples by insertion sort of a copy */
+static float sort_median(const float * last, uint8_t window)
+{
+	float sorted[ADS_MEDIAN_MAX_WINDOW];
+	uint8_t i, j;
+
+	for(i = 0; i < window; i++)
+	{
+		float x = last[-(int)i];
+
+		for(j = i; j > 0 && sorted[j - 1] > x; j--)
+			sorted[j] = sorted[j - 1];
+
+		sorted[j] = x;
+	}
+
+	return sorted[window / 2];
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: ads_median_bench [-n samples]\n");
+	exit(2);
+}
+
+int main(int argc, char ** argv)
+{
+	uint32_t samples = 1000000;
+	uint32_t seed = 1;
+	int opt;
+
+	while((opt = getopt(argc, argv, "n:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'n': samples = strtoul(optarg, NULL, 0); break;
+		default: usage();
+		}
+	}
+
+	if(optind != argc || samples < ADS_MEDIAN_MAX_WINDOW)
+		usage();
+
+	input = malloc((size_t)samples * sizeof(float));
+	output = malloc((size_t)samples * sizeof(float));
+
+	if(input == NULL || output == NULL)
+		return 1;
+
+	// Random walk with a spike now and then
+	for(uint32_t n = 0; n < samples; n++)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		input[n] = (n ? input[n - 1] : 0) + (float)(seed & 0xFFFF) / 65536.0f - 0.5f;
+
+		if((seed >> 24) == 0)
+			input[n] += 100.0f;
+	}
+
+	printf("%u samples\n\n", samples);
+	printf("%6s %10s %10s %10s %8s %10s\n", "window", "sort ns", "median ns", "hampel ns", "speedup", "mismatch");
+
+	for(size_t r = 0; r < sizeof(windows) / sizeof(windows[0]); r++)
+	{
+		uint8_t window = windows[r];
+		uint32_t mismatch = 0;
+		double start, sort_ns, median_ns, hampel_ns;
+
+		// Full windows only, the sort has no fill
+		start = now_ns();
+
+		for(uint32_t n = window - 1; n < samples; n++)
+			output[n] = sort_median(&input[n], window);
+
+		sort_ns = (now_ns() - start) / (samples - window + 1);
+
+		ads_median_init(&median, window);
+
+		for(uint32_t n = 0; n < window - 1u; n++)
+			ads_median_apply(&median, input[n]);
+
+		start = now_ns();
+
+		for(uint32_t n = window - 1; n < samples; n++)
+			if(ads_median_apply(&median, input[n]) != output[n])
+				mismatch++;
+
+		median_ns = (now_ns() - start) / (samples - window + 1);
+
+		ads_hampel_init(&hampel, window, 3.0f, 1.0f);
+
+		start = now_ns();
+
+		for(uint32_t n = 0; n < samples; n++)
+			output[n] = ads_hampel_apply(&hampel, input[n]);
+
+		hampel_ns = (now_ns() - start) / samples;
+
+		printf("%6u %10.1f %10.1f %10.1f %7.1fx %10u\n", window, sort_ns, median_ns, hampel_ns,
+			   sort_ns / median_ns, mismatch);
+	}
+
+	free(input);
+	free(output);
+
+	return 0;
+}
@@ -0,0 +1,421 @@
+/**
+ * ads_stream_bench.c
+ *
+ * Streaming benchmark of simulated sensors. N ADS are spread over simulated
+ * buses, a few per bus with their own addresses, and stream for a fixed
+ * virtual time in each mode of the driver:
+ *	- interrupt		data ready interrupts, float samples to a callback
+ *	- queued		data ready interrupts into the queue, drained with
+ *					ads_read_batch every loop period
+ *	- fixed			interrupt mode with raw samples through the Q9.6 low
+ *					pass of the one axis demo, checked against the same
+ *					biquad in float
+ *	- scheduled		polled mode, read by one ads_sched per bus
+ * Samples, drops and latency come from the statistics of the simulated
+ * sensors and buses, from the first sample after ads_run to the end.
+ *
+ * The default rates are 500, 200, 100, 500, 333, 500, 500 and 500 Hz by
+ * address, about 37% of a 400 kHz bus for eight sensors. The time of
+ * ads_init, 100 ms of simulated boot plus the probe, is printed first.
+ *
+ * The virtual clock does not move during a transfer, bus time is counted
+ * aside. Latency is from data ready to the end of the read, scheduled mode
+ * reports how late reads started, not contention between them.
+ *
+ * Build and run from portable/tools:
+ *	cc -O2 -I.. -o ads_stream_bench ads_stream_bench.c ../ads.c ../ads_cmd.c ../ads_sched.c ../ads_filter.c ../ads_hal_sim.c -lm
+ *	./ads_stream_bench -n 4096
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "ads.h"
+#include "ads_fixed.h"
+#include "ads_filter.h"
+#include "ads_sched.h"
+#include "ads_hal_sim.h"
+
+#define BENCH_MAX_SENSORS	ADS_SIM_MAX_SENSORS
+#define BENCH_MAX_BUSES		(BENCH_MAX_SENSORS)
+#define BENCH_ADDR			(0x20)		// Address of the first sensor of a bus
+#define BENCH_DRDY_PIN		(BENCH_MAX_SENSORS)	// Data ready pins follow the reset pins
+
+typedef enum {
+	BENCH_INTERRUPT = 0,
+	BENCH_QUEUED,
+	BENCH_FIXED,
+	BENCH_SCHEDULED
+} BENCH_MODE_T;
+
+static const char * const bench_names[] = { "interrupt", "queued", "fixed", "scheduled" };
+
+/* Rates by address on a bus, the eight sensor mix */
+static const ADS_SPS_T bench_rates[] = {
+	ADS_500_HZ, ADS_200_HZ, ADS_100_HZ, ADS_500_HZ,
+	ADS_333_HZ, ADS_500_HZ, ADS_500_HZ, ADS_500_HZ
+};
+
+/* Low pass of the one axis demo, in Q2.14 and float */
+static const ads_biquad_t bench_lowpass = {
+	0.20657208382614792f, 0.41314416765229584f, 0.20657208382614792f,
+	-0.36952737735124147f, 0.19581571265583314f
+};
+
+static ads_sim_bus_t buses[BENCH_MAX_BUSES];
+static ads_sim_sensor_t sensors[BENCH_MAX_SENSORS];
+static ads_dev_t devs[BENCH_MAX_SENSORS];
+static ads_sched_t scheds[BENCH_MAX_BUSES];
+static uint64_t sched_due_us[BENCH_MAX_BUSES];
+static ads_q6_biquad_t q6_filters[BENCH_MAX_SENSORS];
+static ads_filter_t float_filters[BENCH_MAX_SENSORS];
+static ads_sample_t batch[ADS_QUEUE_LEN];
+
+static uint32_t n_sensors = 64;
+static uint32_t per_bus = 8;
+static uint32_t n_buses;
+static uint32_t bit_rate = 400000;
+static uint32_t rate_hz;				// 0 for the mix
+static uint32_t run_ms = 1000;
+static uint32_t loop_us = 10000;
+
+static uint64_t delivered;
+static float max_err_lsb;
+static float fixed_err_lsb;			// Error of the fixed run, kept for the summary
+
+static ADS_SPS_T bench_rate(uint32_t i)
+{
+	if(rate_hz)
+		return (ADS_SPS_T)(16384 / rate_hz);
+
+	return bench_rates[(i % per_bus) % (sizeof(bench_rates) / sizeof(bench_rates[0]))];
+}
+
+static void bench_callback(ads_dev_t * dev, float * sample, uint8_t sample_type)
+{
+	(void)dev;
+	(void)sample;
+
+	if(sample_type == ADS_SAMPLE)
+		delivered++;
+}
+
+static void bench_raw_callback(ads_dev_t * dev, ads_q6_t * sample, uint8_t sample_type)
+{
+	uint32_t i = (uint32_t)(dev - devs);
+
+	if(sample_type != ADS_SAMPLE)
+		return;
+
+	ads_q6_t fixed = ads_q6_biquad(&q6_filters[i], sample[0]);
+	float ref = ads_filter_apply(&float_filters[i], ads_q6_to_float(sample[0]));
+	float err = fabsf(ref * ADS_Q6_ONE - fixed);
+
+	if(err > max_err_lsb)
+		max_err_lsb = err;
+
+	delivered++;
+}
+
+static void bench_sched_callback(ads_dev_t * dev, ads_sample_t * sample)
+{
+	(void)dev;
+	(void)sample;
+
+	delivered++;
+}
+
+/**
+ * @brief Attaches and initializes every sensor for a mode
+ *
+ * @param mode			Mode of the run
+ * @param init_us[out]	Time ads_init took for the first sensor
+ * @return	ADS_OK if every sensor started
+ */
+static int bench_setup(BENCH_MODE_T mode, uint64_t * init_us)
+{
+	ads_sim_reset();
+
+	for(uint32_t b = 0; b < n_buses; b++)
+	{
+		ads_sim_bus_init(&buses[b], bit_rate);
+
+		if(mode == BENCH_SCHEDULED)
+			ads_sched_init(&scheds[b], bit_rate, bench_sched_callback);
+	}
+
+	for(uint32_t i = 0; i < n_sensors; i++)
+	{
+		ads_sim_bus_t * bus = &buses[i / per_bus];
+		ads_init_t init;
+
+		ads_sim_sensor_init(&sensors[i]);
+		sensors[i].addr = BENCH_ADDR + (i % per_bus);
+
+		if(ads_sim_attach(bus, &sensors[i], i, BENCH_DRDY_PIN + i) != ADS_OK)
+			return ADS_ERR_BAD_PARAM;
+
+		memset(&devs[i], 0, sizeof(devs[i]));
+		memset(&init, 0, sizeof(init));
+		init.sps = bench_rate(i);
+		init.reset_pin = i;
+		init.datardy_pin = BENCH_DRDY_PIN + i;
+		init.bus = bus;
+		init.addr = sensors[i].addr;
+		init.queued = (mode == BENCH_QUEUED);
+
+		if(mode == BENCH_FIXED)
+		{
+			init.ads_raw_sample_callback = bench_raw_callback;
+			ads_q6_biquad_init(&q6_filters[i], ADS_Q14(0.20657208382614792f), ADS_Q14(0.41314416765229584f),
+							   ADS_Q14(0.20657208382614792f), ADS_Q14(-0.36952737735124147f), ADS_Q14(0.19581571265583314f));
+			ads_filter_init_biquads(&float_filters[i], &bench_lowpass, 1);
+			ads_filter_reset(&float_filters[i], 0);
+		}
+		else
+		{
+			init.ads_sample_callback = bench_callback;
+		}
+
+		uint64_t start_us = ads_sim_now_us();
+
+		if(ads_init(&devs[i], &init) != ADS_OK)
+			return ADS_ERR_IO;
+
+		if(i == 0)
+			*init_us = ads_sim_now_us() - start_us;
+
+		if(mode == BENCH_SCHEDULED)
+		{
+			if(ads_sched_add(&scheds[i / per_bus], &devs[i], init.sps) != ADS_OK)
+				return ADS_ERR_BAD_PARAM;
+		}
+	}
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Starts the sensors and clears the statistics
+ */
+static int bench_start(BENCH_MODE_T mode)
+{
+	for(uint32_t i = 0; i < n_sensors; i++)
+	{
+		if(mode != BENCH_SCHEDULED && ads_run(&devs[i], true) != ADS_OK)
+			return ADS_ERR_IO;
+	}
+
+	for(uint32_t b = 0; b < n_buses; b++)
+	{
+		if(mode == BENCH_SCHEDULED)
+		{
+			if(ads_sched_start(&scheds[b]) != ADS_OK)
+				return ADS_ERR_IO;
+
+			sched_due_us[b] = ads_sim_now_us();
+		}
+
+		buses[b].stats = (ads_sim_bus_stats_t){0};
+	}
+
+	for(uint32_t i = 0; i < n_sensors; i++)
+		sensors[i].stats = (ads_sim_sensor_stats_t){0};
+
+	delivered = 0;
+	max_err_lsb = 0;
+
+	return ADS_OK;
+}
+
+/**
+ * @brief Streams for run_ms of virtual time
+ */
+static void bench_stream(BENCH_MODE_T mode)
+{
+	uint64_t end_us = ads_sim_now_us() + (uint64_t)run_ms * 1000;
+
+	if(mode == BENCH_QUEUED)
+	{
+		while(ads_sim_now_us() < end_us)
+		{
+			ads_sim_advance(loop_us);
+
+			for(uint32_t i = 0; i < n_sensors; i++)
+			{
+				uint8_t count;
+
+				do
+				{
+					ads_read_batch(&devs[i], batch, ADS_QUEUE_LEN, &count);
+					delivered += count;
+				} while(count == ADS_QUEUE_LEN);
+			}
+		}
+	}
+	else if(mode == BENCH_SCHEDULED)
+	{
+		for(;;)
+		{
+			uint64_t now_us = ads_sim_now_us();
+			uint64_t next_us = end_us;
+
+			// Run the schedulers that are due, the others are idle until their next read
+			for(uint32_t b = 0; b < n_buses; b++)
+			{
+				if(sched_due_us[b] <= now_us)
+				{
+					ads_sched_run(&scheds[b]);
+					sched_due_us[b] = now_us + ads_sched_idle_us(&scheds[b]);
+				}
+
+				if(sched_due_us[b] < next_us)
+					next_us = sched_due_us[b];
+			}
+
+			if(next_us >= end_us)
+				break;
+
+			if(next_us > now_us)
+				ads_sim_advance(next_us - now_us);
+		}
+
+		if(end_us > ads_sim_now_us())
+			ads_sim_advance(end_us - ads_sim_now_us());
+	}
+	else
+	{
+		ads_sim_advance(end_us - ads_sim_now_us());
+	}
+}
+
+static void bench_report(BENCH_MODE_T mode)
+{
+	uint64_t samples = 0, read = 0, dropped = 0, latency_sum = 0, busy_us = 0;
+	uint32_t latency_max = 0, misses = 0;
+	char mean[16] = "-", max[16] = "-", miss[16] = "-";
+
+	for(uint32_t i = 0; i < n_sensors; i++)
+	{
+		samples += sensors[i].stats.samples;
+		read += sensors[i].stats.samples_read;
+		dropped += sensors[i].stats.samples_dropped + devs[i].queue_overflows;
+		latency_sum += sensors[i].stats.latency_us_sum;
+
+		if(sensors[i].stats.latency_us_max > latency_max)
+			latency_max = sensors[i].stats.latency_us_max;
+	}
+
+	for(uint32_t b = 0; b < n_buses; b++)
+	{
+		busy_us += buses[b].stats.busy_us;
+
+		if(mode != BENCH_SCHEDULED)
+			continue;
+
+		for(uint8_t e = 0; e < scheds[b].count; e++)
+		{
+			misses += scheds[b].entries[e].misses;
+
+			if(scheds[b].entries[e].max_late_us > latency_max)
+				latency_max = scheds[b].entries[e].max_late_us;
+		}
+	}
+
+	if(mode == BENCH_SCHEDULED)
+	{
+		snprintf(max, sizeof(max), "%u", latency_max);
+		snprintf(miss, sizeof(miss), "%u", misses);
+	}
+	else if(read)
+	{
+		snprintf(mean, sizeof(mean), "%.1f", (double)latency_sum / read);
+		snprintf(max, sizeof(max), "%u", latency_max);
+	}
+
+	printf("%-10s %8u %6u %10llu %10llu %10llu %8s %8s %7s %6.1f\n",
+		   bench_names[mode], n_sensors, n_buses, (unsigned long long)samples, (unsigned long long)delivered,
+		   (unsigned long long)dropped, mean, max, miss,
+		   100.0 * busy_us / ((double)run_ms * 1000 * n_buses));
+}
+
+static void usage(const char * name)
+{
+	printf("Usage: %s [-n sensors] [-p sensors per bus] [-b bit rate] [-s Hz, 0 for the mix]\n"
+		   "          [-t ms of virtual time] [-l queued loop us]\n", name);
+}
+
+int main(int argc, char ** argv)
+{
+	uint64_t init_us = 0;
+	uint16_t est_permille = 0;
+	int opt;
+
+	while((opt = getopt(argc, argv, "n:p:b:s:t:l:h")) != -1)
+	{
+		switch(opt)
+		{
+		case 'n': n_sensors = strtoul(optarg, NULL, 0); break;
+		case 'p': per_bus = strtoul(optarg, NULL, 0); break;
+		case 'b': bit_rate = strtoul(optarg, NULL, 0); break;
+		case 's': rate_hz = strtoul(optarg, NULL, 0); break;
+		case 't': run_ms = strtoul(optarg, NULL, 0); break;
+		case 'l': loop_us = strtoul(optarg, NULL, 0); break;
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if(n_sensors < 1 || n_sensors > BENCH_MAX_SENSORS || per_bus < 1 || per_bus > 0x80 - BENCH_ADDR ||
+	   (rate_hz && (rate_hz < 1 || rate_hz > 16384)) || run_ms < 1 || loop_us < 1)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	n_buses = (n_sensors + per_bus - 1) / per_bus;
+
+	printf("%u sensors, %u per bus at %u Hz, %u ms of virtual time\n\n",
+		   n_sensors, per_bus, bit_rate, run_ms);
+	printf("%-10s %8s %6s %10s %10s %10s %8s %8s %7s %6s\n",
+		   "mode", "sensors", "buses", "samples", "delivered", "dropped", "lat us", "max us", "misses", "bus %");
+
+	for(int mode = BENCH_INTERRUPT; mode <= BENCH_SCHEDULED; mode++)
+	{
+		if(mode == BENCH_SCHEDULED && per_bus > ADS_SCHED_MAX_DEVICES)
+		{
+			printf("%-10s more than %d sensors per bus, skipped\n", bench_names[mode], ADS_SCHED_MAX_DEVICES);
+			continue;
+		}
+
+		if(bench_setup((BENCH_MODE_T)mode, &init_us) != ADS_OK || bench_start((BENCH_MODE_T)mode) != ADS_OK)
+		{
+			printf("%-10s failed to start\n", bench_names[mode]);
+			continue;
+		}
+
+		if(mode == BENCH_SCHEDULED)
+			est_permille = ads_sched_utilization(&scheds[0]);
+
+		bench_stream((BENCH_MODE_T)mode);
+		bench_report((BENCH_MODE_T)mode);
+
+		if(mode == BENCH_FIXED)
+			fixed_err_lsb = max_err_lsb;
+	}
+
+	printf("\nads_init %.1f ms, %u ms simulated boot, startup %.1f ms\n",
+		   init_us / 1000.0, sensors[0].boot_ms, devs[0].startup_us / 1000.0);
+	printf("fixed point low pass, largest difference from float %.2f LSB\n", fixed_err_lsb);
+
+	if(est_permille)
+		printf("scheduled estimated load of the first bus %u.%u%%\n", est_permille / 10, est_permille % 10);
+
+	printf("\nlat us: data ready to end of read, scheduled: max us is the latest read start\n");
+
+	return 0;
+}